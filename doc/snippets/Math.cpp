@@ -24,10 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Bvh.h"
+#include "Magnum/Math/ColorBatch.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Bezier.h"
 #include "Magnum/Math/CubicHermite.h"
@@ -841,6 +844,29 @@ if(!(b < a - epsilon || a + epsilon < b)) {
 /* [BitVector-boolean] */
 }
 
+{
+/* [Bvh-usage] */
+Containers::StridedArrayView1D<const Range3D> objectBounds = DOXYGEN_ELLIPSIS({});
+Math::Bvh bvh{objectBounds};
+
+/* Find the object under each picking ray */
+Containers::StridedArrayView1D<const Vector3> origins = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<const Vector3> directions = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<UnsignedInt> ids = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<Float> distances = DOXYGEN_ELLIPSIS({});
+bvh.nearestHitsInto(origins, directions, ids, distances);
+
+/* Or all objects intersected by each ray, sorted front to back */
+Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>>
+    hits = bvh.allHits(origins, directions);
+for(std::size_t i = 0; i != origins.size(); ++i) {
+    for(UnsignedInt id: hits.second().slice(hits.first()[i], hits.first()[i + 1])) {
+        DOXYGEN_ELLIPSIS(static_cast<void>(id);)
+    }
+}
+/* [Bvh-usage] */
+}
+
 {
 /* [Color3] */
 Color3 a{1.0f, 0.2f, 0.4f};
@@ -1316,6 +1342,15 @@ Math::unpackInto(Containers::stridedArrayView(src),
 /* [unpackInto] */
 }
 
+{
+/* [fromSrgbInto] */
+Containers::StridedArrayView1D<const Color4ub> srgba = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<Color4> rgba = DOXYGEN_ELLIPSIS({});
+Math::fromSrgbInto(srgba.slice(&Color4ub::data),
+                   rgba.slice(&Color4::data));
+/* [fromSrgbInto] */
+}
+
 {
 /* [unpackInto-vector-slice] */
 Containers::StridedArrayView1D<const Color3ub> src = DOXYGEN_ELLIPSIS({});
@@ -1065,7 +1065,17 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
             endif()
 
         # No special setup for MaterialTools library
-        # No special setup for MeshTools library
+        # MeshTools library
+        elseif(_component STREQUAL MeshTools)
+            # MeshTools optionally spawns threads, which needs pthread
+            # linked in case of a static build
+            if(MAGNUM_BUILD_STATIC)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
+
         # No special setup for OpenGLTester library
         # No special setup for VulkanTester library
         # No special setup for Primitives library
@@ -0,0 +1,117 @@
+#ifndef Magnum_Math_Algorithms_PolarDecomposition_h
+#define Magnum_Math_Algorithms_PolarDecomposition_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::polarDecomposition()
+ * @m_since_latest
+ */
+
+#include <limits>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Algorithms/SymmetricEigen.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Polar decomposition of a 3x3 matrix
+@param matrix   Matrix to decompose
+@param sweeps   Count of Jacobi sweeps
+@m_since_latest
+
+Decomposes @p matrix into a rotation @f$ \boldsymbol{R} @f$ and a symmetric
+matrix @f$ \boldsymbol{S} @f$ containing the scaling and shear: @f[
+    \boldsymbol{M} = \boldsymbol{R} \boldsymbol{S}
+@f]
+
+Returns the rotation as the first and the symmetric part as the second value.
+The rotation is always a proper rotation, i.e. with a determinant of
+@cpp 1 @ce. If @p matrix contains a reflection, it's kept in
+@f$ \boldsymbol{S} @f$, which then has a negative eigenvalue along the axis of
+the smallest scale. The decomposition works also for singular matrices, in
+which case the rotation is not unique.
+
+Calculated by first diagonalizing @f$ \boldsymbol{M}^T \boldsymbol{M} @f$
+with @ref symmetricEigen(), giving @f$ \boldsymbol{V} @f$ of the singular
+value decomposition @f$ \boldsymbol{M} = \boldsymbol{U} \boldsymbol{\Sigma} \boldsymbol{V}^T @f$,
+and then orthonormalizing the columns of @f$ \boldsymbol{M} \boldsymbol{V} @f$
+to get @f$ \boldsymbol{U} @f$, with the last column calculated as a cross
+product of the first two. The result is then @f[
+    \begin{array}{rcl}
+        \boldsymbol{R} & = & \boldsymbol{U} \boldsymbol{V}^T \\
+        \boldsymbol{S} & = & \boldsymbol{R}^T \boldsymbol{M}
+    \end{array}
+@f]
+
+Compared to extracting the rotation using the generic @ref svd(), there are
+no convergence checks and the count of iterations is fixed, which makes this
+function several times faster. As @f$ \boldsymbol{M}^T \boldsymbol{M} @f$ has
+the condition number of @p matrix squared, the precision is however lower for
+matrices with scaling factors spanning many orders of magnitude.
+@see @ref Matrix4::rotation(), @ref Matrix4::rotationShear(), @ref qr()
+*/
+template<class T> Containers::Pair<Matrix<3, T>, Matrix<3, T>> polarDecomposition(const Matrix<3, T>& matrix, const std::size_t sweeps = 4) {
+    Matrix<3, T> v = symmetricEigen(matrix.transposed()*matrix, sweeps).first();
+
+    /* Make V a proper rotation so R is a proper rotation as well */
+    if(v.determinant() < T(0))
+        v[2] = -v[2];
+
+    /* Columns of M*V are U scaled by the singular values, sorted from the
+       largest. Orthonormalize them, falling back to an arbitrary direction if
+       the matrix is singular. */
+    const Matrix<3, T> b = matrix*v;
+    Vector3<T> u0{b[0]};
+    const T u0LengthSquared = u0.dot();
+    if(u0LengthSquared > std::numeric_limits<T>::min())
+        u0 /= std::sqrt(u0LengthSquared);
+    else
+        u0 = Vector3<T>::xAxis();
+
+    Vector3<T> u1 = Vector3<T>{b[1]} - u0*Math::dot(u0, Vector3<T>{b[1]});
+    const T u1LengthSquared = u1.dot();
+    if(u1LengthSquared > TypeTraits<T>::epsilon()*TypeTraits<T>::epsilon()*u0LengthSquared && u1LengthSquared > std::numeric_limits<T>::min())
+        u1 /= std::sqrt(u1LengthSquared);
+    else {
+        /* Pick the axis that's the least aligned with u0 to get a
+           well-defined perpendicular direction */
+        const Vector3<T> u0Abs = Math::abs(u0);
+        const Vector3<T> axis =
+            u0Abs.x() <= u0Abs.y() && u0Abs.x() <= u0Abs.z() ? Vector3<T>::xAxis() :
+            u0Abs.y() <= u0Abs.z() ? Vector3<T>::yAxis() : Vector3<T>::zAxis();
+        u1 = Math::cross(u0, axis).normalized();
+    }
+
+    const Matrix<3, T> u{u0, u1, Math::cross(u0, u1)};
+    const Matrix<3, T> r = u*v.transposed();
+    return {r, r.transposed()*matrix};
+}
+
+}}}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef Magnum_Math_Algorithms_SymmetricEigen_h
+#define Magnum_Math_Algorithms_SymmetricEigen_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::symmetricEigen()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* Jacobi rotation zeroing out the (p, q) element of a symmetric matrix a, and
+   accumulating the rotation into v. The update formulas follow Numerical
+   Recipes, with only the upper triangle of a being relevant. */
+template<class T> void jacobiRotate(Matrix<3, T>& a, Matrix<3, T>& v, const std::size_t p, const std::size_t q) {
+    const T apq = a[q][p];
+    /* Already diagonal in this element. This is also the only case where the
+       angle calculation below would produce a NaN. */
+    if(apq == T(0)) return;
+
+    /* If theta is so large that its square overflows, t becomes zero and the
+       rotation is an identity, which is fine as the element is negligible
+       compared to the diagonal */
+    const T theta = (a[q][q] - a[p][p])/(T(2)*apq);
+    const T t = (theta < T(0) ? T(-1) : T(1))/(std::abs(theta) + std::sqrt(theta*theta + T(1)));
+    const T c = T(1)/std::sqrt(t*t + T(1));
+    const T s = t*c;
+
+    const std::size_t r = 3 - p - q;
+    const T arp = a[p][r];
+    const T arq = a[q][r];
+    a[p][p] -= t*apq;
+    a[q][q] += t*apq;
+    a[q][p] = a[p][q] = T(0);
+    a[p][r] = a[r][p] = c*arp - s*arq;
+    a[q][r] = a[r][q] = s*arp + c*arq;
+
+    const Vector<3, T> vp = v[p];
+    const Vector<3, T> vq = v[q];
+    v[p] = c*vp - s*vq;
+    v[q] = s*vp + c*vq;
+}
+
+}
+
+/**
+@brief Eigendecomposition of a symmetric 3x3 matrix
+@param matrix   Symmetric matrix
+@param sweeps   Count of Jacobi sweeps
+@m_since_latest
+
+Calculates eigenvalues @f$ \boldsymbol{\lambda} @f$ and an orthonormal basis
+of eigenvectors @f$ \boldsymbol{V} @f$ such that @f[
+    \boldsymbol{M} = \boldsymbol{V} \operatorname{diag}(\boldsymbol{\lambda}) \boldsymbol{V}^T
+@f]
+
+Returns a matrix with the eigenvectors in columns and a vector of
+corresponding eigenvalues, sorted from the largest to the smallest. Only the
+upper triangle of @p matrix is used, the lower triangle is assumed to be equal
+to it.
+
+Implemented using the [cyclic Jacobi eigenvalue algorithm](https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm)
+with a fixed count of @p sweeps, each consisting of three rotations that zero
+out the off-diagonal elements. Unlike the generic @ref svd() there are no
+convergence checks, making it a lot faster and suitable for processing many
+small matrices in a loop. The algorithm converges quadratically, the default
+of four sweeps is enough to reach full precision for both @ref Magnum::Float "Float"
+and @ref Magnum::Double "Double" matrices in general. The result is however
+not guaranteed to be precise for matrices with eigenvalues spanning many
+orders of magnitude.
+@see @ref polarDecomposition()
+*/
+template<class T> Containers::Pair<Matrix<3, T>, Vector<3, T>> symmetricEigen(const Matrix<3, T>& matrix, const std::size_t sweeps = 4) {
+    /* Make the lower triangle equal to the upper */
+    Matrix<3, T> a = matrix;
+    a[0][1] = a[1][0];
+    a[0][2] = a[2][0];
+    a[1][2] = a[2][1];
+
+    Matrix<3, T> v{IdentityInit};
+    for(std::size_t i = 0; i != sweeps; ++i) {
+        Implementation::jacobiRotate(a, v, 0, 1);
+        Implementation::jacobiRotate(a, v, 0, 2);
+        Implementation::jacobiRotate(a, v, 1, 2);
+    }
+
+    /* Sort the eigenvalues and eigenvectors from the largest */
+    Vector<3, T> eigenvalues = a.diagonal();
+    const auto sort = [&](const std::size_t i, const std::size_t j) {
+        if(eigenvalues[i] < eigenvalues[j]) {
+            Utility::swap(eigenvalues[i], eigenvalues[j]);
+            Utility::swap(v[i], v[j]);
+        }
+    };
+    sort(0, 1);
+    sort(0, 2);
+    sort(1, 2);
+
+    return {v, eigenvalues};
+}
+
+}}}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct PolarDecompositionTest: TestSuite::Tester {
+    explicit PolarDecompositionTest();
+
+    template<class T> void rotationScaling();
+    template<class T> void scalingRotation();
+    template<class T> void rotationShear();
+    template<class T> void reflection();
+    template<class T> void singular();
+    template<class T> void zero();
+
+    void compareToSvd();
+};
+
+PolarDecompositionTest::PolarDecompositionTest() {
+    addTests({&PolarDecompositionTest::rotationScaling<Float>,
+              &PolarDecompositionTest::rotationScaling<Double>,
+              &PolarDecompositionTest::scalingRotation<Float>,
+              &PolarDecompositionTest::scalingRotation<Double>,
+              &PolarDecompositionTest::rotationShear<Float>,
+              &PolarDecompositionTest::rotationShear<Double>,
+              &PolarDecompositionTest::reflection<Float>,
+              &PolarDecompositionTest::reflection<Double>,
+              &PolarDecompositionTest::singular<Float>,
+              &PolarDecompositionTest::singular<Double>,
+              &PolarDecompositionTest::zero<Float>,
+              &PolarDecompositionTest::zero<Double>,
+
+              &PolarDecompositionTest::compareToSvd});
+}
+
+using namespace Math::Literals;
+
+template<class T> void PolarDecompositionTest::rotationScaling() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3x3<T> rotation = Matrix4<T>::rotation(Deg<T>(T(35.0)), Vector3<T>{T(1.0), T(0.5), T(-1.0)}.normalized()).rotationScaling();
+    const Matrix3x3<T> a = rotation*Matrix3x3<T>::fromDiagonal({T(1.5), T(2.0), T(0.25)});
+
+    Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> rs = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(rs.first(), rotation);
+    CORRADE_COMPARE(rs.second(), Matrix3x3<T>::fromDiagonal({T(1.5), T(2.0), T(0.25)}));
+    CORRADE_COMPARE(rs.first()*rs.second(), a);
+}
+
+template<class T> void PolarDecompositionTest::scalingRotation() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* With the scaling applied after the rotation, the rotation is still the
+       same, only the symmetric part is rotated */
+    const Matrix3x3<T> rotation = Matrix4<T>::rotationZ(Deg<T>(T(35.0))).rotationScaling();
+    const Matrix3x3<T> a = Matrix3x3<T>::fromDiagonal({T(1.5), T(2.0), T(1.0)})*rotation;
+
+    Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> rs = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(rs.first(), rotation);
+    CORRADE_COMPARE(rs.second(), rotation.transposed()*Matrix3x3<T>::fromDiagonal({T(1.5), T(2.0), T(1.0)})*rotation);
+    CORRADE_COMPARE(rs.first()*rs.second(), a);
+}
+
+template<class T> void PolarDecompositionTest::rotationShear() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3x3<T> a = Matrix4<T>::rotationX(Deg<T>(T(-60.0))).rotationScaling()*Matrix3x3<T>{
+        Vector3<T>{T(1.0), T(0.0), T(0.0)},
+        Vector3<T>{T(0.5), T(1.0), T(0.0)},
+        Vector3<T>{T(0.0), T(0.3), T(2.0)}};
+
+    Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> rs = Algorithms::polarDecomposition(a);
+
+    /* R is a proper rotation, S is symmetric and positive definite */
+    CORRADE_COMPARE(rs.first().transposed()*rs.first(), Matrix3x3<T>{IdentityInit});
+    CORRADE_COMPARE(rs.first().determinant(), T(1.0));
+    CORRADE_COMPARE(rs.second(), rs.second().transposed());
+    CORRADE_COMPARE_AS(rs.second().determinant(), T(0.0),
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(rs.first()*rs.second(), a);
+}
+
+template<class T> void PolarDecompositionTest::reflection() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3x3<T> rotation = Matrix4<T>::rotationY(Deg<T>(T(120.0))).rotationScaling();
+    const Matrix3x3<T> a = rotation*Matrix3x3<T>::fromDiagonal({T(2.0), T(-0.5), T(1.0)});
+
+    Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> rs = Algorithms::polarDecomposition(a);
+
+    /* The rotation is proper, the reflection is kept in the symmetric part */
+    CORRADE_COMPARE(rs.first().transposed()*rs.first(), Matrix3x3<T>{IdentityInit});
+    CORRADE_COMPARE(rs.first().determinant(), T(1.0));
+    CORRADE_COMPARE(rs.second(), rs.second().transposed());
+    CORRADE_COMPARE(rs.second().determinant(), T(-1.0));
+    CORRADE_COMPARE(rs.first()*rs.second(), a);
+}
+
+template<class T> void PolarDecompositionTest::singular() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3x3<T> rotation = Matrix4<T>::rotation(Deg<T>(T(-20.0)), Vector3<T>{T(0.0), T(1.0), T(1.0)}.normalized()).rotationScaling();
+
+    /* Flattened to a plane and to a line. The rotation isn't unique in this
+       case, but it should still be a proper rotation that reconstructs the
+       original matrix. */
+    for(const Vector3<T>& scaling: {Vector3<T>{T(3.0), T(0.0), T(1.5)},
+                                    Vector3<T>{T(0.0), T(0.0), T(2.0)}}) {
+        CORRADE_ITERATION(scaling);
+
+        const Matrix3x3<T> a = rotation*Matrix3x3<T>::fromDiagonal(scaling);
+        Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> rs = Algorithms::polarDecomposition(a);
+        CORRADE_COMPARE(rs.first().transposed()*rs.first(), Matrix3x3<T>{IdentityInit});
+        CORRADE_COMPARE(rs.first().determinant(), T(1.0));
+        CORRADE_COMPARE(rs.second(), rs.second().transposed());
+        CORRADE_COMPARE(rs.first()*rs.second(), a);
+    }
+}
+
+template<class T> void PolarDecompositionTest::zero() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Shouldn't produce NaNs */
+    Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> rs = Algorithms::polarDecomposition(Matrix3x3<T>{ZeroInit});
+    CORRADE_COMPARE(rs.first(), Matrix3x3<T>{IdentityInit});
+    CORRADE_COMPARE(rs.second(), Matrix3x3<T>{ZeroInit});
+}
+
+void PolarDecompositionTest::compareToSvd() {
+    using Magnum::Matrix3x3;
+    using Magnum::Matrix4;
+    using Magnum::Vector3;
+
+    Matrix3x3 a = (Matrix4::rotation(47.0_degf, Vector3{-1.0f, 2.0f, 0.5f}.normalized())*Matrix4::scaling({0.5f, 3.0f, 1.25f})).rotationScaling();
+    a[2][0] += 0.75f;
+
+    /* The rotation extracted via a SVD is the same as from the polar
+       decomposition */
+    Containers::Triple<Matrix3x3, Math::Vector<3, Float>, Matrix3x3> uwv{*Algorithms::svd(a)};
+    CORRADE_COMPARE(Algorithms::polarDecomposition(a).first(), uwv.first()*uwv.third().transposed());
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::PolarDecompositionTest)
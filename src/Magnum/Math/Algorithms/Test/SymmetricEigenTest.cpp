@@ -0,0 +1,135 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/SymmetricEigen.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct SymmetricEigenTest: TestSuite::Tester {
+    explicit SymmetricEigenTest();
+
+    template<class T> void test();
+    template<class T> void repeatedEigenvalues();
+    template<class T> void diagonal();
+    template<class T> void zero();
+    void lowerTriangleIgnored();
+};
+
+SymmetricEigenTest::SymmetricEigenTest() {
+    addTests({&SymmetricEigenTest::test<Float>,
+              &SymmetricEigenTest::test<Double>,
+              &SymmetricEigenTest::repeatedEigenvalues<Float>,
+              &SymmetricEigenTest::repeatedEigenvalues<Double>,
+              &SymmetricEigenTest::diagonal<Float>,
+              &SymmetricEigenTest::diagonal<Double>,
+              &SymmetricEigenTest::zero<Float>,
+              &SymmetricEigenTest::zero<Double>,
+              &SymmetricEigenTest::lowerTriangleIgnored});
+}
+
+using namespace Math::Literals;
+
+template<class T> void SymmetricEigenTest::test() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* A symmetric matrix constructed from known eigenvalues and an arbitrary
+       rotation */
+    const Matrix3x3<T> rotation = Matrix4<T>::rotation(Deg<T>(T(37.0)), Vector3<T>{T(1.0), T(-2.0), T(0.5)}.normalized()).rotationScaling();
+    const Matrix3x3<T> a = rotation*Matrix3x3<T>::fromDiagonal({T(-0.5), T(7.0), T(2.5)})*rotation.transposed();
+
+    Containers::Pair<Matrix3x3<T>, Vector<3, T>> vl = Algorithms::symmetricEigen(a);
+
+    /* Sorted from the largest */
+    CORRADE_COMPARE(vl.second(), (Vector<3, T>{T(7.0), T(2.5), T(-0.5)}));
+
+    /* Test that V is orthonormal */
+    CORRADE_COMPARE(vl.first().transposed()*vl.first(), Matrix3x3<T>{IdentityInit});
+
+    /* Test composition */
+    CORRADE_COMPARE(vl.first()*Matrix3x3<T>::fromDiagonal(vl.second())*vl.first().transposed(), a);
+
+    /* The eigenvectors are the rotation columns, up to a sign */
+    CORRADE_COMPARE(Math::abs(Vector3<T>{vl.first()[0]}), Math::abs(Vector3<T>{rotation[1]}));
+    CORRADE_COMPARE(Math::abs(Vector3<T>{vl.first()[1]}), Math::abs(Vector3<T>{rotation[2]}));
+    CORRADE_COMPARE(Math::abs(Vector3<T>{vl.first()[2]}), Math::abs(Vector3<T>{rotation[0]}));
+}
+
+template<class T> void SymmetricEigenTest::repeatedEigenvalues() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* The eigenvectors aren't unique in this case, but they should still form
+       an orthonormal basis reconstructing the original matrix */
+    const Matrix3x3<T> rotation = Matrix4<T>::rotation(Deg<T>(T(-71.0)), Vector3<T>{T(0.3), T(1.0), T(-0.2)}.normalized()).rotationScaling();
+    const Matrix3x3<T> a = rotation*Matrix3x3<T>::fromDiagonal({T(3.0), T(1.0), T(3.0)})*rotation.transposed();
+
+    Containers::Pair<Matrix3x3<T>, Vector<3, T>> vl = Algorithms::symmetricEigen(a);
+    CORRADE_COMPARE(vl.second(), (Vector<3, T>{T(3.0), T(3.0), T(1.0)}));
+    CORRADE_COMPARE(vl.first().transposed()*vl.first(), Matrix3x3<T>{IdentityInit});
+    CORRADE_COMPARE(vl.first()*Matrix3x3<T>::fromDiagonal(vl.second())*vl.first().transposed(), a);
+}
+
+template<class T> void SymmetricEigenTest::diagonal() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* No rotations should be done, only sorting */
+    Containers::Pair<Matrix3x3<T>, Vector<3, T>> vl = Algorithms::symmetricEigen(Matrix3x3<T>::fromDiagonal({T(1.0), T(-2.0), T(5.0)}));
+    CORRADE_COMPARE(vl.second(), (Vector<3, T>{T(5.0), T(1.0), T(-2.0)}));
+    CORRADE_COMPARE(vl.first(), (Matrix3x3<T>{Vector3<T>::zAxis(),
+                                              Vector3<T>::xAxis(),
+                                              Vector3<T>::yAxis()}));
+}
+
+template<class T> void SymmetricEigenTest::zero() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Shouldn't produce NaNs */
+    Containers::Pair<Matrix3x3<T>, Vector<3, T>> vl = Algorithms::symmetricEigen(Matrix3x3<T>{ZeroInit});
+    CORRADE_COMPARE(vl.second(), (Vector<3, T>{}));
+    CORRADE_COMPARE(vl.first(), Matrix3x3<T>{IdentityInit});
+}
+
+void SymmetricEigenTest::lowerTriangleIgnored() {
+    using Magnum::Matrix3x3;
+    using Magnum::Vector3;
+
+    const Matrix3x3 a{Vector3{2.0f, 0.0f, 0.0f},
+                      Vector3{1.0f, 2.0f, 0.0f},
+                      Vector3{0.0f, 0.0f, 1.0f}};
+    const Matrix3x3 aSymmetric{Vector3{2.0f, 1.0f, 0.0f},
+                               Vector3{1.0f, 2.0f, 0.0f},
+                               Vector3{0.0f, 0.0f, 1.0f}};
+
+    Containers::Pair<Matrix3x3, Math::Vector<3, Float>> vl = Algorithms::symmetricEigen(a);
+    CORRADE_COMPARE(vl.second(), (Math::Vector<3, Float>{3.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(vl.first()*Matrix3x3::fromDiagonal(vl.second())*vl.first().transposed(), aSymmetric);
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SymmetricEigenTest)
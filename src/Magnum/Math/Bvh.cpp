@@ -0,0 +1,345 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Bvh.h"
+
+#include <algorithm> /* std::sort() */
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Math {
+
+/* If count is zero, it's an inner node and offset is index of the first
+   child, with the second child directly after. Otherwise it's a leaf and
+   offset is index of the first item in _itemRanges / _itemIds. */
+struct Bvh::Node {
+    Range3D<Float> bounds;
+    UnsignedInt offset;
+    UnsignedInt count;
+};
+
+namespace {
+
+/* Count of bins the centroid bounds are subdivided into along each axis when
+   evaluating the surface area heuristic */
+enum: UnsignedInt { BinCount = 16 };
+
+/* Half of the surface area, the factor of two doesn't matter for comparing
+   the costs */
+inline Float halfArea(const Range3D<Float>& range) {
+    const Vector3<Float> size = range.size();
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+/* Returns distance at which the ray enters the range, clamped to zero if the
+   origin is inside, or an infinity if it isn't hit or the hit is behind the
+   origin */
+inline Float rayEntry(const Range3D<Float>& range, const Vector3<Float>& origin, const Vector3<Float>& inverseDirection) {
+    const Vector3<Float> t0 = (range.min() - origin)*inverseDirection;
+    const Vector3<Float> t1 = (range.max() - origin)*inverseDirection;
+    const Float entryDistance = Math::max(Math::min(t0, t1).max(), 0.0f);
+    const Float exitDistance = Math::max(t0, t1).min();
+    return entryDistance <= exitDistance ? entryDistance : Constants<Float>::inf();
+}
+
+struct BuildTask {
+    UnsignedInt node;
+    UnsignedInt begin;
+    UnsignedInt end;
+    UnsignedInt depth;
+};
+
+struct Bin {
+    Range3D<Float> bounds;
+    UnsignedInt count;
+};
+
+struct TraversalEntry {
+    UnsignedInt node;
+    Float distance;
+};
+
+}
+
+Bvh::Bvh(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const UnsignedInt maxLeafSize): _depth{} {
+    static_assert(sizeof(Node) == 32, "expected two nodes to fit into a cache line");
+
+    CORRADE_ASSERT(maxLeafSize,
+        "Math::Bvh: max leaf size expected to be non-zero", );
+
+    const std::size_t itemCount = ranges.size();
+    _itemIds = Containers::Array<UnsignedInt>{NoInit, itemCount};
+    if(!itemCount) return;
+
+    /* Centroids are calculated as min + max, i.e. twice the actual center,
+       as only their relative positions matter */
+    Containers::Array<Vector3<Float>> centroids{NoInit, itemCount};
+    for(std::size_t i = 0; i != itemCount; ++i) {
+        _itemIds[i] = UnsignedInt(i);
+        centroids[i] = ranges[i].min() + ranges[i].max();
+    }
+
+    /* Each split produces two non-empty children, so there's at most
+       2n - 1 nodes */
+    Containers::Array<Node> nodes{NoInit, 2*itemCount - 1};
+    std::size_t nodeCount = 1;
+
+    Containers::Array<BuildTask> tasks;
+    arrayAppend(tasks, BuildTask{0, 0, UnsignedInt(itemCount), 1});
+    while(!tasks.isEmpty()) {
+        const BuildTask task = tasks.back();
+        arrayRemoveSuffix(tasks, 1);
+        Node& node = nodes[task.node];
+
+        /* Calculate bounds of the node and of the item centroids in it */
+        Range3D<Float> bounds = ranges[_itemIds[task.begin]];
+        Range3D<Float> centroidBounds{centroids[_itemIds[task.begin]], centroids[_itemIds[task.begin]]};
+        for(UnsignedInt i = task.begin + 1; i != task.end; ++i) {
+            const UnsignedInt id = _itemIds[i];
+            bounds = join(bounds, ranges[id]);
+            centroidBounds.min() = Math::min(centroidBounds.min(), centroids[id]);
+            centroidBounds.max() = Math::max(centroidBounds.max(), centroids[id]);
+        }
+        node.bounds = bounds;
+
+        /* Small enough, make a leaf */
+        const UnsignedInt count = task.end - task.begin;
+        if(count <= maxLeafSize) {
+            node.offset = task.begin;
+            node.count = count;
+            _depth = Math::max(_depth, task.depth);
+            continue;
+        }
+
+        /* Find the cheapest split among bin boundaries on all axes. Only
+           splits that have items on both sides are considered. */
+        const Vector3<Float> centroidExtent = centroidBounds.size();
+        Float bestCost = Constants<Float>::inf();
+        UnsignedInt bestAxis = ~UnsignedInt{};
+        UnsignedInt bestSplit = 0;
+        for(UnsignedInt axis = 0; axis != 3; ++axis) {
+            if(!(centroidExtent[axis] > 0.0f)) continue;
+
+            Bin bins[BinCount]{};
+            const Float scale = BinCount/centroidExtent[axis];
+            for(UnsignedInt i = task.begin; i != task.end; ++i) {
+                const UnsignedInt id = _itemIds[i];
+                Bin& bin = bins[Math::min(UnsignedInt((centroids[id][axis] - centroidBounds.min()[axis])*scale), UnsignedInt(BinCount - 1))];
+                bin.bounds = bin.count ? join(bin.bounds, ranges[id]) : ranges[id];
+                ++bin.count;
+            }
+
+            /* Sweep from the right to calculate the cost of everything
+               right of each split, then from the left to calculate the
+               total */
+            Float rightCost[BinCount];
+            Range3D<Float> rightBounds;
+            UnsignedInt rightCount = 0;
+            for(UnsignedInt split = BinCount - 1; split != 0; --split) {
+                const Bin& bin = bins[split];
+                if(bin.count) {
+                    rightBounds = rightCount ? join(rightBounds, bin.bounds) : bin.bounds;
+                    rightCount += bin.count;
+                }
+                rightCost[split] = rightCount ? rightCount*halfArea(rightBounds) : Constants<Float>::inf();
+            }
+            Range3D<Float> leftBounds;
+            UnsignedInt leftCount = 0;
+            for(UnsignedInt split = 1; split != BinCount; ++split) {
+                const Bin& bin = bins[split - 1];
+                if(bin.count) {
+                    leftBounds = leftCount ? join(leftBounds, bin.bounds) : bin.bounds;
+                    leftCount += bin.count;
+                }
+                if(!leftCount) continue;
+                const Float cost = leftCount*halfArea(leftBounds) + rightCost[split];
+                if(cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = split;
+                }
+            }
+        }
+
+        /* Partition the items in place. If no split was found, which happens
+           if all centroids are the same, split in half. */
+        UnsignedInt middle;
+        if(bestAxis != ~UnsignedInt{}) {
+            const Float scale = BinCount/centroidExtent[bestAxis];
+            middle = task.begin;
+            for(UnsignedInt i = task.begin; i != task.end; ++i) {
+                const UnsignedInt id = _itemIds[i];
+                if(Math::min(UnsignedInt((centroids[id][bestAxis] - centroidBounds.min()[bestAxis])*scale), UnsignedInt(BinCount - 1)) < bestSplit)
+                    Utility::swap(_itemIds[i], _itemIds[middle++]);
+            }
+            CORRADE_INTERNAL_ASSERT(middle != task.begin && middle != task.end);
+        } else middle = task.begin + count/2;
+
+        /* Both children are allocated next to each other, the left one is
+           processed first */
+        node.offset = UnsignedInt(nodeCount);
+        node.count = 0;
+        arrayAppend(tasks, {
+            BuildTask{UnsignedInt(nodeCount + 1), middle, task.end, task.depth + 1},
+            BuildTask{UnsignedInt(nodeCount), task.begin, middle, task.depth + 1}
+        });
+        nodeCount += 2;
+    }
+
+    /* Copy the nodes to an exactly-sized array */
+    _nodes = Containers::Array<Node>{NoInit, nodeCount};
+    Utility::copy(nodes.prefix(nodeCount), _nodes);
+
+    /* Store the item ranges in the order in which they're referenced by the
+       leaves, so leaf traversal accesses contiguous memory */
+    _itemRanges = Containers::Array<Range3D<Float>>{NoInit, itemCount};
+    for(std::size_t i = 0; i != itemCount; ++i)
+        _itemRanges[i] = ranges[_itemIds[i]];
+}
+
+Bvh::Bvh(Bvh&&) noexcept = default;
+
+Bvh::~Bvh() = default;
+
+Bvh& Bvh::operator=(Bvh&&) noexcept = default;
+
+Range3D<Float> Bvh::bounds() const {
+    return _nodes.isEmpty() ? Range3D<Float>{} : _nodes[0].bounds;
+}
+
+void Bvh::nearestHitsInto(const Containers::StridedArrayView1D<const Vector3<Float>>& rayOrigins, const Containers::StridedArrayView1D<const Vector3<Float>>& rayDirections, const Containers::StridedArrayView1D<UnsignedInt>& ids, const Containers::StridedArrayView1D<Float>& distances) const {
+    CORRADE_ASSERT(rayOrigins.size() == rayDirections.size() && rayOrigins.size() == ids.size() && rayOrigins.size() == distances.size(),
+        "Math::Bvh::nearestHitsInto(): expected ray origin, direction, ID and distance views to have the same size, got" << rayOrigins.size() << Debug::nospace << "," << rayDirections.size() << Debug::nospace << "," << ids.size() << "and" << distances.size(), );
+
+    /* Each visited inner node puts at most one child on the stack while the
+       other is visited right away, so the stack can't be deeper than the
+       hierarchy */
+    Containers::Array<TraversalEntry> stack{NoInit, _depth + 1};
+
+    for(std::size_t i = 0; i != rayOrigins.size(); ++i) {
+        const Vector3<Float> origin = rayOrigins[i];
+        const Vector3<Float> inverseDirection = 1.0f/rayDirections[i];
+
+        UnsignedInt nearestId = ~UnsignedInt{};
+        Float nearest = Constants<Float>::inf();
+
+        std::size_t stackSize = 0;
+        if(!_nodes.isEmpty()) {
+            const Float distance = rayEntry(_nodes[0].bounds, origin, inverseDirection);
+            if(distance != Constants<Float>::inf())
+                stack[stackSize++] = {0, distance};
+        }
+
+        while(stackSize) {
+            const TraversalEntry entry = stack[--stackSize];
+            /* A nearer hit was found since this node was put on the stack */
+            if(entry.distance >= nearest) continue;
+
+            const Node& node = _nodes[entry.node];
+
+            /* Leaf, test all items */
+            if(node.count) {
+                for(UnsignedInt j = node.offset, jMax = node.offset + node.count; j != jMax; ++j) {
+                    const Float distance = rayEntry(_itemRanges[j], origin, inverseDirection);
+                    if(distance < nearest) {
+                        nearest = distance;
+                        nearestId = _itemIds[j];
+                    }
+                }
+                continue;
+            }
+
+            /* Inner node, visit the nearer child first */
+            const Float distanceA = rayEntry(_nodes[node.offset].bounds, origin, inverseDirection);
+            const Float distanceB = rayEntry(_nodes[node.offset + 1].bounds, origin, inverseDirection);
+            const TraversalEntry a{node.offset, distanceA};
+            const TraversalEntry b{node.offset + 1, distanceB};
+            const TraversalEntry& nearChild = distanceA <= distanceB ? a : b;
+            const TraversalEntry& farChild = distanceA <= distanceB ? b : a;
+            if(farChild.distance < nearest) stack[stackSize++] = farChild;
+            if(nearChild.distance < nearest) stack[stackSize++] = nearChild;
+        }
+
+        ids[i] = nearestId;
+        distances[i] = nearest;
+    }
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> Bvh::allHits(const Containers::StridedArrayView1D<const Vector3<Float>>& rayOrigins, const Containers::StridedArrayView1D<const Vector3<Float>>& rayDirections) const {
+    CORRADE_ASSERT(rayOrigins.size() == rayDirections.size(),
+        "Math::Bvh::allHits(): expected ray origin and direction views to have the same size, got" << rayOrigins.size() << "and" << rayDirections.size(), {});
+
+    Containers::Array<UnsignedInt> offsets{NoInit, rayOrigins.size() + 1};
+    offsets[0] = 0;
+    Containers::Array<Containers::Pair<Float, UnsignedInt>> hits;
+    Containers::Array<UnsignedInt> stack{NoInit, _depth + 1};
+
+    for(std::size_t i = 0; i != rayOrigins.size(); ++i) {
+        const Vector3<Float> origin = rayOrigins[i];
+        const Vector3<Float> inverseDirection = 1.0f/rayDirections[i];
+        const std::size_t hitsBegin = hits.size();
+
+        std::size_t stackSize = 0;
+        if(!_nodes.isEmpty() && rayEntry(_nodes[0].bounds, origin, inverseDirection) != Constants<Float>::inf())
+            stack[stackSize++] = 0;
+
+        while(stackSize) {
+            const Node& node = _nodes[stack[--stackSize]];
+
+            if(node.count) {
+                for(UnsignedInt j = node.offset, jMax = node.offset + node.count; j != jMax; ++j) {
+                    const Float distance = rayEntry(_itemRanges[j], origin, inverseDirection);
+                    if(distance != Constants<Float>::inf())
+                        arrayAppend(hits, InPlaceInit, distance, _itemIds[j]);
+                }
+                continue;
+            }
+
+            for(UnsignedInt child: {node.offset, node.offset + 1})
+                if(rayEntry(_nodes[child].bounds, origin, inverseDirection) != Constants<Float>::inf())
+                    stack[stackSize++] = child;
+        }
+
+        std::sort(hits.begin() + hitsBegin, hits.end(), [](const Containers::Pair<Float, UnsignedInt>& a, const Containers::Pair<Float, UnsignedInt>& b) {
+            return a.first() < b.first() || (a.first() == b.first() && a.second() < b.second());
+        });
+        offsets[i + 1] = UnsignedInt(hits.size());
+    }
+
+    Containers::Array<UnsignedInt> ids{NoInit, hits.size()};
+    for(std::size_t i = 0; i != hits.size(); ++i)
+        ids[i] = hits[i].second();
+
+    return {Utility::move(offsets), Utility::move(ids)};
+}
+
+}}
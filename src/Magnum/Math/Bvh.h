@@ -0,0 +1,177 @@
+#ifndef Magnum_Math_Bvh_h
+#define Magnum_Math_Bvh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Bvh
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Bounding volume hierarchy
+@m_since_latest
+
+Acceleration structure over a list of @ref Range3D "Range3D<Float>" items,
+allowing to query which items are intersected by a ray without having to test
+all of them.
+
+The hierarchy is built top-down, with each node being split using a surface
+area heuristic evaluated over a fixed count of bins along each axis of the item
+centroid bounds. If no useful split is found, for example because all item
+centroids are the same, the items are split in half. Nodes are split until each
+leaf contains at most the count of items specified in the constructor.
+
+The nodes are stored in a single flat array, with the two children of each node
+being next to each other. Each node is 32 bytes, consisting of its bounds and
+two 32-bit integers, making two sibling nodes fit into a single 64-byte cache
+line.
+
+@section Math-Bvh-usage Usage
+
+@snippet Math.cpp Bvh-usage
+
+The ray queries operate on batches of rays. Ray directions don't need to be
+normalized, hit distances are then in multiples of the direction length.
+Similarly to @ref Intersection::rayRange(), if a ray is parallel to an axis
+and its origin lies exactly on one of the item faces, the result for that item
+is undefined.
+*/
+class MAGNUM_EXPORT Bvh {
+    public:
+        /**
+         * @brief Constructor
+         * @param ranges        Item ranges
+         * @param maxLeafSize   Max count of items in a leaf node
+         *
+         * Expects that @p maxLeafSize is not zero. Items are referenced by
+         * their index in @p ranges in all queries. The ranges are copied, so
+         * the view doesn't need to stay in scope after the construction.
+         */
+        explicit Bvh(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, UnsignedInt maxLeafSize = 4);
+
+        /** @brief Copying is not allowed */
+        Bvh(const Bvh&) = delete;
+
+        /** @brief Move constructor */
+        Bvh(Bvh&&) noexcept;
+
+        ~Bvh();
+
+        /** @brief Copying is not allowed */
+        Bvh& operator=(const Bvh&) = delete;
+
+        /** @brief Move assignment */
+        Bvh& operator=(Bvh&&) noexcept;
+
+        /** @brief Count of items */
+        std::size_t size() const { return _itemIds.size(); }
+
+        /**
+         * @brief Count of nodes
+         *
+         * If there are no items, the count is @cpp 0 @ce, otherwise it's
+         * always odd.
+         */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /**
+         * @brief Depth of the hierarchy
+         *
+         * Count of nodes on the longest path from the root to a leaf,
+         * including both. If there are no items, the depth is @cpp 0 @ce.
+         */
+        UnsignedInt depth() const { return _depth; }
+
+        /**
+         * @brief Bounds of all items
+         *
+         * If there are no items, returns a default-constructed range.
+         */
+        Range3D<Float> bounds() const;
+
+        /**
+         * @brief Find the nearest hit for each ray
+         * @param[in]  rayOrigins       Ray origins
+         * @param[in]  rayDirections    Ray directions
+         * @param[out] ids              Where to put IDs of the nearest hit
+         *      items
+         * @param[out] distances        Where to put distances of the nearest
+         *      hits
+         *
+         * For each ray finds the item whose range is entered first, with the
+         * distance being the ray parameter at which it's entered, or
+         * @cpp 0.0f @ce if the ray origin is inside the range. Items behind
+         * the ray origin are not considered. If a ray doesn't hit anything,
+         * the ID is set to @cpp 0xffffffffu @ce and the distance to
+         * @ref Constants::inf(). If two items are entered at the same
+         * distance, the one that's found first is picked.
+         *
+         * Expects that all views have the same size. The children of each
+         * node are visited in the order in which the ray enters them and
+         * subtrees that are farther than the nearest hit found so far are
+         * skipped.
+         */
+        void nearestHitsInto(const Containers::StridedArrayView1D<const Vector3<Float>>& rayOrigins, const Containers::StridedArrayView1D<const Vector3<Float>>& rayDirections, const Containers::StridedArrayView1D<UnsignedInt>& ids, const Containers::StridedArrayView1D<Float>& distances) const;
+
+        /**
+         * @brief Find all hits for each ray
+         * @param rayOrigins        Ray origins
+         * @param rayDirections     Ray directions
+         * @return Offsets into the hit array for each ray and the hit array
+         *
+         * For each ray finds all items whose range it intersects, in the same
+         * way as @ref nearestHitsInto(). The first returned array has one
+         * more item than the count of rays, with hits of ray @cpp i @ce being
+         * IDs between offsets @cpp i @ce and @cpp i + 1 @ce in the second
+         * array. The hits of each ray are sorted by distance and then by item
+         * ID. Expects that @p rayOrigins and @p rayDirections have the same
+         * size.
+         */
+        Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> allHits(const Containers::StridedArrayView1D<const Vector3<Float>>& rayOrigins, const Containers::StridedArrayView1D<const Vector3<Float>>& rayDirections) const;
+
+    private:
+        struct Node;
+
+        Containers::Array<Node> _nodes;
+        /* Item ranges in the order in which they're referenced by leaf
+           nodes, and their original IDs */
+        Containers::Array<Range3D<Float>> _itemRanges;
+        Containers::Array<UnsignedInt> _itemIds;
+        UnsignedInt _depth;
+};
+
+}}
+
+#endif
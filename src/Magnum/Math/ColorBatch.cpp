@@ -27,9 +27,13 @@
 #include "ColorBatch.h"
 
 #include <cstring>
+#include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/PackingBatch.h"
 
 namespace Magnum { namespace Math {
 
@@ -142,16 +146,442 @@ inline void yFlipBc5BlockInPlace(char* const data) {
     yFlipBc4BlockInPlace(data + 8);
 }
 
-template<std::size_t blockSize, void(*flipBlock)(char*)> void yFlipBlocksInPlace(const Containers::StridedArrayView4D<char>& blocks
+/* BC7 blocks are 128-bit little-endian values, with fields crossing the
+   64-bit boundary */
+inline UnsignedInt bc7Bits(const UnsignedLong(&block)[2], const UnsignedInt offset, const UnsignedInt count) {
+    UnsignedLong value = block[offset/64] >> (offset % 64);
+    if(offset % 64 + count > 64)
+        value |= block[offset/64 + 1] << (64 - offset % 64);
+    return UnsignedInt(value & ((1ull << count) - 1));
+}
+
+inline void bc7SetBits(UnsignedLong(&block)[2], const UnsignedInt offset, const UnsignedInt count, const UnsignedInt value) {
+    const UnsignedLong mask = (1ull << count) - 1;
+    block[offset/64] = (block[offset/64] & ~(mask << (offset % 64)))|UnsignedLong(value) << (offset % 64);
+    if(offset % 64 + count > 64) {
+        const UnsignedInt shift = 64 - offset % 64;
+        block[offset/64 + 1] = (block[offset/64 + 1] & ~(mask >> shift))|UnsignedLong(value) >> shift;
+    }
+}
+
+/* Swaps pairs of endpoint fields of given size, each channel having the two
+   endpoints next to each other */
+inline void bc7SwapEndpoints(UnsignedLong(&block)[2], const UnsignedInt offset, const UnsignedInt bits, const UnsignedInt channels) {
+    for(UnsignedInt i = 0; i != channels; ++i) {
+        const UnsignedInt offset0 = offset + 2*i*bits;
+        const UnsignedInt offset1 = offset0 + bits;
+        const UnsignedInt endpoint0 = bc7Bits(block, offset0, bits);
+        bc7SetBits(block, offset0, bits, bc7Bits(block, offset1, bits));
+        bc7SetBits(block, offset1, bits, endpoint0);
+    }
+}
+
+/* Flips 4x4 indices of given size starting at given offset. The indices are
+   in a row-major order, with the first one being the anchor that has the
+   most significant bit implicitly zero. If the index that becomes the new
+   anchor has the most significant bit set, all indices get inverted and the
+   function returns true to signal that the corresponding endpoints need to be
+   swapped. As the interpolation weights are symmetric, that results in the
+   exact same pixel values. */
+bool yFlipBc7Indices(UnsignedLong(&block)[2], const UnsignedInt offset, const UnsignedInt bits) {
+    UnsignedInt indices[16];
+    for(UnsignedInt i = 0, bitOffset = offset; i != 16; ++i) {
+        const UnsignedInt size = i ? bits : bits - 1;
+        indices[i] = bc7Bits(block, bitOffset, size);
+        bitOffset += size;
+    }
+
+    const UnsignedInt mask = (1 << bits) - 1;
+    const bool invert = indices[12] >> (bits - 1);
+    for(UnsignedInt y = 0, bitOffset = offset; y != 4; ++y) {
+        for(UnsignedInt x = 0; x != 4; ++x) {
+            const UnsignedInt size = x || y ? bits : bits - 1;
+            bc7SetBits(block, bitOffset, size, (invert ? indices[(3 - y)*4 + x] ^ mask : indices[(3 - y)*4 + x]));
+            bitOffset += size;
+        }
+    }
+
+    return invert;
+}
+
+bool yFlipBc7BlockInPlace(char* const data) {
+    /* The 128-bit little-endian block starts with a mode, which is a number
+       of zero bits followed by a one bit. Only modes 4, 5 and 6 have a
+       single subset, the rest uses one of 64 fixed partitions of the pixels
+       into two or three subsets, the vertically mirrored variant of which
+       isn't generally among them. Such blocks are left untouched and reported
+       as not flipped exactly. If the first byte is zero, the mode is
+       reserved and the block decodes to zeros regardless of its contents,
+       so such block doesn't need any change. See the official specification
+       for details:
+       https://learn.microsoft.com/en-us/windows/win32/direct3d11/bc7-format-mode-reference */
+    UnsignedLong block[2]{};
+    for(std::size_t i = 0; i != 16; ++i)
+        block[i/8] |= UnsignedLong(UnsignedByte(data[i])) << (i % 8)*8;
+
+    const UnsignedInt modeBits = UnsignedInt(block[0] & 0xff);
+    if(!modeBits)
+        return true;
+
+    /* Mode 4 has 5-bit RGB and 6-bit alpha endpoints with one set of 2-bit
+       and one set of 3-bit indices, with the index mode bit deciding which
+       one is used for RGB and which for alpha */
+    if(modeBits & 0x10 && !(modeBits & 0x0f)) {
+        const bool indexMode = block[0] & 0x80;
+        if(yFlipBc7Indices(block, 50, 2)) {
+            if(indexMode) bc7SwapEndpoints(block, 38, 6, 1);
+            else bc7SwapEndpoints(block, 8, 5, 3);
+        }
+        if(yFlipBc7Indices(block, 81, 3)) {
+            if(indexMode) bc7SwapEndpoints(block, 8, 5, 3);
+            else bc7SwapEndpoints(block, 38, 6, 1);
+        }
+
+    /* Mode 5 has 7-bit RGB and 8-bit alpha endpoints, each with its own set
+       of 2-bit indices */
+    } else if(modeBits & 0x20 && !(modeBits & 0x1f)) {
+        if(yFlipBc7Indices(block, 66, 2))
+            bc7SwapEndpoints(block, 8, 7, 3);
+        if(yFlipBc7Indices(block, 97, 2))
+            bc7SwapEndpoints(block, 50, 8, 1);
+
+    /* Mode 6 has 7-bit RGBA endpoints with a per-endpoint P-bit and a single
+       set of 4-bit indices */
+    } else if(modeBits & 0x40 && !(modeBits & 0x3f)) {
+        if(yFlipBc7Indices(block, 65, 4)) {
+            bc7SwapEndpoints(block, 7, 7, 4);
+            bc7SwapEndpoints(block, 63, 1, 1);
+        }
+
+    /* Modes 0 to 3 and 7 */
+    } else return false;
+
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = char(block[i/8] >> (i % 8)*8);
+    return true;
+}
+
+bool yFlipBc6hBlockInPlace(char* const data) {
+    /* The 128-bit little-endian block starts with a mode, which is either two
+       or five bits. Mode 0x03 (mode 11 in the official specification) is the
+       only one with a single region and both endpoints stored directly. The
+       two-region modes have the same partition problem as in BC7, and the
+       remaining single-region modes store the second endpoint as a
+       difference from the first, where the difference after swapping the
+       endpoints isn't always representable. All those are left untouched and
+       reported as not flipped exactly. The reserved modes decode to zeros so
+       the block doesn't need any change. The same layout is used for both
+       the unsigned and signed variant. See the official specification for
+       details:
+       https://learn.microsoft.com/en-us/windows/win32/direct3d11/bc6h-format */
+    UnsignedLong block[2]{};
+    for(std::size_t i = 0; i != 16; ++i)
+        block[i/8] |= UnsignedLong(UnsignedByte(data[i])) << (i % 8)*8;
+
+    const UnsignedInt mode = UnsignedInt(block[0] & (block[0] & 0x02 ? 0x1f : 0x03));
+    if(mode == 0x13 || mode == 0x17 || mode == 0x1b || mode == 0x1f)
+        return true;
+    if(mode != 0x03)
+        return false;
+
+    /* Mode 0x03 has first all three 10-bit channels of the first endpoint,
+       then the second endpoint, and a single set of 4-bit indices */
+    if(yFlipBc7Indices(block, 65, 4)) {
+        for(UnsignedInt i = 0; i != 3; ++i) {
+            const UnsignedInt endpoint0 = bc7Bits(block, 5 + i*10, 10);
+            bc7SetBits(block, 5 + i*10, 10, bc7Bits(block, 35 + i*10, 10));
+            bc7SetBits(block, 35 + i*10, 10, endpoint0);
+        }
+    }
+
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = char(block[i/8] >> (i % 8)*8);
+    return true;
+}
+
+/* Unlike BC, the ETC2 and EAC blocks are stored as big-endian 64-bit
+   values */
+inline UnsignedLong loadEtcBlock(const char* const data) {
+    UnsignedLong block = 0;
+    for(std::size_t i = 0; i != 8; ++i)
+        block = (block << 8)|UnsignedLong(UnsignedByte(data[i]));
+    return block;
+}
+
+inline void storeEtcBlock(char* const data, const UnsignedLong block) {
+    for(std::size_t i = 0; i != 8; ++i)
+        data[i] = char(block >> (56 - i*8));
+}
+
+inline void yFlipEacBlockInPlace(char* const data) {
+    /* The 64-bit big-endian block is laid out as follows:
+
+       - 8 bits for base codeword
+       - 4 bits for multiplier
+       - 4 bits for modifier table index
+       - 48 bits for 4x4 3-bit indices, the first pixel in the most
+         significant bits, in this order:
+
+            a e i m
+            b f j n
+            c g k o
+            d h l p
+
+       Which means each 12 bits are one column, and the Y-flip reduces down to
+       reversing the order of 3-bit groups in each. See the Khronos Data
+       Format Specification for details:
+       https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#ETC2 */
+    const UnsignedLong block = loadEtcBlock(data);
+    storeEtcBlock(data,
+        (block & 0xffff000000000000ull) |
+        (block & 0x0000e00e00e00e00ull) >> 9 |
+        (block & 0x00001c01c01c01c0ull) >> 3 |
+        (block & 0x0000038038038038ull) << 3 |
+        (block & 0x0000007007007007ull) << 9);
+}
+
+inline void yFlipEacRG11BlockInPlace(char* const data) {
+    yFlipEacBlockInPlace(data);
+    yFlipEacBlockInPlace(data + 8);
+}
+
+/* ETC2 has the 4x4 2-bit indices in the lower 32 bits, split into 16 bits
+   of most significant bits and 16 bits of least significant bits, each half
+   in the same column-major order as EAC, but starting from the least
+   significant bit. The Y-flip is thus reversing bit order in each nibble. */
+inline UnsignedLong yFlipEtc2Indices(const UnsignedLong block) {
+    return
+        (block & 0xffffffff00000000ull) |
+        (block & 0x0000000011111111ull) << 3 |
+        (block & 0x0000000022222222ull) << 1 |
+        (block & 0x0000000044444444ull) >> 1 |
+        (block & 0x0000000088888888ull) >> 3;
+}
+
+inline Int signExtend3(const UnsignedLong value) {
+    return Int((value & 0x7) ^ 0x4) - 4;
+}
+
+inline Int etc2PlanarExpand(const Int value, const UnsignedInt bits) {
+    return value << (8 - bits)|value >> (2*bits - 8);
+}
+
+inline Int etc2PlanarValue(const Int o, const Int h, const Int v, const Int x, const Int y) {
+    return Math::clamp((x*(h - o) + y*(v - o) + 4*o + 2) >> 2, 0, 255);
+}
+
+/* Returns a value that expands closest to given 8-bit value */
+inline Int etc2PlanarQuantize(const Int value, const UnsignedInt bits) {
+    const Int max = (1 << bits) - 1;
+    return Math::clamp((Math::clamp(value, 0, 255)*max + 127)/255, 0, max);
+}
+
+UnsignedLong yFlipEtc2PlanarBlock(const UnsignedLong block, bool& exact) {
+    /* Unpack the 6-7-6 bit origin, horizontal and vertical colors */
+    const UnsignedInt bits[]{6, 7, 6};
+    const Int o[]{
+        Int(block >> 57 & 0x3f),
+        Int((block >> 56 & 0x1) << 6|(block >> 49 & 0x3f)),
+        Int((block >> 48 & 0x1) << 5|(block >> 43 & 0x3) << 3|(block >> 39 & 0x7))
+    };
+    const Int h[]{
+        Int((block >> 34 & 0x1f) << 1|(block >> 32 & 0x1)),
+        Int(block >> 25 & 0x7f),
+        Int(block >> 19 & 0x3f)
+    };
+    const Int v[]{
+        Int(block >> 13 & 0x3f),
+        Int(block >> 6 & 0x7f),
+        Int(block & 0x3f)
+    };
+
+    /* The flipped plane has the origin at O + 3(V - O)/4, the same horizontal
+       and the opposite vertical gradient. That's in general not representable
+       with the available precision and the values may get out of range, so
+       the quantized estimate and its neighbors are searched for the smallest
+       error against the flipped original pixels. */
+    Int oFlipped[3], hFlipped[3], vFlipped[3];
+    exact = true;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Int max = (1 << bits[i]) - 1;
+        const Int oExpanded = etc2PlanarExpand(o[i], bits[i]);
+        const Int hExpanded = etc2PlanarExpand(h[i], bits[i]);
+        const Int vExpanded = etc2PlanarExpand(v[i], bits[i]);
+
+        Int expected[4][4];
+        for(Int x = 0; x != 4; ++x)
+            for(Int y = 0; y != 4; ++y)
+                expected[x][y] = etc2PlanarValue(oExpanded, hExpanded, vExpanded, x, 3 - y);
+
+        const Int oEstimate = oExpanded + (3*(vExpanded - oExpanded))/4;
+        const Int oQuantized = etc2PlanarQuantize(oEstimate, bits[i]);
+        const Int hQuantized = etc2PlanarQuantize(hExpanded + oEstimate - oExpanded, bits[i]);
+        const Int vQuantized = etc2PlanarQuantize(oEstimate + oExpanded - vExpanded, bits[i]);
+        Int minError = 0x7fffffff;
+        for(Int oi = Math::max(oQuantized - 1, 0), oiMax = Math::min(oQuantized + 1, max); oi <= oiMax; ++oi)
+        for(Int hi = Math::max(hQuantized - 1, 0), hiMax = Math::min(hQuantized + 1, max); hi <= hiMax; ++hi)
+        for(Int vi = Math::max(vQuantized - 1, 0), viMax = Math::min(vQuantized + 1, max); vi <= viMax; ++vi) {
+            const Int oiExpanded = etc2PlanarExpand(oi, bits[i]);
+            const Int hiExpanded = etc2PlanarExpand(hi, bits[i]);
+            const Int viExpanded = etc2PlanarExpand(vi, bits[i]);
+            Int error = 0;
+            for(Int x = 0; x != 4; ++x)
+                for(Int y = 0; y != 4; ++y)
+                    error += Math::abs(etc2PlanarValue(oiExpanded, hiExpanded, viExpanded, x, y) - expected[x][y]);
+            if(error < minError) {
+                minError = error;
+                oFlipped[i] = oi;
+                hFlipped[i] = hi;
+                vFlipped[i] = vi;
+            }
+        }
+
+        if(minError) exact = false;
+    }
+
+    /* Pack the colors back, preserving the differential / opaque bit */
+    UnsignedLong out = (block & (1ull << 33)) |
+        UnsignedLong(oFlipped[0]) << 57 |
+        UnsignedLong(oFlipped[1] >> 6) << 56 |
+        UnsignedLong(oFlipped[1] & 0x3f) << 49 |
+        UnsignedLong(oFlipped[2] >> 5) << 48 |
+        UnsignedLong(oFlipped[2] >> 3 & 0x3) << 43 |
+        UnsignedLong(oFlipped[2] & 0x7) << 39 |
+        UnsignedLong(hFlipped[0] >> 1) << 34 |
+        UnsignedLong(hFlipped[0] & 0x1) << 32 |
+        UnsignedLong(hFlipped[1]) << 25 |
+        UnsignedLong(hFlipped[2]) << 19 |
+        UnsignedLong(vFlipped[0]) << 13 |
+        UnsignedLong(vFlipped[1]) << 6 |
+        UnsignedLong(vFlipped[2]);
+
+    /* The planar mode is signalled by the red and green channels of the
+       differential mode not overflowing and the blue overflowing. Set the
+       unused bits to ensure that. */
+    if(Int(out >> 59 & 0xf) + signExtend3(out >> 56) < 0)
+        out |= 1ull << 63;
+    if(Int(out >> 51 & 0xf) + signExtend3(out >> 48) < 0)
+        out |= 1ull << 55;
+    if((out >> 43 & 0x3) + (out >> 40 & 0x3) >= 4)
+        out |= 0x7ull << 45;
+    else
+        out |= 1ull << 42;
+    return out;
+}
+
+template<bool punchthrough> bool yFlipEtc2BlockInPlace(char* const data) {
+    /* The 64-bit big-endian block has the upper 32 bits specifying base
+       colors and the lower 32 bits per-pixel indices. The block can be in
+       one of five modes:
+
+       - individual, which has two 4x2 or 2x4 subblocks with 4-bit colors,
+         depending on the flip bit
+       - differential, which has the same subblocks but with a 5-bit color
+         for the first and a 3-bit difference for the second
+       - T and H, which are signalled by an overflow in the red or green
+         channel of the differential mode, and where the colors don't depend
+         on the pixel position
+       - planar, signalled by an overflow in the blue channel, with three
+         colors defining a gradient and no indices
+
+       The punchthrough alpha variant has no individual mode, the bit
+       otherwise signalling the differential mode is used for opacity. See
+       the Khronos Data Format Specification for details:
+       https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#ETC2 */
+    UnsignedLong block = loadEtcBlock(data);
+
+    /* Individual mode */
+    if(!punchthrough && !(block & (1ull << 33))) {
+        /* If the subblocks are top and bottom, swap their colors and
+           modifier table codewords */
+        if(block & (1ull << 32)) block =
+            (block & 0x00000003ffffffffull) |
+            (block & 0xf0f0f00000000000ull) >> 4 |
+            (block & 0x0f0f0f0000000000ull) << 4 |
+            (block & 0x000000e000000000ull) >> 3 |
+            (block & 0x0000001c00000000ull) << 3;
+        storeEtcBlock(data, yFlipEtc2Indices(block));
+        return true;
+    }
+
+    const Int color1[]{
+        Int(block >> 59 & 0x1f),
+        Int(block >> 51 & 0x1f),
+        Int(block >> 43 & 0x1f)
+    };
+    const Int delta[]{
+        signExtend3(block >> 56),
+        signExtend3(block >> 48),
+        signExtend3(block >> 40)
+    };
+    const Int color2[]{
+        color1[0] + delta[0],
+        color1[1] + delta[1],
+        color1[2] + delta[2]
+    };
+
+    /* T and H mode, only the indices need to be flipped */
+    if(color2[0] < 0 || color2[0] > 31 || color2[1] < 0 || color2[1] > 31) {
+        storeEtcBlock(data, yFlipEtc2Indices(block));
+        return true;
+    }
+
+    /* Planar mode, the gradient needs to be recalculated */
+    if(color2[2] < 0 || color2[2] > 31) {
+        bool exact;
+        storeEtcBlock(data, yFlipEtc2PlanarBlock(block, exact));
+        return exact;
+    }
+
+    /* Differential mode. If the subblocks are top and bottom, the second
+       color becomes the base and the difference gets negated. A difference
+       of -4 can't be negated, it's approximated with 3 instead and the block
+       is reported as not flipped exactly. */
+    bool exact = true;
+    if(block & (1ull << 32)) {
+        UnsignedLong out =
+            (block & 0x00000003ffffffffull) |
+            (block & 0x000000e000000000ull) >> 3 |
+            (block & 0x0000001c00000000ull) << 3;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt shift = UnsignedInt(56 - i*8);
+            if(delta[i] == -4) exact = false;
+            out |= UnsignedLong(color2[i]) << (shift + 3)|
+                   UnsignedLong((delta[i] == -4 ? 3 : -delta[i]) & 0x7) << shift;
+        }
+        block = out;
+    }
+
+    storeEtcBlock(data, yFlipEtc2Indices(block));
+    return exact;
+}
+
+inline bool yFlipEtc2RGBA8BlockInPlace(char* const data) {
+    /* The 128-bit block is an EAC block for alpha followed by an ETC2 block
+       for RGB */
+    yFlipEacBlockInPlace(data);
+    return yFlipEtc2BlockInPlace<false>(data + 8);
+}
+
+/* Adapts block flip functions that are always exact to what
+   yFlipBlocksInPlace() expects */
+template<void(*flipBlock)(char*)> bool yFlipBlockExactInPlace(char* const data) {
+    flipBlock(data);
+    return true;
+}
+
+template<std::size_t blockSize, bool(*flipBlock)(char*)> std::size_t yFlipBlocksInPlace(const Containers::StridedArrayView4D<char>& blocks, const Containers::MutableBitArrayView* const inexact
     #ifndef CORRADE_NO_ASSERT
     , const char* messagePrefix
     #endif
 ) {
     const std::size_t* const size = blocks.size().begin();
     CORRADE_ASSERT(size[3] == blockSize,
-        messagePrefix << "expected last dimension to be" << blockSize << "bytes but got" << size[3], );
+        messagePrefix << "expected last dimension to be" << blockSize << "bytes but got" << size[3], {});
     CORRADE_ASSERT(blocks.isContiguous<3>(),
-        messagePrefix << "last dimension is not contiguous", );
+        messagePrefix << "last dimension is not contiguous", {});
+    CORRADE_ASSERT(!inexact || inexact->size() == size[0]*size[1]*size[2],
+        messagePrefix << "expected inexact block mask to have" << size[0]*size[1]*size[2] << "bits but got" << inexact->size(), {});
 
     /* The high-level logic is mostly a copy of Utility::flipInPlace() without
        the "leftovers" part. It's however not calling that function directly
@@ -160,6 +590,13 @@ template<std::size_t blockSize, void(*flipBlock)(char*)> void yFlipBlocksInPlace
 
     CORRADE_INTERNAL_ASSERT(blocks.template isContiguous<3>());
 
+    /* Marks the block at given output position as not flipped exactly */
+    std::size_t inexactCount = 0;
+    const auto report = [&](const bool exact, const std::size_t z, const std::size_t y, const std::size_t x) {
+        if(!exact) ++inexactCount;
+        if(inexact) inexact->set((z*size[1] + y)*size[2] + x, !exact);
+    };
+
     char* const ptr = static_cast<char*>(blocks.data());
     const std::ptrdiff_t* const stride = blocks.stride().begin();
     for(std::size_t z = 0; z != size[0]; ++z) {
@@ -176,8 +613,8 @@ template<std::size_t blockSize, void(*flipBlock)(char*)> void yFlipBlocksInPlace
             for(std::size_t x = 0; x != size[2]; ++x) {
                 char* const ptrXTop = ptrYTop + x*stride[2];
                 char* const ptrXBottom = ptrYBottom + x*stride[2];
-                flipBlock(ptrXTop);
-                flipBlock(ptrXBottom);
+                report(flipBlock(ptrXTop), z, size[1] - y - 1, x);
+                report(flipBlock(ptrXBottom), z, y, x);
                 std::memcpy(tmp, ptrXTop, blockSize);
                 std::memcpy(ptrXTop, ptrXBottom, blockSize);
                 std::memcpy(ptrXBottom, tmp, blockSize);
@@ -189,15 +626,17 @@ template<std::size_t blockSize, void(*flipBlock)(char*)> void yFlipBlocksInPlace
         if(size[1] % 2) {
             char* const ptrYMid = ptrZ + (size[1]/2)*stride[1];
             for(std::size_t x = 0; x != size[2]; ++x)
-                flipBlock(ptrYMid + x*stride[2]);
+                report(flipBlock(ptrYMid + x*stride[2]), z, size[1]/2, x);
         }
     }
+
+    return inexactCount;
 }
 
 }
 
 void yFlipBc1InPlace(const Containers::StridedArrayView4D<char>& blocks) {
-    yFlipBlocksInPlace<8, yFlipBc1BlockInPlace>(blocks
+    yFlipBlocksInPlace<8, yFlipBlockExactInPlace<yFlipBc1BlockInPlace>>(blocks, nullptr
         #ifndef CORRADE_NO_ASSERT
         , "Math::yFlipBc1InPlace():"
         #endif
@@ -205,7 +644,7 @@ void yFlipBc1InPlace(const Containers::StridedArrayView4D<char>& blocks) {
 }
 
 void yFlipBc2InPlace(const Containers::StridedArrayView4D<char>& blocks) {
-    yFlipBlocksInPlace<16, yFlipBc2BlockInPlace>(blocks
+    yFlipBlocksInPlace<16, yFlipBlockExactInPlace<yFlipBc2BlockInPlace>>(blocks, nullptr
         #ifndef CORRADE_NO_ASSERT
         , "Math::yFlipBc2InPlace():"
         #endif
@@ -213,7 +652,7 @@ void yFlipBc2InPlace(const Containers::StridedArrayView4D<char>& blocks) {
 }
 
 void yFlipBc3InPlace(const Containers::StridedArrayView4D<char>& blocks) {
-    yFlipBlocksInPlace<16, yFlipBc3BlockInPlace>(blocks
+    yFlipBlocksInPlace<16, yFlipBlockExactInPlace<yFlipBc3BlockInPlace>>(blocks, nullptr
         #ifndef CORRADE_NO_ASSERT
         , "Math::yFlipBc3InPlace():"
         #endif
@@ -221,7 +660,7 @@ void yFlipBc3InPlace(const Containers::StridedArrayView4D<char>& blocks) {
 }
 
 void yFlipBc4InPlace(const Containers::StridedArrayView4D<char>& blocks) {
-    yFlipBlocksInPlace<8, yFlipBc4BlockInPlace>(blocks
+    yFlipBlocksInPlace<8, yFlipBlockExactInPlace<yFlipBc4BlockInPlace>>(blocks, nullptr
         #ifndef CORRADE_NO_ASSERT
         , "Math::yFlipBc4InPlace():"
         #endif
@@ -229,11 +668,284 @@ void yFlipBc4InPlace(const Containers::StridedArrayView4D<char>& blocks) {
 }
 
 void yFlipBc5InPlace(const Containers::StridedArrayView4D<char>& blocks) {
-    yFlipBlocksInPlace<16, yFlipBc5BlockInPlace>(blocks
+    yFlipBlocksInPlace<16, yFlipBlockExactInPlace<yFlipBc5BlockInPlace>>(blocks, nullptr
         #ifndef CORRADE_NO_ASSERT
         , "Math::yFlipBc5InPlace():"
         #endif
     );
 }
 
+std::size_t yFlipBc6hInPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact) {
+    return yFlipBlocksInPlace<16, yFlipBc6hBlockInPlace>(blocks, &inexact
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipBc6hInPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipBc6hInPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    return yFlipBlocksInPlace<16, yFlipBc6hBlockInPlace>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipBc6hInPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipBc7InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact) {
+    return yFlipBlocksInPlace<16, yFlipBc7BlockInPlace>(blocks, &inexact
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipBc7InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipBc7InPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    return yFlipBlocksInPlace<16, yFlipBc7BlockInPlace>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipBc7InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipEtc2RGB8InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact) {
+    return yFlipBlocksInPlace<8, yFlipEtc2BlockInPlace<false>>(blocks, &inexact
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEtc2RGB8InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipEtc2RGB8InPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    return yFlipBlocksInPlace<8, yFlipEtc2BlockInPlace<false>>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEtc2RGB8InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipEtc2RGB8A1InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact) {
+    return yFlipBlocksInPlace<8, yFlipEtc2BlockInPlace<true>>(blocks, &inexact
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEtc2RGB8A1InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipEtc2RGB8A1InPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    return yFlipBlocksInPlace<8, yFlipEtc2BlockInPlace<true>>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEtc2RGB8A1InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipEtc2RGBA8InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact) {
+    return yFlipBlocksInPlace<16, yFlipEtc2RGBA8BlockInPlace>(blocks, &inexact
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEtc2RGBA8InPlace():"
+        #endif
+    );
+}
+
+std::size_t yFlipEtc2RGBA8InPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    return yFlipBlocksInPlace<16, yFlipEtc2RGBA8BlockInPlace>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEtc2RGBA8InPlace():"
+        #endif
+    );
+}
+
+void yFlipEacR11InPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    yFlipBlocksInPlace<8, yFlipBlockExactInPlace<yFlipEacBlockInPlace>>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEacR11InPlace():"
+        #endif
+    );
+}
+
+void yFlipEacRG11InPlace(const Containers::StridedArrayView4D<char>& blocks) {
+    yFlipBlocksInPlace<16, yFlipBlockExactInPlace<yFlipEacRG11BlockInPlace>>(blocks, nullptr
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::yFlipEacRG11InPlace():"
+        #endif
+    );
+}
+
+namespace {
+
+/* Values of each channel are gathered into a contiguous block of this size,
+   converted in a tight loop that the compiler can vectorize and then
+   scattered back to the destination */
+constexpr std::size_t SrgbBlockSize = 256;
+
+/* Approximation of log2() for positive normal values and infinity. The value
+   is split into an exponent and a mantissa in the [sqrt(0.5), sqrt(2)) range,
+   for which log2() is calculated with the first five terms of the
+   2/ln(2)*atanh((m - 1)/(m + 1)) series. The maximum absolute error is around
+   1.0e-7. */
+inline Float log2Approx(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    Int exponent = Int(bits >> 23) - 127;
+    bits = (bits & 0x007fffffu)|0x3f800000u;
+    Float mantissa;
+    std::memcpy(&mantissa, &bits, 4);
+
+    const bool above = mantissa > 1.41421356f;
+    mantissa = above ? mantissa*0.5f : mantissa;
+    exponent += Int(above);
+
+    const Float t = (mantissa - 1.0f)/(mantissa + 1.0f);
+    const Float t2 = t*t;
+    return Float(exponent) + t*(2.88539008f + t2*(0.961796694f + t2*(0.577078016f + t2*(0.412198583f + t2*0.320598898f))));
+}
+
+/* Approximation of exp2(). The value is split into an integer part that goes
+   directly into the exponent and a fractional part in the [-0.5, 0.5] range,
+   for which exp2() is calculated with a degree 7 Taylor polynomial. Values
+   above 128 produce an infinity, values below -126 are clamped to the
+   smallest normal value. */
+inline Float exp2Approx(Float value) {
+    value = value < -126.0f ? -126.0f : value > 128.0f ? 128.0f : value;
+    /* The addition makes the value positive, so the truncation is a floor */
+    const Int integer = Int(value + 128.5f) - 128;
+    const Float f = value - Float(integer);
+    const Float fraction = 1.0f + f*(0.693147181f + f*(0.240226507f + f*(0.0555041087f + f*(0.00961812911f + f*(0.00133335581f + f*(0.000154035304f + f*0.0000152527338f))))));
+    const UnsignedInt bits = UnsignedInt(integer + 127) << 23;
+    Float scale;
+    std::memcpy(&scale, &bits, 4);
+    return fraction*scale;
+}
+
+/* Both branches are calculated and then one is selected in order to keep the
+   loop free of control flow. The input to the pow() approximation is replaced
+   with 1.0f if not used, which makes it well-defined for negative values,
+   zeros, denormals and NaNs. NaNs fail the comparison and thus take the
+   linear branch, propagating to the output. */
+inline Float fromSrgbApprox(const Float srgb) {
+    const bool curve = srgb > 0.04045f;
+    const Float x = curve ? (srgb + 0.055f)*(1.0f/1.055f) : 1.0f;
+    const Float curved = exp2Approx(log2Approx(x)*2.4f);
+    return curve ? curved : srgb*(1.0f/12.92f);
+}
+
+inline Float toSrgbApprox(const Float linear) {
+    const bool curve = linear > 0.0031308f;
+    const Float x = curve ? linear : 1.0f;
+    const Float curved = 1.055f*exp2Approx(log2Approx(x)*(1.0f/2.4f)) - 0.055f;
+    return curve ? curved : linear*12.92f;
+}
+
+/* The lookup table is calculated using the scalar code to be bit-identical
+   to it */
+const Float* fromSrgbLookupTable() {
+    static const struct Table {
+        Table() {
+            for(UnsignedInt i = 0; i != 256; ++i)
+                data[i] = Color3<Float>::fromSrgb(Vector3<UnsignedByte>{UnsignedByte(i)}).r();
+        }
+
+        Float data[256];
+    } table;
+    return table.data;
+}
+
+template<class T, class U, class Convert, class ConvertAlpha> void srgbInto(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst, Convert convert, ConvertAlpha convertAlpha
+    #ifndef CORRADE_NO_ASSERT
+    , const char* messagePrefix
+    #endif
+) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        messagePrefix << "wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.size()[1] <= 4,
+        messagePrefix << "expected at most four channels but got" << src.size()[1], );
+
+    const Containers::StridedArrayView2D<const T> srcChannels = src.template transposed<0, 1>();
+    const Containers::StridedArrayView2D<U> dstChannels = dst.template transposed<0, 1>();
+    for(std::size_t i = 0, iMax = Math::min(src.size()[1], std::size_t{3}); i != iMax; ++i)
+        convert(srcChannels[i], dstChannels[i]);
+    if(src.size()[1] == 4)
+        convertAlpha(srcChannels[3], dstChannels[3]);
+}
+
+/* Calls the converter on contiguous blocks gathered from the source, then
+   passes the result to the output function */
+template<Float(*convert)(Float), class Output> void convertBlocks(const Containers::StridedArrayView1D<const Float>& src, Output output) {
+    Float block[SrgbBlockSize];
+    for(std::size_t offset = 0; offset < src.size(); offset += SrgbBlockSize) {
+        const Containers::StridedArrayView1D<const Float> srcBlock = src.slice(offset, Math::min(offset + SrgbBlockSize, src.size()));
+        const std::size_t size = srcBlock.size();
+        for(std::size_t i = 0; i != size; ++i)
+            block[i] = srcBlock[i];
+        for(std::size_t i = 0; i != size; ++i)
+            block[i] = convert(block[i]);
+        output(offset, Containers::arrayView(block).prefix(size));
+    }
+}
+
+template<Float(*convert)(Float)> void convertFloatInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    convertBlocks<convert>(src, [&](std::size_t offset, Containers::ArrayView<const Float> block) {
+        const Containers::StridedArrayView1D<Float> dstBlock = dst.slice(offset, offset + block.size());
+        for(std::size_t i = 0; i != block.size(); ++i)
+            dstBlock[i] = block[i];
+    });
+}
+
+void copyAlphaInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    Utility::copy(src, dst);
+}
+
+}
+
+void fromSrgbInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    srgbInto(src, dst,
+        [](const Containers::StridedArrayView1D<const UnsignedByte>& srcChannel, const Containers::StridedArrayView1D<Float>& dstChannel) {
+            const Float* const table = fromSrgbLookupTable();
+            for(std::size_t i = 0; i != srcChannel.size(); ++i)
+                dstChannel[i] = table[srcChannel[i]];
+        },
+        [](const Containers::StridedArrayView1D<const UnsignedByte>& srcChannel, const Containers::StridedArrayView1D<Float>& dstChannel) {
+            /* The channel views aren't contiguous, so they have to be turned
+               into {N, 1} views instead of relying on the implicit conversion
+               to a {1, N} view that unpackInto() would reject */
+            unpackInto(Containers::arrayCast<2, const UnsignedByte>(srcChannel), Containers::arrayCast<2, Float>(dstChannel));
+        }
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::fromSrgbInto():"
+        #endif
+    );
+}
+
+void fromSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    srgbInto(src, dst, convertFloatInto<fromSrgbApprox>, copyAlphaInto
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::fromSrgbInto():"
+        #endif
+    );
+}
+
+void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    srgbInto(src, dst,
+        [](const Containers::StridedArrayView1D<const Float>& srcChannel, const Containers::StridedArrayView1D<UnsignedByte>& dstChannel) {
+            convertBlocks<toSrgbApprox>(srcChannel, [&](std::size_t offset, Containers::ArrayView<const Float> block) {
+                packInto(Containers::arrayCast<2, const Float>(Containers::stridedArrayView(block)), Containers::arrayCast<2, UnsignedByte>(dstChannel.slice(offset, offset + block.size())));
+            });
+        },
+        [](const Containers::StridedArrayView1D<const Float>& srcChannel, const Containers::StridedArrayView1D<UnsignedByte>& dstChannel) {
+            packInto(Containers::arrayCast<2, const Float>(srcChannel), Containers::arrayCast<2, UnsignedByte>(dstChannel));
+        }
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::toSrgbInto():"
+        #endif
+    );
+}
+
+void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    srgbInto(src, dst, convertFloatInto<toSrgbApprox>, copyAlphaInto
+        #ifndef CORRADE_NO_ASSERT
+        , "Math::toSrgbInto():"
+        #endif
+    );
+}
+
 }}
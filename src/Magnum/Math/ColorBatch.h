@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Math::yFlipBc1InPlace(), @ref Magnum::Math::yFlipBc3InPlace(), @ref Magnum::Math::yFlipBc4InPlace(), @ref Magnum::Math::yFlipBc5InPlace()
+ * @brief Function @ref Magnum::Math::yFlipBc1InPlace(), @ref Magnum::Math::yFlipBc3InPlace(), @ref Magnum::Math::yFlipBc4InPlace(), @ref Magnum::Math::yFlipBc5InPlace(), @ref Magnum::Math::yFlipBc6hInPlace(), @ref Magnum::Math::yFlipBc7InPlace(), @ref Magnum::Math::yFlipEtc2RGB8InPlace(), @ref Magnum::Math::yFlipEtc2RGB8A1InPlace(), @ref Magnum::Math::yFlipEtc2RGBA8InPlace(), @ref Magnum::Math::yFlipEacR11InPlace(), @ref Magnum::Math::yFlipEacRG11InPlace(), @ref Magnum::Math::fromSrgbInto(), @ref Magnum::Math::toSrgbInto()
  * @m_since_latest
  */
 
@@ -140,6 +140,348 @@ halves of each block.
 */
 MAGNUM_EXPORT void yFlipBc5InPlace(const Containers::StridedArrayView4D<char>& blocks);
 
+/**
+@brief Y-flip BC6H texture blocks in-place
+@param[in,out] blocks   Blocks to flip
+@param[out] inexact     Blocks that weren't flipped exactly
+@return Count of blocks that weren't flipped exactly
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed. Blocks in mode 11
+(mode bits @cpp 0x03 @ce), which is the only single-region mode with
+unencoded endpoints, are flipped losslessly the same way as the single-subset
+modes in @ref yFlipBc7InPlace(). Blocks with one of the reserved modes decode
+to zeros and are thus kept as-is.
+
+Blocks in modes 1 to 10 (mode bits @cpp 0x00 @ce, @cpp 0x01 @ce, @cpp 0x02 @ce,
+@cpp 0x06 @ce, @cpp 0x0a @ce, @cpp 0x0e @ce, @cpp 0x12 @ce, @cpp 0x16 @ce,
+@cpp 0x1a @ce and @cpp 0x1e @ce) have two regions, with the same partition
+problem as in @ref yFlipBc7InPlace(). Blocks in modes 12, 13 and 14 (mode bits
+@cpp 0x07 @ce, @cpp 0x0b @ce and @cpp 0x0f @ce) have a single region, but
+store the second endpoint as a difference from the first, and swapping the
+endpoints would need a difference that isn't always representable. Such blocks
+are moved to their flipped position but their contents are left untouched,
+i.e. they're upside down, and they're reported in @p inexact and in the
+returned count the same way as in @ref yFlipBc7InPlace().
+
+Also note that this operation flips full blocks --- if size of the actual image
+isn't whole blocks, the flipped image will be shifted compared to the
+original, possibly with garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 128-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 16. The function works for both the
+unsigned and the signed variant.
+@see @ref CompressedPixelFormat::Bc6hRGBUfloat,
+    @ref CompressedPixelFormat::Bc6hRGBSfloat
+*/
+MAGNUM_EXPORT std::size_t yFlipBc6hInPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact);
+
+/**
+@overload
+@m_since_latest
+
+Doesn't report which blocks weren't flipped exactly, only their count.
+*/
+MAGNUM_EXPORT std::size_t yFlipBc6hInPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Y-flip BC7 texture blocks in-place
+@param[in,out] blocks   Blocks to flip
+@param[out] inexact     Blocks that weren't flipped exactly
+@return Count of blocks that weren't flipped exactly
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed. Blocks in modes 4, 5
+and 6, which have a single subset, are flipped losslessly by reordering the
+pixel indices and, if the index that becomes the implicit anchor has its most
+significant bit set, inverting the indices and swapping the corresponding
+endpoints. Blocks with the reserved mode decode to zeros and are thus kept
+as-is.
+
+Blocks in modes 0, 1, 2, 3 and 7 partition the pixels into two or three
+subsets using a fixed table, which in general doesn't contain the vertically
+mirrored partition. Such blocks are moved to their flipped position but their
+contents are left untouched, i.e. they're upside down. Bits corresponding to
+them in @p inexact are set, bits for all other blocks are reset, and the
+function returns their count. The application can then for example decode and
+re-encode just those. The @p inexact view is expected to have a bit for each
+block, indexed in the order of the first three dimensions of @p blocks after
+the flip.
+
+Also note that this operation flips full blocks --- if size of the actual image
+isn't whole blocks, the flipped image will be shifted compared to the
+original, possibly with garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 128-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 16.
+
+@see @ref yFlipBc6hInPlace(), @ref CompressedPixelFormat::Bc7RGBAUnorm,
+    @ref CompressedPixelFormat::Bc7RGBASrgb
+*/
+MAGNUM_EXPORT std::size_t yFlipBc7InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact);
+
+/**
+@overload
+@m_since_latest
+
+Doesn't report which blocks weren't flipped exactly, only their count.
+*/
+MAGNUM_EXPORT std::size_t yFlipBc7InPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Y-flip ETC2 RGB texture blocks in-place
+@param[in,out] blocks   Blocks to flip
+@param[out] inexact     Blocks that weren't flipped exactly
+@return Count of blocks that weren't flipped exactly
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed. Blocks in the
+individual, T and H modes and blocks in the differential mode with subblocks
+side by side are flipped losslessly. There are however two cases where the
+exact information cannot be represented after the flip:
+
+-   In the differential mode with subblocks on top of each other the
+    subblocks get swapped, which means the color difference gets negated. A
+    difference of @cpp -4 @ce can't be negated and is approximated with
+    @cpp 3 @ce, causing a single quantization step difference in given
+    channel of one subblock.
+-   In the planar mode the gradient origin gets moved to the opposite side of
+    the block, which in general isn't representable with the available
+    precision. The gradient is approximated with the closest representable
+    one, with the error being larger if the gradient saturates inside the
+    block. If the flipped gradient is representable exactly, such as when
+    there's no vertical gradient, the block is flipped losslessly.
+
+Bits in @p inexact corresponding to blocks that weren't flipped exactly are
+set, bits for all other blocks are reset, and the function returns their
+count. The @p inexact view is expected to have a bit for each block, indexed in
+the order of the first three dimensions of @p blocks after the flip.
+
+Also note that this operation flips full blocks --- if size of the actual
+image isn't whole blocks, the flipped image will be shifted compared to the
+original, possibly with garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 64-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 8.
+@see @ref CompressedPixelFormat::Etc2RGB8Unorm,
+    @ref CompressedPixelFormat::Etc2RGB8Srgb
+*/
+MAGNUM_EXPORT std::size_t yFlipEtc2RGB8InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact);
+
+/**
+@overload
+@m_since_latest
+
+Doesn't report which blocks weren't flipped exactly, only their count.
+*/
+MAGNUM_EXPORT std::size_t yFlipEtc2RGB8InPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Y-flip ETC2 RGB texture blocks with punchthrough alpha in-place
+@param[in,out] blocks   Blocks to flip
+@param[out] inexact     Blocks that weren't flipped exactly
+@return Count of blocks that weren't flipped exactly
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed. Compared to
+@ref yFlipEtc2RGB8InPlace() the format doesn't have the individual mode, the
+same cases where the exact information cannot be represented after the flip
+apply here as well, and are reported the same way.
+
+Also note that this operation flips full blocks --- if size of the actual image
+isn't whole blocks, the flipped image will be shifted compared to the
+original, possibly with garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 64-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 8.
+@see @ref CompressedPixelFormat::Etc2RGB8A1Unorm,
+    @ref CompressedPixelFormat::Etc2RGB8A1Srgb
+*/
+MAGNUM_EXPORT std::size_t yFlipEtc2RGB8A1InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact);
+
+/**
+@overload
+@m_since_latest
+
+Doesn't report which blocks weren't flipped exactly, only their count.
+*/
+MAGNUM_EXPORT std::size_t yFlipEtc2RGB8A1InPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Y-flip ETC2 RGBA texture blocks in-place
+@param[in,out] blocks   Blocks to flip
+@param[out] inexact     Blocks that weren't flipped exactly
+@return Count of blocks that weren't flipped exactly
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed. Also note that this
+operation flips full blocks --- if size of the actual image isn't whole blocks,
+the flipped image will be shifted compared to the original, possibly with
+garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 128-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 16. As ETC2 RGBA is internally a 64-bit
+EAC block for alpha followed by a 64-bit ETC2 RGB block, the operation is the
+same as performing @ref yFlipEacR11InPlace() on the first half and
+@ref yFlipEtc2RGB8InPlace() on second half of each block, including the cases
+where the exact information cannot be represented after the flip and how
+they're reported.
+@see @ref CompressedPixelFormat::Etc2RGBA8Unorm,
+    @ref CompressedPixelFormat::Etc2RGBA8Srgb
+*/
+MAGNUM_EXPORT std::size_t yFlipEtc2RGBA8InPlace(const Containers::StridedArrayView4D<char>& blocks, Containers::MutableBitArrayView inexact);
+
+/**
+@overload
+@m_since_latest
+
+Doesn't report which blocks weren't flipped exactly, only their count.
+*/
+MAGNUM_EXPORT std::size_t yFlipEtc2RGBA8InPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Y-flip EAC R11 texture blocks in-place
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed, thus the operation
+is lossless. However note that this operation flips full blocks --- if size of
+the actual image isn't whole blocks, the flipped image will be shifted compared
+to the original, possibly with garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 64-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 8.
+@see @ref CompressedPixelFormat::EacR11Unorm,
+    @ref CompressedPixelFormat::EacR11Snorm
+*/
+MAGNUM_EXPORT void yFlipEacR11InPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Y-flip EAC RG11 texture blocks in-place
+@m_since_latest
+
+Performs a Y flip of given 3D image by flipping block order and modifying
+internal block representation to encode the same information, just upside down.
+No decoding or re-encoding of the block data is performed, thus the operation
+is lossless. However note that this operation flips full blocks --- if size of
+the actual image isn't whole blocks, the flipped image will be shifted compared
+to the original, possibly with garbage data appearing in the first few rows.
+
+First dimension is expected to be image slices, second block rows, third
+2D blocks, fourth the 128-bit 4x4 block data, i.e. the last dimension is
+expected to be contiguous with size of 16. As EAC RG11 is internally two 64-bit
+EAC R11 blocks, the operation is the same as performing
+@ref yFlipEacR11InPlace() on both halves of each block.
+@see @ref CompressedPixelFormat::EacRG11Unorm,
+    @ref CompressedPixelFormat::EacRG11Snorm
+*/
+MAGNUM_EXPORT void yFlipEacRG11InPlace(const Containers::StridedArrayView4D<char>& blocks);
+
+/**
+@brief Convert sRGB colors to linear RGB
+@param[in]  src     Source 8-bit sRGB values
+@param[out] dst     Destination linear floating-point values
+@m_since_latest
+
+Batch equivalent of @ref Color3::fromSrgb(const Vector3<Integral>&) and
+@ref Color4::fromSrgbAlpha(const Vector4<Integral>&). Second dimension is
+meant to contain color channels. The first three channels are converted from
+sRGB, the fourth channel, if present, is treated as linear alpha and is only
+unpacked to the @f$ [0, 1] @f$ range. Expects that @p src and @p dst have the
+same size and that the second dimension is at most @cpp 4 @ce.
+
+The conversion is done via a 256-entry lookup table calculated from the scalar
+@ref Color3::fromSrgb() on first use, producing output that's bit-identical to
+it. Contiguous views of @ref Color3ub / @ref Color4ub can be passed by slicing
+to @ref Vector::data():
+
+@snippet Math.cpp fromSrgbInto
+
+@see @ref unpackInto()
+*/
+MAGNUM_EXPORT void fromSrgbInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+/**
+@brief Convert sRGB colors to linear RGB
+@param[in]  src     Source floating-point sRGB values
+@param[out] dst     Destination linear floating-point values
+@m_since_latest
+
+Batch equivalent of @ref Color3::fromSrgb(const Vector3<FloatingPointType>&)
+and @ref Color4::fromSrgbAlpha(const Vector4<FloatingPointType>&). Second
+dimension is meant to contain color channels. The first three channels are
+converted from sRGB, the fourth channel, if present, is treated as linear alpha
+and copied unchanged. Expects that @p src and @p dst have the same size and
+that the second dimension is at most @cpp 4 @ce.
+
+Instead of calling @ref pow() for every value, the conversion uses a
+polynomial approximation that's evaluated on blocks of values without any
+branching, allowing the compiler to vectorize it. Compared to the scalar
+@ref Color3::fromSrgb() the relative error is below @cpp 1.0e-6f @ce for
+values in the @f$ [0, 1] @f$ range. NaNs are propagated to the output.
+*/
+MAGNUM_EXPORT void fromSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+/**
+@brief Convert linear RGB colors to sRGB
+@param[in]  src     Source linear floating-point values
+@param[out] dst     Destination 8-bit sRGB values
+@m_since_latest
+
+Batch equivalent of @ref Color3::toSrgb() "Color3::toSrgb<Integral>()" and
+@ref Color4::toSrgbAlpha() "Color4::toSrgbAlpha<Integral>()". Second dimension
+is meant to contain color channels. The first three channels are converted to
+sRGB, the fourth channel, if present, is treated as linear alpha and is only
+packed from the @f$ [0, 1] @f$ range. Expects that @p src and @p dst have the
+same size and that the second dimension is at most @cpp 4 @ce.
+
+The conversion is done using the same polynomial approximation as
+@ref toSrgbInto(const Containers::StridedArrayView2D<const Float>&, const Containers::StridedArrayView2D<Float>&),
+with the result then passed through @ref packInto(). Because of the
+approximation, the output may in rare cases differ by one from the scalar
+@ref Color3::toSrgb() for values that are very close to a rounding boundary.
+Same as with @ref packInto(), values outside of the @f$ [0, 1] @f$ range are
+not clamped.
+*/
+MAGNUM_EXPORT void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst);
+
+/**
+@brief Convert linear RGB colors to sRGB
+@param[in]  src     Source linear floating-point values
+@param[out] dst     Destination floating-point sRGB values
+@m_since_latest
+
+Batch equivalent of @ref Color3::toSrgb() and @ref Color4::toSrgbAlpha().
+Second dimension is meant to contain color channels. The first three channels
+are converted to sRGB, the fourth channel, if present, is treated as linear
+alpha and copied unchanged. Expects that @p src and @p dst have the same size
+and that the second dimension is at most @cpp 4 @ce.
+
+Instead of calling @ref pow() for every value, the conversion uses a
+polynomial approximation that's evaluated on blocks of values without any
+branching, allowing the compiler to vectorize it. Compared to the scalar
+@ref Color3::toSrgb() the relative error is below @cpp 1.0e-6f @ce for values
+in the @f$ [0, 1] @f$ range. NaNs are propagated to the output.
+*/
+MAGNUM_EXPORT void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst);
+
 }}
 
 #endif
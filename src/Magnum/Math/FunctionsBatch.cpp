@@ -0,0 +1,496 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2020 janos <janos.meny@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FunctionsBatch.h"
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Utility/Macros.h> /* CORRADE_UNUSED, CORRADE_ALWAYS_INLINE */
+#if defined(CORRADE_ENABLE_SSE2) || defined(CORRADE_ENABLE_AVX)
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#include <Corrade/Utility/IntrinsicsAvx.h>
+#elif defined(CORRADE_ENABLE_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "Magnum/Math/Constants.h"
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+namespace {
+
+/* All kernels below operate on a contiguous range of count scalars that
+   represent either scalars (period being 1) or three-component vectors
+   (period being 3). The SIMD variants keep one accumulator register per
+   component of a vector so a register lane always corresponds to the same
+   component, then the lanes get reduced and the remaining tail is processed
+   with the scalar variant. Both period values are instantiated to allow the
+   compiler to fully unroll the inner loop.
+
+   The min/max operations have the same semantics as Math::min(a, b) and
+   Math::max(a, b) with a being the accumulated value, so a NaN in the input
+   is ignored and a NaN in the initial value is preserved. Finally, both the
+   minimum and maximum are calculated only if the corresponding output pointer
+   is non-null. */
+
+template<std::size_t period, class T> void minmaxScalar(const T* const data, const std::size_t count, T* const min, T* const max) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const std::size_t component = i % period;
+        if(min) min[component] = Math::min(min[component], data[i]);
+        if(max) max[component] = Math::max(max[component], data[i]);
+    }
+}
+
+template<std::size_t period, bool inf, class T> void isNanInfScalar(const T* const data, const std::size_t count, bool* const out) {
+    for(std::size_t i = 0; i != count; ++i) {
+        if(inf ? Math::isInf(data[i]) : Math::isNan(data[i])) {
+            out[i % period] = true;
+            /* For scalars there's no need to continue once any is found */
+            if(period == 1) return;
+        }
+    }
+}
+
+/* Sets the accumulator lanes to initial values for given component */
+template<std::size_t period, std::size_t lanes, class T> void fillLanes(const T* const initial, T(&out)[period*lanes]) {
+    for(std::size_t i = 0; i != period*lanes; ++i)
+        out[i] = initial[i % period];
+}
+
+template<std::size_t period, std::size_t lanes, class T> void reduceMinmaxLanes(const T(&lanesMin)[period*lanes], const T(&lanesMax)[period*lanes], T* const min, T* const max) {
+    for(std::size_t i = 0; i != period*lanes; ++i) {
+        const std::size_t component = i % period;
+        if(min) min[component] = Math::min(min[component], lanesMin[i]);
+        if(max) max[component] = Math::max(max[component], lanesMax[i]);
+    }
+}
+
+#if defined(CORRADE_ENABLE_SSE2) || defined(CORRADE_ENABLE_AVX)
+/* Operand order in the min/max instructions is important -- if either value
+   is NaN or they're equal, the second one is returned, which matches the
+   Math::min() and Math::max() behavior with the second value being the
+   accumulator */
+template<class T> struct Sse2Traits;
+template<> struct Sse2Traits<Float> {
+    typedef __m128 Type;
+    enum: std::size_t { Lanes = 4 };
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 load(const Float* const a) { return _mm_loadu_ps(a); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static void store(Float* const a, const __m128 b) { _mm_storeu_ps(a, b); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 zero() { return _mm_setzero_ps(); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 min(const __m128 a, const __m128 accumulator) { return _mm_min_ps(a, accumulator); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 max(const __m128 a, const __m128 accumulator) { return _mm_max_ps(a, accumulator); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 isNan(const __m128 a) { return _mm_cmpunord_ps(a, a); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 isInf(const __m128 a) {
+        return _mm_cmpeq_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), a), _mm_set1_ps(Constants<Float>::inf()));
+    }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128 or_(const __m128 a, const __m128 b) { return _mm_or_ps(a, b); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static int mask(const __m128 a) { return _mm_movemask_ps(a); }
+};
+template<> struct Sse2Traits<Double> {
+    typedef __m128d Type;
+    enum: std::size_t { Lanes = 2 };
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d load(const Double* const a) { return _mm_loadu_pd(a); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static void store(Double* const a, const __m128d b) { _mm_storeu_pd(a, b); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d zero() { return _mm_setzero_pd(); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d min(const __m128d a, const __m128d accumulator) { return _mm_min_pd(a, accumulator); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d max(const __m128d a, const __m128d accumulator) { return _mm_max_pd(a, accumulator); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d isNan(const __m128d a) { return _mm_cmpunord_pd(a, a); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d isInf(const __m128d a) {
+        return _mm_cmpeq_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), a), _mm_set1_pd(Constants<Double>::inf()));
+    }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static __m128d or_(const __m128d a, const __m128d b) { return _mm_or_pd(a, b); }
+    CORRADE_ENABLE_SSE2 CORRADE_ALWAYS_INLINE static int mask(const __m128d a) { return _mm_movemask_pd(a); }
+};
+
+template<std::size_t period, class T> CORRADE_ENABLE_SSE2 void minmaxSse2(const T* const data, const std::size_t count, T* const min, T* const max) {
+    typedef Sse2Traits<T> Traits;
+    constexpr std::size_t chunk = period*Traits::Lanes;
+
+    std::size_t i = 0;
+    if(count >= chunk) {
+        T lanesMin[chunk]{}, lanesMax[chunk]{};
+        if(min) fillLanes<period, Traits::Lanes>(min, lanesMin);
+        if(max) fillLanes<period, Traits::Lanes>(max, lanesMax);
+        typename Traits::Type accumulatorMin[period], accumulatorMax[period];
+        for(std::size_t j = 0; j != period; ++j) {
+            accumulatorMin[j] = Traits::load(lanesMin + j*Traits::Lanes);
+            accumulatorMax[j] = Traits::load(lanesMax + j*Traits::Lanes);
+        }
+
+        for(; i + chunk <= count; i += chunk) {
+            for(std::size_t j = 0; j != period; ++j) {
+                const typename Traits::Type in = Traits::load(data + i + j*Traits::Lanes);
+                accumulatorMin[j] = Traits::min(in, accumulatorMin[j]);
+                accumulatorMax[j] = Traits::max(in, accumulatorMax[j]);
+            }
+        }
+
+        for(std::size_t j = 0; j != period; ++j) {
+            Traits::store(lanesMin + j*Traits::Lanes, accumulatorMin[j]);
+            Traits::store(lanesMax + j*Traits::Lanes, accumulatorMax[j]);
+        }
+        reduceMinmaxLanes<period, Traits::Lanes>(lanesMin, lanesMax, min, max);
+    }
+
+    minmaxScalar<period>(data + i, count - i, min, max);
+}
+
+template<std::size_t period, bool inf, class T> CORRADE_ENABLE_SSE2 void isNanInfSse2(const T* const data, const std::size_t count, bool* const out) {
+    typedef Sse2Traits<T> Traits;
+    constexpr std::size_t chunk = period*Traits::Lanes;
+
+    std::size_t i = 0;
+    typename Traits::Type accumulator[period];
+    for(std::size_t j = 0; j != period; ++j)
+        accumulator[j] = Traits::zero();
+    for(; i + chunk <= count; i += chunk) {
+        for(std::size_t j = 0; j != period; ++j) {
+            const typename Traits::Type in = Traits::load(data + i + j*Traits::Lanes);
+            accumulator[j] = Traits::or_(accumulator[j], inf ? Traits::isInf(in) : Traits::isNan(in));
+        }
+        /* For scalars there's no need to continue once any is found */
+        if(period == 1 && Traits::mask(accumulator[0])) {
+            out[0] = true;
+            return;
+        }
+    }
+
+    for(std::size_t j = 0; j != period; ++j) {
+        const int mask = Traits::mask(accumulator[j]);
+        for(std::size_t k = 0; k != Traits::Lanes; ++k)
+            if(mask & (1 << k)) out[(j*Traits::Lanes + k) % period] = true;
+    }
+
+    isNanInfScalar<period, inf>(data + i, count - i, out);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+template<class T> struct AvxTraits;
+template<> struct AvxTraits<Float> {
+    typedef __m256 Type;
+    enum: std::size_t { Lanes = 8 };
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 load(const Float* const a) { return _mm256_loadu_ps(a); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static void store(Float* const a, const __m256 b) { _mm256_storeu_ps(a, b); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 zero() { return _mm256_setzero_ps(); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 min(const __m256 a, const __m256 accumulator) { return _mm256_min_ps(a, accumulator); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 max(const __m256 a, const __m256 accumulator) { return _mm256_max_ps(a, accumulator); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 isNan(const __m256 a) { return _mm256_cmp_ps(a, a, _CMP_UNORD_Q); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 isInf(const __m256 a) {
+        return _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a), _mm256_set1_ps(Constants<Float>::inf()), _CMP_EQ_OQ);
+    }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256 or_(const __m256 a, const __m256 b) { return _mm256_or_ps(a, b); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static int mask(const __m256 a) { return _mm256_movemask_ps(a); }
+};
+template<> struct AvxTraits<Double> {
+    typedef __m256d Type;
+    enum: std::size_t { Lanes = 4 };
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d load(const Double* const a) { return _mm256_loadu_pd(a); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static void store(Double* const a, const __m256d b) { _mm256_storeu_pd(a, b); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d zero() { return _mm256_setzero_pd(); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d min(const __m256d a, const __m256d accumulator) { return _mm256_min_pd(a, accumulator); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d max(const __m256d a, const __m256d accumulator) { return _mm256_max_pd(a, accumulator); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d isNan(const __m256d a) { return _mm256_cmp_pd(a, a, _CMP_UNORD_Q); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d isInf(const __m256d a) {
+        return _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), a), _mm256_set1_pd(Constants<Double>::inf()), _CMP_EQ_OQ);
+    }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static __m256d or_(const __m256d a, const __m256d b) { return _mm256_or_pd(a, b); }
+    CORRADE_ENABLE_AVX CORRADE_ALWAYS_INLINE static int mask(const __m256d a) { return _mm256_movemask_pd(a); }
+};
+
+/* Same as the SSE2 variants, just with a different traits class. Can't be
+   shared with the SSE2 code as the target attribute has to be different. */
+template<std::size_t period, class T> CORRADE_ENABLE_AVX void minmaxAvx(const T* const data, const std::size_t count, T* const min, T* const max) {
+    typedef AvxTraits<T> Traits;
+    constexpr std::size_t chunk = period*Traits::Lanes;
+
+    std::size_t i = 0;
+    if(count >= chunk) {
+        T lanesMin[chunk]{}, lanesMax[chunk]{};
+        if(min) fillLanes<period, Traits::Lanes>(min, lanesMin);
+        if(max) fillLanes<period, Traits::Lanes>(max, lanesMax);
+        typename Traits::Type accumulatorMin[period], accumulatorMax[period];
+        for(std::size_t j = 0; j != period; ++j) {
+            accumulatorMin[j] = Traits::load(lanesMin + j*Traits::Lanes);
+            accumulatorMax[j] = Traits::load(lanesMax + j*Traits::Lanes);
+        }
+
+        for(; i + chunk <= count; i += chunk) {
+            for(std::size_t j = 0; j != period; ++j) {
+                const typename Traits::Type in = Traits::load(data + i + j*Traits::Lanes);
+                accumulatorMin[j] = Traits::min(in, accumulatorMin[j]);
+                accumulatorMax[j] = Traits::max(in, accumulatorMax[j]);
+            }
+        }
+
+        for(std::size_t j = 0; j != period; ++j) {
+            Traits::store(lanesMin + j*Traits::Lanes, accumulatorMin[j]);
+            Traits::store(lanesMax + j*Traits::Lanes, accumulatorMax[j]);
+        }
+        reduceMinmaxLanes<period, Traits::Lanes>(lanesMin, lanesMax, min, max);
+    }
+
+    minmaxScalar<period>(data + i, count - i, min, max);
+}
+
+template<std::size_t period, bool inf, class T> CORRADE_ENABLE_AVX void isNanInfAvx(const T* const data, const std::size_t count, bool* const out) {
+    typedef AvxTraits<T> Traits;
+    constexpr std::size_t chunk = period*Traits::Lanes;
+
+    std::size_t i = 0;
+    typename Traits::Type accumulator[period];
+    for(std::size_t j = 0; j != period; ++j)
+        accumulator[j] = Traits::zero();
+    for(; i + chunk <= count; i += chunk) {
+        for(std::size_t j = 0; j != period; ++j) {
+            const typename Traits::Type in = Traits::load(data + i + j*Traits::Lanes);
+            accumulator[j] = Traits::or_(accumulator[j], inf ? Traits::isInf(in) : Traits::isNan(in));
+        }
+        if(period == 1 && Traits::mask(accumulator[0])) {
+            out[0] = true;
+            return;
+        }
+    }
+
+    for(std::size_t j = 0; j != period; ++j) {
+        const int mask = Traits::mask(accumulator[j]);
+        for(std::size_t k = 0; k != Traits::Lanes; ++k)
+            if(mask & (1 << k)) out[(j*Traits::Lanes + k) % period] = true;
+    }
+
+    isNanInfScalar<period, inf>(data + i, count - i, out);
+}
+#endif
+
+/* Double-precision operations are available in the base instruction set only
+   on AArch64 */
+#if defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+/* Unlike on x86, the min/max instructions propagate NaNs, so a comparison
+   and a bitwise select is used instead */
+template<class T> struct NeonTraits;
+template<> struct NeonTraits<Float> {
+    typedef float32x4_t Type;
+    typedef uint32x4_t Mask;
+    enum: std::size_t { Lanes = 4 };
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static float32x4_t load(const Float* const a) { return vld1q_f32(a); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static void store(Float* const a, const float32x4_t b) { vst1q_f32(a, b); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint32x4_t zero() { return vdupq_n_u32(0); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static float32x4_t min(const float32x4_t a, const float32x4_t accumulator) { return vbslq_f32(vcltq_f32(a, accumulator), a, accumulator); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static float32x4_t max(const float32x4_t a, const float32x4_t accumulator) { return vbslq_f32(vcgtq_f32(a, accumulator), a, accumulator); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint32x4_t isNan(const float32x4_t a) { return vmvnq_u32(vceqq_f32(a, a)); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint32x4_t isInf(const float32x4_t a) { return vceqq_f32(vabsq_f32(a), vdupq_n_f32(Constants<Float>::inf())); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint32x4_t or_(const uint32x4_t a, const uint32x4_t b) { return vorrq_u32(a, b); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static int mask(const uint32x4_t a) {
+        const uint32x4_t bits{1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(a, bits));
+    }
+};
+template<> struct NeonTraits<Double> {
+    typedef float64x2_t Type;
+    typedef uint64x2_t Mask;
+    enum: std::size_t { Lanes = 2 };
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static float64x2_t load(const Double* const a) { return vld1q_f64(a); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static void store(Double* const a, const float64x2_t b) { vst1q_f64(a, b); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint64x2_t zero() { return vdupq_n_u64(0); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static float64x2_t min(const float64x2_t a, const float64x2_t accumulator) { return vbslq_f64(vcltq_f64(a, accumulator), a, accumulator); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static float64x2_t max(const float64x2_t a, const float64x2_t accumulator) { return vbslq_f64(vcgtq_f64(a, accumulator), a, accumulator); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint64x2_t isNan(const float64x2_t a) {
+        return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(vceqq_f64(a, a))));
+    }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint64x2_t isInf(const float64x2_t a) { return vceqq_f64(vabsq_f64(a), vdupq_n_f64(Constants<Double>::inf())); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static uint64x2_t or_(const uint64x2_t a, const uint64x2_t b) { return vorrq_u64(a, b); }
+    CORRADE_ENABLE_NEON CORRADE_ALWAYS_INLINE static int mask(const uint64x2_t a) {
+        return int(vgetq_lane_u64(a, 0) & 1)|int(vgetq_lane_u64(a, 1) & 2);
+    }
+};
+
+template<std::size_t period, class T> CORRADE_ENABLE_NEON void minmaxNeon(const T* const data, const std::size_t count, T* const min, T* const max) {
+    typedef NeonTraits<T> Traits;
+    constexpr std::size_t chunk = period*Traits::Lanes;
+
+    std::size_t i = 0;
+    if(count >= chunk) {
+        T lanesMin[chunk]{}, lanesMax[chunk]{};
+        if(min) fillLanes<period, Traits::Lanes>(min, lanesMin);
+        if(max) fillLanes<period, Traits::Lanes>(max, lanesMax);
+        typename Traits::Type accumulatorMin[period], accumulatorMax[period];
+        for(std::size_t j = 0; j != period; ++j) {
+            accumulatorMin[j] = Traits::load(lanesMin + j*Traits::Lanes);
+            accumulatorMax[j] = Traits::load(lanesMax + j*Traits::Lanes);
+        }
+
+        for(; i + chunk <= count; i += chunk) {
+            for(std::size_t j = 0; j != period; ++j) {
+                const typename Traits::Type in = Traits::load(data + i + j*Traits::Lanes);
+                accumulatorMin[j] = Traits::min(in, accumulatorMin[j]);
+                accumulatorMax[j] = Traits::max(in, accumulatorMax[j]);
+            }
+        }
+
+        for(std::size_t j = 0; j != period; ++j) {
+            Traits::store(lanesMin + j*Traits::Lanes, accumulatorMin[j]);
+            Traits::store(lanesMax + j*Traits::Lanes, accumulatorMax[j]);
+        }
+        reduceMinmaxLanes<period, Traits::Lanes>(lanesMin, lanesMax, min, max);
+    }
+
+    minmaxScalar<period>(data + i, count - i, min, max);
+}
+
+template<std::size_t period, bool inf, class T> CORRADE_ENABLE_NEON void isNanInfNeon(const T* const data, const std::size_t count, bool* const out) {
+    typedef NeonTraits<T> Traits;
+    constexpr std::size_t chunk = period*Traits::Lanes;
+
+    std::size_t i = 0;
+    typename Traits::Mask accumulator[period];
+    for(std::size_t j = 0; j != period; ++j)
+        accumulator[j] = Traits::zero();
+    for(; i + chunk <= count; i += chunk) {
+        for(std::size_t j = 0; j != period; ++j) {
+            const typename Traits::Type in = Traits::load(data + i + j*Traits::Lanes);
+            accumulator[j] = Traits::or_(accumulator[j], inf ? Traits::isInf(in) : Traits::isNan(in));
+        }
+        if(period == 1 && Traits::mask(accumulator[0])) {
+            out[0] = true;
+            return;
+        }
+    }
+
+    for(std::size_t j = 0; j != period; ++j) {
+        const int mask = Traits::mask(accumulator[j]);
+        for(std::size_t k = 0; k != Traits::Lanes; ++k)
+            if(mask & (1 << k)) out[(j*Traits::Lanes + k) % period] = true;
+    }
+
+    isNanInfScalar<period, inf>(data + i, count - i, out);
+}
+#endif
+
+/* Index 0 is for scalars, index 1 for three-component vectors */
+struct Kernels {
+    void(*minmaxFloat[2])(const Float*, std::size_t, Float*, Float*);
+    void(*minmaxDouble[2])(const Double*, std::size_t, Double*, Double*);
+    void(*isNanFloat[2])(const Float*, std::size_t, bool*);
+    void(*isNanDouble[2])(const Double*, std::size_t, bool*);
+    void(*isInfFloat[2])(const Float*, std::size_t, bool*);
+    void(*isInfDouble[2])(const Double*, std::size_t, bool*);
+};
+
+/* Only one of these gets used if CORRADE_BUILD_CPU_RUNTIME_DISPATCH isn't
+   enabled, hence the CORRADE_UNUSED */
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return {
+        {minmaxScalar<1, Float>, minmaxScalar<3, Float>},
+        {minmaxScalar<1, Double>, minmaxScalar<3, Double>},
+        {isNanInfScalar<1, false, Float>, isNanInfScalar<3, false, Float>},
+        {isNanInfScalar<1, false, Double>, isNanInfScalar<3, false, Double>},
+        {isNanInfScalar<1, true, Float>, isNanInfScalar<3, true, Float>},
+        {isNanInfScalar<1, true, Double>, isNanInfScalar<3, true, Double>},
+    };
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return {
+        {minmaxSse2<1, Float>, minmaxSse2<3, Float>},
+        {minmaxSse2<1, Double>, minmaxSse2<3, Double>},
+        {isNanInfSse2<1, false, Float>, isNanInfSse2<3, false, Float>},
+        {isNanInfSse2<1, false, Double>, isNanInfSse2<3, false, Double>},
+        {isNanInfSse2<1, true, Float>, isNanInfSse2<3, true, Float>},
+        {isNanInfSse2<1, true, Double>, isNanInfSse2<3, true, Double>},
+    };
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return {
+        {minmaxAvx<1, Float>, minmaxAvx<3, Float>},
+        {minmaxAvx<1, Double>, minmaxAvx<3, Double>},
+        {isNanInfAvx<1, false, Float>, isNanInfAvx<3, false, Float>},
+        {isNanInfAvx<1, false, Double>, isNanInfAvx<3, false, Double>},
+        {isNanInfAvx<1, true, Float>, isNanInfAvx<3, true, Float>},
+        {isNanInfAvx<1, true, Double>, isNanInfAvx<3, true, Double>},
+    };
+}
+#endif
+
+#if defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Neon)) {
+    return {
+        {minmaxNeon<1, Float>, minmaxNeon<3, Float>},
+        {minmaxNeon<1, Double>, minmaxNeon<3, Double>},
+        {isNanInfNeon<1, false, Float>, isNanInfNeon<3, false, Float>},
+        {isNanInfNeon<1, false, Double>, isNanInfNeon<3, false, Double>},
+        {isNanInfNeon<1, true, Float>, isNanInfNeon<3, true, Float>},
+        {isNanInfNeon<1, true, Double>, isNanInfNeon<3, true, Double>},
+    };
+}
+#endif
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+CORRADE_CPU_DISPATCHER_BASE(kernelsImplementation)
+#endif
+
+const Kernels& kernels() {
+    /* Picked on first use instead of during static initialization so the
+       functions are safe to call from other static initializers as well */
+    static const Kernels kernels =
+        #ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+        kernelsImplementation(Cpu::runtimeFeatures());
+        #else
+        kernelsImplementation(CORRADE_CPU_SELECT(Cpu::Default));
+        #endif
+    return kernels;
+}
+
+}
+
+void minmaxContiguous(const Float* const data, const std::size_t count, const std::size_t period, Float* const min, Float* const max) {
+    kernels().minmaxFloat[period == 3](data, count, min, max);
+}
+
+void minmaxContiguous(const Double* const data, const std::size_t count, const std::size_t period, Double* const min, Double* const max) {
+    kernels().minmaxDouble[period == 3](data, count, min, max);
+}
+
+void isNanContiguous(const Float* const data, const std::size_t count, const std::size_t period, bool* const out) {
+    kernels().isNanFloat[period == 3](data, count, out);
+}
+
+void isNanContiguous(const Double* const data, const std::size_t count, const std::size_t period, bool* const out) {
+    kernels().isNanDouble[period == 3](data, count, out);
+}
+
+void isInfContiguous(const Float* const data, const std::size_t count, const std::size_t period, bool* const out) {
+    kernels().isInfFloat[period == 3](data, count, out);
+}
+
+void isInfContiguous(const Double* const data, const std::size_t count, const std::size_t period, bool* const out) {
+    kernels().isInfDouble[period == 3](data, count, out);
+}
+
+}}}
@@ -53,6 +53,76 @@ template<class T, class View = decltype(Containers::Implementation::ErasedArrayV
 template<class T> static typename std::remove_const<T>::type stridedArrayViewTypeFor(const Containers::ArrayView<T>&);
 template<class T> static typename std::remove_const<T>::type stridedArrayViewTypeFor(const Containers::StridedArrayView1D<T>&);
 
+#ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+/* SIMD kernels for contiguous ranges of Float and Double scalars and
+   three-component vectors, implemented in FunctionsBatch.cpp. The count is in
+   scalars, period is either 1 or 3. The min and max pointers are either null
+   or point to period initial values that are then updated in-place, with the
+   initial values being treated as the first item of the range. The out array
+   has period items which get set to true if any value in given component is
+   NaN or infinity, values already set to true aren't reset. */
+MAGNUM_EXPORT void minmaxContiguous(const Float* data, std::size_t count, std::size_t period, Float* min, Float* max);
+MAGNUM_EXPORT void minmaxContiguous(const Double* data, std::size_t count, std::size_t period, Double* min, Double* max);
+MAGNUM_EXPORT void isNanContiguous(const Float* data, std::size_t count, std::size_t period, bool* out);
+MAGNUM_EXPORT void isNanContiguous(const Double* data, std::size_t count, std::size_t period, bool* out);
+MAGNUM_EXPORT void isInfContiguous(const Float* data, std::size_t count, std::size_t period, bool* out);
+MAGNUM_EXPORT void isInfContiguous(const Double* data, std::size_t count, std::size_t period, bool* out);
+
+template<class T> struct ContiguousKernel: std::false_type {};
+template<> struct ContiguousKernel<Float>: std::true_type {
+    typedef Float Type;
+    enum: std::size_t { Size = 1 };
+};
+template<> struct ContiguousKernel<Double>: std::true_type {
+    typedef Double Type;
+    enum: std::size_t { Size = 1 };
+};
+template<class T> struct ContiguousKernel<Vector<3, T>>: ContiguousKernel<T> {
+    enum: std::size_t { Size = 3 };
+};
+template<class T> struct ContiguousKernel<Vector3<T>>: ContiguousKernel<Vector<3, T>> {};
+
+/* If the range is contiguous and there's a kernel for given type, runs it and
+   returns true, otherwise returns false and the caller is expected to execute
+   the generic loop */
+template<class T> inline bool minmaxKernel(std::false_type, const Containers::StridedArrayView1D<const T>&, T*, T*) {
+    return false;
+}
+template<class T> inline bool minmaxKernel(std::true_type, const Containers::StridedArrayView1D<const T>& range, T* const min, T* const max) {
+    if(!range.isContiguous()) return false;
+    typedef typename ContiguousKernel<T>::Type Type;
+    minmaxContiguous(static_cast<const Type*>(range.data()), range.size()*ContiguousKernel<T>::Size, ContiguousKernel<T>::Size, reinterpret_cast<Type*>(min), reinterpret_cast<Type*>(max));
+    return true;
+}
+
+inline void setComponent(bool& out, std::size_t) { out = true; }
+template<std::size_t size> inline void setComponent(BitVector<size>& out, std::size_t i) { out.set(i); }
+
+template<class T, class Out> inline bool isNanKernel(std::false_type, const Containers::StridedArrayView1D<const T>&, Out&) {
+    return false;
+}
+template<class T, class Out> inline bool isNanKernel(std::true_type, const Containers::StridedArrayView1D<const T>& range, Out& out) {
+    if(!range.isContiguous()) return false;
+    bool components[ContiguousKernel<T>::Size]{};
+    isNanContiguous(static_cast<const typename ContiguousKernel<T>::Type*>(range.data()), range.size()*ContiguousKernel<T>::Size, ContiguousKernel<T>::Size, components);
+    for(std::size_t i = 0; i != ContiguousKernel<T>::Size; ++i)
+        if(components[i]) setComponent(out, i);
+    return true;
+}
+
+template<class T, class Out> inline bool isInfKernel(std::false_type, const Containers::StridedArrayView1D<const T>&, Out&) {
+    return false;
+}
+template<class T, class Out> inline bool isInfKernel(std::true_type, const Containers::StridedArrayView1D<const T>& range, Out& out) {
+    if(!range.isContiguous()) return false;
+    bool components[ContiguousKernel<T>::Size]{};
+    isInfContiguous(static_cast<const typename ContiguousKernel<T>::Type*>(range.data()), range.size()*ContiguousKernel<T>::Size, ContiguousKernel<T>::Size, components);
+    for(std::size_t i = 0; i != ContiguousKernel<T>::Size; ++i)
+        if(components[i]) setComponent(out, i);
+    return true;
+}
+#endif
+
 }
 
 /**
@@ -69,11 +139,26 @@ For scalar types returns @cpp true @ce as soon as it finds an infinite value,
 @cpp false @ce otherwise. For vector types, returns @ref BitVector with bits
 set to @cpp 1 @ce if any value has that component infinite. If the range is
 empty, returns @cpp false @ce or a @ref BitVector with no bits set.
+
+If @p range is contiguous and of a @relativeref{Magnum,Float} or
+@relativeref{Magnum,Double} scalar or three-component vector type, the
+operation is done using a SIMD-optimized code path on platforms where it's
+available, giving the same result as the generic code path.
 @see @ref isInf(T), @ref Constants::inf()
 */
 template<class T> auto isInf(const Containers::StridedArrayView1D<const T>& range) -> decltype(isInf(std::declval<T>())) {
     if(range.isEmpty()) return {};
 
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    /* Contiguous Float and Double scalars and three-component vectors go
+       through a SIMD kernel */
+    {
+        decltype(isInf(std::declval<T>())) out{};
+        if(Implementation::isInfKernel(Implementation::ContiguousKernel<T>{}, range, out))
+            return out;
+    }
+    #endif
+
     /* For scalars, this loop exits once any value is infinity. For vectors
        the loop accumulates the bits and exits as soon as all bits are set
        or the input is exhausted */
@@ -121,11 +206,26 @@ For scalar types returns @cpp true @ce as soon as it finds a NaN value,
 @cpp false @ce otherwise. For vector types, returns @ref BitVector with bits
 set to @cpp 1 @ce if any value has that component NaN. If the range is empty,
 returns @cpp false @ce or a @ref BitVector with no bits set.
+
+If @p range is contiguous and of a @relativeref{Magnum,Float} or
+@relativeref{Magnum,Double} scalar or three-component vector type, the
+operation is done using a SIMD-optimized code path on platforms where it's
+available, giving the same result as the generic code path.
 @see @ref isNan(T), @ref Constants::nan()
 */
 template<class T> inline auto isNan(const Containers::StridedArrayView1D<const T>& range) -> decltype(isNan(std::declval<T>())) {
     if(range.isEmpty()) return {};
 
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    /* Contiguous Float and Double scalars and three-component vectors go
+       through a SIMD kernel */
+    {
+        decltype(isNan(std::declval<T>())) out{};
+        if(Implementation::isNanKernel(Implementation::ContiguousKernel<T>{}, range, out))
+            return out;
+    }
+    #endif
+
     /* For scalars, this loop exits once any value is infinity. For vectors
        the loop accumulates the bits and exits as soon as all bits are set
        or the input is exhausted */
@@ -206,12 +306,23 @@ namespace Implementation {
 
 If the range is empty, returns default-constructed value. <em>NaN</em>s are
 ignored, unless the range is all <em>NaN</em>s.
+
+If @p range is contiguous and of a @relativeref{Magnum,Float} or
+@relativeref{Magnum,Double} scalar or three-component vector type, the
+operation is done using a SIMD-optimized code path on platforms where it's
+available, giving the same result as the generic code path.
 @see @ref min(T, T), @ref isNan(const Containers::StridedArrayView1D<const T>&)
 */
 template<class T> inline T min(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
     Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    /* Contiguous Float and Double scalars and three-component vectors go
+       through a SIMD kernel */
+    if(Implementation::minmaxKernel(Implementation::ContiguousKernel<T>{}, range.exceptPrefix(iOut.first() + 1), &iOut.second(), nullptr))
+        return iOut.second();
+    #endif
     for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
         iOut.second() = Math::min(iOut.second(), range[iOut.first()]);
 
@@ -251,12 +362,23 @@ template<class T, std::size_t size> inline T min(const T(&array)[size]) {
 
 If the range is empty, returns default-constructed value. <em>NaN</em>s are
 ignored, unless the range is all <em>NaN</em>s.
+
+If @p range is contiguous and of a @relativeref{Magnum,Float} or
+@relativeref{Magnum,Double} scalar or three-component vector type, the
+operation is done using a SIMD-optimized code path on platforms where it's
+available, giving the same result as the generic code path.
 @see @ref max(T, T), @ref isNan(const Containers::StridedArrayView1D<const T>&)
 */
 template<class T> inline T max(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
     Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    /* Contiguous Float and Double scalars and three-component vectors go
+       through a SIMD kernel */
+    if(Implementation::minmaxKernel(Implementation::ContiguousKernel<T>{}, range.exceptPrefix(iOut.first() + 1), nullptr, &iOut.second()))
+        return iOut.second();
+    #endif
     for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
         iOut.second() = Math::max(iOut.second(), range[iOut.first()]);
 
@@ -309,6 +431,11 @@ namespace Implementation {
 
 If the range is empty, returns default-constructed values. <em>NaN</em>s are
 ignored, unless the range is all <em>NaN</em>s.
+
+If @p range is contiguous and of a @relativeref{Magnum,Float} or
+@relativeref{Magnum,Double} scalar or three-component vector type, the
+operation is done using a SIMD-optimized code path on platforms where it's
+available, giving the same result as the generic code path.
 @see @ref minmax(T, T),
     @ref Range::Range(const Containers::Pair<VectorType, VectorType>&),
     @ref isNan(const Containers::StridedArrayView1D<const T>&)
@@ -318,6 +445,12 @@ template<class T> inline Containers::Pair<T, T> minmax(const Containers::Strided
 
     Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
     T min{iOut.second()}, max{iOut.second()};
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    /* Contiguous Float and Double scalars and three-component vectors go
+       through a SIMD kernel */
+    if(Implementation::minmaxKernel(Implementation::ContiguousKernel<T>{}, range.exceptPrefix(iOut.first() + 1), &min, &max))
+        return {min, max};
+    #endif
     for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
         Implementation::minmax(min, max, range[iOut.first()]);
 
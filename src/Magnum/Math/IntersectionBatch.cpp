@@ -0,0 +1,186 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IntersectionBatch.h"
+
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+namespace {
+
+/* Items are processed in blocks of this size. Each block is first gathered
+   from the (potentially strided) input into a SoA layout on stack, then each
+   plane is applied to the whole block in a loop without early exits that can
+   be vectorized, and finally the results are written to the output bits. */
+enum: std::size_t { BlockSize = 64 };
+
+/* Precalculated plane data, to not have to recalculate the absolute value of
+   the normal for every item */
+struct Plane {
+    Float nx, ny, nz;
+    Float ax, ay, az;
+    Float w;
+};
+
+void planesFromFrustum(const Frustum<Float>& frustum, Plane(&planes)[6]) {
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Vector4<Float>& plane = frustum[i];
+        planes[i] = {plane.x(), plane.y(), plane.z(),
+                     Math::abs(plane.x()), Math::abs(plane.y()), Math::abs(plane.z()),
+                     plane.w()};
+    }
+}
+
+void writeBlock(const bool(&visible)[BlockSize], const Containers::MutableBitArrayView& out, const std::size_t offset, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        if(visible[i]) out.set(offset + i);
+        else out.reset(offset + i);
+    }
+}
+
+/* The center is expected to be twice the actual center and the extents twice
+   the actual extents for ranges, which is compensated by the wScale */
+void aabbFrustumBlock(const Float(&cx)[BlockSize], const Float(&cy)[BlockSize], const Float(&cz)[BlockSize], const Float(&ex)[BlockSize], const Float(&ey)[BlockSize], const Float(&ez)[BlockSize], const Plane(&planes)[6], const Float wScale, bool(&visible)[BlockSize], const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        visible[i] = true;
+
+    for(const Plane& plane: planes) {
+        const Float w = -wScale*plane.w;
+        for(std::size_t i = 0; i != count; ++i) {
+            /* Same order of operations as in aabbFrustum() and
+               rangeFrustum() to give the exact same results */
+            const Float d = cx[i]*plane.nx + cy[i]*plane.ny + cz[i]*plane.nz;
+            const Float r = ex[i]*plane.ax + ey[i]*plane.ay + ez[i]*plane.az;
+            visible[i] = visible[i] & !(d + r < w);
+        }
+    }
+}
+
+}
+
+void rangeFrustumInto(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Containers::MutableBitArrayView out) {
+    CORRADE_ASSERT(ranges.size() == out.size(),
+        "Math::Intersection::rangeFrustumInto(): expected ranges and output views to have the same size, got" << ranges.size() << "and" << out.size(), );
+
+    Plane planes[6];
+    planesFromFrustum(frustum, planes);
+
+    Float cx[BlockSize], cy[BlockSize], cz[BlockSize];
+    Float ex[BlockSize], ey[BlockSize], ez[BlockSize];
+    bool visible[BlockSize];
+    for(std::size_t offset = 0; offset < ranges.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(std::size_t(BlockSize), ranges.size() - offset);
+        for(std::size_t i = 0; i != count; ++i) {
+            /* Convert to center/extent, avoiding division by 2 and instead
+               comparing to 2*-plane.w() later, same as rangeFrustum() */
+            const Range3D<Float>& range = ranges[offset + i];
+            const Vector3<Float> center = range.min() + range.max();
+            const Vector3<Float> extent = range.max() - range.min();
+            cx[i] = center.x();
+            cy[i] = center.y();
+            cz[i] = center.z();
+            ex[i] = extent.x();
+            ey[i] = extent.y();
+            ez[i] = extent.z();
+        }
+
+        aabbFrustumBlock(cx, cy, cz, ex, ey, ez, planes, 2.0f, visible, count);
+        writeBlock(visible, out, offset, count);
+    }
+}
+
+void aabbFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Containers::MutableBitArrayView out) {
+    CORRADE_ASSERT(aabbCenters.size() == aabbExtents.size() && aabbCenters.size() == out.size(),
+        "Math::Intersection::aabbFrustumInto(): expected center, extent and output views to have the same size, got" << aabbCenters.size() << Debug::nospace << "," << aabbExtents.size() << "and" << out.size(), );
+
+    Plane planes[6];
+    planesFromFrustum(frustum, planes);
+
+    Float cx[BlockSize], cy[BlockSize], cz[BlockSize];
+    Float ex[BlockSize], ey[BlockSize], ez[BlockSize];
+    bool visible[BlockSize];
+    for(std::size_t offset = 0; offset < aabbCenters.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(std::size_t(BlockSize), aabbCenters.size() - offset);
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector3<Float>& center = aabbCenters[offset + i];
+            const Vector3<Float>& extent = aabbExtents[offset + i];
+            cx[i] = center.x();
+            cy[i] = center.y();
+            cz[i] = center.z();
+            ex[i] = extent.x();
+            ey[i] = extent.y();
+            ez[i] = extent.z();
+        }
+
+        aabbFrustumBlock(cx, cy, cz, ex, ey, ez, planes, 1.0f, visible, count);
+        writeBlock(visible, out, offset, count);
+    }
+}
+
+void sphereFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Containers::MutableBitArrayView out) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size() && sphereCenters.size() == out.size(),
+        "Math::Intersection::sphereFrustumInto(): expected center, radius and output views to have the same size, got" << sphereCenters.size() << Debug::nospace << "," << sphereRadii.size() << "and" << out.size(), );
+
+    Plane planes[6];
+    planesFromFrustum(frustum, planes);
+
+    Float cx[BlockSize], cy[BlockSize], cz[BlockSize];
+    Float radiiSq[BlockSize];
+    bool visible[BlockSize];
+    for(std::size_t offset = 0; offset < sphereCenters.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(std::size_t(BlockSize), sphereCenters.size() - offset);
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector3<Float>& center = sphereCenters[offset + i];
+            const Float radius = sphereRadii[offset + i];
+            cx[i] = center.x();
+            cy[i] = center.y();
+            cz[i] = center.z();
+            /* Negated already, to not have to do that for every plane */
+            radiiSq[i] = -radius*radius;
+            visible[i] = true;
+        }
+
+        for(const Plane& plane: planes) {
+            for(std::size_t i = 0; i != count; ++i) {
+                /* Same order of operations as in Distance::pointPlaneScaled()
+                   used by sphereFrustum() */
+                const Float distance = plane.nx*cx[i] + plane.ny*cy[i] + plane.nz*cz[i] + plane.w;
+                visible[i] = visible[i] & !(distance < radiiSq[i]);
+            }
+        }
+
+        writeBlock(visible, out, offset, count);
+    }
+}
+
+}}}
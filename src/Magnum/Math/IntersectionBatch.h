@@ -0,0 +1,96 @@
+#ifndef Magnum_Math_IntersectionBatch_h
+#define Magnum_Math_IntersectionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Intersection::rangeFrustumInto(), @ref Magnum::Math::Intersection::aabbFrustumInto(), @ref Magnum::Math::Intersection::sphereFrustumInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+/**
+@brief Intersection of a list of ranges and a frustum
+@param[in]  ranges      Ranges
+@param[in]  frustum     Frustum planes with normals pointing outwards
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref rangeFrustum(), setting a bit in @p out for each range
+that intersects the frustum and resetting it otherwise. The result is the same
+as calling @ref rangeFrustum() for each item. Expects that @p ranges and
+@p out have the same size.
+
+Instead of testing all planes for one range at a time, the ranges are
+processed in blocks, with each frustum plane applied to the whole block before
+moving on to the next. The per-plane data are thus calculated only once and
+the inner loop has no early exits, allowing the compiler to vectorize it.
+@see @ref MeshTools::boundingRange()
+*/
+MAGNUM_EXPORT void rangeFrustumInto(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, Containers::MutableBitArrayView out);
+
+/**
+@brief Intersection of a list of axis-aligned boxes and a frustum
+@param[in]  aabbCenters Centers of the AABBs
+@param[in]  aabbExtents (Half-)extents of the AABBs
+@param[in]  frustum     Frustum planes with normals pointing outwards
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref aabbFrustum(), setting a bit in @p out for each box that
+intersects the frustum and resetting it otherwise. The result is the same as
+calling @ref aabbFrustum() for each item. Expects that @p aabbCenters,
+@p aabbExtents and @p out have the same size. See
+@ref rangeFrustumInto() for details about the implementation.
+*/
+MAGNUM_EXPORT void aabbFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, Containers::MutableBitArrayView out);
+
+/**
+@brief Intersection of a list of spheres and a frustum
+@param[in]  sphereCenters   Sphere centers
+@param[in]  sphereRadii     Sphere radii
+@param[in]  frustum         Frustum planes with normals pointing outwards
+@param[out] out             Where to put the results
+@m_since_latest
+
+Batch variant of @ref sphereFrustum(), setting a bit in @p out for each sphere
+that intersects the frustum and resetting it otherwise. The result is the same
+as calling @ref sphereFrustum() for each item. Expects that @p sphereCenters,
+@p sphereRadii and @p out have the same size. See @ref rangeFrustumInto() for
+details about the implementation.
+@see @ref MeshTools::boundingSphereBouncingBubble()
+*/
+MAGNUM_EXPORT void sphereFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, Containers::MutableBitArrayView out);
+
+}}}
+
+#endif
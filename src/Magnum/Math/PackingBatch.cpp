@@ -32,6 +32,17 @@
 #endif
 #include <Corrade/Utility/Assert.h>
 
+#ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+#include <Corrade/Cpu.h>
+#include <Corrade/Utility/Macros.h> /* CORRADE_UNUSED */
+#if defined(CORRADE_ENABLE_SSE2) || defined(CORRADE_ENABLE_AVX2) || defined(CORRADE_ENABLE_AVX_F16C)
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#include <Corrade/Utility/IntrinsicsAvx.h>
+#elif defined(CORRADE_ENABLE_NEON)
+#include <arm_neon.h>
+#endif
+#endif
+
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
@@ -39,7 +50,491 @@ namespace Magnum { namespace Math {
 
 namespace {
 
-template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
+/* Kernels operating on a contiguous range of values. They get used if the
+   whole source and destination views are contiguous or if the rows are long
+   enough. The scalar variants are equivalent to the strided loops in the
+   *Implementation() functions below and the SIMD variants use them to process
+   the remaining tail. All variants produce bit-identical output. */
+
+template<class T> void unpackScalar(const T* const src, Float* const dst, const std::size_t count) {
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float value = src[i]/bitMax;
+        /* A no-op for unsigned types. Avoiding a max() call in Debug. */
+        dst[i] = value < -1.0f ? -1.0f : value;
+    }
+}
+
+template<class T> void packScalar(const Float* const src, T* const dst, const std::size_t count) {
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = std::round(src[i]*bitMax);
+}
+
+template<class T, class U> void castScalar(const T* const src, U* const dst, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = U(src[i]);
+}
+
+#if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_SSE2)
+/* Widens eight values to two vectors of four 32-bit integers */
+CORRADE_ENABLE_SSE2 inline void widenSse2(const UnsignedByte* const src, __m128i& a, __m128i& b) {
+    const __m128i in = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), _mm_setzero_si128());
+    a = _mm_unpacklo_epi16(in, _mm_setzero_si128());
+    b = _mm_unpackhi_epi16(in, _mm_setzero_si128());
+}
+CORRADE_ENABLE_SSE2 inline void widenSse2(const Byte* const src, __m128i& a, __m128i& b) {
+    /* There's no sign extension instruction in SSE2, so duplicate each byte
+       into all four bytes of a 32-bit lane and do an arithmetic shift */
+    const __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    const __m128i in16 = _mm_unpacklo_epi8(in, in);
+    a = _mm_srai_epi32(_mm_unpacklo_epi16(in16, in16), 24);
+    b = _mm_srai_epi32(_mm_unpackhi_epi16(in16, in16), 24);
+}
+CORRADE_ENABLE_SSE2 inline void widenSse2(const UnsignedShort* const src, __m128i& a, __m128i& b) {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    a = _mm_unpacklo_epi16(in, _mm_setzero_si128());
+    b = _mm_unpackhi_epi16(in, _mm_setzero_si128());
+}
+CORRADE_ENABLE_SSE2 inline void widenSse2(const Short* const src, __m128i& a, __m128i& b) {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    a = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+    b = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+}
+CORRADE_ENABLE_SSE2 inline void widenSse2(const Int* const src, __m128i& a, __m128i& b) {
+    a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4));
+}
+
+/* Narrows two vectors of four 32-bit integers to eight values. Values outside
+   of the destination type range get saturated. */
+CORRADE_ENABLE_SSE2 inline void narrowSse2(const __m128i a, const __m128i b, UnsignedByte* const dst) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_setzero_si128()));
+}
+CORRADE_ENABLE_SSE2 inline void narrowSse2(const __m128i a, const __m128i b, Byte* const dst) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_setzero_si128()));
+}
+CORRADE_ENABLE_SSE2 inline void narrowSse2(const __m128i a, const __m128i b, UnsignedShort* const dst) {
+    /* Unsigned 32-to-16-bit saturation is only since SSE4.1, so move the
+       range to signed, saturate and move it back */
+    const __m128i bias = _mm_set1_epi32(0x8000);
+    const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(packed, _mm_set1_epi16(-32768)));
+}
+CORRADE_ENABLE_SSE2 inline void narrowSse2(const __m128i a, const __m128i b, Short* const dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(a, b));
+}
+CORRADE_ENABLE_SSE2 inline void narrowSse2(const __m128i a, const __m128i b, Int* const dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), b);
+}
+
+/* Equivalent to std::round(), i.e. rounding half away from zero, unlike
+   _mm_cvtps_epi32() which rounds half to even. The fractional part is
+   calculated exactly, so there's no double rounding. */
+CORRADE_ENABLE_SSE2 inline __m128i roundSse2(const __m128 a) {
+    const __m128i truncated = _mm_cvttps_epi32(a);
+    const __m128 fraction = _mm_sub_ps(a, _mm_cvtepi32_ps(truncated));
+    /* The comparisons produce all ones, i.e. -1, in lanes that need to be
+       adjusted */
+    return _mm_add_epi32(
+        _mm_sub_epi32(truncated, _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)))),
+        _mm_castps_si128(_mm_cmple_ps(fraction, _mm_set1_ps(-0.5f))));
+}
+
+template<class T> CORRADE_ENABLE_SSE2 void unpackSse2(const T* const src, Float* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m128i a, b;
+        widenSse2(src + i, a, b);
+        /* Dividing instead of multiplying with an inverse in order to be
+           bit-exact with the scalar variant. The max() is a no-op for
+           unsigned types. */
+        _mm_storeu_ps(dst + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(a), bitMax), minusOne));
+        _mm_storeu_ps(dst + i + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(b), bitMax), minusOne));
+    }
+    unpackScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE2 void packSse2(const Float* const src, T* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) narrowSse2(
+        roundSse2(_mm_mul_ps(_mm_loadu_ps(src + i), bitMax)),
+        roundSse2(_mm_mul_ps(_mm_loadu_ps(src + i + 4), bitMax)),
+        dst + i);
+    packScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE2 void castToFloatSse2(const T* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m128i a, b;
+        widenSse2(src + i, a, b);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(a));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(b));
+    }
+    castScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE2 void castFromFloatSse2(const Float* const src, T* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) narrowSse2(
+        _mm_cvttps_epi32(_mm_loadu_ps(src + i)),
+        _mm_cvttps_epi32(_mm_loadu_ps(src + i + 4)),
+        dst + i);
+    castScalar(src + i, dst + i, count - i);
+}
+#endif
+
+#if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_AVX2)
+/* Widens eight values to a vector of eight 32-bit integers */
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const UnsignedByte* const src) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const Byte* const src) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const UnsignedShort* const src) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const Short* const src) {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const Int* const src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+/* Narrows a vector of eight 32-bit integers to eight values. The pack
+   instructions operate on 128-bit lanes, so it's done on the two halves.
+   Values outside of the destination type range get saturated. */
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(const __m256i a, UnsignedByte* const dst) {
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(packed, packed));
+}
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(const __m256i a, Byte* const dst) {
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(packed, packed));
+}
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(const __m256i a, UnsignedShort* const dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1)));
+}
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(const __m256i a, Short* const dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1)));
+}
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(const __m256i a, Int* const dst) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), a);
+}
+
+/* Equivalent to std::round(), see roundSse2() for details */
+CORRADE_ENABLE_AVX2 inline __m256i roundAvx2(const __m256 a) {
+    const __m256i truncated = _mm256_cvttps_epi32(a);
+    const __m256 fraction = _mm256_sub_ps(a, _mm256_cvtepi32_ps(truncated));
+    return _mm256_add_epi32(
+        _mm256_sub_epi32(truncated, _mm256_castps_si256(_mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ))),
+        _mm256_castps_si256(_mm256_cmp_ps(fraction, _mm256_set1_ps(-0.5f), _CMP_LE_OQ)));
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void unpackAvx2(const T* const src, Float* const dst, const std::size_t count) {
+    const __m256 bitMax = _mm256_set1_ps(Implementation::bitMax<T>());
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    std::size_t i = 0;
+    /* See unpackSse2() for why division and max() */
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_max_ps(_mm256_div_ps(_mm256_cvtepi32_ps(widenAvx2(src + i)), bitMax), minusOne));
+    unpackScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void packAvx2(const Float* const src, T* const dst, const std::size_t count) {
+    const __m256 bitMax = _mm256_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        narrowAvx2(roundAvx2(_mm256_mul_ps(_mm256_loadu_ps(src + i), bitMax)), dst + i);
+    packScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void castToFloatAvx2(const T* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(widenAvx2(src + i)));
+    castScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void castFromFloatAvx2(const Float* const src, T* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        narrowAvx2(_mm256_cvttps_epi32(_mm256_loadu_ps(src + i)), dst + i);
+    castScalar(src + i, dst + i, count - i);
+}
+#endif
+
+/* The NEON variants use a division and a round-half-away-from-zero
+   conversion, which are both available only on AArch64 */
+#if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+/* Widens eight values to two vectors of four 32-bit integers */
+CORRADE_ENABLE_NEON inline void widenNeon(const UnsignedByte* const src, int32x4_t& a, int32x4_t& b) {
+    const uint16x8_t in = vmovl_u8(vld1_u8(src));
+    a = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(in)));
+    b = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(in)));
+}
+CORRADE_ENABLE_NEON inline void widenNeon(const Byte* const src, int32x4_t& a, int32x4_t& b) {
+    const int16x8_t in = vmovl_s8(vld1_s8(src));
+    a = vmovl_s16(vget_low_s16(in));
+    b = vmovl_s16(vget_high_s16(in));
+}
+CORRADE_ENABLE_NEON inline void widenNeon(const UnsignedShort* const src, int32x4_t& a, int32x4_t& b) {
+    const uint16x8_t in = vld1q_u16(src);
+    a = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(in)));
+    b = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(in)));
+}
+CORRADE_ENABLE_NEON inline void widenNeon(const Short* const src, int32x4_t& a, int32x4_t& b) {
+    const int16x8_t in = vld1q_s16(src);
+    a = vmovl_s16(vget_low_s16(in));
+    b = vmovl_s16(vget_high_s16(in));
+}
+CORRADE_ENABLE_NEON inline void widenNeon(const Int* const src, int32x4_t& a, int32x4_t& b) {
+    a = vld1q_s32(src);
+    b = vld1q_s32(src + 4);
+}
+
+/* Narrows two vectors of four 32-bit integers to eight values. Values outside
+   of the destination type range get saturated. */
+CORRADE_ENABLE_NEON inline void narrowNeon(const int32x4_t a, const int32x4_t b, UnsignedByte* const dst) {
+    vst1_u8(dst, vqmovn_u16(vcombine_u16(vqmovun_s32(a), vqmovun_s32(b))));
+}
+CORRADE_ENABLE_NEON inline void narrowNeon(const int32x4_t a, const int32x4_t b, Byte* const dst) {
+    vst1_s8(dst, vqmovn_s16(vcombine_s16(vqmovn_s32(a), vqmovn_s32(b))));
+}
+CORRADE_ENABLE_NEON inline void narrowNeon(const int32x4_t a, const int32x4_t b, UnsignedShort* const dst) {
+    vst1q_u16(dst, vcombine_u16(vqmovun_s32(a), vqmovun_s32(b)));
+}
+CORRADE_ENABLE_NEON inline void narrowNeon(const int32x4_t a, const int32x4_t b, Short* const dst) {
+    vst1q_s16(dst, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+}
+CORRADE_ENABLE_NEON inline void narrowNeon(const int32x4_t a, const int32x4_t b, Int* const dst) {
+    vst1q_s32(dst, a);
+    vst1q_s32(dst + 4, b);
+}
+
+template<class T> CORRADE_ENABLE_NEON void unpackNeon(const T* const src, Float* const dst, const std::size_t count) {
+    const float32x4_t bitMax = vdupq_n_f32(Implementation::bitMax<T>());
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    std::size_t i = 0;
+    /* See unpackSse2() for why division and max() */
+    for(; i + 8 <= count; i += 8) {
+        int32x4_t a, b;
+        widenNeon(src + i, a, b);
+        vst1q_f32(dst + i, vmaxq_f32(vdivq_f32(vcvtq_f32_s32(a), bitMax), minusOne));
+        vst1q_f32(dst + i + 4, vmaxq_f32(vdivq_f32(vcvtq_f32_s32(b), bitMax), minusOne));
+    }
+    unpackScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_NEON void packNeon(const Float* const src, T* const dst, const std::size_t count) {
+    const float32x4_t bitMax = vdupq_n_f32(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    /* vcvtaq_s32_f32() rounds half away from zero, same as std::round() */
+    for(; i + 8 <= count; i += 8) narrowNeon(
+        vcvtaq_s32_f32(vmulq_f32(vld1q_f32(src + i), bitMax)),
+        vcvtaq_s32_f32(vmulq_f32(vld1q_f32(src + i + 4), bitMax)),
+        dst + i);
+    packScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_NEON void castToFloatNeon(const T* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        int32x4_t a, b;
+        widenNeon(src + i, a, b);
+        vst1q_f32(dst + i, vcvtq_f32_s32(a));
+        vst1q_f32(dst + i + 4, vcvtq_f32_s32(b));
+    }
+    castScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_NEON void castFromFloatNeon(const Float* const src, T* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) narrowNeon(
+        vcvtq_s32_f32(vld1q_f32(src + i)),
+        vcvtq_s32_f32(vld1q_f32(src + i + 4)),
+        dst + i);
+    castScalar(src + i, dst + i, count - i);
+}
+#endif
+
+struct Kernels {
+    void(*unpackUnsignedByte)(const UnsignedByte*, Float*, std::size_t);
+    void(*unpackUnsignedShort)(const UnsignedShort*, Float*, std::size_t);
+    void(*unpackByte)(const Byte*, Float*, std::size_t);
+    void(*unpackShort)(const Short*, Float*, std::size_t);
+    void(*packUnsignedByte)(const Float*, UnsignedByte*, std::size_t);
+    void(*packUnsignedShort)(const Float*, UnsignedShort*, std::size_t);
+    void(*packByte)(const Float*, Byte*, std::size_t);
+    void(*packShort)(const Float*, Short*, std::size_t);
+    void(*castUnsignedByteToFloat)(const UnsignedByte*, Float*, std::size_t);
+    void(*castUnsignedShortToFloat)(const UnsignedShort*, Float*, std::size_t);
+    void(*castByteToFloat)(const Byte*, Float*, std::size_t);
+    void(*castShortToFloat)(const Short*, Float*, std::size_t);
+    void(*castIntToFloat)(const Int*, Float*, std::size_t);
+    void(*castFloatToUnsignedByte)(const Float*, UnsignedByte*, std::size_t);
+    void(*castFloatToUnsignedShort)(const Float*, UnsignedShort*, std::size_t);
+    void(*castFloatToByte)(const Float*, Byte*, std::size_t);
+    void(*castFloatToShort)(const Float*, Short*, std::size_t);
+    void(*castFloatToInt)(const Float*, Int*, std::size_t);
+};
+
+Kernels scalarKernels() {
+    return {
+        unpackScalar<UnsignedByte>,
+        unpackScalar<UnsignedShort>,
+        unpackScalar<Byte>,
+        unpackScalar<Short>,
+        packScalar<UnsignedByte>,
+        packScalar<UnsignedShort>,
+        packScalar<Byte>,
+        packScalar<Short>,
+        castScalar<UnsignedByte, Float>,
+        castScalar<UnsignedShort, Float>,
+        castScalar<Byte, Float>,
+        castScalar<Short, Float>,
+        castScalar<Int, Float>,
+        castScalar<Float, UnsignedByte>,
+        castScalar<Float, UnsignedShort>,
+        castScalar<Float, Byte>,
+        castScalar<Float, Short>,
+        castScalar<Float, Int>
+    };
+}
+
+#ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+/* Only one of these gets used if CORRADE_BUILD_CPU_RUNTIME_DISPATCH isn't
+   enabled, hence the CORRADE_UNUSED */
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return scalarKernels();
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return {
+        unpackSse2<UnsignedByte>,
+        unpackSse2<UnsignedShort>,
+        unpackSse2<Byte>,
+        unpackSse2<Short>,
+        packSse2<UnsignedByte>,
+        packSse2<UnsignedShort>,
+        packSse2<Byte>,
+        packSse2<Short>,
+        castToFloatSse2<UnsignedByte>,
+        castToFloatSse2<UnsignedShort>,
+        castToFloatSse2<Byte>,
+        castToFloatSse2<Short>,
+        castToFloatSse2<Int>,
+        castFromFloatSse2<UnsignedByte>,
+        castFromFloatSse2<UnsignedShort>,
+        castFromFloatSse2<Byte>,
+        castFromFloatSse2<Short>,
+        castFromFloatSse2<Int>
+    };
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return {
+        unpackAvx2<UnsignedByte>,
+        unpackAvx2<UnsignedShort>,
+        unpackAvx2<Byte>,
+        unpackAvx2<Short>,
+        packAvx2<UnsignedByte>,
+        packAvx2<UnsignedShort>,
+        packAvx2<Byte>,
+        packAvx2<Short>,
+        castToFloatAvx2<UnsignedByte>,
+        castToFloatAvx2<UnsignedShort>,
+        castToFloatAvx2<Byte>,
+        castToFloatAvx2<Short>,
+        castToFloatAvx2<Int>,
+        castFromFloatAvx2<UnsignedByte>,
+        castFromFloatAvx2<UnsignedShort>,
+        castFromFloatAvx2<Byte>,
+        castFromFloatAvx2<Short>,
+        castFromFloatAvx2<Int>
+    };
+}
+#endif
+
+#if defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UNUSED Kernels kernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Neon)) {
+    return {
+        unpackNeon<UnsignedByte>,
+        unpackNeon<UnsignedShort>,
+        unpackNeon<Byte>,
+        unpackNeon<Short>,
+        packNeon<UnsignedByte>,
+        packNeon<UnsignedShort>,
+        packNeon<Byte>,
+        packNeon<Short>,
+        castToFloatNeon<UnsignedByte>,
+        castToFloatNeon<UnsignedShort>,
+        castToFloatNeon<Byte>,
+        castToFloatNeon<Short>,
+        castToFloatNeon<Int>,
+        castFromFloatNeon<UnsignedByte>,
+        castFromFloatNeon<UnsignedShort>,
+        castFromFloatNeon<Byte>,
+        castFromFloatNeon<Short>,
+        castFromFloatNeon<Int>
+    };
+}
+#endif
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+CORRADE_CPU_DISPATCHER_BASE(kernelsImplementation)
+#endif
+#endif
+
+const Kernels& kernels() {
+    /* Picked on first use instead of during static initialization so the
+       functions are safe to call from other static initializers as well */
+    static const Kernels kernels =
+        #ifdef MAGNUM_SINGLES_NO_CPU_DISPATCH
+        scalarKernels();
+        #elif defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH)
+        kernelsImplementation(Cpu::runtimeFeatures());
+        #else
+        kernelsImplementation(CORRADE_CPU_SELECT(Cpu::Default));
+        #endif
+    return kernels;
+}
+
+/* If both views are contiguous, processes them as a single range with a
+   kernel from above. Otherwise, if the rows are long enough for the SIMD
+   variants to make a difference, processes the rows one by one. The second
+   dimension is expected to be checked for contiguity by the caller already. */
+template<class T, class U> bool contiguousKernelInto(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst, void(*const kernel)(const T*, U*, std::size_t)) {
+    if(src.isContiguous() && dst.isContiguous()) {
+        kernel(static_cast<const T*>(src.data()), static_cast<U*>(dst.data()), src.size()[0]*src.size()[1]);
+        return true;
+    }
+
+    const std::size_t maxJ = src.size()[1];
+    if(maxJ < 32) return false;
+
+    const char* srcPtr = static_cast<const char*>(src.data());
+    char* dstPtr = static_cast<char*>(dst.data());
+    const std::ptrdiff_t srcStride = src.stride()[0];
+    const std::ptrdiff_t dstStride = dst.stride()[0];
+    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+        kernel(reinterpret_cast<const T*>(srcPtr), reinterpret_cast<U*>(dstPtr), maxJ);
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+    return true;
+}
+
+template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst, void(*const kernel)(const T*, Float*, std::size_t)) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.template isContiguous<1>(),
@@ -47,8 +542,7 @@ template<class T> inline void unpackUnsignedIntoImplementation(const Containers:
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(contiguousKernelInto(src, dst, kernel)) return;
 
     /* Caching values to avoid inline function calls in ebug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
@@ -71,16 +565,16 @@ template<class T> inline void unpackUnsignedIntoImplementation(const Containers:
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackUnsignedIntoImplementation(src, dst);
+    unpackUnsignedIntoImplementation(src, dst, kernels().unpackUnsignedByte);
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackUnsignedIntoImplementation(src, dst);
+    unpackUnsignedIntoImplementation(src, dst, kernels().unpackUnsignedShort);
 }
 
 namespace {
 
-template<class T> inline void unpackSignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
+template<class T> inline void unpackSignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst, void(*const kernel)(const T*, Float*, std::size_t)) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.template isContiguous<1>(),
@@ -88,8 +582,7 @@ template<class T> inline void unpackSignedIntoImplementation(const Containers::S
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(contiguousKernelInto(src, dst, kernel)) return;
 
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
@@ -115,16 +608,16 @@ template<class T> inline void unpackSignedIntoImplementation(const Containers::S
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackSignedIntoImplementation(src, dst);
+    unpackSignedIntoImplementation(src, dst, kernels().unpackByte);
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackSignedIntoImplementation(src, dst);
+    unpackSignedIntoImplementation(src, dst, kernels().unpackShort);
 }
 
 namespace {
 
-template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst, void(*const kernel)(const Float*, T*, std::size_t)) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::packInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.isContiguous<1>(),
@@ -132,8 +625,7 @@ template<class T> inline void packIntoImplementation(const Containers::StridedAr
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::packInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(contiguousKernelInto(src, dst, kernel)) return;
 
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
@@ -157,24 +649,25 @@ template<class T> inline void packIntoImplementation(const Containers::StridedAr
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packUnsignedByte);
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packUnsignedShort);
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packByte);
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packShort);
 }
 
 namespace {
 
-template<class T, class U> inline void castIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst) {
+/* The kernel is null for type combinations that don't have a SIMD variant */
+template<class T, class U> inline void castIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst, void(*const kernel)(const T*, U*, std::size_t) = nullptr) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::castInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.template isContiguous<1>(),
@@ -182,8 +675,7 @@ template<class T, class U> inline void castIntoImplementation(const Containers::
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::castInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(kernel && contiguousKernelInto(src, dst, kernel)) return;
 
     /* Caching values to avoid inline function calls in debug buílds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
@@ -205,19 +697,19 @@ template<class T, class U> inline void castIntoImplementation(const Containers::
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castUnsignedByteToFloat);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castByteToFloat);
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castUnsignedShortToFloat);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castShortToFloat);
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst) {
@@ -225,7 +717,7 @@ void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, cons
 }
 
 void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castIntToFloat);
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Double>& dst) {
@@ -253,19 +745,19 @@ void castInto(const Containers::StridedArrayView2D<const Int>& src, const Contai
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castFloatToUnsignedByte);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castFloatToByte);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castFloatToUnsignedShort);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castFloatToShort);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
@@ -273,7 +765,7 @@ void castInto(const Containers::StridedArrayView2D<const Float>& src, const Cont
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoImplementation(src, dst, kernels().castFloatToInt);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
@@ -477,6 +969,159 @@ static_assert(sizeof(HalfMantissaTable) + sizeof(HalfOffsetTable) + sizeof(HalfE
 static_assert(sizeof(HalfBaseTable) + sizeof(HalfShiftTable) == 1536,
     "improper size of float->half conversion tables");
 
+namespace {
+
+/* Kernels operating on a contiguous range of values, similarly to the ones at
+   the top of the file. The SIMD variants use hardware conversion
+   instructions, but those differ from the table-based implementation in the
+   handling of NaNs and, in case of packing, of values that overflow, so
+   blocks containing such values are processed with the scalar variant. With
+   that, all variants produce bit-identical output. */
+
+void unpackHalfScalar(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    UnsignedInt* const dstBits = reinterpret_cast<UnsignedInt*>(dst);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedShort h = src[i];
+        dstBits[i] = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+    }
+}
+
+void packHalfScalar(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    const UnsignedInt* const srcBits = reinterpret_cast<const UnsignedInt*>(src);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt f = srcBits[i];
+        dst[i] = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+    }
+}
+
+#if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_AVX_F16C)
+CORRADE_ENABLE_AVX_F16C void unpackHalfF16c(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        /* The instruction turns signaling NaNs into quiet NaNs, while the
+           table preserves them. The comparison is signed, which is fine as
+           the sign bit is masked away. */
+        if(_mm_movemask_epi8(_mm_cmpgt_epi16(_mm_and_si128(in, _mm_set1_epi16(0x7fff)), _mm_set1_epi16(0x7c00))))
+            unpackHalfScalar(src + i, dst + i, 8);
+        else
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(in));
+    }
+    unpackHalfScalar(src + i, dst + i, count - i);
+}
+
+CORRADE_ENABLE_AVX_F16C void packHalfF16c(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 overflow = _mm256_set1_ps(65536.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256 in = _mm256_loadu_ps(src + i);
+        /* The table truncates, which matches the round-towards-zero mode
+           except for values that overflow, where it produces an infinity
+           instead of the largest representable value. NaN payloads are
+           treated differently as well. The comparison is unordered, so it's
+           true for NaNs. */
+        if(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(in, absMask), overflow, _CMP_NLT_UQ)))
+            packHalfScalar(src + i, dst + i, 8);
+        else
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(in, _MM_FROUND_TO_ZERO));
+    }
+    packHalfScalar(src + i, dst + i, count - i);
+}
+#endif
+
+/* The FP16 conversion instructions are available in the base instruction set
+   only on AArch64 */
+#if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_ENABLE_NEON void unpackHalfNeon(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const uint16x8_t in = vld1q_u16(src + i);
+        /* See unpackHalfF16c() for why */
+        if(vmaxvq_u16(vcgtq_u16(vandq_u16(in, vdupq_n_u16(0x7fff)), vdupq_n_u16(0x7c00)))) {
+            unpackHalfScalar(src + i, dst + i, 8);
+        } else {
+            const float16x8_t inHalf = vreinterpretq_f16_u16(in);
+            vst1q_f32(dst + i, vcvt_f32_f16(vget_low_f16(inHalf)));
+            vst1q_f32(dst + i + 4, vcvt_high_f32_f16(inHalf));
+        }
+    }
+    unpackHalfScalar(src + i, dst + i, count - i);
+}
+
+CORRADE_ENABLE_NEON void packHalfNeon(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    const float32x4_t overflow = vdupq_n_f32(65536.0f);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const float32x4_t in = vld1q_f32(src + i);
+        const float32x4_t inAbs = vabsq_f32(in);
+        /* See packHalfF16c() for why. The comparison is false for NaNs,
+           which makes the minimum zero. */
+        if(!vminvq_u32(vcltq_f32(inAbs, overflow))) {
+            packHalfScalar(src + i, dst + i, 4);
+        } else {
+            /* There's no round-towards-zero conversion, so convert with the
+               default round-to-nearest and then step one representable
+               value towards zero where the result got rounded up in
+               magnitude. The comparison produces all ones, i.e. -1, in such
+               lanes. */
+            const float16x4_t out = vcvt_f16_f32(in);
+            const uint32x4_t roundedUp = vcgtq_f32(vabsq_f32(vcvt_f32_f16(out)), inAbs);
+            vst1_u16(dst + i, vadd_u16(vreinterpret_u16_f16(out), vmovn_u32(roundedUp)));
+        }
+    }
+    packHalfScalar(src + i, dst + i, count - i);
+}
+#endif
+
+struct HalfKernels {
+    void(*unpackHalf)(const UnsignedShort*, Float*, std::size_t);
+    void(*packHalf)(const Float*, UnsignedShort*, std::size_t);
+};
+
+#ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+/* Only one of these gets used if CORRADE_BUILD_CPU_RUNTIME_DISPATCH isn't
+   enabled, hence the CORRADE_UNUSED */
+CORRADE_UNUSED HalfKernels halfKernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return {unpackHalfScalar, packHalfScalar};
+}
+
+#ifdef CORRADE_ENABLE_AVX_F16C
+CORRADE_UNUSED HalfKernels halfKernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxF16c)) {
+    return {unpackHalfF16c, packHalfF16c};
+}
+#endif
+
+#if defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UNUSED HalfKernels halfKernelsImplementation(CORRADE_CPU_DECLARE(Cpu::Neon)) {
+    return {unpackHalfNeon, packHalfNeon};
+}
+#endif
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#ifdef CORRADE_TARGET_X86
+CORRADE_CPU_DISPATCHER(halfKernelsImplementation, Cpu::AvxF16c)
+#else
+CORRADE_CPU_DISPATCHER_BASE(halfKernelsImplementation)
+#endif
+#endif
+#endif
+
+const HalfKernels& halfKernels() {
+    /* See kernels() above for why it's a function-local static */
+    static const HalfKernels kernels =
+        #ifdef MAGNUM_SINGLES_NO_CPU_DISPATCH
+        HalfKernels{unpackHalfScalar, packHalfScalar};
+        #elif defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH)
+        halfKernelsImplementation(Cpu::runtimeFeatures());
+        #else
+        halfKernelsImplementation(CORRADE_CPU_SELECT(Cpu::Default));
+        #endif
+    return kernels;
+}
+
+}
+
 void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -485,6 +1130,8 @@ void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& s
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackHalfInto(): second destination view dimension is not contiguous", );
 
+    if(contiguousKernelInto(src, dst, halfKernels().unpackHalf)) return;
+
     /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
@@ -512,6 +1159,8 @@ void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::packHalfInto(): second destination view dimension is not contiguous", );
 
+    if(contiguousKernelInto(src, dst, halfKernels().packHalf)) return;
+
     /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
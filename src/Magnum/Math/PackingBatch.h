@@ -78,6 +78,17 @@ Or call the function on the nested dimensions in a loop if not:
 
 @snippet Math.cpp unpackInto-slice-loop
 
+If both @p src and @p dst are contiguous as a whole, or if their rows are at
+least 32 items long, the data are processed with a SIMD-optimized
+implementation. On x86 the AVX2 and SSE2 variants are picked based on
+@relativeref{Corrade,Cpu::runtimeFeatures()} if Corrade is built with
+@ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH enabled and based on
+@relativeref{Corrade,Cpu::DefaultBase} otherwise, on 64-bit ARM a NEON variant
+is used. All variants produce output that's bit-identical to the scalar code
+path used for other views. The same applies to @ref packInto() and to
+@ref castInto() between @relativeref{Magnum,Float} and all integer types
+except for @relativeref{Magnum,UnsignedInt}.
+
 @see @ref packInto(), @ref castInto(),
     @relativeref{Corrade,Containers::StridedArrayView::isContiguous()}
 */
@@ -168,6 +179,13 @@ for various examples of how to pass the arguments.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
 ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+
+If both @p src and @p dst are contiguous as a whole, or if their rows are at
+least 32 items long, the data are processed using the F16C instructions on x86
+if available and using NEON on 64-bit ARM. Values are rounded towards zero and
+values outside of the half-float range become infinity, same as with the table.
+Blocks containing such values or NaNs are processed with the table-based
+implementation to make the output bit-identical to it.
 @see @ref Half
 */
 MAGNUM_EXPORT void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst);
@@ -188,6 +206,12 @@ for various examples of how to pass the arguments.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
 ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+
+If both @p src and @p dst are contiguous as a whole, or if their rows are at
+least 32 items long, the data are processed using the F16C instructions on x86
+if available and using NEON on 64-bit ARM. As the instructions turn signaling
+NaNs into quiet NaNs, blocks containing NaNs are processed with the table-based
+implementation to make the output bit-identical to it.
 @see @ref Half
 */
 MAGNUM_EXPORT void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst);
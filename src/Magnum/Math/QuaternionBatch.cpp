@@ -0,0 +1,309 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "QuaternionBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Items are processed in blocks of this size. Each block is first gathered
+   from the (potentially strided) input into a SoA layout on stack, then
+   processed in loops without branches that can be vectorized, and finally
+   scattered to the output. */
+enum: std::size_t { BlockSize = 64 };
+
+struct QuaternionBlock {
+    Float x[BlockSize];
+    Float y[BlockSize];
+    Float z[BlockSize];
+    Float w[BlockSize];
+};
+
+void gatherBlock(const Containers::StridedArrayView1D<const Quaternion<Float>>& src, const std::size_t offset, const std::size_t count, QuaternionBlock& out) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Quaternion<Float>& q = src[offset + i];
+        out.x[i] = q.vector().x();
+        out.y[i] = q.vector().y();
+        out.z[i] = q.vector().z();
+        out.w[i] = q.scalar();
+    }
+}
+
+void scatterBlock(const QuaternionBlock& src, const std::size_t offset, const std::size_t count, const Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    for(std::size_t i = 0; i != count; ++i)
+        out[offset + i] = Quaternion<Float>{{src.x[i], src.y[i], src.z[i]}, src.w[i]};
+}
+
+/* Same order of operations as in Math::dot(const Quaternion<T>&, const Quaternion<T>&) */
+void dotBlock(const QuaternionBlock& a, const QuaternionBlock& b, Float(&out)[BlockSize], const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        out[i] = a.x[i]*b.x[i] + a.y[i]*b.y[i] + a.z[i]*b.z[i] + a.w[i]*b.w[i];
+}
+
+/* Same order of operations as in Quaternion::normalized() */
+void normalizeBlock(QuaternionBlock& q, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float length = std::sqrt(q.x[i]*q.x[i] + q.y[i]*q.y[i] + q.z[i]*q.z[i] + q.w[i]*q.w[i]);
+        q.x[i] /= length;
+        q.y[i] /= length;
+        q.z[i] /= length;
+        q.w[i] /= length;
+    }
+}
+
+/* Calculates out = (wa*a + wb*b)/divisor, with a and out allowed to be the
+   same */
+void weightedSumBlock(const Float(&wa)[BlockSize], const QuaternionBlock& a, const Float(&wb)[BlockSize], const QuaternionBlock& b, const Float(&divisor)[BlockSize], QuaternionBlock& out, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        out.x[i] = (wa[i]*a.x[i] + wb[i]*b.x[i])/divisor[i];
+        out.y[i] = (wa[i]*a.y[i] + wb[i]*b.y[i])/divisor[i];
+        out.z[i] = (wa[i]*a.z[i] + wb[i]*b.z[i])/divisor[i];
+        out.w[i] = (wa[i]*a.w[i] + wb[i]*b.w[i])/divisor[i];
+    }
+}
+
+/* Checks sizes of all views, gathers the inputs and calls the block function
+   on them, which is expected to write the result to the first block */
+template<class F> void interpolateInto(const char* const name, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out, F block) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == out.size(),
+        "Math::" << Debug::nospace << name << Debug::nospace << "(): expected quaternion, factor and output views to have the same size, got" << normalizedA.size() << Debug::nospace << "," << normalizedB.size() << Debug::nospace << "," << t.size() << "and" << out.size(), );
+    #ifdef CORRADE_NO_DEBUG_ASSERT
+    static_cast<void>(name);
+    #endif
+
+    QuaternionBlock a, b;
+    Float phase[BlockSize];
+    for(std::size_t offset = 0; offset < normalizedA.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(std::size_t(BlockSize), normalizedA.size() - offset);
+        #ifndef CORRADE_NO_DEBUG_ASSERT
+        for(std::size_t i = 0; i != count; ++i) {
+            CORRADE_DEBUG_ASSERT(normalizedA[offset + i].isNormalized() && normalizedB[offset + i].isNormalized(),
+                "Math::" << Debug::nospace << name << Debug::nospace << "(): quaternions" << normalizedA[offset + i] << "and" << normalizedB[offset + i] << "at index" << offset + i << "are not normalized", );
+        }
+        #endif
+        gatherBlock(normalizedA, offset, count, a);
+        gatherBlock(normalizedB, offset, count, b);
+        for(std::size_t i = 0; i != count; ++i)
+            phase[i] = t[offset + i];
+
+        block(a, b, phase, count);
+        scatterBlock(a, offset, count, out);
+    }
+}
+
+/* Same order of operations as in lerp(), with the factors negated for
+   lerpShortestPath(). The sign flip is exact so it gives the same result as
+   negating the quaternion. */
+void lerpBlock(QuaternionBlock& a, const QuaternionBlock& b, const Float(&t)[BlockSize], const Float(&sign)[BlockSize], const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float wa = sign[i]*(1.0f - t[i]);
+        a.x[i] = wa*a.x[i] + t[i]*b.x[i];
+        a.y[i] = wa*a.y[i] + t[i]*b.y[i];
+        a.z[i] = wa*a.z[i] + t[i]*b.z[i];
+        a.w[i] = wa*a.w[i] + t[i]*b.w[i];
+    }
+    normalizeBlock(a, count);
+}
+
+}
+
+void normalizeInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& src, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::normalizeInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    QuaternionBlock q;
+    for(std::size_t offset = 0; offset < src.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(std::size_t(BlockSize), src.size() - offset);
+        gatherBlock(src, offset, count, q);
+        normalizeBlock(q, count);
+        scatterBlock(q, offset, count, dst);
+    }
+}
+
+void normalizeInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& src, const Containers::StridedArrayView1D<DualQuaternion<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::normalizeInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    QuaternionBlock r, d;
+    for(std::size_t offset = 0; offset < src.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(std::size_t(BlockSize), src.size() - offset);
+        for(std::size_t i = 0; i != count; ++i) {
+            const DualQuaternion<Float>& q = src[offset + i];
+            r.x[i] = q.real().vector().x();
+            r.y[i] = q.real().vector().y();
+            r.z[i] = q.real().vector().z();
+            r.w[i] = q.real().scalar();
+            d.x[i] = q.dual().vector().x();
+            d.y[i] = q.dual().vector().y();
+            d.z[i] = q.dual().vector().z();
+            d.w[i] = q.dual().scalar();
+        }
+
+        /* Same order of operations as in DualQuaternion::normalized(), i.e.
+           dividing by a dual length calculated from lengthSquared() */
+        for(std::size_t i = 0; i != count; ++i) {
+            const Float lengthSquaredReal = r.x[i]*r.x[i] + r.y[i]*r.y[i] + r.z[i]*r.z[i] + r.w[i]*r.w[i];
+            const Float lengthSquaredDual = 2.0f*(r.x[i]*d.x[i] + r.y[i]*d.y[i] + r.z[i]*d.z[i] + r.w[i]*d.w[i]);
+            const Float lengthReal = std::sqrt(lengthSquaredReal);
+            const Float lengthDual = lengthSquaredDual/(2*lengthReal);
+            const Float lengthRealSquared = lengthReal*lengthReal;
+            d.x[i] = (d.x[i]*lengthReal - r.x[i]*lengthDual)/lengthRealSquared;
+            d.y[i] = (d.y[i]*lengthReal - r.y[i]*lengthDual)/lengthRealSquared;
+            d.z[i] = (d.z[i]*lengthReal - r.z[i]*lengthDual)/lengthRealSquared;
+            d.w[i] = (d.w[i]*lengthReal - r.w[i]*lengthDual)/lengthRealSquared;
+            r.x[i] /= lengthReal;
+            r.y[i] /= lengthReal;
+            r.z[i] /= lengthReal;
+            r.w[i] /= lengthReal;
+        }
+
+        for(std::size_t i = 0; i != count; ++i)
+            dst[offset + i] = DualQuaternion<Float>{
+                {{r.x[i], r.y[i], r.z[i]}, r.w[i]},
+                {{d.x[i], d.y[i], d.z[i]}, d.w[i]}};
+    }
+}
+
+void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    interpolateInto("lerpInto", normalizedA, normalizedB, t, out, [](QuaternionBlock& a, const QuaternionBlock& b, const Float(&phase)[BlockSize], const std::size_t count) {
+        Float sign[BlockSize];
+        for(std::size_t i = 0; i != count; ++i)
+            sign[i] = 1.0f;
+        lerpBlock(a, b, phase, sign, count);
+    });
+}
+
+void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    interpolateInto("lerpShortestPathInto", normalizedA, normalizedB, t, out, [](QuaternionBlock& a, const QuaternionBlock& b, const Float(&phase)[BlockSize], const std::size_t count) {
+        Float sign[BlockSize];
+        dotBlock(a, b, sign, count);
+        for(std::size_t i = 0; i != count; ++i)
+            sign[i] = sign[i] < 0.0f ? -1.0f : 1.0f;
+        lerpBlock(a, b, phase, sign, count);
+    });
+}
+
+void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    interpolateInto("slerpInto", normalizedA, normalizedB, t, out, [](QuaternionBlock& a, const QuaternionBlock& b, const Float(&phase)[BlockSize], const std::size_t count) {
+        Float cosHalfAngle[BlockSize];
+        dotBlock(a, b, cosHalfAngle, count);
+
+        /* Calculate the weights in the same way as slerp(), including the
+           linear interpolation fallback for nearly the same quaternions. The
+           fallback isn't normalized and has the divisor set to 1, which is
+           exact. */
+        Float wa[BlockSize], wb[BlockSize], divisor[BlockSize];
+        for(std::size_t i = 0; i != count; ++i) {
+            if(std::abs(cosHalfAngle[i]) > 1.0f - 0.5f*TypeTraits<Float>::epsilon()) {
+                wa[i] = cosHalfAngle[i] < 0 ? -(1.0f - phase[i]) : 1.0f - phase[i];
+                wb[i] = phase[i];
+                divisor[i] = 1.0f;
+            } else {
+                const Float angle = std::acos(cosHalfAngle[i]);
+                wa[i] = std::sin((1.0f - phase[i])*angle);
+                wb[i] = std::sin(phase[i]*angle);
+                divisor[i] = std::sin(angle);
+            }
+        }
+
+        weightedSumBlock(wa, a, wb, b, divisor, a, count);
+    });
+}
+
+void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    interpolateInto("slerpShortestPathInto", normalizedA, normalizedB, t, out, [](QuaternionBlock& a, const QuaternionBlock& b, const Float(&phase)[BlockSize], const std::size_t count) {
+        Float cosHalfAngle[BlockSize];
+        dotBlock(a, b, cosHalfAngle, count);
+
+        /* Same as in slerpInto() above, except for the threshold and the
+           shortest path handling matching slerpShortestPath() */
+        Float wa[BlockSize], wb[BlockSize], divisor[BlockSize];
+        for(std::size_t i = 0; i != count; ++i) {
+            const Float sign = cosHalfAngle[i] < 0 ? -1.0f : 1.0f;
+            if(std::abs(cosHalfAngle[i]) >= 1.0f - TypeTraits<Float>::epsilon()) {
+                wa[i] = sign*(1.0f - phase[i]);
+                wb[i] = phase[i];
+                divisor[i] = 1.0f;
+            } else {
+                const Float angle = std::acos(std::abs(cosHalfAngle[i]));
+                wa[i] = sign*std::sin((1.0f - phase[i])*angle);
+                wb[i] = std::sin(phase[i]*angle);
+                divisor[i] = std::sin(angle);
+            }
+        }
+
+        weightedSumBlock(wa, a, wb, b, divisor, a, count);
+    });
+}
+
+void slerpShortestPathFastInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    interpolateInto("slerpShortestPathFastInto", normalizedA, normalizedB, t, out, [](QuaternionBlock& a, const QuaternionBlock& b, const Float(&phase)[BlockSize], const std::size_t count) {
+        Float sign[BlockSize];
+        dotBlock(a, b, sign, count);
+
+        /* Adjust the phase to approximate the constant angular velocity of a
+           slerp. The polynomial coefficients are a least-squares fit of the
+           correction depending on the angle between the quaternions, from
+           https://zeux.io/2015/07/23/approximating-slerp/ */
+        Float adjusted[BlockSize];
+        for(std::size_t i = 0; i != count; ++i) {
+            const Float d = std::abs(sign[i]);
+            const Float ka = 1.0904f + d*(-3.2452f + d*(3.55645f - d*1.43519f));
+            const Float kb = 0.848013f + d*(-1.06021f + d*0.215638f);
+            const Float tc = phase[i] - 0.5f;
+            const Float k = ka*tc*tc + kb;
+            adjusted[i] = phase[i] + phase[i]*tc*(phase[i] - 1.0f)*k;
+            sign[i] = sign[i] < 0.0f ? -1.0f : 1.0f;
+        }
+
+        lerpBlock(a, b, adjusted, sign, count);
+    });
+}
+
+void sclerpInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<DualQuaternion<Float>>& out) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == out.size(),
+        "Math::sclerpInto(): expected dual quaternion, factor and output views to have the same size, got" << normalizedA.size() << Debug::nospace << "," << normalizedB.size() << Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        out[i] = sclerp(normalizedA[i], normalizedB[i], t[i]);
+}
+
+void sclerpShortestPathInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<DualQuaternion<Float>>& out) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == out.size(),
+        "Math::sclerpShortestPathInto(): expected dual quaternion, factor and output views to have the same size, got" << normalizedA.size() << Debug::nospace << "," << normalizedB.size() << Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    for(std::size_t i = 0; i != normalizedA.size(); ++i)
+        out[i] = sclerpShortestPath(normalizedA[i], normalizedB[i], t[i]);
+}
+
+}}
@@ -0,0 +1,207 @@
+#ifndef Magnum_Math_QuaternionBatch_h
+#define Magnum_Math_QuaternionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::normalizeInto(), @ref Magnum::Math::lerpInto(), @ref Magnum::Math::lerpShortestPathInto(), @ref Magnum::Math::slerpInto(), @ref Magnum::Math::slerpShortestPathInto(), @ref Magnum::Math::slerpShortestPathFastInto(), @ref Magnum::Math::sclerpInto(), @ref Magnum::Math::sclerpShortestPathInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch quaternion functions
+
+These functions process an unbounded range of quaternions or dual quaternions,
+as opposed to single values. The items are processed in blocks, each first
+gathered from the (potentially strided) input into a SoA layout on stack and
+then processed in loops without branches that can be vectorized by the
+compiler.
+
+The interpolation functions take a separate interpolation phase for each item.
+If the same phase is used for all items, pass a zero-stride view, for example
+with @cpp Containers::stridedArrayView(&t, 1).broadcasted<0>(size) @ce.
+*/
+
+/**
+@brief Normalize a list of quaternions
+@param[in]  src     Source quaternions
+@param[out] dst     Destination quaternions
+@m_since_latest
+
+Batch variant of @ref Quaternion::normalized(), giving the same result as
+calling it for each item. Expects that @p src and @p dst have the same size.
+The views are allowed to point to the same memory for an in-place operation.
+*/
+MAGNUM_EXPORT void normalizeInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& src, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+@brief Normalize a list of dual quaternions
+@param[in]  src     Source dual quaternions
+@param[out] dst     Destination dual quaternions
+@m_since_latest
+
+Batch variant of @ref DualQuaternion::normalized(), giving the same result as
+calling it for each item. Expects that @p src and @p dst have the same size.
+The views are allowed to point to the same memory for an in-place operation.
+*/
+MAGNUM_EXPORT void normalizeInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& src, const Containers::StridedArrayView1D<DualQuaternion<Float>>& dst);
+
+/**
+@brief Linear interpolation of a list of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref lerp(const Quaternion<T>&, const Quaternion<T>&, T),
+giving the same result as calling it for each item. Expects that all views
+have the same size and that all quaternions are normalized.
+@see @ref lerpShortestPathInto(), @ref slerpShortestPathFastInto()
+*/
+MAGNUM_EXPORT void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Linear shortest-path interpolation of a list of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T),
+giving the same result as calling it for each item. Expects that all views
+have the same size and that all quaternions are normalized.
+@see @ref lerpInto(), @ref slerpShortestPathFastInto()
+*/
+MAGNUM_EXPORT void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Spherical linear interpolation of a list of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref slerp(const Quaternion<T>&, const Quaternion<T>&, T),
+giving the same result as calling it for each item. Expects that all views
+have the same size and that all quaternions are normalized.
+
+Only the dot products and the final weighted sums are vectorized, the
+@f$ \arccos @f$ and @f$ \sin @f$ calculation is done with the standard library
+functions for each item. If exact results aren't needed, use
+@ref slerpShortestPathFastInto() instead.
+@see @ref slerpShortestPathInto(), @ref lerpInto()
+*/
+MAGNUM_EXPORT void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Spherical linear shortest-path interpolation of a list of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T),
+giving the same result as calling it for each item. Expects that all views
+have the same size and that all quaternions are normalized. See
+@ref slerpInto() for details about the implementation.
+@see @ref slerpShortestPathFastInto(), @ref lerpShortestPathInto()
+*/
+MAGNUM_EXPORT void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Fast approximation of spherical linear shortest-path interpolation of a list of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Approximates @ref slerpShortestPathInto() with a normalized linear
+interpolation, with the interpolation phase adjusted by a polynomial in
+@f$ t @f$ and @f$ |q_A \cdot q_B| @f$ to compensate for the non-constant
+angular velocity of a linear interpolation. The result is always normalized
+and has a maximum error of about @f$ 5 \cdot 10^{-4} @f$ in each component
+compared to @ref slerpShortestPathInto(). Unlike the exact variant, there are
+no trigonometric functions involved, which allows the whole calculation to be
+vectorized.
+
+Expects that all views have the same size and that all quaternions are
+normalized.
+@see @ref lerpShortestPathInto()
+*/
+MAGNUM_EXPORT void slerpShortestPathFastInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Screw linear interpolation of a list of dual quaternion pairs
+@param[in]  normalizedA First dual quaternions
+@param[in]  normalizedB Second dual quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref sclerp(), giving the same result as calling it for each
+item. Expects that all views have the same size and that all dual quaternions
+are normalized. The interpolation has too many special cases to benefit from
+vectorization, so this function is merely a convenience loop.
+@see @ref sclerpShortestPathInto()
+*/
+MAGNUM_EXPORT void sclerpInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<DualQuaternion<Float>>& out);
+
+/**
+@brief Screw linear shortest-path interpolation of a list of dual quaternion pairs
+@param[in]  normalizedA First dual quaternions
+@param[in]  normalizedB Second dual quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] out         Where to put the results
+@m_since_latest
+
+Batch variant of @ref sclerpShortestPath(), giving the same result as calling
+it for each item. Expects that all views have the same size and that all dual
+quaternions are normalized. See @ref sclerpInto() for details about the
+implementation.
+*/
+MAGNUM_EXPORT void sclerpShortestPathInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<DualQuaternion<Float>>& out);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -0,0 +1,162 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Jonathan Hale <squareys@googlemail.com>
+    Copyright © 2020 janos <janos.meny@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <random>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Bvh.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+/* A scene of 100k small boxes with random rays going through it, queried by
+   brute force testing each ray against each box, and through a Bvh */
+
+struct BvhBenchmark: TestSuite::Tester {
+    explicit BvhBenchmark();
+
+    void construct();
+
+    void nearestHitsBruteForce();
+    void nearestHits();
+    void allHits();
+
+    private:
+        Containers::Array<Range3D<Float>> _ranges;
+        Containers::Array<Vector3<Float>> _rayOrigins;
+        Containers::Array<Vector3<Float>> _rayDirections;
+};
+
+enum: std::size_t {
+    ItemCount = 100000,
+    RayCount = 1000
+};
+
+BvhBenchmark::BvhBenchmark() {
+    addBenchmarks({&BvhBenchmark::construct,
+
+                   &BvhBenchmark::nearestHitsBruteForce}, 1);
+
+    addBenchmarks({&BvhBenchmark::nearestHits,
+                   &BvhBenchmark::allHits}, 10);
+
+    /* Generate random data for the benchmarks */
+    std::random_device rnd;
+    std::mt19937 g(rnd());
+    /* Position distribution */
+    std::uniform_real_distribution<float> pd(-100.0f, 100.0f);
+    /* Size distribution */
+    std::uniform_real_distribution<float> sd(0.1f, 2.0f);
+
+    _ranges = Containers::Array<Range3D<Float>>{NoInit, ItemCount};
+    for(Range3D<Float>& range: _ranges)
+        range = Range3D<Float>::fromSize({pd(g), pd(g), pd(g)}, {sd(g), sd(g), sd(g)});
+
+    /* Rays start at random points inside the scene and go in random
+       directions */
+    _rayOrigins = Containers::Array<Vector3<Float>>{NoInit, RayCount};
+    _rayDirections = Containers::Array<Vector3<Float>>{NoInit, RayCount};
+    for(std::size_t i = 0; i != RayCount; ++i) {
+        _rayOrigins[i] = {pd(g), pd(g), pd(g)};
+        _rayDirections[i] = Vector3<Float>{pd(g), pd(g), pd(g)}.normalized();
+    }
+}
+
+void BvhBenchmark::construct() {
+    std::size_t nodeCount = 0;
+    CORRADE_BENCHMARK(1) {
+        Bvh bvh{_ranges};
+        nodeCount += bvh.nodeCount();
+    }
+
+    CORRADE_VERIFY(nodeCount);
+}
+
+void BvhBenchmark::nearestHitsBruteForce() {
+    Containers::Array<UnsignedInt> ids{NoInit, RayCount};
+    Containers::Array<Float> distances{NoInit, RayCount};
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != RayCount; ++i) {
+        const Vector3<Float> origin = _rayOrigins[i];
+        const Vector3<Float> inverseDirection = 1.0f/_rayDirections[i];
+        UnsignedInt nearestId = ~UnsignedInt{};
+        Float nearest = Constants<Float>::inf();
+        for(std::size_t j = 0; j != ItemCount; ++j) {
+            const Vector3<Float> t0 = (_ranges[j].min() - origin)*inverseDirection;
+            const Vector3<Float> t1 = (_ranges[j].max() - origin)*inverseDirection;
+            const Float entryDistance = Math::max(Math::min(t0, t1).max(), 0.0f);
+            if(entryDistance <= Math::max(t0, t1).min() && entryDistance < nearest) {
+                nearest = entryDistance;
+                nearestId = UnsignedInt(j);
+            }
+        }
+        ids[i] = nearestId;
+        distances[i] = nearest;
+    }
+
+    /* Verify the output is consistent with the Bvh */
+    Bvh bvh{_ranges};
+    Containers::Array<UnsignedInt> bvhIds{NoInit, RayCount};
+    Containers::Array<Float> bvhDistances{NoInit, RayCount};
+    bvh.nearestHitsInto(_rayOrigins, _rayDirections, bvhIds, bvhDistances);
+    for(std::size_t i = 0; i != RayCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(bvhDistances[i], distances[i]);
+    }
+}
+
+void BvhBenchmark::nearestHits() {
+    Bvh bvh{_ranges};
+    Containers::Array<UnsignedInt> ids{NoInit, RayCount};
+    Containers::Array<Float> distances{NoInit, RayCount};
+    CORRADE_BENCHMARK(10)
+        bvh.nearestHitsInto(_rayOrigins, _rayDirections, ids, distances);
+
+    /* Make sure the benchmark isn't testing something trivial */
+    std::size_t hitCount = 0;
+    for(UnsignedInt id: ids) if(id != ~UnsignedInt{}) ++hitCount;
+    CORRADE_VERIFY(hitCount);
+}
+
+void BvhBenchmark::allHits() {
+    Bvh bvh{_ranges};
+    std::size_t hitCount = 0;
+    CORRADE_BENCHMARK(10)
+        hitCount += bvh.allHits(_rayOrigins, _rayDirections).second().size();
+
+    CORRADE_VERIFY(hitCount);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BvhBenchmark)
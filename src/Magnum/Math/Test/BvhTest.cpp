@@ -0,0 +1,390 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Jonathan Hale <squareys@googlemail.com>
+    Copyright © 2020 janos <janos.meny@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm> /* std::sort() */
+#include <type_traits>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Bvh.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct BvhTest: TestSuite::Tester {
+    explicit BvhTest();
+
+    void construct();
+    void constructEmpty();
+    void constructSameCentroids();
+    void constructMove();
+
+    void nearestHits();
+    void nearestHitsOriginInside();
+    void nearestHitsEmpty();
+    void allHits();
+    void allHitsEmpty();
+
+    void consistentWithBruteForce();
+
+    void assertions();
+};
+
+using Magnum::Range3D;
+using Magnum::Vector3;
+
+const struct {
+    const char* name;
+    UnsignedInt maxLeafSize;
+} ConsistentWithBruteForceData[]{
+    {"leaf size 1", 1},
+    {"leaf size 4", 4},
+    {"leaf size 16", 16},
+};
+
+BvhTest::BvhTest() {
+    addTests({&BvhTest::construct,
+              &BvhTest::constructEmpty,
+              &BvhTest::constructSameCentroids,
+              &BvhTest::constructMove,
+
+              &BvhTest::nearestHits,
+              &BvhTest::nearestHitsOriginInside,
+              &BvhTest::nearestHitsEmpty,
+              &BvhTest::allHits,
+              &BvhTest::allHitsEmpty});
+
+    addInstancedTests({&BvhTest::consistentWithBruteForce},
+        Containers::arraySize(ConsistentWithBruteForceData));
+
+    addTests({&BvhTest::assertions});
+}
+
+/* Unit cubes along the X axis, at 0, 2, 4 ... 14 */
+const Range3D Cubes[]{
+    Range3D::fromSize({0.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({2.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({4.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({6.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({8.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({10.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({12.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+    Range3D::fromSize({14.0f, 0.0f, 0.0f}, Vector3{1.0f}),
+};
+
+void BvhTest::construct() {
+    Bvh bvh{Cubes, 2};
+    CORRADE_COMPARE(bvh.size(), 8);
+    /* Eight items with at most two in a leaf, there should be at least four
+       leaves and thus at least seven nodes */
+    CORRADE_COMPARE_AS(bvh.nodeCount(), 7, TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(bvh.nodeCount() % 2, 1);
+    CORRADE_COMPARE_AS(bvh.depth(), 3, TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{0.0f, 0.0f, 0.0f}, {15.0f, 1.0f, 1.0f}}));
+}
+
+void BvhTest::constructEmpty() {
+    Bvh bvh{nullptr};
+    CORRADE_COMPARE(bvh.size(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(bvh.depth(), 0);
+    CORRADE_COMPARE(bvh.bounds(), Range3D{});
+}
+
+void BvhTest::constructSameCentroids() {
+    /* All centroids are the same so no SAH split can be made, it should
+       fall back to splitting in half */
+    const Range3D ranges[]{
+        {Vector3{-1.0f}, Vector3{1.0f}},
+        {Vector3{-2.0f}, Vector3{2.0f}},
+        {Vector3{-3.0f}, Vector3{3.0f}},
+        {Vector3{-4.0f}, Vector3{4.0f}},
+        {Vector3{-5.0f}, Vector3{5.0f}},
+    };
+
+    Bvh bvh{ranges, 1};
+    CORRADE_COMPARE(bvh.size(), 5);
+    CORRADE_COMPARE(bvh.nodeCount(), 9);
+    CORRADE_COMPARE(bvh.depth(), 4);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{Vector3{-5.0f}, Vector3{5.0f}}));
+
+    /* A ray from the outside should hit the biggest one first */
+    UnsignedInt id;
+    Float distance;
+    bvh.nearestHitsInto(
+        Containers::stridedArrayView({Vector3{-10.0f, 0.0f, 0.0f}}),
+        Containers::stridedArrayView({Vector3{1.0f, 0.0f, 0.0f}}),
+        Containers::arrayView(&id, 1),
+        Containers::arrayView(&distance, 1));
+    CORRADE_COMPARE(id, 4);
+    CORRADE_COMPARE(distance, 5.0f);
+}
+
+void BvhTest::constructMove() {
+    Bvh a{Cubes};
+    const std::size_t nodeCount = a.nodeCount();
+
+    Bvh b = Utility::move(a);
+    CORRADE_COMPARE(b.size(), 8);
+    CORRADE_COMPARE(b.nodeCount(), nodeCount);
+    CORRADE_COMPARE(b.bounds(), (Range3D{{0.0f, 0.0f, 0.0f}, {15.0f, 1.0f, 1.0f}}));
+
+    Bvh c{nullptr};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 8);
+    CORRADE_COMPARE(c.nodeCount(), nodeCount);
+    CORRADE_COMPARE(b.size(), 0);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<Bvh>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<Bvh>::value);
+}
+
+void BvhTest::nearestHits() {
+    Bvh bvh{Cubes, 1};
+
+    const Vector3 origins[]{
+        /* From the left, hits the first cube */
+        {-5.0f, 0.5f, 0.5f},
+        /* From the right, hits the last cube */
+        {20.0f, 0.5f, 0.5f},
+        /* From above, between cubes 2 and 3, misses */
+        {5.5f, 10.0f, 0.5f},
+        /* From above, hits cube 3 */
+        {6.5f, 10.0f, 0.5f},
+        /* From the left, but in the opposite direction, misses */
+        {-5.0f, 0.5f, 0.5f},
+    };
+    /* Non-normalized directions, the distance is in multiples of their
+       length */
+    const Vector3 directions[]{
+        {1.0f, 0.0f, 0.0f},
+        {-2.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, -0.5f, 0.0f},
+        {-1.0f, 0.0f, 0.0f},
+    };
+
+    UnsignedInt ids[5];
+    Float distances[5];
+    bvh.nearestHitsInto(origins, directions, ids, distances);
+    CORRADE_COMPARE_AS(Containers::arrayView(ids), Containers::arrayView<UnsignedInt>({
+        0, 7, 0xffffffffu, 3, 0xffffffffu
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(distances), Containers::arrayView<Float>({
+        5.0f, 2.5f, Constants<Float>::inf(), 18.0f, Constants<Float>::inf()
+    }), TestSuite::Compare::Container);
+}
+
+void BvhTest::nearestHitsOriginInside() {
+    Bvh bvh{Cubes, 1};
+
+    /* Origin inside the cube 2, pointing right. The distance should be zero
+       and the cube behind shouldn't be considered. */
+    UnsignedInt id;
+    Float distance;
+    bvh.nearestHitsInto(
+        Containers::stridedArrayView({Vector3{4.5f, 0.5f, 0.5f}}),
+        Containers::stridedArrayView({Vector3{1.0f, 0.0f, 0.0f}}),
+        Containers::arrayView(&id, 1),
+        Containers::arrayView(&distance, 1));
+    CORRADE_COMPARE(id, 2);
+    CORRADE_COMPARE(distance, 0.0f);
+}
+
+void BvhTest::nearestHitsEmpty() {
+    Bvh bvh{nullptr};
+
+    UnsignedInt id;
+    Float distance;
+    bvh.nearestHitsInto(
+        Containers::stridedArrayView({Vector3{0.0f}}),
+        Containers::stridedArrayView({Vector3{1.0f, 0.0f, 0.0f}}),
+        Containers::arrayView(&id, 1),
+        Containers::arrayView(&distance, 1));
+    CORRADE_COMPARE(id, 0xffffffffu);
+    CORRADE_COMPARE(distance, Constants<Float>::inf());
+}
+
+void BvhTest::allHits() {
+    Bvh bvh{Cubes, 2};
+
+    const Vector3 origins[]{
+        /* From the right, hits all cubes */
+        {20.0f, 0.5f, 0.5f},
+        /* From above, misses */
+        {5.5f, 10.0f, 0.5f},
+        /* From inside the cube 5 to the left */
+        {10.5f, 0.5f, 0.5f},
+    };
+    const Vector3 directions[]{
+        {-1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f},
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> out = bvh.allHits(origins, directions);
+    CORRADE_COMPARE_AS(out.first(), Containers::arrayView<UnsignedInt>({
+        0, 8, 8, 14
+    }), TestSuite::Compare::Container);
+    /* Sorted by distance */
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView<UnsignedInt>({
+        7, 6, 5, 4, 3, 2, 1, 0,
+        5, 4, 3, 2, 1, 0
+    }), TestSuite::Compare::Container);
+}
+
+void BvhTest::allHitsEmpty() {
+    Bvh bvh{nullptr};
+
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> out = bvh.allHits(
+        Containers::stridedArrayView({Vector3{0.0f}, Vector3{1.0f}}),
+        Containers::stridedArrayView({Vector3{1.0f, 0.0f, 0.0f}, Vector3{0.0f, 1.0f, 0.0f}}));
+    CORRADE_COMPARE_AS(out.first(), Containers::arrayView<UnsignedInt>({
+        0, 0, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.second().size(), 0);
+}
+
+/* Same calculation as done internally, to have the distances bit-exact */
+Float rayEntry(const Range3D& range, const Vector3& origin, const Vector3& inverseDirection) {
+    const Vector3 t0 = (range.min() - origin)*inverseDirection;
+    const Vector3 t1 = (range.max() - origin)*inverseDirection;
+    const Float entryDistance = Math::max(Math::min(t0, t1).max(), 0.0f);
+    const Float exitDistance = Math::max(t0, t1).min();
+    return entryDistance <= exitDistance ? entryDistance : Constants<Float>::inf();
+}
+
+void BvhTest::consistentWithBruteForce() {
+    auto&& data = ConsistentWithBruteForceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A bunch of boxes of varying sizes in a 40x40x40 cube and rays going
+       through it from the outside in various directions */
+    Range3D ranges[503];
+    for(std::size_t i = 0; i != Containers::arraySize(ranges); ++i) {
+        const Vector3 center = Vector3{Float(i*7919 % 401), Float(i*6007 % 397), Float(i*4001 % 389)}/10.0f - Vector3{20.0f};
+        const Vector3 extents = Vector3{Float(i % 7 + 1), Float(i % 5 + 1), Float(i % 3 + 1)}*0.5f;
+        ranges[i] = Range3D::fromCenter(center, extents);
+    }
+
+    Vector3 origins[101];
+    Vector3 directions[101];
+    for(std::size_t i = 0; i != Containers::arraySize(origins); ++i) {
+        origins[i] = Vector3{Float(i*31 % 17) - 8.0f, Float(i*17 % 13) - 6.0f, 30.0f + Float(i % 3)};
+        directions[i] = Vector3{Float(i*13 % 11) - 5.0f, Float(i*7 % 9) - 4.0f, -20.0f};
+    }
+
+    Bvh bvh{ranges, data.maxLeafSize};
+    CORRADE_COMPARE(bvh.size(), Containers::arraySize(ranges));
+
+    UnsignedInt ids[Containers::arraySize(origins)];
+    Float distances[Containers::arraySize(origins)];
+    bvh.nearestHitsInto(origins, directions, ids, distances);
+
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<UnsignedInt>> all = bvh.allHits(origins, directions);
+    CORRADE_COMPARE(all.first().size(), Containers::arraySize(origins) + 1);
+
+    std::size_t hitCount = 0;
+    for(std::size_t i = 0; i != Containers::arraySize(origins); ++i) {
+        CORRADE_ITERATION(i);
+
+        const Vector3 inverseDirection = 1.0f/directions[i];
+        UnsignedInt expectedId = 0xffffffffu;
+        Float expectedDistance = Constants<Float>::inf();
+        Containers::Array<UnsignedInt> expectedAll;
+        for(UnsignedInt j = 0; j != Containers::arraySize(ranges); ++j) {
+            const Float distance = rayEntry(ranges[j], origins[i], inverseDirection);
+            if(distance == Constants<Float>::inf()) continue;
+            arrayAppend(expectedAll, j);
+            if(distance < expectedDistance) {
+                expectedDistance = distance;
+                expectedId = j;
+            }
+        }
+
+        /* The nearest distance has to match exactly. The ID might differ only
+           if there are two items entered at the same distance. */
+        CORRADE_COMPARE(distances[i], expectedDistance);
+        if(ids[i] != expectedId)
+            CORRADE_COMPARE(rayEntry(ranges[ids[i]], origins[i], inverseDirection), expectedDistance);
+
+        /* All hits should be the same set of items, sorted by distance */
+        Containers::ArrayView<const UnsignedInt> hits = all.second().slice(all.first()[i], all.first()[i + 1]);
+        CORRADE_COMPARE(hits.size(), expectedAll.size());
+        for(std::size_t j = 1; j < hits.size(); ++j)
+            CORRADE_COMPARE_AS(rayEntry(ranges[hits[j - 1]], origins[i], inverseDirection),
+                rayEntry(ranges[hits[j]], origins[i], inverseDirection),
+                TestSuite::Compare::LessOrEqual);
+        Containers::Array<UnsignedInt> sortedHits{NoInit, hits.size()};
+        Utility::copy(hits, sortedHits);
+        std::sort(sortedHits.begin(), sortedHits.end());
+        CORRADE_COMPARE_AS(sortedHits, expectedAll, TestSuite::Compare::Container);
+        if(!hits.isEmpty())
+            CORRADE_COMPARE(rayEntry(ranges[hits[0]], origins[i], inverseDirection), distances[i]);
+
+        hitCount += hits.size();
+    }
+
+    /* Make sure the test isn't testing something trivial */
+    CORRADE_COMPARE_AS(hitCount, Containers::arraySize(origins), TestSuite::Compare::Greater);
+}
+
+void BvhTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Range3D ranges[3];
+    const Vector3 origins[3];
+    const Vector3 directions[2];
+    UnsignedInt ids[3];
+    Float distances[4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    Bvh{ranges, 0};
+    Bvh bvh{ranges};
+    bvh.nearestHitsInto(origins, directions, ids, Containers::arrayView(distances).prefix(3));
+    bvh.nearestHitsInto(origins, origins, ids, distances);
+    bvh.allHits(origins, directions);
+    CORRADE_COMPARE(out,
+        "Math::Bvh: max leaf size expected to be non-zero\n"
+        "Math::Bvh::nearestHitsInto(): expected ray origin, direction, ID and distance views to have the same size, got 3, 2, 3 and 3\n"
+        "Math::Bvh::nearestHitsInto(): expected ray origin, direction, ID and distance views to have the same size, got 3, 3, 3 and 4\n"
+        "Math::Bvh::allHits(): expected ray origin and direction views to have the same size, got 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BvhTest)
@@ -24,9 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring> /* std::memcpy() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -36,8 +40,8 @@
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Math/ColorBatch.h"
-#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -54,6 +58,19 @@ struct ColorBatchTest: TestSuite::Tester {
 
     void yFlipInvalidLastDimension();
 
+    void yFlipSingleBlock();
+    void yFlipInexact();
+    void yFlipInexactInvalidSize();
+
+    void fromSrgbUnsignedByte();
+    void fromSrgbFloat();
+    void toSrgbUnsignedByte();
+    void toSrgbFloat();
+    void srgbChannelCount();
+    void srgbStrided();
+    void srgbNan();
+    void srgbInvalidSize();
+
     PluginManager::Manager<Trade::AbstractImageConverter> _converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
     PluginManager::Manager<Trade::AbstractImporter> _importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
 };
@@ -285,13 +302,225 @@ const struct {
     }}},
 };
 
+const struct {
+    const char* name;
+    std::size_t(*function)(const Containers::StridedArrayView4D<char>&);
+    std::size_t blockSize;
+    Containers::Array<char> input;
+    Containers::Array<char> expected;
+    bool lossless;
+} YFlipSingleBlockData[]{
+    {"BC6H, mode 11", yFlipBc6hInPlace, 16, {InPlaceInit, {
+        '\xa3', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, {InPlaceInit, {
+        /* The new anchor has the most significant bit set, so the endpoints
+           get swapped and the indices inverted */
+        '\x83', '\x16', '\xe3', '\xb0', '\x6c', '\x5e', '\xbf', '\x08',
+        '\xbb', '\x8b', '\x3e', '\xf3', '\x71', '\x97', '\x2d', '\xe6'
+    }}, true},
+    {"BC6H, mode 11, no endpoint swap", yFlipBc6hInPlace, 16, {InPlaceInit, {
+        '\x63', '\xa4', '\xb3', '\x2e', '\xf7', '\x99', '\xfb', '\x29',
+        '\x7a', '\xb4', '\xca', '\x66', '\x14', '\xbb', '\x52', '\x99'
+    }}, {InPlaceInit, {
+        /* Only the indices change */
+        '\x63', '\xa4', '\xb3', '\x2e', '\xf7', '\x99', '\xfb', '\x29',
+        '\x54', '\x99', '\x14', '\xbb', '\xca', '\x66', '\x75', '\xb4'
+    }}, true},
+    {"BC6H, reserved mode", yFlipBc6hInPlace, 16, {InPlaceInit, {
+        '\xb3', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, {InPlaceInit, {
+        /* Decodes to zeros, so it's kept as-is */
+        '\xb3', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, true},
+    {"BC6H, mode 1", yFlipBc6hInPlace, 16, {InPlaceInit, {
+        '\xa0', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, {InPlaceInit, {
+        /* Two regions, left untouched */
+        '\xa0', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, false},
+    {"BC6H, mode 12", yFlipBc6hInPlace, 16, {InPlaceInit, {
+        '\xa7', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, {InPlaceInit, {
+        /* Delta-encoded endpoints, left untouched */
+        '\xa7', '\x79', '\xfd', '\x22', '\xa4', '\xc5', '\x38', '\x2c',
+        '\xd5', '\x19', '\x8e', '\x68', '\xc1', '\x0c', '\x4a', '\x74'
+    }}, false},
+    {"BC7, mode 4", yFlipBc7InPlace, 16, {InPlaceInit, {
+        '\x90', '\xae', '\x4b', '\x0c', '\x86', '\x98', '\x87', '\x83',
+        '\xeb', '\x02', '\x6c', '\x54', '\xa6', '\xe9', '\xd3', '\x62'
+    }}, {InPlaceInit, {
+        /* The new anchor has the most significant bit set, so the endpoints
+           get swapped and the indices inverted */
+        '\x90', '\xdd', '\x61', '\x39', '\x80', '\x98', '\x07', '\xea',
+        '\x82', '\x83', '\xd5', '\x69', '\xc1', '\x9a', '\x55', '\xb9'
+    }}, true},
+    {"BC7, mode 5", yFlipBc7InPlace, 16, {InPlaceInit, {
+        '\xe0', '\x96', '\xa3', '\xf2', '\xc8', '\x5f', '\x98', '\x8c',
+        '\xa9', '\x99', '\xc5', '\xfc', '\x9c', '\x17', '\x73', '\x43'
+    }}, {InPlaceInit, {
+        '\xe0', '\x47', '\xcb', '\x51', '\xb9', '\xe0', '\x8f', '\x99',
+        '\x04', '\x3b', '\x67', '\x56', '\xbc', '\x8c', '\xe8', '\x63'
+    }}, true},
+    {"BC7, mode 6", yFlipBc7InPlace, 16, {InPlaceInit, {
+        '\x40', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    }}, {InPlaceInit, {
+        '\xc0', '\x1c', '\xa7', '\xfa', '\x15', '\xfb', '\x08', '\x9c',
+        '\x87', '\x1a', '\xa4', '\x40', '\x35', '\xeb', '\x3a', '\x46'
+    }}, true},
+    {"BC7, reserved mode", yFlipBc7InPlace, 16, {InPlaceInit, {
+        '\x00', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    }}, {InPlaceInit, {
+        /* Decodes to zeros, so it's kept as-is */
+        '\x00', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    }}, true},
+    {"BC7, mode 1", yFlipBc7InPlace, 16, {InPlaceInit, {
+        '\x02', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    }}, {InPlaceInit, {
+        /* Multiple subsets, left untouched */
+        '\x02', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    }}, false},
+    {"ETC2 RGB8, individual, subblocks side by side", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x63', '\xe8', '\xca', '\xe0', '\x41', '\x67', '\x7d', '\x61'
+    }}, {InPlaceInit, {
+        /* Only the pixel indices change */
+        '\x63', '\xe8', '\xca', '\xe0', '\x28', '\x6e', '\xeb', '\x68'
+    }}, true},
+    {"ETC2 RGB8, individual, subblocks on top of each other", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x03', '\x2b', '\x84', '\x6d', '\x0b', '\xbd', '\x3f', '\x4b'
+    }}, {InPlaceInit, {
+        /* Colors and modifier tables of the two subblocks get swapped */
+        '\x30', '\xb2', '\x48', '\x6d', '\x0d', '\xdb', '\xcf', '\x2d'
+    }}, true},
+    {"ETC2 RGB8, differential, subblocks side by side", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x3b', '\xb7', '\xae', '\xe6', '\x45', '\x44', '\x41', '\x66'
+    }}, {InPlaceInit, {
+        '\x3b', '\xb7', '\xae', '\xe6', '\x2a', '\x22', '\x28', '\x66'
+    }}, true},
+    {"ETC2 RGB8, differential, subblocks on top of each other", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\xbf', '\x62', '\xe2', '\x2b', '\x96', '\x23', '\xfb', '\x4b'
+    }}, {InPlaceInit, {
+        /* The second color becomes the base and the difference negated */
+        '\xb1', '\x76', '\xf6', '\x47', '\x96', '\x4c', '\xfd', '\x2d'
+    }}, true},
+    {"ETC2 RGB8, differential, subblocks on top of each other, -4 difference", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x4c', '\x31', '\x7a', '\x47', '\x96', '\x1d', '\x92', '\x18'
+    }}, {InPlaceInit, {
+        /* The -4 difference in the red channel is approximated with 3 */
+        '\x2b', '\x3f', '\x8e', '\x2b', '\x96', '\x8b', '\x94', '\x81'
+    }}, false},
+    {"ETC2 RGB8, T mode", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x14', '\x75', '\xee', '\x02', '\xbb', '\xc8', '\x75', '\xad'
+    }}, {InPlaceInit, {
+        '\x14', '\x75', '\xee', '\x02', '\xdd', '\x31', '\xea', '\x5b'
+    }}, true},
+    {"ETC2 RGB8, H mode", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\xbe', '\x1c', '\x8f', '\x0a', '\x0f', '\x62', '\xb0', '\xa2'
+    }}, {InPlaceInit, {
+        '\xbe', '\x1c', '\x8f', '\x0a', '\x0f', '\x64', '\xd0', '\x54'
+    }}, true},
+    {"ETC2 RGB8, planar mode, horizontal gradient", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x29', '\x35', '\x04', '\xdb', '\x78', '\x52', '\x96', '\xa1'
+    }}, {InPlaceInit, {
+        /* Without a vertical gradient the block is the same */
+        '\x29', '\x35', '\x04', '\xdb', '\x78', '\x52', '\x96', '\xa1'
+    }}, true},
+    {"ETC2 RGB8, planar mode", yFlipEtc2RGB8InPlace, 8, {InPlaceInit, {
+        '\x5b', '\xc1', '\x0e', '\xf7', '\x5c', '\xc8', '\xa8', '\x17'
+    }}, {InPlaceInit, {
+        '\x1e', '\x60', '\xfa', '\xbb', '\x00', '\x4e', '\xfb', '\xf2'
+    }}, false},
+    {"ETC2 RGB8A1, differential, subblocks on top of each other", yFlipEtc2RGB8A1InPlace, 8, {InPlaceInit, {
+        '\x99', '\x26', '\x7a', '\x71', '\x6c', '\x2b', '\xcf', '\x4b'
+    }}, {InPlaceInit, {
+        /* Compared to RGB8 this would be the individual mode, here it's
+           differential with punchthrough alpha */
+        '\xa7', '\x12', '\x8e', '\x8d', '\x63', '\x4d', '\x3f', '\x2d'
+    }}, true},
+    {"ETC2 RGB8A1, planar mode", yFlipEtc2RGB8A1InPlace, 8, {InPlaceInit, {
+        '\x52', '\xd0', '\x06', '\x5f', '\xa1', '\x5b', '\xac', '\x18'
+    }}, {InPlaceInit, {
+        '\x40', '\x5c', '\x15', '\xce', '\xad', '\xcd', '\x89', '\x80'
+    }}, false},
+    {"ETC2 RGBA8", yFlipEtc2RGBA8InPlace, 16, {InPlaceInit, {
+        '\x1a', '\x5a', '\x91', '\x39', '\x3e', '\xc5', '\xd7', '\xd0',
+        '\x03', '\x2b', '\x84', '\x6d', '\x0b', '\xbd', '\x3f', '\x4b'
+    }}, {InPlaceInit, {
+        /* Same as EAC R11 and ETC2 RGB8 individually */
+        '\x1a', '\x5a', '\x6a', '\x4d', '\xe4', '\xac', '\xe0', '\xbb',
+        '\x30', '\xb2', '\x48', '\x6d', '\x0d', '\xdb', '\xcf', '\x2d'
+    }}, true},
+    {"EAC R11", [](const Containers::StridedArrayView4D<char>& blocks) {
+        yFlipEacR11InPlace(blocks);
+        return std::size_t{};
+    }, 8, {InPlaceInit, {
+        '\x1a', '\x5a', '\x91', '\x39', '\x3e', '\xc5', '\xd7', '\xd0'
+    }}, {InPlaceInit, {
+        /* Only the pixel indices change */
+        '\x1a', '\x5a', '\x6a', '\x4d', '\xe4', '\xac', '\xe0', '\xbb'
+    }}, true},
+    {"EAC RG11", [](const Containers::StridedArrayView4D<char>& blocks) {
+        yFlipEacRG11InPlace(blocks);
+        return std::size_t{};
+    }, 16, {InPlaceInit, {
+        '\x1a', '\x5a', '\x91', '\x39', '\x3e', '\xc5', '\xd7', '\xd0',
+        '\x7f', '\xc3', '\x6a', '\x4d', '\xe4', '\xac', '\xe0', '\xbb'
+    }}, {InPlaceInit, {
+        '\x1a', '\x5a', '\x6a', '\x4d', '\xe4', '\xac', '\xe0', '\xbb',
+        '\x7f', '\xc3', '\x91', '\x39', '\x3e', '\xc5', '\xd7', '\xd0'
+    }}, true},
+};
+
 ColorBatchTest::ColorBatchTest() {
     addInstancedTests({&ColorBatchTest::yFlip},
         Containers::arraySize(YFlipData));
 
+    addInstancedTests({&ColorBatchTest::yFlipSingleBlock},
+        Containers::arraySize(YFlipSingleBlockData));
+
     addTests({&ColorBatchTest::yFlip3D,
 
-              &ColorBatchTest::yFlipInvalidLastDimension});
+              &ColorBatchTest::yFlipInvalidLastDimension,
+
+              &ColorBatchTest::yFlipInexact,
+              &ColorBatchTest::yFlipInexactInvalidSize,
+
+              &ColorBatchTest::fromSrgbUnsignedByte,
+              &ColorBatchTest::fromSrgbFloat,
+              &ColorBatchTest::toSrgbUnsignedByte,
+              &ColorBatchTest::toSrgbFloat,
+              &ColorBatchTest::srgbChannelCount,
+              &ColorBatchTest::srgbStrided,
+              &ColorBatchTest::srgbNan,
+              &ColorBatchTest::srgbInvalidSize});
+}
+
+using Magnum::Color3;
+using Magnum::Color4;
+using Magnum::Constants;
+using Magnum::Vector2;
+using Magnum::Vector3;
+
+/* The whole [0, 1] range with a step that's finer than 8-bit precision, and
+   a few values above */
+Containers::Array<Color4> srgbTestData() {
+    Containers::Array<Color4> out{Magnum::NoInit, 4096 + 3};
+    for(std::size_t i = 0; i != 4096; ++i)
+        out[i] = {Float(i)/4095.0f, Float(4095 - i)/4095.0f, Float(i*7 % 4096)/4095.0f, Float(i % 256)/255.0f};
+    out[4096] = {1.5f, 2.0f, 0.5f, 1.0f};
+    out[4097] = {1.0f, 4.0f, 1.1f, 0.0f};
+    out[4098] = {-0.25f, 0.001f, -1.0f, 0.5f};
+    return out;
 }
 
 void ColorBatchTest::yFlip() {
@@ -376,6 +605,237 @@ void ColorBatchTest::yFlipInvalidLastDimension() {
         "Math::yFlipBc1InPlace(): last dimension is not contiguous\n");
 }
 
+void ColorBatchTest::yFlipSingleBlock() {
+    auto&& data = YFlipSingleBlockData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The multi-block behavior is tested in yFlip() already as it's shared
+       for all formats, so it's enough to test just a single block for all
+       special cases */
+    Containers::Array<char> blocks{Magnum::NoInit, data.input.size()};
+    Utility::copy(data.input, blocks);
+    CORRADE_COMPARE(data.function(stridedArrayView(blocks).expanded<0>(Containers::Size3D{1, 1, data.blockSize})), data.lossless ? 0 : 1);
+    CORRADE_COMPARE_AS(blocks,
+        data.expected,
+        TestSuite::Compare::Container);
+
+    /* If the operation is lossless, flipping again should result in the
+       original data */
+    if(!data.lossless)
+        return;
+    data.function(stridedArrayView(blocks).expanded<0>(Containers::Size3D{1, 1, data.blockSize}));
+    CORRADE_COMPARE_AS(blocks,
+        data.input,
+        TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::yFlipInexact() {
+    /* Three rows of two BC7 blocks, the mode 1 blocks can't be flipped */
+    const char mode6[]{
+        '\x40', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    };
+    const char mode1[]{
+        '\x02', '\x4e', '\xee', '\x5b', '\xf5', '\x89', '\x39', '\x84',
+        '\xcb', '\xb9', '\xca', '\x14', '\x5b', '\xbf', '\x7c', '\xe5'
+    };
+    char data[6*16];
+    for(std::size_t i = 0; i != 6; ++i)
+        std::memcpy(data + i*16, i == 1 || i == 2 ? mode1 : mode6, 16);
+
+    /* Fill the output with ones to verify the other bits get reset */
+    UnsignedByte inexactData[1]{0xff};
+    Containers::MutableBitArrayView inexact{inexactData, 0, 6};
+    CORRADE_COMPARE(yFlipBc7InPlace(Containers::StridedArrayView4D<char>{data, {1, 3, 2, 16}}, inexact), 2);
+
+    /* The blocks at row 0 column 1 and row 1 column 0 are now at row 2
+       column 1 and row 1 column 0 */
+    CORRADE_COMPARE_AS(inexact, Containers::stridedArrayView({
+        false, false,
+        true, false,
+        false, true
+    }).sliceBit(0), TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::yFlipInexactInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[6*16]{};
+    UnsignedByte inexactData[1]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    yFlipBc7InPlace(Containers::StridedArrayView4D<char>{data, {1, 3, 2, 16}}, Containers::MutableBitArrayView{inexactData, 0, 5});
+    CORRADE_COMPARE(out, "Math::yFlipBc7InPlace(): expected inexact block mask to have 6 bits but got 5\n");
+}
+
+void ColorBatchTest::fromSrgbUnsignedByte() {
+    Color4ub src[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        src[i] = {UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i*7), UnsignedByte(i*3)};
+
+    Color4 expected[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        expected[i] = Color4::fromSrgbAlpha(src[i]);
+
+    /* The lookup table is calculated using the scalar code, so the output
+       should be bit-exact */
+    Color4 dst[256];
+    fromSrgbInto(Containers::stridedArrayView(src).slice(&Color4ub::data),
+                 Containers::stridedArrayView(dst).slice(&Color4::data));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(Containers::arrayView(dst)),
+        Containers::arrayCast<const UnsignedInt>(Containers::arrayView(expected)),
+        TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::fromSrgbFloat() {
+    /* Interpreting the test data as sRGB */
+    Containers::Array<Color4> src = srgbTestData();
+
+    Containers::Array<Color4> expected{Magnum::NoInit, src.size()};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        expected[i] = Color4::fromSrgbAlpha(src[i]);
+
+    /* The polynomial approximation should be within the fuzzy compare
+       precision */
+    Containers::Array<Color4> dst{Magnum::NoInit, src.size()};
+    fromSrgbInto(Containers::stridedArrayView(src).slice(&Color4::data),
+                 Containers::stridedArrayView(dst).slice(&Color4::data));
+    CORRADE_COMPARE_AS(dst, expected, TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::toSrgbUnsignedByte() {
+    /* Values above 1 would overflow */
+    Containers::Array<Color4> src = srgbTestData();
+    Containers::ArrayView<const Color4> srcInRange = src.prefix(4096);
+
+    Containers::Array<Color4ub> expected{Magnum::NoInit, srcInRange.size()};
+    for(std::size_t i = 0; i != srcInRange.size(); ++i)
+        expected[i] = srcInRange[i].toSrgbAlpha<UnsignedByte>();
+
+    /* Even though the output can in theory differ by one near the rounding
+       boundaries, it's exact for this data set */
+    Containers::Array<Color4ub> dst{Magnum::NoInit, srcInRange.size()};
+    toSrgbInto(Containers::stridedArrayView(srcInRange).slice(&Color4::data),
+               Containers::stridedArrayView(dst).slice(&Color4ub::data));
+    CORRADE_COMPARE_AS(dst, expected, TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::toSrgbFloat() {
+    Containers::Array<Color4> src = srgbTestData();
+
+    Containers::Array<Color4> expected{Magnum::NoInit, src.size()};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        expected[i] = Color4{src[i].toSrgbAlpha()};
+
+    Containers::Array<Color4> dst{Magnum::NoInit, src.size()};
+    toSrgbInto(Containers::stridedArrayView(src).slice(&Color4::data),
+               Containers::stridedArrayView(dst).slice(&Color4::data));
+    CORRADE_COMPARE_AS(dst, expected, TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::srgbChannelCount() {
+    /* With three channels or less, all are converted, only the fourth is
+       treated as alpha */
+    const Float src[]{0.0f, 0.2f, 0.5f, 0.8f, 1.0f, 0.3f};
+
+    Float dst1[6];
+    toSrgbInto(Containers::stridedArrayView(src),
+               Containers::stridedArrayView(dst1));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst1), Containers::arrayView({
+        Color3{0.0f, 0.2f, 0.5f}.toSrgb()[0],
+        Color3{0.0f, 0.2f, 0.5f}.toSrgb()[1],
+        Color3{0.0f, 0.2f, 0.5f}.toSrgb()[2],
+        Color3{0.8f, 1.0f, 0.3f}.toSrgb()[0],
+        Color3{0.8f, 1.0f, 0.3f}.toSrgb()[1],
+        Color3{0.8f, 1.0f, 0.3f}.toSrgb()[2]
+    }), TestSuite::Compare::Container);
+
+    Vector3 dst3[2];
+    toSrgbInto(Containers::StridedArrayView2D<const Float>{src, {2, 3}},
+               Containers::stridedArrayView(dst3).slice(&Vector3::data));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst3), Containers::arrayView({
+        Color3{0.0f, 0.2f, 0.5f}.toSrgb(),
+        Color3{0.8f, 1.0f, 0.3f}.toSrgb()
+    }), TestSuite::Compare::Container);
+
+    Vector2 dst2[3];
+    toSrgbInto(Containers::StridedArrayView2D<const Float>{src, {3, 2}},
+               Containers::stridedArrayView(dst2).slice(&Vector2::data));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst2), Containers::arrayView({
+        Color3{0.0f, 0.2f, 0.5f}.toSrgb().xy(),
+        Color3{0.5f, 0.8f, 0.0f}.toSrgb().xy(),
+        Color3{1.0f, 0.3f, 0.0f}.toSrgb().xy()
+    }), TestSuite::Compare::Container);
+}
+
+void ColorBatchTest::srgbStrided() {
+    /* Over three times the block size used internally to test also the
+       block boundaries, with items skipped in both the input and output */
+    Containers::Array<Color4> src = srgbTestData();
+    Containers::StridedArrayView1D<const Color4> srcStrided = Containers::stridedArrayView(src).every(5);
+
+    Containers::Array<Color4> expected{Magnum::NoInit, srcStrided.size()};
+    for(std::size_t i = 0; i != srcStrided.size(); ++i)
+        expected[i] = Color4::fromSrgbAlpha(srcStrided[i]);
+
+    Containers::Array<Color4> dst{ValueInit, srcStrided.size()*2};
+    Containers::StridedArrayView1D<Color4> dstStrided = Containers::stridedArrayView(dst).every(2);
+    fromSrgbInto(srcStrided.slice(&Color4::data),
+                 dstStrided.slice(&Color4::data));
+    CORRADE_COMPARE_AS(dstStrided, Containers::stridedArrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* The skipped items should stay untouched */
+    for(std::size_t i = 1; i < dst.size(); i += 2) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Color4{});
+    }
+}
+
+void ColorBatchTest::srgbNan() {
+    const Float src[]{0.5f, Constants::nan(), 0.002f};
+
+    Float dst[3];
+    fromSrgbInto(Containers::stridedArrayView(src),
+                 Containers::stridedArrayView(dst));
+    CORRADE_COMPARE(dst[0], Color3::fromSrgb(Vector3{0.5f}).r());
+    CORRADE_VERIFY(Math::isNan(dst[1]));
+    CORRADE_COMPARE(dst[2], 0.002f/12.92f);
+
+    toSrgbInto(Containers::stridedArrayView(src),
+               Containers::stridedArrayView(dst));
+    CORRADE_COMPARE(dst[0], Color3{0.5f}.toSrgb().r());
+    CORRADE_VERIFY(Math::isNan(dst[1]));
+    CORRADE_COMPARE(dst[2], 0.002f*12.92f);
+}
+
+void ColorBatchTest::srgbInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedByte a[10]{};
+    Float b[10]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    fromSrgbInto(Containers::StridedArrayView2D<const UnsignedByte>{a, {2, 4}},
+                 Containers::StridedArrayView2D<Float>{b, {2, 3}});
+    fromSrgbInto(Containers::StridedArrayView2D<const UnsignedByte>{a, {2, 5}},
+                 Containers::StridedArrayView2D<Float>{b, {2, 5}});
+    fromSrgbInto(Containers::StridedArrayView2D<const Float>{b, {3, 3}},
+                 Containers::StridedArrayView2D<Float>{b, {2, 3}});
+    toSrgbInto(Containers::StridedArrayView2D<const Float>{b, {2, 4}},
+               Containers::StridedArrayView2D<UnsignedByte>{a, {1, 4}});
+    toSrgbInto(Containers::StridedArrayView2D<const Float>{b, {1, 6}},
+               Containers::StridedArrayView2D<Float>{b, {1, 6}});
+    CORRADE_COMPARE(out,
+        "Math::fromSrgbInto(): wrong destination size, got {2, 3} but expected {2, 4}\n"
+        "Math::fromSrgbInto(): expected at most four channels but got 5\n"
+        "Math::fromSrgbInto(): wrong destination size, got {2, 3} but expected {3, 3}\n"
+        "Math::toSrgbInto(): wrong destination size, got {1, 4} but expected {2, 4}\n"
+        "Math::toSrgbInto(): expected at most four channels but got 6\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::ColorBatchTest)
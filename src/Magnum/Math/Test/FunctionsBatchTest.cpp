@@ -47,9 +47,42 @@ struct FunctionsBatchTest: TestSuite::Tester {
     void nanIgnoring();
     void nanIgnoringVector();
 
+    template<class T> void minmaxContiguous();
+    template<class T> void isNanInfContiguous();
+
     void constIterable();
 };
 
+template<class> struct NameTraits;
+template<> struct NameTraits<Float> {
+    static const char* name() { return "Float"; }
+};
+template<> struct NameTraits<Double> {
+    static const char* name() { return "Double"; }
+};
+template<> struct NameTraits<Math::Vector3<Float>> {
+    static const char* name() { return "Vector3"; }
+};
+template<> struct NameTraits<Math::Vector3<Double>> {
+    static const char* name() { return "Vector3d"; }
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+    /* Index of a scalar component to set to a NaN / negative infinity, -1 if
+       none */
+    Int nan, inf;
+} ContiguousData[]{
+    {"one item", 1, -1, -1},
+    {"7 items", 7, -1, -1},
+    {"33 items", 33, -1, -1},
+    {"100 items", 100, -1, -1},
+    {"100 items, NaN first", 100, 0, -1},
+    {"100 items, NaN and infinity in the middle", 100, 37, 52},
+    {"100 items, NaN and infinity at the end", 100, 98, 99},
+};
+
 using namespace Literals;
 
 using Magnum::Constants;
@@ -65,9 +98,20 @@ FunctionsBatchTest::FunctionsBatchTest() {
               &FunctionsBatchTest::minmax,
 
               &FunctionsBatchTest::nanIgnoring,
-              &FunctionsBatchTest::nanIgnoringVector,
-
-              &FunctionsBatchTest::constIterable});
+              &FunctionsBatchTest::nanIgnoringVector});
+
+    addInstancedTests<FunctionsBatchTest>({
+        &FunctionsBatchTest::minmaxContiguous<Float>,
+        &FunctionsBatchTest::minmaxContiguous<Double>,
+        &FunctionsBatchTest::minmaxContiguous<Math::Vector3<Float>>,
+        &FunctionsBatchTest::minmaxContiguous<Math::Vector3<Double>>,
+        &FunctionsBatchTest::isNanInfContiguous<Float>,
+        &FunctionsBatchTest::isNanInfContiguous<Double>,
+        &FunctionsBatchTest::isNanInfContiguous<Math::Vector3<Float>>,
+        &FunctionsBatchTest::isNanInfContiguous<Math::Vector3<Double>>},
+        Containers::arraySize(ContiguousData));
+
+    addTests({&FunctionsBatchTest::constIterable});
 }
 
 void FunctionsBatchTest::isInf() {
@@ -289,6 +333,71 @@ void FunctionsBatchTest::nanIgnoringVector() {
     CORRADE_COMPARE(Math::minmax(allNan).second()[1], Constants::nan());
 }
 
+/* Fills the data with deterministic values of both signs, with a NaN and a
+   negative infinity at given scalar positions, and makes a copy that has every
+   other item skipped */
+template<class T> Containers::Array<T> contiguousTestData(std::size_t size, Int nan, Int inf, Containers::Array<T>& strided) {
+    typedef UnderlyingTypeOf<T> S;
+
+    Containers::Array<T> out{NoInit, size};
+    Containers::ArrayView<S> scalars = Containers::arrayCast<S>(Containers::arrayView(out));
+    for(std::size_t i = 0; i != scalars.size(); ++i)
+        scalars[i] = S(Int(i*7919 % 1000) - 500)*S(0.25);
+    if(nan != -1) scalars[nan] = Math::Constants<S>::nan();
+    if(inf != -1) scalars[inf] = -Math::Constants<S>::inf();
+
+    strided = Containers::Array<T>{ValueInit, size*2};
+    for(std::size_t i = 0; i != size; ++i)
+        strided[i*2] = out[i];
+
+    return out;
+}
+
+template<class T> void FunctionsBatchTest::minmaxContiguous() {
+    auto&& data = ContiguousData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    /* Contiguous Float and Double scalars and three-component vectors go
+       through a separate code path that's SIMD-optimized on certain
+       platforms. The strided view goes through the generic code path, check
+       that both give the same results. */
+    Containers::Array<T> strided;
+    Containers::Array<T> contiguous = contiguousTestData<T>(data.size, data.nan, data.inf, strided);
+    Containers::StridedArrayView1D<const T> stridedView = Containers::stridedArrayView(strided).every(2);
+
+    CORRADE_COMPARE(Math::min(contiguous), Math::min(stridedView));
+    CORRADE_COMPARE(Math::max(contiguous), Math::max(stridedView));
+    CORRADE_COMPARE(Math::minmax(contiguous), Math::minmax(stridedView));
+
+    /* The negative infinity should be always picked as the minimum */
+    if(data.inf != -1) {
+        typedef decltype(Math::isInf(std::declval<T>())) Result;
+        CORRADE_VERIFY(Math::isInf(Math::min(contiguous)) != Result{});
+    }
+}
+
+template<class T> void FunctionsBatchTest::isNanInfContiguous() {
+    auto&& data = ContiguousData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    /* Like minmaxContiguous(), verifying the contiguous code path against
+       the generic one */
+    Containers::Array<T> strided;
+    Containers::Array<T> contiguous = contiguousTestData<T>(data.size, data.nan, data.inf, strided);
+    Containers::StridedArrayView1D<const T> stridedView = Containers::stridedArrayView(strided).every(2);
+
+    CORRADE_COMPARE(Math::isNan(contiguous), Math::isNan(stridedView));
+    CORRADE_COMPARE(Math::isInf(contiguous), Math::isInf(stridedView));
+
+    /* And the values actually being found, for the generic code path it's
+       tested in isNan() and isInf() */
+    typedef decltype(Math::isNan(std::declval<T>())) Result;
+    CORRADE_COMPARE(Math::isNan(contiguous) != Result{}, data.nan != -1);
+    CORRADE_COMPARE(Math::isInf(contiguous) != Result{}, data.inf != -1);
+}
+
 void FunctionsBatchTest::constIterable() {
     const Vector2 data[]{{5, -3}, {-2, 14}, {9, -5}};
 
@@ -24,10 +24,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Vector3.h"
 
 #ifdef CORRADE_TARGET_SSE2
 #include <xmmintrin.h>
@@ -49,6 +53,11 @@ struct FunctionsBenchmark: TestSuite::Tester {
 
     void sinCosSeparate();
     void sinCosCombined();
+
+    void minmaxFloatContiguous();
+    void minmaxFloatStrided();
+    void minmaxVector3Contiguous();
+    void minmaxVector3Strided();
 };
 
 FunctionsBenchmark::FunctionsBenchmark() {
@@ -67,11 +76,19 @@ FunctionsBenchmark::FunctionsBenchmark() {
 
     addBenchmarks({&FunctionsBenchmark::sinCosSeparate,
                    &FunctionsBenchmark::sinCosCombined}, 100);
+
+    /* Contiguous Float and Vector3 ranges are processed with a SIMD-optimized
+       kernel if available, strided ranges go through a generic scalar loop */
+    addBenchmarks({&FunctionsBenchmark::minmaxFloatContiguous,
+                   &FunctionsBenchmark::minmaxFloatStrided,
+                   &FunctionsBenchmark::minmaxVector3Contiguous,
+                   &FunctionsBenchmark::minmaxVector3Strided}, 10);
 }
 
 using Magnum::Constants;
 using Magnum::Deg;
 using Magnum::Rad;
+using Magnum::Vector3;
 
 enum: std::size_t { Repeats = 100000 };
 
@@ -225,6 +242,73 @@ void FunctionsBenchmark::sinCosCombined() {
 }
 
 
+/* A million three-component vectors, or three million scalars */
+enum: std::size_t { MinmaxSize = 1024*1024 };
+
+template<class T> Containers::Array<T> minmaxData(std::size_t stride);
+template<> Containers::Array<Float> minmaxData(std::size_t stride) {
+    Containers::Array<Float> out{ValueInit, MinmaxSize*3*stride};
+    for(std::size_t i = 0; i != MinmaxSize*3; ++i)
+        out[i*stride] = Float(i % 1000) - 500.0f;
+    return out;
+}
+template<> Containers::Array<Vector3> minmaxData(std::size_t stride) {
+    Containers::Array<Vector3> out{ValueInit, MinmaxSize*stride};
+    for(std::size_t i = 0; i != MinmaxSize; ++i)
+        out[i*stride] = Vector3{Float(i % 1000), -Float(i % 777), Float(i % 313)};
+    return out;
+}
+
+void FunctionsBenchmark::minmaxFloatContiguous() {
+    Containers::Array<Float> data = minmaxData<Float>(1);
+    const Containers::StridedArrayView1D<const Float> view = data;
+    CORRADE_VERIFY(view.isContiguous());
+
+    Containers::Pair<Float, Float> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(view);
+
+    CORRADE_COMPARE(out, Containers::pair(-500.0f, 499.0f));
+}
+
+void FunctionsBenchmark::minmaxFloatStrided() {
+    /* Every other value is skipped, but the same amount of values is
+       processed */
+    Containers::Array<Float> data = minmaxData<Float>(2);
+    const Containers::StridedArrayView1D<const Float> view = Containers::stridedArrayView(data).every(2);
+    CORRADE_VERIFY(!view.isContiguous());
+
+    Containers::Pair<Float, Float> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(view);
+
+    CORRADE_COMPARE(out, Containers::pair(-500.0f, 499.0f));
+}
+
+void FunctionsBenchmark::minmaxVector3Contiguous() {
+    Containers::Array<Vector3> data = minmaxData<Vector3>(1);
+    const Containers::StridedArrayView1D<const Vector3> view = data;
+    CORRADE_VERIFY(view.isContiguous());
+
+    Containers::Pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(view);
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3{0.0f, -776.0f, 0.0f}, Vector3{999.0f, 0.0f, 312.0f}));
+}
+
+void FunctionsBenchmark::minmaxVector3Strided() {
+    Containers::Array<Vector3> data = minmaxData<Vector3>(2);
+    const Containers::StridedArrayView1D<const Vector3> view = Containers::stridedArrayView(data).every(2);
+    CORRADE_VERIFY(!view.isContiguous());
+
+    Containers::Pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1)
+        out = Math::minmax(view);
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3{0.0f, -776.0f, 0.0f}, Vector3{999.0f, 0.0f, 312.0f}));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsBenchmark)
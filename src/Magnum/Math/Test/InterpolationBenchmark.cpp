@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #ifndef CORRADE_NO_ASSERT
@@ -31,6 +33,7 @@
 #endif
 
 #include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -44,6 +47,16 @@ struct InterpolationBenchmark: TestSuite::Tester {
     void quaternionSlerpShortestPath();
     void dualQuaternionSclerp();
     void dualQuaternionSclerpShortestPath();
+
+    void quaternionLerpShortestPathLoop();
+    void quaternionLerpShortestPathBatch();
+    void quaternionSlerpShortestPathLoop();
+    void quaternionSlerpShortestPathBatch();
+    void quaternionSlerpShortestPathFastBatch();
+    void quaternionNormalizeLoop();
+    void quaternionNormalizeBatch();
+    void dualQuaternionSclerpShortestPathLoop();
+    void dualQuaternionSclerpShortestPathBatch();
 };
 
 InterpolationBenchmark::InterpolationBenchmark() {
@@ -54,12 +67,25 @@ InterpolationBenchmark::InterpolationBenchmark() {
                    &InterpolationBenchmark::quaternionSlerpShortestPath,
                    &InterpolationBenchmark::dualQuaternionSclerp,
                    &InterpolationBenchmark::dualQuaternionSclerpShortestPath}, 100);
+
+    /* Batch functions compared to calling the single-value variants in a
+       loop on the same data */
+    addBenchmarks({&InterpolationBenchmark::quaternionLerpShortestPathLoop,
+                   &InterpolationBenchmark::quaternionLerpShortestPathBatch,
+                   &InterpolationBenchmark::quaternionSlerpShortestPathLoop,
+                   &InterpolationBenchmark::quaternionSlerpShortestPathBatch,
+                   &InterpolationBenchmark::quaternionSlerpShortestPathFastBatch,
+                   &InterpolationBenchmark::quaternionNormalizeLoop,
+                   &InterpolationBenchmark::quaternionNormalizeBatch,
+                   &InterpolationBenchmark::dualQuaternionSclerpShortestPathLoop,
+                   &InterpolationBenchmark::dualQuaternionSclerpShortestPathBatch}, 10);
 }
 
 using namespace Literals;
 
 /* What's a typedef and not a using differs from the typedefs in root Magnum
    namespace */
+using Magnum::Deg;
 using Magnum::Quaternion;
 using Magnum::DualQuaternion;
 using Magnum::Vector3;
@@ -156,6 +182,126 @@ void InterpolationBenchmark::dualQuaternionSclerpShortestPath() {
     CORRADE_VERIFY(!c.isNormalized());
 }
 
+/* Joint rotations of a larger crowd */
+enum: std::size_t { BatchSize = 64*1024 };
+
+struct BatchData {
+    Containers::Array<Quaternion> a{NoInit, BatchSize};
+    Containers::Array<Quaternion> b{NoInit, BatchSize};
+    Containers::Array<Float> t{NoInit, BatchSize};
+    Containers::Array<Quaternion> out{NoInit, BatchSize};
+};
+
+BatchData batchData() {
+    BatchData out;
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        out.a[i] = Quaternion::rotation(Deg(Float(i % 360)), Vector3{1.0f, Float(i % 3), 2.0f}.normalized());
+        out.b[i] = Quaternion::rotation(Deg(Float(i % 97)*3.0f), Vector3{Float(i % 5), -1.0f, 0.5f}.normalized());
+        out.t[i] = Float(i % 128)/127.0f;
+    }
+    return out;
+}
+
+void InterpolationBenchmark::quaternionLerpShortestPathLoop() {
+    BatchData data = batchData();
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            data.out[i] = lerpShortestPath(data.a[i], data.b[i], data.t[i]);
+    }
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionLerpShortestPathBatch() {
+    BatchData data = batchData();
+    CORRADE_BENCHMARK(1)
+        lerpShortestPathInto(data.a, data.b, data.t, data.out);
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionSlerpShortestPathLoop() {
+    BatchData data = batchData();
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            data.out[i] = slerpShortestPath(data.a[i], data.b[i], data.t[i]);
+    }
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionSlerpShortestPathBatch() {
+    BatchData data = batchData();
+    CORRADE_BENCHMARK(1)
+        slerpShortestPathInto(data.a, data.b, data.t, data.out);
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionSlerpShortestPathFastBatch() {
+    BatchData data = batchData();
+    CORRADE_BENCHMARK(1)
+        slerpShortestPathFastInto(data.a, data.b, data.t, data.out);
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionNormalizeLoop() {
+    BatchData data = batchData();
+    for(Quaternion& i: data.a) i *= 2.0f;
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            data.out[i] = data.a[i].normalized();
+    }
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionNormalizeBatch() {
+    BatchData data = batchData();
+    for(Quaternion& i: data.a) i *= 2.0f;
+
+    CORRADE_BENCHMARK(1)
+        normalizeInto(data.a, data.out);
+
+    CORRADE_VERIFY(data.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::dualQuaternionSclerpShortestPathLoop() {
+    BatchData data = batchData();
+    Containers::Array<DualQuaternion> a{NoInit, BatchSize};
+    Containers::Array<DualQuaternion> b{NoInit, BatchSize};
+    Containers::Array<DualQuaternion> out{NoInit, BatchSize};
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        a[i] = DualQuaternion::translation(Vector3::xAxis(Float(i % 10)))*DualQuaternion{data.a[i]};
+        b[i] = DualQuaternion::translation(Vector3::yAxis(Float(i % 7)))*DualQuaternion{data.b[i]};
+    }
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = sclerpShortestPath(a[i], b[i], data.t[i]);
+    }
+
+    CORRADE_VERIFY(out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::dualQuaternionSclerpShortestPathBatch() {
+    BatchData data = batchData();
+    Containers::Array<DualQuaternion> a{NoInit, BatchSize};
+    Containers::Array<DualQuaternion> b{NoInit, BatchSize};
+    Containers::Array<DualQuaternion> out{NoInit, BatchSize};
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        a[i] = DualQuaternion::translation(Vector3::xAxis(Float(i % 10)))*DualQuaternion{data.a[i]};
+        b[i] = DualQuaternion::translation(Vector3::yAxis(Float(i % 7)))*DualQuaternion{data.b[i]};
+    }
+
+    CORRADE_BENCHMARK(1)
+        sclerpShortestPathInto(a, b, data.t, out);
+
+    CORRADE_VERIFY(out[BatchSize - 1].isNormalized());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::InterpolationBenchmark)
@@ -0,0 +1,231 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Jonathan Hale <squareys@googlemail.com>
+    Copyright © 2020 janos <janos.meny@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct IntersectionBatchTest: TestSuite::Tester {
+    explicit IntersectionBatchTest();
+
+    void rangeFrustum();
+    void aabbFrustum();
+    void sphereFrustum();
+
+    void consistentWithSingle();
+
+    void assertions();
+};
+
+using Magnum::Frustum;
+using Magnum::Range3D;
+using Magnum::Vector3;
+using Magnum::Vector4;
+
+IntersectionBatchTest::IntersectionBatchTest() {
+    addTests({&IntersectionBatchTest::rangeFrustum,
+              &IntersectionBatchTest::aabbFrustum,
+              &IntersectionBatchTest::sphereFrustum,
+
+              &IntersectionBatchTest::consistentWithSingle,
+
+              &IntersectionBatchTest::assertions});
+}
+
+/* Same as in IntersectionTest */
+const Frustum RangeFrustum{
+    {1.0f, 0.0f, 0.0f, 0.0f},
+    {-1.0f, 0.0f, 0.0f, 5.0f},
+    {0.0f, 1.0f, 0.0f, 0.0f},
+    {0.0f, -1.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, -1.0f, 10.0f}};
+
+const Range3D Ranges[]{
+    /* Fully inside */
+    {Vector3{1.0f}, Vector3{2.0f}},
+    /* Outside of frustum */
+    {Vector3{-10.0f}, Vector3{-5.0f}},
+    /* Intersects with exactly one plane each */
+    Range3D::fromSize({2.4f, -0.1f, 4.9f}, Vector3{0.2f}),
+    Range3D::fromSize({2.4f, 0.9f, 4.9f}, Vector3{0.2f}),
+    Range3D::fromSize({-0.1f, 0.4f, 4.9f}, Vector3{0.2f}),
+    Range3D::fromSize({4.9f, 0.4f, 4.9f}, Vector3{0.2f}),
+    Range3D::fromSize({2.4f, 0.4f, -0.1f}, Vector3{0.2f}),
+    Range3D::fromSize({2.4f, 0.4f, 9.9f}, Vector3{0.2f}),
+    /* Just outside of one plane */
+    Range3D::fromSize({5.1f, 0.4f, 4.9f}, Vector3{0.2f}),
+    /* Bigger than frustum, but still intersects */
+    {Vector3{-100.0f}, Vector3{100.0f}},
+};
+
+const bool RangesExpected[]{
+    true, false, true, true, true, true, true, true, false, true
+};
+
+void IntersectionBatchTest::rangeFrustum() {
+    Containers::BitArray out{DirectInit, Containers::arraySize(Ranges), true};
+    Intersection::rangeFrustumInto(Ranges, RangeFrustum, out);
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], RangesExpected[i]);
+    }
+}
+
+void IntersectionBatchTest::aabbFrustum() {
+    Vector3 centers[Containers::arraySize(Ranges)];
+    Vector3 extents[Containers::arraySize(Ranges)];
+    for(std::size_t i = 0; i != Containers::arraySize(Ranges); ++i) {
+        centers[i] = Ranges[i].center();
+        extents[i] = Ranges[i].size()/2.0f;
+    }
+
+    Containers::BitArray out{DirectInit, Containers::arraySize(Ranges), true};
+    Intersection::aabbFrustumInto(centers, extents, RangeFrustum, out);
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], RangesExpected[i]);
+    }
+}
+
+void IntersectionBatchTest::sphereFrustum() {
+    /* Same as in IntersectionTest */
+    const Frustum frustum{
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f, 10.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f, 10.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+
+    Vector4 spheres[]{
+        /* Sphere on edge */
+        {0.0f, 0.0f, -1.0f, 1.5f},
+        /* Sphere inside */
+        {5.5f, 5.5f, 5.5f, 1.5f},
+        /* Sphere outside */
+        {0.0f, 0.0f, 100.0f, 0.5f},
+    };
+
+    /* Verifies that the views can be strided as well */
+    Containers::BitArray out{DirectInit, Containers::arraySize(spheres), false};
+    Intersection::sphereFrustumInto(
+        Containers::StridedArrayView1D<const Vector3>{spheres, &spheres[0].xyz(), Containers::arraySize(spheres), sizeof(Vector4)},
+        Containers::StridedArrayView1D<const Float>{spheres, &spheres[0].w(), Containers::arraySize(spheres), sizeof(Vector4)},
+        frustum, out);
+    CORRADE_VERIFY(out[0]);
+    CORRADE_VERIFY(out[1]);
+    CORRADE_VERIFY(!out[2]);
+}
+
+void IntersectionBatchTest::consistentWithSingle() {
+    /* A frustum of a perspective camera looking somewhere to the side, and a
+       bunch of boxes and spheres around it. There's more than one block of
+       items to verify the block remainder is handled correctly. */
+    const Frustum frustum = Frustum::fromMatrix(
+        Matrix4<Float>::perspectiveProjection(Deg<Float>(60.0f), 1.5f, 0.1f, 20.0f)*
+        Matrix4<Float>::lookAt({1.0f, 2.0f, 3.0f}, {-4.0f, 0.5f, -3.0f}, Vector3::yAxis()).inverted());
+
+    Vector3 centers[203];
+    Vector3 extents[203];
+    Range3D ranges[203];
+    Float radii[203];
+    for(std::size_t i = 0; i != Containers::arraySize(centers); ++i) {
+        centers[i] = Vector3{Float(i*7919 % 401), Float(i*6007 % 397), Float(i*4001 % 389)}/10.0f - Vector3{20.0f};
+        extents[i] = Vector3{Float(i % 7), Float(i % 5), Float(i % 3)}*0.5f;
+        ranges[i] = Range3D::fromCenter(centers[i], extents[i]);
+        radii[i] = extents[i].length();
+    }
+
+    /* Putting the output at an offset to verify it's correctly handled */
+    Containers::BitArray out{ValueInit, Containers::arraySize(centers) + 5};
+    Containers::MutableBitArrayView outView = out.exceptPrefix(5);
+
+    std::size_t visibleCount = 0;
+    Intersection::rangeFrustumInto(ranges, frustum, outView);
+    for(std::size_t i = 0; i != outView.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(outView[i], Intersection::rangeFrustum(ranges[i], frustum));
+        if(outView[i]) ++visibleCount;
+    }
+
+    Intersection::aabbFrustumInto(centers, extents, frustum, outView);
+    for(std::size_t i = 0; i != outView.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(outView[i], Intersection::aabbFrustum(centers[i], extents[i], frustum));
+    }
+
+    Intersection::sphereFrustumInto(centers, radii, frustum, outView);
+    for(std::size_t i = 0; i != outView.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(outView[i], Intersection::sphereFrustum(centers[i], radii[i], frustum));
+    }
+
+    /* The prefix should stay untouched */
+    CORRADE_COMPARE(out.prefix(5).count(), 0);
+
+    /* Make sure the test isn't testing something trivial */
+    CORRADE_COMPARE_AS(visibleCount, 0, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(visibleCount, Containers::arraySize(centers), TestSuite::Compare::Less);
+}
+
+void IntersectionBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Range3D ranges[3];
+    const Vector3 centers[3];
+    const Vector3 extents[2];
+    const Float radii[4];
+    Containers::BitArray out{ValueInit, 3};
+
+    Containers::String outString;
+    Error redirectError{&outString};
+    Intersection::rangeFrustumInto(ranges, {}, out.prefix(2));
+    Intersection::aabbFrustumInto(centers, extents, {}, out);
+    Intersection::aabbFrustumInto(centers, centers, {}, out.prefix(2));
+    Intersection::sphereFrustumInto(centers, radii, {}, out);
+    Intersection::sphereFrustumInto(centers, Containers::arrayView(radii).prefix(3), {}, out.prefix(2));
+    CORRADE_COMPARE(outString,
+        "Math::Intersection::rangeFrustumInto(): expected ranges and output views to have the same size, got 3 and 2\n"
+        "Math::Intersection::aabbFrustumInto(): expected center, extent and output views to have the same size, got 3, 2 and 3\n"
+        "Math::Intersection::aabbFrustumInto(): expected center, extent and output views to have the same size, got 3, 3 and 2\n"
+        "Math::Intersection::sphereFrustumInto(): expected center, radius and output views to have the same size, got 3, 4 and 3\n"
+        "Math::Intersection::sphereFrustumInto(): expected center, radius and output views to have the same size, got 3, 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBatchTest)
@@ -26,10 +26,14 @@
 */
 
 #include <random>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -102,10 +106,14 @@ struct IntersectionBenchmark: TestSuite::Tester {
 
     void rangeFrustumNaive();
     void rangeFrustum();
+    void rangeFrustumBatch();
+    void aabbFrustum();
+    void aabbFrustumBatch();
 
     void rangeCone();
 
     void sphereFrustum();
+    void sphereFrustumBatch();
 
     void sphereConeNaive();
     void sphereCone();
@@ -120,16 +128,22 @@ struct IntersectionBenchmark: TestSuite::Tester {
     Matrix4 _coneView;
 
     std::vector<Range3D> _boxes;
+    std::vector<Vector3> _boxCenters;
+    std::vector<Vector3> _boxExtents;
     std::vector<Vector4> _spheres;
 };
 
 IntersectionBenchmark::IntersectionBenchmark() {
     addBenchmarks({&IntersectionBenchmark::rangeFrustumNaive,
                    &IntersectionBenchmark::rangeFrustum,
+                   &IntersectionBenchmark::rangeFrustumBatch,
+                   &IntersectionBenchmark::aabbFrustum,
+                   &IntersectionBenchmark::aabbFrustumBatch,
 
                    &IntersectionBenchmark::rangeCone,
 
                    &IntersectionBenchmark::sphereFrustum,
+                   &IntersectionBenchmark::sphereFrustumBatch,
 
                    &IntersectionBenchmark::sphereConeNaive,
                    &IntersectionBenchmark::sphereCone,
@@ -150,11 +164,15 @@ IntersectionBenchmark::IntersectionBenchmark() {
     _frustum = Frustum::fromMatrix(_coneView*Matrix4::perspectiveProjection(_cone.angle, 1.0f, 0.001f, 100.0f));
 
     _boxes.reserve(512);
+    _boxCenters.reserve(512);
+    _boxExtents.reserve(512);
     _spheres.reserve(512);
     for(int i = 0; i < 512; ++i) {
         Vector3 center{pd(g), pd(g), pd(g)};
         Vector3 extents{pd(g), pd(g), pd(g)};
         _boxes.emplace_back(center - extents, center + extents);
+        _boxCenters.push_back(center);
+        _boxExtents.push_back(Math::abs(extents));
         _spheres.emplace_back(center, extents.length());
     }
 }
@@ -173,6 +191,40 @@ void IntersectionBenchmark::rangeFrustum() {
     }
 }
 
+void IntersectionBenchmark::rangeFrustumBatch() {
+    Containers::BitArray out{NoInit, _boxes.size()};
+    CORRADE_BENCHMARK(50)
+        Intersection::rangeFrustumInto(Containers::arrayView(_boxes.data(), _boxes.size()), _frustum, out);
+
+    /* Verify the output is consistent with the per-item variant */
+    for(std::size_t i = 0; i != _boxes.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Intersection::rangeFrustum(_boxes[i], _frustum));
+    }
+}
+
+void IntersectionBenchmark::aabbFrustum() {
+    volatile bool b = false;
+    CORRADE_BENCHMARK(50) for(std::size_t i = 0; i != _boxCenters.size(); ++i) {
+        b = b ^ Intersection::aabbFrustum(_boxCenters[i], _boxExtents[i], _frustum);
+    }
+}
+
+void IntersectionBenchmark::aabbFrustumBatch() {
+    Containers::BitArray out{NoInit, _boxCenters.size()};
+    CORRADE_BENCHMARK(50)
+        Intersection::aabbFrustumInto(
+            Containers::arrayView(_boxCenters.data(), _boxCenters.size()),
+            Containers::arrayView(_boxExtents.data(), _boxExtents.size()),
+            _frustum, out);
+
+    /* Verify the output is consistent with the per-item variant */
+    for(std::size_t i = 0; i != _boxCenters.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Intersection::aabbFrustum(_boxCenters[i], _boxExtents[i], _frustum));
+    }
+}
+
 void IntersectionBenchmark::rangeCone() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
@@ -191,6 +243,21 @@ void IntersectionBenchmark::sphereFrustum() {
     }
 }
 
+void IntersectionBenchmark::sphereFrustumBatch() {
+    Containers::BitArray out{NoInit, _spheres.size()};
+    CORRADE_BENCHMARK(50)
+        Intersection::sphereFrustumInto(
+            Containers::StridedArrayView1D<const Vector3>{Containers::arrayView(_spheres.data(), _spheres.size()), &_spheres[0].xyz(), _spheres.size(), sizeof(Vector4)},
+            Containers::StridedArrayView1D<const Float>{Containers::arrayView(_spheres.data(), _spheres.size()), &_spheres[0].w(), _spheres.size(), sizeof(Vector4)},
+            _frustum, out);
+
+    /* Verify the output is consistent with the per-item variant */
+    for(std::size_t i = 0; i != _spheres.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Intersection::sphereFrustum(_spheres[i].xyz(), _spheres[i].w(), _frustum));
+    }
+}
+
 void IntersectionBenchmark::sphereConeNaive() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) for(auto& sphere: _spheres) {
@@ -29,6 +29,8 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+#include "Magnum/Math/Algorithms/Svd.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -49,6 +51,11 @@ struct MatrixBenchmark: TestSuite::Tester {
     void invert4Rigid();
     void invert4Orthogonal();
 
+    void rotation3Svd();
+    void rotation3PolarDecomposition();
+    void eigen3Svd();
+    void eigen3SymmetricEigen();
+
     void transformVector3();
     void transformPoint3();
     void transformVector4();
@@ -70,6 +77,11 @@ MatrixBenchmark::MatrixBenchmark() {
                    &MatrixBenchmark::invert4Rigid,
                    &MatrixBenchmark::invert4Orthogonal}, 50);
 
+    addBenchmarks({&MatrixBenchmark::rotation3Svd,
+                   &MatrixBenchmark::rotation3PolarDecomposition,
+                   &MatrixBenchmark::eigen3Svd,
+                   &MatrixBenchmark::eigen3SymmetricEigen}, 50);
+
     addBenchmarks({&MatrixBenchmark::transformVector3,
                    &MatrixBenchmark::transformPoint3,
                    &MatrixBenchmark::transformVector4,
@@ -81,6 +93,7 @@ using Magnum::Vector3;
 using Magnum::Vector4;
 using Magnum::Matrix4;
 using Magnum::Matrix3;
+using Magnum::Matrix3x3;
 
 enum: std::size_t { Repeats = 10000 };
 
@@ -94,6 +107,10 @@ const Matrix4 Data4Orthogonal = Matrix4::rotation(134.7_degf, Vector3{1.0f, 3.0f
 const Matrix4 Data4Rigid = Data4Orthogonal*Matrix4::translation(Vector3::zAxis());
 const Matrix4 Data4 = Data4Orthogonal*Matrix4::scaling(Vector3{2.5f})*Matrix4::translation(Vector3::zAxis());
 
+const Matrix3x3 Data3x3Scaling = Matrix3x3::fromDiagonal({1.5f, 2.0f, 0.25f});
+const Matrix3x3 Data3x3 = Data4Orthogonal.rotationScaling()*Data3x3Scaling;
+const Matrix3x3 Data3x3Symmetric = Data3x3*Data3x3.transposed();
+
 void MatrixBenchmark::multiply3() {
     Matrix3 a = Data3;
     CORRADE_BENCHMARK(Repeats) {
@@ -202,6 +219,47 @@ void MatrixBenchmark::invert4Orthogonal() {
     CORRADE_VERIFY(a.toVector().sum() != 0);
 }
 
+void MatrixBenchmark::rotation3Svd() {
+    Matrix3x3 a = Data3x3;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Triple<Matrix3x3, Math::Vector<3, Float>, Matrix3x3> uwv{*Math::Algorithms::svd(a)};
+        a = uwv.first()*uwv.third().transposed()*Data3x3Scaling;
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0);
+}
+
+void MatrixBenchmark::rotation3PolarDecomposition() {
+    Matrix3x3 a = Data3x3;
+    CORRADE_BENCHMARK(Repeats) {
+        a = Math::Algorithms::polarDecomposition(a).first()*Data3x3Scaling;
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0);
+}
+
+void MatrixBenchmark::eigen3Svd() {
+    /* For a symmetric positive definite matrix, the SVD is equivalent to the
+       eigendecomposition */
+    Matrix3x3 a = Data3x3Symmetric;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Triple<Matrix3x3, Math::Vector<3, Float>, Matrix3x3> uwv{*Math::Algorithms::svd(a)};
+        a = uwv.first()*Matrix3x3::fromDiagonal(uwv.second())*uwv.third().transposed();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0);
+}
+
+void MatrixBenchmark::eigen3SymmetricEigen() {
+    Matrix3x3 a = Data3x3Symmetric;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Pair<Matrix3x3, Math::Vector<3, Float>> vl = Math::Algorithms::symmetricEigen(a);
+        a = vl.first()*Matrix3x3::fromDiagonal(vl.second())*vl.first().transposed();
+    }
+
+    CORRADE_VERIFY(a.toVector().sum() != 0);
+}
+
 void MatrixBenchmark::transformVector3() {
     Vector2 a{3.0f, -2.2f};
     CORRADE_BENCHMARK(Repeats) {
@@ -0,0 +1,313 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+/* Contiguous views are processed with a SIMD-optimized kernel if available,
+   non-contiguous views with short rows go through a generic scalar loop. The
+   benchmarks compare the two with the same amount of values processed. */
+
+struct PackingBatchBenchmark: TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    template<class T> void unpackContiguous();
+    template<class T> void unpackStrided();
+    template<class T> void packContiguous();
+    template<class T> void packStrided();
+    template<class T> void castToFloatContiguous();
+    template<class T> void castToFloatStrided();
+    template<class T> void castFromFloatContiguous();
+    template<class T> void castFromFloatStrided();
+
+    void unpackHalfContiguous();
+    void unpackHalfStrided();
+    void packHalfContiguous();
+    void packHalfStrided();
+};
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addBenchmarks({
+        &PackingBatchBenchmark::unpackContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::unpackStrided<UnsignedByte>,
+        &PackingBatchBenchmark::unpackContiguous<Byte>,
+        &PackingBatchBenchmark::unpackStrided<Byte>,
+        &PackingBatchBenchmark::unpackContiguous<UnsignedShort>,
+        &PackingBatchBenchmark::unpackStrided<UnsignedShort>,
+        &PackingBatchBenchmark::unpackContiguous<Short>,
+        &PackingBatchBenchmark::unpackStrided<Short>,
+
+        &PackingBatchBenchmark::packContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::packStrided<UnsignedByte>,
+        &PackingBatchBenchmark::packContiguous<Byte>,
+        &PackingBatchBenchmark::packStrided<Byte>,
+        &PackingBatchBenchmark::packContiguous<UnsignedShort>,
+        &PackingBatchBenchmark::packStrided<UnsignedShort>,
+        &PackingBatchBenchmark::packContiguous<Short>,
+        &PackingBatchBenchmark::packStrided<Short>,
+
+        &PackingBatchBenchmark::castToFloatContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::castToFloatStrided<UnsignedByte>,
+        &PackingBatchBenchmark::castToFloatContiguous<Short>,
+        &PackingBatchBenchmark::castToFloatStrided<Short>,
+        &PackingBatchBenchmark::castToFloatContiguous<Int>,
+        &PackingBatchBenchmark::castToFloatStrided<Int>,
+
+        &PackingBatchBenchmark::castFromFloatContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::castFromFloatStrided<UnsignedByte>,
+        &PackingBatchBenchmark::castFromFloatContiguous<Short>,
+        &PackingBatchBenchmark::castFromFloatStrided<Short>,
+        &PackingBatchBenchmark::castFromFloatContiguous<Int>,
+        &PackingBatchBenchmark::castFromFloatStrided<Int>,
+
+        &PackingBatchBenchmark::unpackHalfContiguous,
+        &PackingBatchBenchmark::unpackHalfStrided,
+        &PackingBatchBenchmark::packHalfContiguous,
+        &PackingBatchBenchmark::packHalfStrided}, 10);
+}
+
+/* A million three-component vectors */
+enum: std::size_t { Size = 1024*1024 };
+
+template<class T> void PackingBatchBenchmark::unpackContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<T>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector3<T>{T(i), T(i*3), T(i*7)};
+    Containers::Array<Math::Vector3<Float>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, T>(Containers::stridedArrayView(src));
+    const auto dstView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst));
+    CORRADE_VERIFY(srcView.isContiguous());
+    CORRADE_VERIFY(dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        unpackInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1], (Math::unpack<Math::Vector3<Float>>(src[Size - 1])));
+}
+
+template<class T> void PackingBatchBenchmark::unpackStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector4<T>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector4<T>{T(i), T(i*3), T(i*7), T{}};
+    Containers::Array<Math::Vector4<Float>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, T>(Containers::stridedArrayView(src)).prefix({Size, 3});
+    const auto dstView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)).prefix({Size, 3});
+    CORRADE_VERIFY(!srcView.isContiguous());
+    CORRADE_VERIFY(!dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        unpackInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1].xyz(), (Math::unpack<Math::Vector3<Float>>(src[Size - 1].xyz())));
+}
+
+template<class T> void PackingBatchBenchmark::packContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<Float>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector3<Float>{Float(i%101), Float(i%37), Float(i%13)}/101.0f;
+    Containers::Array<Math::Vector3<T>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(src));
+    const auto dstView = Containers::arrayCast<2, T>(Containers::stridedArrayView(dst));
+    CORRADE_VERIFY(srcView.isContiguous());
+    CORRADE_VERIFY(dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        packInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1], Math::pack<Math::Vector3<T>>(src[Size - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::packStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector4<Float>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector4<Float>{Float(i%101), Float(i%37), Float(i%13), 0.0f}/101.0f;
+    Containers::Array<Math::Vector4<T>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)).prefix({Size, 3});
+    const auto dstView = Containers::arrayCast<2, T>(Containers::stridedArrayView(dst)).prefix({Size, 3});
+    CORRADE_VERIFY(!srcView.isContiguous());
+    CORRADE_VERIFY(!dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        packInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1].xyz(), Math::pack<Math::Vector3<T>>(src[Size - 1].xyz()));
+}
+
+template<class T> void PackingBatchBenchmark::castToFloatContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<T>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector3<T>{T(i), T(i*3), T(i*7)};
+    Containers::Array<Math::Vector3<Float>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, T>(Containers::stridedArrayView(src));
+    const auto dstView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst));
+    CORRADE_VERIFY(srcView.isContiguous());
+    CORRADE_VERIFY(dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        castInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1], Math::Vector3<Float>{src[Size - 1]});
+}
+
+template<class T> void PackingBatchBenchmark::castToFloatStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector4<T>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector4<T>{T(i), T(i*3), T(i*7), T{}};
+    Containers::Array<Math::Vector4<Float>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, T>(Containers::stridedArrayView(src)).prefix({Size, 3});
+    const auto dstView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)).prefix({Size, 3});
+    CORRADE_VERIFY(!srcView.isContiguous());
+    CORRADE_VERIFY(!dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        castInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1].xyz(), Math::Vector3<Float>{src[Size - 1].xyz()});
+}
+
+template<class T> void PackingBatchBenchmark::castFromFloatContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector3<Float>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector3<Float>{Float(i%101), Float(i%37), Float(i%13)};
+    Containers::Array<Math::Vector3<T>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(src));
+    const auto dstView = Containers::arrayCast<2, T>(Containers::stridedArrayView(dst));
+    CORRADE_VERIFY(srcView.isContiguous());
+    CORRADE_VERIFY(dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        castInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1], Math::Vector3<T>{src[Size - 1]});
+}
+
+template<class T> void PackingBatchBenchmark::castFromFloatStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Math::Vector4<Float>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector4<Float>{Float(i%101), Float(i%37), Float(i%13), 0.0f};
+    Containers::Array<Math::Vector4<T>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)).prefix({Size, 3});
+    const auto dstView = Containers::arrayCast<2, T>(Containers::stridedArrayView(dst)).prefix({Size, 3});
+    CORRADE_VERIFY(!srcView.isContiguous());
+    CORRADE_VERIFY(!dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        castInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1].xyz(), Math::Vector3<T>{src[Size - 1].xyz()});
+}
+
+void PackingBatchBenchmark::unpackHalfContiguous() {
+    Containers::Array<Math::Vector3<UnsignedShort>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::packHalf(Math::Vector3<Float>{Float(i%101), Float(i%37), -Float(i%13)}/13.0f);
+    Containers::Array<Math::Vector3<Float>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(src));
+    const auto dstView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst));
+    CORRADE_VERIFY(srcView.isContiguous());
+    CORRADE_VERIFY(dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        unpackHalfInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1], Math::Vector3<Float>{Math::unpackHalf(src[Size - 1])});
+}
+
+void PackingBatchBenchmark::unpackHalfStrided() {
+    Containers::Array<Math::Vector4<UnsignedShort>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::packHalf(Math::Vector4<Float>{Float(i%101), Float(i%37), -Float(i%13), 0.0f}/13.0f);
+    Containers::Array<Math::Vector4<Float>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(src)).prefix({Size, 3});
+    const auto dstView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)).prefix({Size, 3});
+    CORRADE_VERIFY(!srcView.isContiguous());
+    CORRADE_VERIFY(!dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        unpackHalfInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1].xyz(), Math::Vector3<Float>{Math::unpackHalf(src[Size - 1].xyz())});
+}
+
+void PackingBatchBenchmark::packHalfContiguous() {
+    Containers::Array<Math::Vector3<Float>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector3<Float>{Float(i%101), Float(i%37), -Float(i%13)}/13.0f;
+    Containers::Array<Math::Vector3<UnsignedShort>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(src));
+    const auto dstView = Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(dst));
+    CORRADE_VERIFY(srcView.isContiguous());
+    CORRADE_VERIFY(dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        packHalfInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1], Math::Vector3<UnsignedShort>{Math::packHalf(src[Size - 1])});
+}
+
+void PackingBatchBenchmark::packHalfStrided() {
+    Containers::Array<Math::Vector4<Float>> src{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i)
+        src[i] = Math::Vector4<Float>{Float(i%101), Float(i%37), -Float(i%13), 0.0f}/13.0f;
+    Containers::Array<Math::Vector4<UnsignedShort>> dst{NoInit, Size};
+
+    const auto srcView = Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)).prefix({Size, 3});
+    const auto dstView = Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(dst)).prefix({Size, 3});
+    CORRADE_VERIFY(!srcView.isContiguous());
+    CORRADE_VERIFY(!dstView.isContiguous());
+    CORRADE_BENCHMARK(1)
+        packHalfInto(srcView, dstView);
+
+    CORRADE_COMPARE(dst[Size - 1].xyz(), Math::Vector3<UnsignedShort>{Math::packHalf(src[Size - 1].xyz())});
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
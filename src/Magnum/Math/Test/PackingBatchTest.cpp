@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -48,8 +49,14 @@ struct PackingBatchTest: TestSuite::Tester {
     void packSignedByte();
     void packSignedShort();
 
+    template<class T> void unpackContiguous();
+    template<class T> void packContiguous();
+    template<class T> void castContiguous();
+
     void unpackHalf();
     void packHalf();
+    void unpackHalfContiguous();
+    void packHalfContiguous();
 
     template<class FloatingPoint, class Integral> void castUnsignedFloatingPoint();
     template<class FloatingPoint, class Integral> void castSignedFloatingPoint();
@@ -73,8 +80,24 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::packSignedByte,
               &PackingBatchTest::packSignedShort,
 
+              &PackingBatchTest::unpackContiguous<UnsignedByte>,
+              &PackingBatchTest::unpackContiguous<UnsignedShort>,
+              &PackingBatchTest::unpackContiguous<Byte>,
+              &PackingBatchTest::unpackContiguous<Short>,
+              &PackingBatchTest::packContiguous<UnsignedByte>,
+              &PackingBatchTest::packContiguous<UnsignedShort>,
+              &PackingBatchTest::packContiguous<Byte>,
+              &PackingBatchTest::packContiguous<Short>,
+              &PackingBatchTest::castContiguous<UnsignedByte>,
+              &PackingBatchTest::castContiguous<UnsignedShort>,
+              &PackingBatchTest::castContiguous<Byte>,
+              &PackingBatchTest::castContiguous<Short>,
+              &PackingBatchTest::castContiguous<Int>,
+
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
+              &PackingBatchTest::unpackHalfContiguous,
+              &PackingBatchTest::packHalfContiguous,
 
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedByte>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedShort>,
@@ -416,6 +439,102 @@ void PackingBatchTest::packSignedShort() {
         CORRADE_COMPARE(Math::pack<Vector2s>(data[i].src), data[i].dst);
 }
 
+template<class T> void PackingBatchTest::unpackContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Contiguous views and views with long enough rows go through a separate
+       code path that's SIMD-optimized on certain platforms. The size is
+       chosen to have a remaining tail that isn't a multiple of the SIMD
+       width. */
+    T src[4*37];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        src[i] = T(i*2731);
+
+    Float dst[4*37];
+    unpackInto(Containers::StridedArrayView2D<const T>{src, {37, 4}},
+        Containers::StridedArrayView2D<Float>{dst, {37, 4}});
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Math::unpack<Float>(src[i]));
+    }
+
+    /* Non-contiguous rows that are long enough, the last three items of
+       each row stay untouched */
+    Float dstRows[4*37]{};
+    unpackInto(Containers::StridedArrayView2D<const T>{src, {4, 37}}.prefix({4, 34}),
+        Containers::StridedArrayView2D<Float>{dstRows, {4, 37}}.prefix({4, 34}));
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dstRows[i], i % 37 < 34 ? Math::unpack<Float>(src[i]) : 0.0f);
+    }
+}
+
+template<class T> void PackingBatchTest::packContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Contiguous views and views with long enough rows go through a separate
+       code path that's SIMD-optimized on certain platforms. The size is
+       chosen to have a remaining tail that isn't a multiple of the SIMD
+       width. The values are chosen to include exact halves to verify the
+       rounding is consistent. */
+    constexpr Float min = std::is_signed<T>::value ? -1.0f : 0.0f;
+    constexpr Float bitMax = Math::Implementation::bitMax<T>();
+    Float src[4*37];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        const Float value = min + (1.0f - min)*i/Containers::arraySize(src);
+        src[i] = i % 2 ? value : (Math::floor(value*bitMax) + 0.5f)/bitMax;
+    }
+    /* The above doesn't reach the upper bound, so add it explicitly */
+    src[Containers::arraySize(src) - 1] = 1.0f;
+
+    T dst[4*37];
+    packInto(Containers::StridedArrayView2D<const Float>{src, {37, 4}},
+        Containers::StridedArrayView2D<T>{dst, {37, 4}});
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Math::pack<T>(src[i]));
+    }
+
+    /* Non-contiguous rows that are long enough, the last three items of
+       each row stay untouched */
+    T dstRows[4*37]{};
+    packInto(Containers::StridedArrayView2D<const Float>{src, {4, 37}}.prefix({4, 34}),
+        Containers::StridedArrayView2D<T>{dstRows, {4, 37}}.prefix({4, 34}));
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dstRows[i], i % 37 < 34 ? Math::pack<T>(src[i]) : T{});
+    }
+}
+
+template<class T> void PackingBatchTest::castContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Contiguous views go through a separate code path that's SIMD-optimized
+       on certain platforms. The size is chosen to have a remaining tail that
+       isn't a multiple of the SIMD width. */
+    T src[4*37];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        src[i] = T(i*2731);
+
+    Float dst[4*37];
+    castInto(Containers::StridedArrayView2D<const T>{src, {37, 4}},
+        Containers::StridedArrayView2D<Float>{dst, {37, 4}});
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Float(src[i]));
+    }
+
+    /* Test the other way around as well, with the fractional part being
+       discarded */
+    for(Float& i: dst) i += 0.75f*Math::sign(i);
+    T dstIntegral[4*37];
+    castInto(Containers::StridedArrayView2D<const Float>{dst, {37, 4}},
+        Containers::StridedArrayView2D<T>{dstIntegral, {37, 4}});
+    CORRADE_COMPARE_AS(Containers::arrayView(dstIntegral),
+        Containers::arrayView(src),
+        TestSuite::Compare::Container);
+}
+
 void PackingBatchTest::unpackHalf() {
     /* Test data adapted from HalfTest */
     struct Data {
@@ -484,6 +603,64 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+void PackingBatchTest::unpackHalfContiguous() {
+    /* Contiguous views go through a separate code path that's SIMD-optimized
+       on certain platforms. Check that it gives bit-identical results to the
+       scalar code path for all possible inputs, including NaNs with various
+       payloads. */
+    Containers::Array<UnsignedShort> src{NoInit, 65536};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = UnsignedShort(i);
+
+    Containers::Array<Float> dst{NoInit, 65536};
+    unpackHalfInto(Containers::StridedArrayView2D<const UnsignedShort>{Containers::arrayView(src), {256, 256}},
+        Containers::StridedArrayView2D<Float>{Containers::arrayView(dst), {256, 256}});
+
+    /* Every other item and a row of one element, which goes through the
+       scalar code path */
+    Containers::Array<Float> expected{NoInit, 65536*2};
+    unpackHalfInto(Containers::StridedArrayView2D<const UnsignedShort>{Containers::arrayView(src), {65536, 1}},
+        Containers::StridedArrayView2D<Float>{Containers::arrayView(expected), {65536, 1}, {8, 4}});
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(Containers::stridedArrayView(dst)),
+        Containers::arrayCast<const UnsignedInt>(Containers::stridedArrayView(expected).every(2)),
+        TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::packHalfContiguous() {
+    /* Like unpackHalfContiguous(), but with all representable half values,
+       values in between them that have to be rounded and values that
+       overflow, in both signs, together with various NaN payloads */
+    Containers::Array<UnsignedInt> src{NoInit, 65536*4};
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        const UnsignedInt sign = (i & 0x8000) << 16;
+        /* Exponent and mantissa spanning the whole float range in coarse
+           steps, with the lowest mantissa bits filled to test rounding */
+        src[i*4 + 0] = sign|((i & 0x7fff) << 16)|(i & 0xffff);
+        src[i*4 + 1] = sign|((i & 0x7fff) << 16)|0x1000;
+        src[i*4 + 2] = sign|((i & 0x7fff) << 16);
+        /* Values just around the half range limits */
+        src[i*4 + 3] = sign|(0x477fe000 + (i & 0x7fff));
+    }
+
+    Containers::Array<UnsignedShort> dst{NoInit, 65536*4};
+    packHalfInto(Containers::StridedArrayView2D<const Float>{Containers::arrayCast<const Float>(src), {1024, 256}},
+        Containers::StridedArrayView2D<UnsignedShort>{Containers::arrayView(dst), {1024, 256}});
+
+    Containers::Array<UnsignedShort> expected{NoInit, 65536*4*2};
+    packHalfInto(Containers::StridedArrayView2D<const Float>{Containers::arrayCast<const Float>(src), {65536*4, 1}},
+        Containers::StridedArrayView2D<UnsignedShort>{Containers::arrayView(expected), {65536*4, 1}, {4, 2}});
+    CORRADE_COMPARE_AS(Containers::stridedArrayView(dst),
+        Containers::stridedArrayView(expected).every(2),
+        TestSuite::Compare::Container);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    const Containers::ArrayView<const Float> srcFloat = Containers::arrayCast<const Float>(src);
+    for(std::size_t i = 0; i < srcFloat.size(); i += 257) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Math::packHalf(srcFloat[i]));
+    }
+}
+
 template<class FloatingPoint, class Integral> void PackingBatchTest::castUnsignedFloatingPoint() {
     setTestCaseTemplateName({TypeTraits<FloatingPoint>::name(), TypeTraits<Integral>::name()});
 
@@ -0,0 +1,316 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Jonathan Hale <squareys@googlemail.com>
+    Copyright © 2020 janos <janos.meny@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct QuaternionBatchTest: TestSuite::Tester {
+    explicit QuaternionBatchTest();
+
+    void normalize();
+    void normalizeDual();
+
+    void lerp();
+    void lerpShortestPath();
+    void slerp();
+    void slerpShortestPath();
+    void slerpShortestPathFast();
+    void sclerp();
+    void sclerpShortestPath();
+
+    void assertions();
+    void assertionsNotNormalized();
+};
+
+using namespace Literals;
+
+using Magnum::Deg;
+using Magnum::DualQuaternion;
+using Magnum::Quaternion;
+using Magnum::Vector3;
+
+QuaternionBatchTest::QuaternionBatchTest() {
+    addTests({&QuaternionBatchTest::normalize,
+              &QuaternionBatchTest::normalizeDual,
+
+              &QuaternionBatchTest::lerp,
+              &QuaternionBatchTest::lerpShortestPath,
+              &QuaternionBatchTest::slerp,
+              &QuaternionBatchTest::slerpShortestPath,
+              &QuaternionBatchTest::slerpShortestPathFast,
+              &QuaternionBatchTest::sclerp,
+              &QuaternionBatchTest::sclerpShortestPath,
+
+              &QuaternionBatchTest::assertions,
+              &QuaternionBatchTest::assertionsNotNormalized});
+}
+
+/* More than one block to verify the block boundaries are handled correctly */
+enum: std::size_t { Size = 150 };
+
+struct Data {
+    Quaternion a[Size], b[Size];
+    DualQuaternion dualA[Size], dualB[Size];
+    Float t[Size];
+};
+
+/* Quaternion pairs with all kinds of mutual angles, including the same and
+   opposite quaternions that hit the linear interpolation fallback in slerp()
+   and sclerp() */
+Data data() {
+    Data out;
+    for(std::size_t i = 0; i != Size; ++i) {
+        out.a[i] = Quaternion::rotation(Deg(Float(i)*37.0f), Vector3{1.0f, Float(i % 3), 2.0f}.normalized());
+        if(i % 10 == 3)
+            out.b[i] = out.a[i];
+        else if(i % 10 == 7)
+            out.b[i] = -out.a[i];
+        else
+            out.b[i] = Quaternion::rotation(Deg(Float(i)*11.0f - 500.0f), Vector3{Float(i % 5), -1.0f, 0.5f}.normalized());
+
+        out.dualA[i] = DualQuaternion::translation({Float(i), 2.0f, -1.0f})*DualQuaternion{out.a[i]};
+        out.dualB[i] = DualQuaternion::translation({3.0f, -Float(i)*0.5f, 0.0f})*DualQuaternion{out.b[i]};
+        /* Not containing 0.5, as lerp() of two opposite quaternions would
+           result in a zero quaternion that can't be normalized */
+        out.t[i] = Float(i % 8)/7.0f;
+    }
+    return out;
+}
+
+void QuaternionBatchTest::normalize() {
+    Quaternion src[Size];
+    Quaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i) {
+        src[i] = {{Float(i), 1.0f - Float(i % 7), 2.5f}, -Float(i % 13)};
+        expected[i] = src[i].normalized();
+    }
+
+    Quaternion out[Size];
+    normalizeInto(src, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    for(const Quaternion& i: out)
+        CORRADE_VERIFY(i.isNormalized());
+
+    /* In-place */
+    normalizeInto(src, src);
+    CORRADE_COMPARE_AS(Containers::arrayView(src),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::normalizeDual() {
+    DualQuaternion src[Size];
+    DualQuaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i) {
+        src[i] = {{{Float(i), 1.0f - Float(i % 7), 2.5f}, -Float(i % 13)},
+                  {{0.5f, Float(i % 3), -Float(i)}, 1.0f}};
+        expected[i] = src[i].normalized();
+    }
+
+    DualQuaternion out[Size];
+    normalizeInto(src, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* In-place, with a strided view */
+    Containers::StridedArrayView1D<DualQuaternion> srcEveryOther = Containers::stridedArrayView(src).every(2);
+    normalizeInto(srcEveryOther, srcEveryOther);
+    CORRADE_COMPARE_AS(srcEveryOther,
+        Containers::stridedArrayView(expected).every(2),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::lerp() {
+    const Data d = data();
+
+    Quaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i)
+        expected[i] = Math::lerp(d.a[i], d.b[i], d.t[i]);
+
+    Quaternion out[Size];
+    lerpInto(d.a, d.b, d.t, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::lerpShortestPath() {
+    const Data d = data();
+
+    Quaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i)
+        expected[i] = Math::lerpShortestPath(d.a[i], d.b[i], d.t[i]);
+
+    Quaternion out[Size];
+    lerpShortestPathInto(d.a, d.b, d.t, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::slerp() {
+    const Data d = data();
+
+    Quaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i)
+        expected[i] = Math::slerp(d.a[i], d.b[i], d.t[i]);
+
+    Quaternion out[Size];
+    slerpInto(d.a, d.b, d.t, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::slerpShortestPath() {
+    const Data d = data();
+
+    Quaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i)
+        expected[i] = Math::slerpShortestPath(d.a[i], d.b[i], d.t[i]);
+
+    Quaternion out[Size];
+    slerpShortestPathInto(d.a, d.b, d.t, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::slerpShortestPathFast() {
+    const Data d = data();
+
+    Quaternion out[Size];
+    slerpShortestPathFastInto(d.a, d.b, d.t, out);
+    for(std::size_t i = 0; i != Size; ++i) {
+        CORRADE_ITERATION(i);
+        const Quaternion expected = Math::slerpShortestPath(d.a[i], d.b[i], d.t[i]);
+        CORRADE_VERIFY(out[i].isNormalized());
+        for(std::size_t j = 0; j != 4; ++j) {
+            CORRADE_ITERATION(j);
+            CORRADE_COMPARE_WITH(out[i].data()[j], expected.data()[j],
+                TestSuite::Compare::around(0.0005f));
+        }
+    }
+}
+
+void QuaternionBatchTest::sclerp() {
+    const Data d = data();
+
+    DualQuaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i)
+        expected[i] = Math::sclerp(d.dualA[i], d.dualB[i], d.t[i]);
+
+    DualQuaternion out[Size];
+    sclerpInto(d.dualA, d.dualB, d.t, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::sclerpShortestPath() {
+    const Data d = data();
+
+    DualQuaternion expected[Size];
+    for(std::size_t i = 0; i != Size; ++i)
+        expected[i] = Math::sclerpShortestPath(d.dualA[i], d.dualB[i], d.t[i]);
+
+    DualQuaternion out[Size];
+    sclerpShortestPathInto(d.dualA, d.dualB, d.t, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Quaternion a[3];
+    const Quaternion b[2];
+    const DualQuaternion dualA[3];
+    const DualQuaternion dualB[2];
+    const Float t[3]{};
+    Quaternion out[3];
+    DualQuaternion dualOut[3];
+
+    Containers::String outString;
+    Error redirectError{&outString};
+    normalizeInto(a, Containers::arrayView(out).prefix(2));
+    normalizeInto(dualA, Containers::arrayView(dualOut).prefix(2));
+    lerpInto(a, b, t, out);
+    lerpShortestPathInto(a, a, Containers::arrayView(t).prefix(2), out);
+    slerpInto(a, a, t, Containers::arrayView(out).prefix(2));
+    slerpShortestPathInto(a, b, t, out);
+    slerpShortestPathFastInto(a, b, t, out);
+    sclerpInto(dualA, dualB, t, dualOut);
+    sclerpShortestPathInto(dualA, dualA, t, Containers::arrayView(dualOut).prefix(2));
+    CORRADE_COMPARE(outString,
+        "Math::normalizeInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::normalizeInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::lerpInto(): expected quaternion, factor and output views to have the same size, got 3, 2, 3 and 3\n"
+        "Math::lerpShortestPathInto(): expected quaternion, factor and output views to have the same size, got 3, 3, 2 and 3\n"
+        "Math::slerpInto(): expected quaternion, factor and output views to have the same size, got 3, 3, 3 and 2\n"
+        "Math::slerpShortestPathInto(): expected quaternion, factor and output views to have the same size, got 3, 2, 3 and 3\n"
+        "Math::slerpShortestPathFastInto(): expected quaternion, factor and output views to have the same size, got 3, 2, 3 and 3\n"
+        "Math::sclerpInto(): expected dual quaternion, factor and output views to have the same size, got 3, 2, 3 and 3\n"
+        "Math::sclerpShortestPathInto(): expected dual quaternion, factor and output views to have the same size, got 3, 3, 3 and 2\n");
+}
+
+void QuaternionBatchTest::assertionsNotNormalized() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    Quaternion a[70];
+    Quaternion b[70];
+    const Float t[70]{};
+    Quaternion out[70];
+    /* In the second block */
+    b[67] *= 2.0f;
+
+    Containers::String outString;
+    Error redirectError{&outString};
+    lerpInto(a, b, t, out);
+    slerpShortestPathFastInto(b, a, t, out);
+    CORRADE_COMPARE(outString,
+        "Math::lerpInto(): quaternions Quaternion({0, 0, 0}, 1) and Quaternion({0, 0, 0}, 2) at index 67 are not normalized\n"
+        "Math::slerpShortestPathFastInto(): quaternions Quaternion({0, 0, 0}, 2) and Quaternion({0, 0, 0}, 1) at index 67 are not normalized\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::QuaternionBatchTest)
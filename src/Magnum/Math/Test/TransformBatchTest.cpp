@@ -0,0 +1,330 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/TransformBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct TransformBatchTest: TestSuite::Tester {
+    explicit TransformBatchTest();
+
+    template<class T> void vectors2D();
+    template<class T> void vectors3D();
+    template<class T> void points2D();
+    template<class T> void points3D();
+    template<class T> void pointsHomogeneous();
+    template<class T> void normals2D();
+    template<class T> void normals3D();
+
+    void strided();
+    void inPlace();
+
+    void assertions();
+};
+
+
+TransformBatchTest::TransformBatchTest() {
+    addTests({&TransformBatchTest::vectors2D<Float>,
+              &TransformBatchTest::vectors2D<Double>,
+              &TransformBatchTest::vectors3D<Float>,
+              &TransformBatchTest::vectors3D<Double>,
+              &TransformBatchTest::points2D<Float>,
+              &TransformBatchTest::points2D<Double>,
+              &TransformBatchTest::points3D<Float>,
+              &TransformBatchTest::points3D<Double>,
+              &TransformBatchTest::pointsHomogeneous<Float>,
+              &TransformBatchTest::pointsHomogeneous<Double>,
+              &TransformBatchTest::normals2D<Float>,
+              &TransformBatchTest::normals2D<Double>,
+              &TransformBatchTest::normals3D<Float>,
+              &TransformBatchTest::normals3D<Double>,
+
+              &TransformBatchTest::strided,
+              &TransformBatchTest::inPlace,
+
+              &TransformBatchTest::assertions});
+}
+
+template<class T> Matrix3<T> transformation2D() {
+    return
+        Matrix3<T>::translation({T(1.5), T(-3.0)})*
+        Matrix3<T>::rotation(Deg<T>(T(35.0)))*
+        Matrix3<T>::scaling({T(2.0), T(-0.5)});
+}
+
+template<class T> Matrix4<T> transformation3D() {
+    return
+        Matrix4<T>::translation({T(1.5), T(-3.0), T(0.25)})*
+        Matrix4<T>::rotation(Deg<T>(T(35.0)), Vector3<T>{T(1.0), T(2.0), T(-0.5)}.normalized())*
+        Matrix4<T>::scaling({T(2.0), T(-0.5), T(3.0)});
+}
+
+template<class T> void TransformBatchTest::vectors2D() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3<T> matrix = transformation2D<T>();
+    const Vector2<T> src[]{
+        {T(1.0), T(0.0)},
+        {T(-2.5), T(3.0)},
+        {T(0.0), T(0.0)},
+        {T(7.0), T(-0.125)},
+    };
+    Vector2<T> dst[Containers::arraySize(src)];
+    Vector2<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = matrix.transformVector(src[i]);
+
+    transformVectorsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void TransformBatchTest::vectors3D() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix4<T> matrix = transformation3D<T>();
+    const Vector3<T> src[]{
+        {T(1.0), T(0.0), T(0.0)},
+        {T(-2.5), T(3.0), T(0.5)},
+        {T(0.0), T(0.0), T(0.0)},
+        {T(7.0), T(-0.125), T(-4.0)},
+    };
+    Vector3<T> dst[Containers::arraySize(src)];
+    Vector3<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = matrix.transformVector(src[i]);
+
+    transformVectorsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void TransformBatchTest::points2D() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3<T> matrix = transformation2D<T>();
+    const Vector2<T> src[]{
+        {T(1.0), T(0.0)},
+        {T(-2.5), T(3.0)},
+        {T(0.0), T(0.0)},
+        {T(7.0), T(-0.125)},
+    };
+    Vector2<T> dst[Containers::arraySize(src)];
+    Vector2<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = matrix.transformPoint(src[i]);
+
+    transformPointsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void TransformBatchTest::points3D() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Using a projection matrix to verify the division by W is done as
+       well */
+    const Matrix4<T> matrix = Matrix4<T>::perspectiveProjection(Deg<T>(T(60.0)), T(1.5), T(0.5), T(50.0))*transformation3D<T>();
+    const Vector3<T> src[]{
+        {T(1.0), T(0.0), T(-3.0)},
+        {T(-2.5), T(3.0), T(0.5)},
+        {T(0.0), T(0.0), T(-10.0)},
+        {T(7.0), T(-0.125), T(-4.0)},
+    };
+    Vector3<T> dst[Containers::arraySize(src)];
+    Vector3<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = matrix.transformPoint(src[i]);
+
+    transformPointsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void TransformBatchTest::pointsHomogeneous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix4<T> matrix = Matrix4<T>::perspectiveProjection(Deg<T>(T(60.0)), T(1.5), T(0.5), T(50.0))*transformation3D<T>();
+    const Vector4<T> src[]{
+        {T(1.0), T(0.0), T(-3.0), T(1.0)},
+        {T(-2.5), T(3.0), T(0.5), T(0.0)},
+        {T(0.0), T(0.0), T(-10.0), T(2.0)},
+        {T(7.0), T(-0.125), T(-4.0), T(-0.5)},
+    };
+    Vector4<T> dst[Containers::arraySize(src)];
+    Vector4<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = matrix*src[i];
+
+    transformPointsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void TransformBatchTest::normals2D() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix3<T> matrix = transformation2D<T>();
+    const Vector2<T> src[]{
+        {T(1.0), T(0.0)},
+        Vector2<T>{T(-2.5), T(3.0)}.normalized(),
+        {T(0.0), T(-1.0)},
+        Vector2<T>{T(7.0), T(-0.125)}.normalized(),
+    };
+    Vector2<T> dst[Containers::arraySize(src)];
+    Vector2<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = (matrix.rotationScaling().inverted().transposed()*src[i]).normalized();
+
+    transformNormalsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    for(const Vector2<T>& i: dst) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(i.isNormalized());
+    }
+}
+
+template<class T> void TransformBatchTest::normals3D() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Matrix4<T> matrix = transformation3D<T>();
+    const Vector3<T> src[]{
+        {T(1.0), T(0.0), T(0.0)},
+        Vector3<T>{T(-2.5), T(3.0), T(0.5)}.normalized(),
+        {T(0.0), T(0.0), T(-1.0)},
+        Vector3<T>{T(7.0), T(-0.125), T(-4.0)}.normalized(),
+    };
+    Vector3<T> dst[Containers::arraySize(src)];
+    Vector3<T> expected[Containers::arraySize(src)];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = (matrix.normalMatrix()*src[i]).normalized();
+
+    transformNormalsInto(matrix, src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    for(const Vector3<T>& i: dst) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(i.isNormalized());
+    }
+}
+
+void TransformBatchTest::strided() {
+    /* The contiguous case goes through a different code path, verify that
+       the strided one gives the same result */
+    const Matrix4<Float> matrix = transformation3D<Float>();
+
+    struct Vertex {
+        Vector3<Float> position;
+        Vector3<Float> normal;
+    } vertices[]{
+        {{1.0f, 0.0f, -3.0f}, {1.0f, 0.0f, 0.0f}},
+        {{-2.5f, 3.0f, 0.5f}, {0.0f, 1.0f, 0.0f}},
+        {{7.0f, -0.125f, -4.0f}, {0.0f, 0.0f, 1.0f}},
+    };
+    Vector3<Float> positions[Containers::arraySize(vertices)];
+    Vector3<Float> normals[Containers::arraySize(vertices)];
+
+    const auto view = Containers::stridedArrayView(vertices);
+    transformPointsInto(matrix, view.slice(&Vertex::position), positions);
+    transformNormalsInto(matrix, view.slice(&Vertex::normal), normals);
+    for(std::size_t i = 0; i != Containers::arraySize(vertices); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(positions[i], matrix.transformPoint(vertices[i].position));
+        CORRADE_COMPARE(normals[i], (matrix.normalMatrix()*vertices[i].normal).normalized());
+    }
+
+    /* Transforming into a strided view as well */
+    transformPointsInto(matrix, view.slice(&Vertex::position), view.slice(&Vertex::normal));
+    for(std::size_t i = 0; i != Containers::arraySize(vertices); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(vertices[i].normal, positions[i]);
+    }
+}
+
+void TransformBatchTest::inPlace() {
+    const Matrix4<Float> matrix = transformation3D<Float>();
+
+    Vector3<Float> data[]{
+        {1.0f, 0.0f, -3.0f},
+        {-2.5f, 3.0f, 0.5f},
+        {7.0f, -0.125f, -4.0f},
+    };
+    Vector3<Float> expected[Containers::arraySize(data)];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        expected[i] = matrix.transformPoint(matrix.transformVector(data[i]));
+
+    transformVectorsInto(matrix, data, data);
+    transformPointsInto(matrix, data, data);
+    CORRADE_COMPARE_AS(Containers::arrayView(data),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void TransformBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector2<Float> src2[3]{};
+    const Vector3<Float> src3[3]{};
+    const Vector4<Float> src4[3]{};
+    Vector2<Float> dst2[2];
+    Vector3<Float> dst3[2];
+    Vector4<Float> dst4[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    transformVectorsInto(Matrix3<Float>{}, src2, dst2);
+    transformVectorsInto(Matrix4<Float>{}, src3, dst3);
+    transformPointsInto(Matrix3<Float>{}, src2, dst2);
+    transformPointsInto(Matrix4<Float>{}, src3, dst3);
+    transformPointsInto(Matrix4<Float>{}, src4, dst4);
+    transformNormalsInto(Matrix3<Float>{}, src2, dst2);
+    transformNormalsInto(Matrix4<Float>{}, src3, dst3);
+    CORRADE_COMPARE(out,
+        "Math::transformVectorsInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::transformVectorsInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::transformPointsInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::transformPointsInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::transformPointsInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::transformNormalsInto(): expected source and destination views to have the same size, got 3 and 2\n"
+        "Math::transformNormalsInto(): expected source and destination views to have the same size, got 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::TransformBatchTest)
@@ -0,0 +1,276 @@
+#ifndef Magnum_Math_TransformBatch_h
+#define Magnum_Math_TransformBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::transformVectorsInto(), @ref Magnum::Math::transformPointsInto(), @ref Magnum::Math::transformNormalsInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+
+/* If both views are contiguous, the loop goes over plain pointers, which
+   makes it easier for the compiler to vectorize it. The kernel is expected to
+   read the whole input before writing the output in order to support
+   in-place operation. */
+template<class T, class U, class Kernel> void transformBatchInto(const Containers::StridedArrayView1D<const T>& src, const Containers::StridedArrayView1D<U>& dst, const Kernel& kernel) {
+    if(src.isContiguous() && dst.isContiguous()) {
+        const T* const srcData = src.data();
+        U* const dstData = dst.data();
+        for(std::size_t i = 0, max = src.size(); i != max; ++i)
+            kernel(srcData[i], dstData[i]);
+    } else for(std::size_t i = 0, max = src.size(); i != max; ++i)
+        kernel(src[i], dst[i]);
+}
+
+}
+
+/**
+@{ @name Batch transformation functions
+
+These functions transform an unbounded range of vectors or points with a
+single matrix, as opposed to calling @ref Matrix3::transformVector(),
+@ref Matrix4::transformPoint() etc. for each item. The matrix elements are
+extracted just once, and if the views are contiguous, the inner loop operates
+directly on the memory, allowing the compiler to vectorize it. The source and
+destination views are expected to have the same size and can point to the
+same memory for an in-place operation.
+*/
+
+/**
+@brief Transform a range of 2D vectors with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source vectors
+@param[out] dst     Destination vectors
+@m_since_latest
+
+Equivalent to calling @ref Matrix3::transformVector() for each item.
+@see @ref transformPointsInto(), @ref transformNormalsInto(),
+    @ref MeshTools::transformVectorsInPlace()
+*/
+template<class T> void transformVectorsInto(const Matrix3<T>& matrix, const Containers::StridedArrayView1D<const Vector2<typename Matrix3<T>::Type>>& src, const Containers::StridedArrayView1D<Vector2<typename Matrix3<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const T m00 = matrix[0][0], m01 = matrix[0][1];
+    const T m10 = matrix[1][0], m11 = matrix[1][1];
+    Implementation::transformBatchInto(src, dst, [=](const Vector2<T>& in, Vector2<T>& out) {
+        const T x = in[0], y = in[1];
+        out[0] = m00*x + m10*y;
+        out[1] = m01*x + m11*y;
+    });
+}
+
+/**
+@brief Transform a range of 3D vectors with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source vectors
+@param[out] dst     Destination vectors
+@m_since_latest
+
+Equivalent to calling @ref Matrix4::transformVector() for each item.
+@see @ref transformPointsInto(), @ref transformNormalsInto(),
+    @ref MeshTools::transformVectorsInPlace()
+*/
+template<class T> void transformVectorsInto(const Matrix4<T>& matrix, const Containers::StridedArrayView1D<const Vector3<typename Matrix4<T>::Type>>& src, const Containers::StridedArrayView1D<Vector3<typename Matrix4<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const T m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+    const T m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+    const T m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+    Implementation::transformBatchInto(src, dst, [=](const Vector3<T>& in, Vector3<T>& out) {
+        const T x = in[0], y = in[1], z = in[2];
+        out[0] = m00*x + m10*y + m20*z;
+        out[1] = m01*x + m11*y + m21*z;
+        out[2] = m02*x + m12*y + m22*z;
+    });
+}
+
+/**
+@brief Transform a range of 2D points with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source points
+@param[out] dst     Destination points
+@m_since_latest
+
+Equivalent to calling @ref Matrix3::transformPoint() for each item.
+@see @ref transformVectorsInto(), @ref MeshTools::transformPointsInPlace()
+*/
+template<class T> void transformPointsInto(const Matrix3<T>& matrix, const Containers::StridedArrayView1D<const Vector2<typename Matrix3<T>::Type>>& src, const Containers::StridedArrayView1D<Vector2<typename Matrix3<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const T m00 = matrix[0][0], m01 = matrix[0][1];
+    const T m10 = matrix[1][0], m11 = matrix[1][1];
+    const T m20 = matrix[2][0], m21 = matrix[2][1];
+    Implementation::transformBatchInto(src, dst, [=](const Vector2<T>& in, Vector2<T>& out) {
+        const T x = in[0], y = in[1];
+        out[0] = m00*x + m10*y + m20;
+        out[1] = m01*x + m11*y + m21;
+    });
+}
+
+/**
+@brief Transform a range of 3D points with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source points
+@param[out] dst     Destination points
+@m_since_latest
+
+Equivalent to calling @ref Matrix4::transformPoint() for each item, including
+the division by the resulting W component.
+@see @ref transformVectorsInto(), @ref MeshTools::transformPointsInPlace()
+*/
+template<class T> void transformPointsInto(const Matrix4<T>& matrix, const Containers::StridedArrayView1D<const Vector3<typename Matrix4<T>::Type>>& src, const Containers::StridedArrayView1D<Vector3<typename Matrix4<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const T m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2], m03 = matrix[0][3];
+    const T m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2], m13 = matrix[1][3];
+    const T m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2], m23 = matrix[2][3];
+    const T m30 = matrix[3][0], m31 = matrix[3][1], m32 = matrix[3][2], m33 = matrix[3][3];
+    Implementation::transformBatchInto(src, dst, [=](const Vector3<T>& in, Vector3<T>& out) {
+        const T x = in[0], y = in[1], z = in[2];
+        const T w = m03*x + m13*y + m23*z + m33;
+        out[0] = (m00*x + m10*y + m20*z + m30)/w;
+        out[1] = (m01*x + m11*y + m21*z + m31)/w;
+        out[2] = (m02*x + m12*y + m22*z + m32)/w;
+    });
+}
+
+/**
+@brief Transform a range of homogeneous 3D points with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source points
+@param[out] dst     Destination points
+@m_since_latest
+
+Equivalent to multiplying each item with @p matrix. Unlike with the
+three-component overload above, no division by the W component is done, which
+makes this variant suitable for example for transforming into clip space.
+*/
+template<class T> void transformPointsInto(const Matrix4<T>& matrix, const Containers::StridedArrayView1D<const Vector4<typename Matrix4<T>::Type>>& src, const Containers::StridedArrayView1D<Vector4<typename Matrix4<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const T m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2], m03 = matrix[0][3];
+    const T m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2], m13 = matrix[1][3];
+    const T m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2], m23 = matrix[2][3];
+    const T m30 = matrix[3][0], m31 = matrix[3][1], m32 = matrix[3][2], m33 = matrix[3][3];
+    Implementation::transformBatchInto(src, dst, [=](const Vector4<T>& in, Vector4<T>& out) {
+        const T x = in[0], y = in[1], z = in[2], w = in[3];
+        out[0] = m00*x + m10*y + m20*z + m30*w;
+        out[1] = m01*x + m11*y + m21*z + m31*w;
+        out[2] = m02*x + m12*y + m22*z + m32*w;
+        out[3] = m03*x + m13*y + m23*z + m33*w;
+    });
+}
+
+/**
+@brief Transform a range of 2D normals with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source normals
+@param[out] dst     Destination normals
+@m_since_latest
+
+Transforms the normals with a normal matrix calculated from @p matrix, which
+is an inverse transpose of its upper-left 2x2 part, and renormalizes them
+afterwards. Equivalent to calling
+@cpp (matrix.rotationScaling().inverted().transposed()*normal).normalized() @ce
+for each item. Zero-length normals result in NaNs, same as with
+@ref Vector::normalized().
+@see @ref transformVectorsInto()
+*/
+template<class T> void transformNormalsInto(const Matrix3<T>& matrix, const Containers::StridedArrayView1D<const Vector2<typename Matrix3<T>::Type>>& src, const Containers::StridedArrayView1D<Vector2<typename Matrix3<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformNormalsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const Matrix2x2<T> normalMatrix = matrix.rotationScaling().inverted().transposed();
+    const T m00 = normalMatrix[0][0], m01 = normalMatrix[0][1];
+    const T m10 = normalMatrix[1][0], m11 = normalMatrix[1][1];
+    Implementation::transformBatchInto(src, dst, [=](const Vector2<T>& in, Vector2<T>& out) {
+        const T x = in[0], y = in[1];
+        const T outX = m00*x + m10*y;
+        const T outY = m01*x + m11*y;
+        const T lengthInverted = T(1)/std::sqrt(outX*outX + outY*outY);
+        out[0] = outX*lengthInverted;
+        out[1] = outY*lengthInverted;
+    });
+}
+
+/**
+@brief Transform a range of 3D normals with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source normals
+@param[out] dst     Destination normals
+@m_since_latest
+
+Transforms the normals with @ref Matrix4::normalMatrix() and renormalizes them
+afterwards. Equivalent to calling
+@cpp (matrix.normalMatrix()*normal).normalized() @ce for each item. Zero-length
+normals result in NaNs, same as with @ref Vector::normalized().
+@see @ref transformVectorsInto()
+*/
+template<class T> void transformNormalsInto(const Matrix4<T>& matrix, const Containers::StridedArrayView1D<const Vector3<typename Matrix4<T>::Type>>& src, const Containers::StridedArrayView1D<Vector3<typename Matrix4<T>::Type>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformNormalsInto(): expected source and destination views to have the same size, got" << src.size() << "and" << dst.size(), );
+
+    const Matrix3x3<T> normalMatrix = matrix.normalMatrix();
+    const T m00 = normalMatrix[0][0], m01 = normalMatrix[0][1], m02 = normalMatrix[0][2];
+    const T m10 = normalMatrix[1][0], m11 = normalMatrix[1][1], m12 = normalMatrix[1][2];
+    const T m20 = normalMatrix[2][0], m21 = normalMatrix[2][1], m22 = normalMatrix[2][2];
+    Implementation::transformBatchInto(src, dst, [=](const Vector3<T>& in, Vector3<T>& out) {
+        const T x = in[0], y = in[1], z = in[2];
+        const T outX = m00*x + m10*y + m20*z;
+        const T outY = m01*x + m11*y + m21*z;
+        const T outZ = m02*x + m12*y + m22*z;
+        const T lengthInverted = T(1)/std::sqrt(outX*outX + outY*outY + outZ*outZ);
+        out[0] = outX*lengthInverted;
+        out[1] = outY*lengthInverted;
+        out[2] = outZ*lengthInverted;
+    });
+}
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -0,0 +1,252 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Analyze.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> VertexCacheStatistics analyzeVertexCacheImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3", {});
+
+    Containers::BitArray referenced{ValueInit, vertexCount};
+    UnsignedInt referencedCount = 0;
+    UnsignedInt transformCount = 0;
+
+    /* The FIFO is simulated the same way as in tipsifyInPlace(), with a
+       per-vertex timestamp of when it was put into the cache */
+    if(model == VertexCacheModel::Fifo) {
+        Containers::Array<UnsignedInt> timestamps{ValueInit, vertexCount};
+        UnsignedInt time = cacheSize + 1;
+        for(const T index: indices) {
+            CORRADE_ASSERT(index < vertexCount,
+                "MeshTools::analyzeVertexCache(): index" << index << "out of range for" << vertexCount << "vertices", {});
+            if(!referenced[index]) {
+                referenced.set(index);
+                ++referencedCount;
+            }
+
+            if(time - timestamps[index] > cacheSize) {
+                timestamps[index] = time++;
+                ++transformCount;
+            }
+        }
+
+    /* The LRU is small enough that a linear search with move-to-front is the
+       simplest and fastest option */
+    } else if(model == VertexCacheModel::Lru) {
+        Containers::Array<UnsignedInt> cache{NoInit, cacheSize};
+        std::size_t cacheCount = 0;
+        for(const T index: indices) {
+            CORRADE_ASSERT(index < vertexCount,
+                "MeshTools::analyzeVertexCache(): index" << index << "out of range for" << vertexCount << "vertices", {});
+            if(!referenced[index]) {
+                referenced.set(index);
+                ++referencedCount;
+            }
+
+            std::size_t position = 0;
+            while(position != cacheCount && cache[position] != index)
+                ++position;
+
+            /* On a miss, the last entry falls out if the cache is full */
+            if(position == cacheCount) {
+                ++transformCount;
+                if(!cacheSize) continue;
+                if(cacheCount != cacheSize) ++cacheCount;
+                position = cacheCount - 1;
+            }
+
+            for(; position; --position)
+                cache[position] = cache[position - 1];
+            cache[0] = index;
+        }
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    VertexCacheStatistics out{};
+    out.vertexTransformCount = transformCount;
+    if(indices.size()) {
+        out.acmr = Float(transformCount)/Float(indices.size()/3);
+        out.atvr = Float(transformCount)/Float(referencedCount);
+    }
+    return out;
+}
+
+VertexCacheStatistics analyzeVertexCacheErasedImplementation(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::analyzeVertexCache(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, model, cacheSize);
+    else if(indices.size()[1] == 2)
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, model, cacheSize);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::analyzeVertexCache(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, model, cacheSize);
+    }
+}
+
+/* A contiguous range of bytes fetched for each vertex, its position given by
+   offset + stride*index */
+struct FetchStream {
+    std::ptrdiff_t offset;
+    std::ptrdiff_t stride;
+    std::size_t size;
+};
+
+template<class T> VertexFetchStatistics analyzeVertexFetchImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const Containers::ArrayView<const FetchStream> streams, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(cacheLineSize && cacheSize && cacheSize % cacheLineSize == 0,
+        "MeshTools::analyzeVertexFetch(): expected cache size to be a non-zero multiple of cache line size but got" << cacheSize << "and" << cacheLineSize, {});
+
+    /* Direct-mapped cache, each slot contains the address of the line it
+       holds, ~0 if empty */
+    Containers::Array<std::size_t> lines{DirectInit, cacheSize/cacheLineSize, ~std::size_t{}};
+    Containers::BitArray referenced{ValueInit, vertexCount};
+    std::size_t referencedCount = 0;
+    std::size_t bytesFetched = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::analyzeVertexFetch(): index" << index << "out of range for" << vertexCount << "vertices", {});
+        if(!referenced[index]) {
+            referenced.set(index);
+            ++referencedCount;
+        }
+
+        for(const FetchStream& stream: streams) {
+            if(!stream.size) continue;
+            /* Valid mesh data have all vertices inside the vertex data,
+               negative strides included, so the address is never negative */
+            const std::size_t begin = stream.offset + stream.stride*std::ptrdiff_t(index);
+            const std::size_t end = begin + stream.size;
+            for(std::size_t line = begin/cacheLineSize, lastLine = (end - 1)/cacheLineSize; line <= lastLine; ++line) {
+                std::size_t& slot = lines[line % lines.size()];
+                if(slot == line) continue;
+                slot = line;
+                bytesFetched += cacheLineSize;
+            }
+        }
+    }
+
+    std::size_t vertexSize = 0;
+    for(const FetchStream& stream: streams)
+        vertexSize += stream.size;
+
+    VertexFetchStatistics out{};
+    out.bytesFetched = bytesFetched;
+    if(referencedCount && vertexSize)
+        out.overfetch = Float(bytesFetched)/Float(referencedCount*vertexSize);
+    return out;
+}
+
+VertexFetchStatistics analyzeVertexFetchErasedImplementation(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const Containers::ArrayView<const FetchStream> streams, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::analyzeVertexFetch(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return analyzeVertexFetchImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, streams, cacheLineSize, cacheSize);
+    else if(indices.size()[1] == 2)
+        return analyzeVertexFetchImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, streams, cacheLineSize, cacheSize);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::analyzeVertexFetch(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return analyzeVertexFetchImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, streams, cacheLineSize, cacheSize);
+    }
+}
+
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, model, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, model, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, model, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheErasedImplementation(indices, vertexCount, model, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Trade::MeshData& mesh, const VertexCacheModel model, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::analyzeVertexCache(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), {});
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::analyzeVertexCache(): mesh data not indexed", {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::analyzeVertexCache(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+
+    return analyzeVertexCacheErasedImplementation(mesh.indices(), mesh.vertexCount(), model, cacheSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const UnsignedInt vertexSize, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    const FetchStream stream{0, std::ptrdiff_t(vertexSize), vertexSize};
+    return analyzeVertexFetchImplementation(indices, vertexCount, {&stream, 1}, cacheLineSize, cacheSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const UnsignedInt vertexSize, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    const FetchStream stream{0, std::ptrdiff_t(vertexSize), vertexSize};
+    return analyzeVertexFetchImplementation(indices, vertexCount, {&stream, 1}, cacheLineSize, cacheSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const UnsignedInt vertexSize, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    const FetchStream stream{0, std::ptrdiff_t(vertexSize), vertexSize};
+    return analyzeVertexFetchImplementation(indices, vertexCount, {&stream, 1}, cacheLineSize, cacheSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const UnsignedInt vertexSize, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    const FetchStream stream{0, std::ptrdiff_t(vertexSize), vertexSize};
+    return analyzeVertexFetchErasedImplementation(indices, vertexCount, {&stream, 1}, cacheLineSize, cacheSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Trade::MeshData& mesh, const UnsignedInt cacheLineSize, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::analyzeVertexFetch(): mesh data not indexed", {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::analyzeVertexFetch(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+
+    /* Each attribute is fetched separately from its actual location */
+    Containers::Array<FetchStream> streams{NoInit, mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::analyzeVertexFetch(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), {});
+        streams[i].offset = mesh.attributeOffset(i);
+        streams[i].stride = mesh.attributeStride(i);
+        streams[i].size = vertexFormatSize(format)*Math::max(mesh.attributeArraySize(i), UnsignedShort{1});
+    }
+
+    return analyzeVertexFetchErasedImplementation(mesh.indices(), mesh.vertexCount(), streams, cacheLineSize, cacheSize);
+}
+
+}}
@@ -0,0 +1,244 @@
+#ifndef Magnum_MeshTools_Analyze_h
+#define Magnum_MeshTools_Analyze_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::analyzeVertexCache(), @ref Magnum::MeshTools::analyzeVertexFetch(), enum @ref Magnum::MeshTools::VertexCacheModel, struct @ref Magnum::MeshTools::VertexCacheStatistics, @ref Magnum::MeshTools::VertexFetchStatistics
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Post-transform vertex cache model
+@m_since_latest
+
+@see @ref analyzeVertexCache()
+*/
+enum class VertexCacheModel: UnsignedByte {
+    /**
+     * A first-in, first-out cache, where a cache hit doesn't change the
+     * position of the vertex in the cache. Matches the behavior of fixed-size
+     * post-transform caches of older and mobile GPUs and is what
+     * @ref tipsifyInPlace() is tuned for.
+     */
+    Fifo,
+
+    /**
+     * A least-recently-used cache, where a cache hit moves the vertex to the
+     * front of the cache. Matches the assumptions of
+     * @ref optimizeVertexCacheInPlace().
+     */
+    Lru
+};
+
+/**
+@brief Vertex cache statistics
+@m_since_latest
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Vertex transform count
+     *
+     * Count of simulated cache misses, i.e. how many times the vertex shader
+     * got invoked.
+     */
+    UnsignedInt vertexTransformCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Vertex transform count divided by the triangle count. The worst
+     * possible value is @cpp 3.0f @ce, the best achievable value for a
+     * regular grid is around @cpp 0.5f @ce. If there are no triangles, the
+     * value is @cpp 0.0f @ce.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transform to vertex ratio
+     *
+     * Vertex transform count divided by count of vertices referenced by the
+     * index buffer. The best possible value is @cpp 1.0f @ce, meaning each
+     * vertex got transformed exactly once. Unlike @ref acmr, the value
+     * doesn't depend on the mesh topology, which makes it more suitable for
+     * comparing different meshes. If there are no triangles, the value is
+     * @cpp 0.0f @ce.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency of a triangle mesh
+@param indices      Triangle indices
+@param vertexCount  Vertex count
+@param model        Cache model
+@param cacheSize    Cache size
+@m_since_latest
+
+Simulates a post-transform vertex cache of given @p model and @p cacheSize
+entries while going through @p indices, counting each cache miss as a vertex
+transform. Expects that the index count is divisible by 3 and all indices are
+less than @p vertexCount. Use this function to compare the efficiency before
+and after @ref optimizeVertexCacheInPlace() or @ref tipsifyInPlace(). Real
+GPUs often process vertices in batches and have caches of varying sizes, so
+the numbers are only an approximation --- the default of a 16-entry FIFO is
+a conservative estimate.
+@see @ref analyzeVertexFetch()
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, VertexCacheModel model = VertexCacheModel::Fifo, UnsignedInt cacheSize = 16);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, VertexCacheModel model = VertexCacheModel::Fifo, UnsignedInt cacheSize = 16);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, VertexCacheModel model = VertexCacheModel::Fifo, UnsignedInt cacheSize = 16);
+
+/**
+@brief Analyze post-transform vertex cache efficiency of a triangle mesh with a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, VertexCacheModel, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, VertexCacheModel model = VertexCacheModel::Fifo, UnsignedInt cacheSize = 16);
+
+/**
+@brief Analyze post-transform vertex cache efficiency of a mesh data
+@m_since_latest
+
+Expects that the mesh is indexed, is a @ref MeshPrimitive::Triangles and its
+index type is not implementation-specific. Then calls
+@ref analyzeVertexCache(const Containers::StridedArrayView2D<const char>&, UnsignedInt, VertexCacheModel, UnsignedInt)
+with @ref Trade::MeshData::indices() and @ref Trade::MeshData::vertexCount().
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Trade::MeshData& mesh, VertexCacheModel model = VertexCacheModel::Fifo, UnsignedInt cacheSize = 16);
+
+/**
+@brief Vertex fetch statistics
+@m_since_latest
+
+@see @ref analyzeVertexFetch()
+*/
+struct VertexFetchStatistics {
+    /**
+     * @brief Fetched byte count
+     *
+     * Count of bytes fetched from memory, always a multiple of the cache line
+     * size.
+     */
+    std::size_t bytesFetched;
+
+    /**
+     * @brief Overfetch ratio
+     *
+     * Fetched byte count divided by size of all vertices referenced by the
+     * index buffer. The best possible value is @cpp 1.0f @ce, meaning each
+     * referenced vertex got fetched exactly once and no unused data got
+     * fetched along with it. If no vertices are referenced, the value is
+     * @cpp 0.0f @ce.
+     */
+    Float overfetch;
+};
+
+/**
+@brief Analyze vertex fetch efficiency
+@param indices          Index array
+@param vertexCount      Vertex count
+@param vertexSize       Size of a single vertex in bytes
+@param cacheLineSize    Cache line size in bytes
+@param cacheSize        Cache size in bytes
+@m_since_latest
+
+Simulates a direct-mapped cache of @p cacheSize bytes split into lines of
+@p cacheLineSize bytes while fetching tightly packed vertices of
+@p vertexSize bytes in the order given by @p indices, with the vertex data
+assumed to start at a cache line boundary. Expects that all indices are less
+than @p vertexCount, that @p cacheLineSize is not zero and @p cacheSize is a
+non-zero multiple of it. The primitive type doesn't matter for this
+operation. Use this function to compare the efficiency before and after
+@ref optimizeVertexFetchInPlace().
+@see @ref analyzeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, UnsignedInt vertexSize, UnsignedInt cacheLineSize = 64, UnsignedInt cacheSize = 16384);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, UnsignedInt vertexSize, UnsignedInt cacheLineSize = 64, UnsignedInt cacheSize = 16384);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, UnsignedInt vertexSize, UnsignedInt cacheLineSize = 64, UnsignedInt cacheSize = 16384);
+
+/**
+@brief Analyze vertex fetch efficiency with a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, UnsignedInt, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, UnsignedInt vertexSize, UnsignedInt cacheLineSize = 64, UnsignedInt cacheSize = 16384);
+
+/**
+@brief Analyze vertex fetch efficiency of a mesh data
+@m_since_latest
+
+Compared to @ref analyzeVertexFetch(const Containers::StridedArrayView2D<const char>&, UnsignedInt, UnsignedInt, UnsignedInt, UnsignedInt)
+takes the actual vertex data layout into account --- each attribute is
+fetched from its own offset and with its own stride, so the result reflects
+both interleaved and non-interleaved layouts, as well as padding between
+attributes. Expects that the mesh is indexed and its index type and attribute
+formats are not implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Trade::MeshData& mesh, UnsignedInt cacheLineSize = 64, UnsignedInt cacheSize = 16384);
+
+}}
+
+#endif
@@ -27,12 +27,19 @@
 
 #include "BoundingVolume.h"
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
 
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Algorithms/SymmetricEigen.h"
+#include "Magnum/MeshTools/Implementation/parallelFor.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -81,4 +88,423 @@ Containers::Pair<Vector3, Float> boundingSphereBouncingBubble(const Containers::
     return {center, radius};
 }
 
+namespace {
+
+/* Relative tolerance for the Welzl containment tests and degeneracy checks,
+   to avoid endless recalculation due to rounding errors for points that are
+   (almost) on the sphere surface */
+constexpr Double WelzlEpsilon = 1.0e-10;
+
+struct Sphere {
+    Vector3d center;
+    Double radiusSquared;
+};
+
+inline bool isOutside(const Sphere& sphere, const Vector3d& point) {
+    return (point - sphere.center).dot() > sphere.radiusSquared*(1.0 + WelzlEpsilon);
+}
+
+Sphere sphereThrough(const Vector3d& a, const Vector3d& b) {
+    const Vector3d center = (a + b)*0.5;
+    return {center, (a - center).dot()};
+}
+
+Sphere sphereThrough(const Vector3d& a, const Vector3d& b, const Vector3d& c) {
+    const Vector3d ab = b - a;
+    const Vector3d ac = c - a;
+    const Vector3d n = Math::cross(ab, ac);
+    const Double denominator = 2.0*n.dot();
+
+    /* Collinear points, the smallest sphere is given by the two most distant
+       ones */
+    if(denominator <= WelzlEpsilon*ab.dot()*ac.dot()) {
+        const Sphere candidates[]{
+            sphereThrough(a, b),
+            sphereThrough(a, c),
+            sphereThrough(b, c)
+        };
+        const Sphere* largest = candidates;
+        for(const Sphere& candidate: candidates)
+            if(candidate.radiusSquared > largest->radiusSquared)
+                largest = &candidate;
+        return *largest;
+    }
+
+    /* Circumcenter relative to a */
+    const Vector3d offset = (Math::cross(n, ab)*ac.dot() + Math::cross(ac, n)*ab.dot())/denominator;
+    return {a + offset, offset.dot()};
+}
+
+Sphere sphereThrough(const Vector3d& a, const Vector3d& b, const Vector3d& c, const Vector3d& d) {
+    const Vector3d ab = b - a;
+    const Vector3d ac = c - a;
+    const Vector3d ad = d - a;
+    const Double determinant = Math::dot(ab, Math::cross(ac, ad));
+
+    /* Coplanar points, there's no sphere through all four. Pick the smallest
+       sphere through three of them that contains the fourth, or the largest
+       if none does due to rounding. */
+    if(Math::abs(determinant) <= WelzlEpsilon*ab.length()*ac.length()*ad.length()) {
+        const Sphere candidates[]{
+            sphereThrough(a, b, c),
+            sphereThrough(a, b, d),
+            sphereThrough(a, c, d),
+            sphereThrough(b, c, d)
+        };
+        const Vector3d fourth[]{d, c, b, a};
+        const Sphere* best = nullptr;
+        for(std::size_t i = 0; i != 4; ++i)
+            if(!isOutside(candidates[i], fourth[i]) && (!best || candidates[i].radiusSquared < best->radiusSquared))
+                best = candidates + i;
+        if(best) return *best;
+        best = candidates;
+        for(const Sphere& candidate: candidates)
+            if(candidate.radiusSquared > best->radiusSquared)
+                best = &candidate;
+        return *best;
+    }
+
+    /* Solving for the center x relative to a, where 2 (p - a) x = |p - a|^2
+       for each of b, c, d */
+    const Vector3d offset = (Math::cross(ac, ad)*ab.dot() +
+                             Math::cross(ad, ab)*ac.dot() +
+                             Math::cross(ab, ac)*ad.dot())/(2.0*determinant);
+    return {a + offset, offset.dot()};
+}
+
+}
+
+Containers::Pair<Vector3, Float> boundingSphereWelzl(const Containers::StridedArrayView1D<const Vector3>& positions) {
+    /* Copy the positions to a contiguous double-precision array, skipping
+       NaNs */
+    Containers::Array<Vector3d> points{NoInit, positions.size()};
+    std::size_t count = 0;
+    for(const Vector3& position: positions)
+        if(!Math::isNan(position).any())
+            points[count++] = Vector3d{position};
+
+    if(!count) return {{}, 0.0f};
+
+    /* Shuffle the points to get the expected linear time even for inputs that
+       are sorted in some way, such as rows of a grid. Using a fixed-seed
+       xorshift to have the result deterministic. */
+    UnsignedInt state = 0x9e3779b9u;
+    for(std::size_t i = count - 1; i > 0; --i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        Utility::swap(points[i], points[state % (i + 1)]);
+    }
+
+    /* The incremental form of the algorithm, where each nesting level adds
+       one more point that has to be on the sphere boundary */
+    Sphere sphere{points[0], 0.0};
+    for(std::size_t i = 1; i != count; ++i) {
+        if(!isOutside(sphere, points[i])) continue;
+        sphere = {points[i], 0.0};
+        for(std::size_t j = 0; j != i; ++j) {
+            if(!isOutside(sphere, points[j])) continue;
+            sphere = sphereThrough(points[i], points[j]);
+            for(std::size_t k = 0; k != j; ++k) {
+                if(!isOutside(sphere, points[k])) continue;
+                sphere = sphereThrough(points[i], points[j], points[k]);
+                for(std::size_t l = 0; l != k; ++l) {
+                    if(!isOutside(sphere, points[l])) continue;
+                    sphere = sphereThrough(points[i], points[j], points[k], points[l]);
+                }
+            }
+        }
+    }
+
+    /* Calculate the radius from the original points and the rounded center
+       so they're guaranteed to be inside */
+    const Vector3 center{sphere.center};
+    Float radiusSquared = 0.0f;
+    for(const Vector3& position: positions)
+        if(!Math::isNan(position).any())
+            radiusSquared = Math::max(radiusSquared, (position - center).dot());
+
+    return {center, Math::sqrt(radiusSquared)};
+}
+
+namespace {
+
+/* Directions along which extremal points are searched for in DiTO-14. Not
+   normalized, as only the order of the projections matters. */
+constexpr Vector3 DiToDirections[]{
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, -1.0f},
+    {1.0f, -1.0f, 1.0f},
+    {1.0f, -1.0f, -1.0f}
+};
+constexpr std::size_t DiToDirectionCount = Containers::arraySize(DiToDirections);
+
+/* Half of the surface area of a box with given size */
+inline Float boxHalfArea(const Vector3& size) {
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+/* Orthonormal right-handed frame with given (normalized) first and second
+   axis */
+inline Matrix3 frame(const Vector3& x, const Vector3& y) {
+    return Matrix3{x, y, Math::cross(x, y)};
+}
+
+struct ExtremalPoints {
+    Vector3 points[DiToDirectionCount*2];
+
+    /* Half area of a box with given orientation enclosing all extremal
+       points */
+    Float halfArea(const Matrix3& axes) const {
+        const Matrix3 inverted = axes.transposed();
+        Range3D range{inverted*points[0], inverted*points[0]};
+        for(std::size_t i = 1; i != DiToDirectionCount*2; ++i) {
+            const Vector3 projected = inverted*points[i];
+            range = {Math::min(range.min(), projected),
+                     Math::max(range.max(), projected)};
+        }
+        return boxHalfArea(range.size());
+    }
+};
+
+}
+
+Matrix4 boundingBoxOriented(const Containers::StridedArrayView1D<const Vector3>& positions) {
+    /* Find points extremal along the DiTO directions, and calculate the
+       covariance matrix for PCA. The covariance is accumulated in double
+       precision relative to the first point to avoid catastrophic
+       cancellation. */
+    ExtremalPoints extremal;
+    Float minProjection[DiToDirectionCount]{};
+    Float maxProjection[DiToDirectionCount]{};
+    Vector3d origin;
+    Vector3d sum;
+    Matrix3d sumOuter{Math::ZeroInit};
+    std::size_t count = 0;
+    for(const Vector3& position: positions) {
+        if(Math::isNan(position).any()) continue;
+
+        if(!count) {
+            origin = Vector3d{position};
+            for(std::size_t i = 0; i != DiToDirectionCount; ++i) {
+                minProjection[i] = maxProjection[i] = Math::dot(position, DiToDirections[i]);
+                extremal.points[i*2 + 0] = extremal.points[i*2 + 1] = position;
+            }
+        } else for(std::size_t i = 0; i != DiToDirectionCount; ++i) {
+            const Float projection = Math::dot(position, DiToDirections[i]);
+            if(projection < minProjection[i]) {
+                minProjection[i] = projection;
+                extremal.points[i*2 + 0] = position;
+            } else if(projection > maxProjection[i]) {
+                maxProjection[i] = projection;
+                extremal.points[i*2 + 1] = position;
+            }
+        }
+
+        const Vector3d relative = Vector3d{position} - origin;
+        sum += relative;
+        for(std::size_t i = 0; i != 3; ++i)
+            sumOuter[i] += relative*relative[i];
+        ++count;
+    }
+
+    if(!count) return Matrix4::scaling(Vector3{0.0f});
+
+    /* The axis-aligned box is known exactly from the first three
+       directions */
+    const Range3D aabb{
+        {minProjection[0], minProjection[1], minProjection[2]},
+        {maxProjection[0], maxProjection[1], maxProjection[2]}
+    };
+
+    /* Principal axes, with the third calculated from the first two to ensure
+       the frame is right-handed. If the covariance is zero, such as for a
+       single point, the eigenvectors are the coordinate axes. */
+    Matrix3 principalAxes;
+    {
+        const Vector3d mean = sum/Double(count);
+        Matrix3d covariance;
+        for(std::size_t i = 0; i != 3; ++i)
+            covariance[i] = sumOuter[i]/Double(count) - mean*mean[i];
+        const Matrix3d eigenvectors = Math::Algorithms::symmetricEigen(covariance).first();
+        principalAxes = frame(Vector3{eigenvectors[0]}.normalized(),
+                              Vector3{eigenvectors[1]}.normalized());
+    }
+
+    /* DiTO candidate orientations, compared to the coordinate axes */
+    Matrix3 bestAxes{Math::IdentityInit};
+    Float bestHalfArea = boxHalfArea(aabb.size());
+    const auto tryAxes = [&](const Matrix3& axes) {
+        const Float area = extremal.halfArea(axes);
+        if(area < bestHalfArea) {
+            bestAxes = axes;
+            bestHalfArea = area;
+        }
+    };
+
+    /* Base triangle of the DiTO algorithm. The first edge is between the most
+       distant pair of extremal points along the same direction. */
+    std::size_t farthestPair = 0;
+    Float farthestPairDistanceSquared = 0.0f;
+    for(std::size_t i = 0; i != DiToDirectionCount; ++i) {
+        const Float distanceSquared = (extremal.points[i*2 + 1] - extremal.points[i*2 + 0]).dot();
+        if(distanceSquared > farthestPairDistanceSquared) {
+            farthestPair = i;
+            farthestPairDistanceSquared = distanceSquared;
+        }
+    }
+
+    /* If all points are the same, there's nothing else to try */
+    if(farthestPairDistanceSquared > 0.0f) {
+        const Vector3 p0 = extremal.points[farthestPair*2 + 0];
+        const Vector3 p1 = extremal.points[farthestPair*2 + 1];
+        const Vector3 e0 = (p1 - p0).normalized();
+
+        /* The third point is the extremal point farthest from the first
+           edge */
+        Vector3 p2;
+        Float p2DistanceSquared = 0.0f;
+        for(const Vector3& point: extremal.points) {
+            const Vector3 relative = point - p0;
+            const Float distanceSquared = (relative - e0*Math::dot(relative, e0)).dot();
+            if(distanceSquared > p2DistanceSquared) {
+                p2 = point;
+                p2DistanceSquared = distanceSquared;
+            }
+        }
+
+        /* Collinear points, any frame with the first edge as an axis is
+           optimal. Pick a perpendicular axis using the coordinate axis in
+           which the edge has the smallest component. */
+        if(p2DistanceSquared <= farthestPairDistanceSquared*Math::TypeTraits<Float>::epsilon()) {
+            const Vector3 absE0 = Math::abs(e0);
+            Vector3 axis;
+            axis[absE0.x() <= absE0.y() && absE0.x() <= absE0.z() ? 0 :
+                 absE0.y() <= absE0.z() ? 1 : 2] = 1.0f;
+            tryAxes(frame(e0, Math::cross(e0, axis).normalized()));
+
+        /* Otherwise take each edge of the base triangle together with its
+           normal, and then the same for triangles of the two tetrahedra built
+           by adding points extremal along the base triangle normal */
+        } else {
+            const auto tryTriangle = [&](const Vector3& a, const Vector3& b, const Vector3& c) {
+                const Vector3 normal = Math::cross(b - a, c - a);
+                if(normal.isZero()) return;
+                const Vector3 n = normal.normalized();
+                const Vector3 edges[]{b - a, c - b, a - c};
+                for(const Vector3& edge: edges)
+                    if(!edge.isZero()) tryAxes(frame(edge.normalized(), n));
+            };
+            tryTriangle(p0, p1, p2);
+
+            const Vector3 n = Math::cross(p1 - p0, p2 - p0).normalized();
+            const Float baseProjection = Math::dot(p0, n);
+            Vector3 below = p0, above = p0;
+            Float belowProjection = baseProjection, aboveProjection = baseProjection;
+            for(const Vector3& point: extremal.points) {
+                const Float projection = Math::dot(point, n);
+                if(projection < belowProjection) {
+                    below = point;
+                    belowProjection = projection;
+                } else if(projection > aboveProjection) {
+                    above = point;
+                    aboveProjection = projection;
+                }
+            }
+            for(const Vector3& apex: {below, above}) {
+                if(apex == p0) continue;
+                tryTriangle(p0, p1, apex);
+                tryTriangle(p1, p2, apex);
+                tryTriangle(p2, p0, apex);
+            }
+        }
+    }
+
+    /* Calculate the final box with all points for both the best DiTO
+       candidate and the principal axes. The DiTO candidate was picked by a
+       box enclosing just the extremal points, so either can be larger than
+       the axis-aligned box in the end, in which case use that instead. Prefer
+       the axis-aligned box also if the difference is just due to rounding,
+       so axis-aligned inputs produce a stable result. */
+    const Matrix3 candidateAxes[]{bestAxes, principalAxes};
+    const Matrix3 candidateInverted[]{bestAxes.transposed(), principalAxes.transposed()};
+    Range3D candidateRanges[]{
+        {Vector3{Constants::inf()}, Vector3{-Constants::inf()}},
+        {Vector3{Constants::inf()}, Vector3{-Constants::inf()}}
+    };
+    for(const Vector3& position: positions) {
+        if(Math::isNan(position).any()) continue;
+        for(std::size_t i = 0; i != 2; ++i) {
+            const Vector3 projected = candidateInverted[i]*position;
+            candidateRanges[i] = {Math::min(candidateRanges[i].min(), projected),
+                                  Math::max(candidateRanges[i].max(), projected)};
+        }
+    }
+
+    Matrix3 axes{Math::IdentityInit};
+    Range3D range = aabb;
+    Float halfArea = boxHalfArea(aabb.size())*0.9999f;
+    for(std::size_t i = 0; i != 2; ++i) {
+        const Float candidateHalfArea = boxHalfArea(candidateRanges[i].size());
+        if(candidateHalfArea < halfArea) {
+            axes = candidateAxes[i];
+            range = candidateRanges[i];
+            halfArea = candidateHalfArea;
+        }
+    }
+
+    const Vector3 halfSize = range.size()*0.5f;
+    return Matrix4::from(
+        Matrix3{axes[0]*halfSize.x(),
+                axes[1]*halfSize.y(),
+                axes[2]*halfSize.z()},
+        axes*range.center());
+}
+
+namespace {
+
+#ifdef MAGNUM_MESHTOOLS_THREADS
+/* Don't spawn threads for less than this many positions in total */
+constexpr std::size_t MinPositionsPerThread = 16384;
+#endif
+
+template<class T, class F> void boundingVolumesInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector3>>& positions, const Containers::StridedArrayView1D<T>& output, UnsignedInt threadCount, const F& function) {
+    const auto calculate = [&](UnsignedInt, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            output[i] = function(positions[i]);
+    };
+
+    #ifdef MAGNUM_MESHTOOLS_THREADS
+    std::size_t positionCount = 0;
+    for(const Containers::StridedArrayView1D<const Vector3>& i: positions)
+        positionCount += i.size();
+    threadCount = Implementation::clampThreadCount(threadCount, Math::min(positions.size(), positionCount/MinPositionsPerThread));
+    if(threadCount > 1) {
+        Implementation::parallelFor(threadCount, positions.size(), calculate);
+        return;
+    }
+    #else
+    static_cast<void>(threadCount);
+    #endif
+
+    calculate(0, 0, positions.size());
+}
+
+}
+
+void boundingSphereWelzlInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector3>>& positions, const Containers::StridedArrayView1D<Containers::Pair<Vector3, Float>>& spheres, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(spheres.size() == positions.size(),
+        "MeshTools::boundingSphereWelzlInto(): expected" << positions.size() << "output items but got" << spheres.size(), );
+    boundingVolumesInto(positions, spheres, threadCount, boundingSphereWelzl);
+}
+
+void boundingBoxOrientedInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector3>>& positions, const Containers::StridedArrayView1D<Matrix4>& boxes, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(boxes.size() == positions.size(),
+        "MeshTools::boundingBoxOrientedInto(): expected" << positions.size() << "output items but got" << boxes.size(), );
+    boundingVolumesInto(positions, boxes, threadCount, boundingBoxOriented);
+}
+
 }}
@@ -28,10 +28,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::boundingRange(), @ref Magnum::MeshTools::boundingSphereBouncingBubble()
+ * @brief Function @ref Magnum::MeshTools::boundingRange(), @ref Magnum::MeshTools::boundingSphereBouncingBubble(), @ref Magnum::MeshTools::boundingSphereWelzl(), @ref Magnum::MeshTools::boundingSphereWelzlInto(), @ref Magnum::MeshTools::boundingBoxOriented(), @ref Magnum::MeshTools::boundingBoxOrientedInto()
  * @m_since_latest
  */
 
+#include <Corrade/Containers/Iterable.h>
+
 #include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
 
@@ -67,10 +69,92 @@ problem, 2012, https://www.grin.com/document/204869*.
 @see @ref Math::Intersection::pointSphere(),
     @ref Math::Intersection::sphereFrustum(),
     @ref Math::Intersection::sphereCone(),
-    @ref Math::Intersection::sphereConeView(), @ref meshtools-bounding-volume
+    @ref Math::Intersection::sphereConeView(), @ref boundingSphereWelzl(),
+    @ref meshtools-bounding-volume
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Vector3, Float> boundingSphereBouncingBubble(const Containers::StridedArrayView1D<const Vector3>& positions);
 
+/**
+@brief Calculate a minimal bounding sphere using the Welzl algorithm
+@param positions    Vertex positions
+@return Sphere center and radius
+@m_since_latest
+
+Unlike @ref boundingSphereBouncingBubble(), the resulting bounding sphere is
+minimal, at the cost of a few times slower calculation. The points are
+processed in a pseudo-random order, which makes the expected time linear in
+the point count. The sphere is calculated in double precision, after which
+the radius is recalculated as the largest distance from the center in single
+precision, so all points are guaranteed to be inside even with rounding
+errors. If @p positions are empty, the returned radius is @cpp 0.0f @ce.
+<em>NaN</em>s are ignored. Algorithm used: * *Emo Welzl --- Smallest
+enclosing disks (balls and ellipsoids), 1991,
+https://doi.org/10.1007/BFb0038202*.
+@see @ref boundingSphereWelzlInto(), @ref boundingBoxOriented(),
+    @ref meshtools-bounding-volume
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Vector3, Float> boundingSphereWelzl(const Containers::StridedArrayView1D<const Vector3>& positions);
+
+/**
+@brief Calculate minimal bounding spheres for a list of meshes
+@param[in]  positions   Vertex positions of each mesh
+@param[out] spheres     Where to put sphere center and radius for each mesh
+@param[in]  threadCount Count of threads to use. If @cpp 0 @ce, it's
+    @ref std::thread::hardware_concurrency().
+@m_since_latest
+
+Calls @ref boundingSphereWelzl() on each item of @p positions and saves the
+result to the corresponding item of @p spheres, which is expected to have the
+same size as @p positions. The meshes are split into @p threadCount
+contiguous chunks processed in parallel, the count is capped to not spawn
+threads for too little work. Results are the same regardless of the thread
+count. On Emscripten without pthreads enabled the @p threadCount is ignored.
+*/
+MAGNUM_MESHTOOLS_EXPORT void boundingSphereWelzlInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector3>>& positions, const Containers::StridedArrayView1D<Containers::Pair<Vector3, Float>>& spheres, UnsignedInt threadCount = 1);
+
+/**
+@brief Calculate an oriented bounding box
+@param positions    Vertex positions
+@return Transformation of a @f$ [-1, 1]^3 @f$ cube to the box
+@m_since_latest
+
+The returned matrix has the box axes scaled by half of the box size in its
+first three columns and the box center in the fourth, i.e. it can be used
+directly to transform for example @ref Primitives::cubeSolid() to visualize
+the box. The axes are orthogonal and form a right-handed basis, an axis may
+have a zero length if the points are flat or collinear.
+
+The box orientation is picked by the DiTO algorithm, which evaluates a set of
+candidate orientations derived from a triangle and two tetrahedra formed by
+points extremal along seven fixed directions. The candidates are compared by
+surface area of a box enclosing just the extremal points. The best candidate
+is then compared to a box along principal axes of the point covariance and to
+the axis-aligned box, this time using all points, and the one with the
+smallest surface area is returned. The result is not minimal in general, but
+is never larger than the axis-aligned box given by @ref boundingRange(). If
+@p positions are empty, a zero scaling is returned. <em>NaN</em>s are ignored.
+Algorithm used: * *Thomas Larsson, Linus Källberg --- Fast Computation of
+Tight-Fitting Oriented Bounding Boxes, 2011, Game Engine Gems 2*.
+@see @ref boundingBoxOrientedInto(), @ref boundingSphereWelzl(),
+    @ref meshtools-bounding-volume
+*/
+MAGNUM_MESHTOOLS_EXPORT Matrix4 boundingBoxOriented(const Containers::StridedArrayView1D<const Vector3>& positions);
+
+/**
+@brief Calculate oriented bounding boxes for a list of meshes
+@param[in]  positions   Vertex positions of each mesh
+@param[out] boxes       Where to put the box transformation for each mesh
+@param[in]  threadCount Count of threads to use. If @cpp 0 @ce, it's
+    @ref std::thread::hardware_concurrency().
+@m_since_latest
+
+Calls @ref boundingBoxOriented() on each item of @p positions and saves the
+result to the corresponding item of @p boxes, which is expected to have the
+same size as @p positions. Threading behaves the same as in
+@ref boundingSphereWelzlInto().
+*/
+MAGNUM_MESHTOOLS_EXPORT void boundingBoxOrientedInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector3>>& positions, const Containers::StridedArrayView1D<Matrix4>& boxes, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
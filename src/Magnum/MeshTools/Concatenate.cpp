@@ -26,14 +26,119 @@
 
 #include "Concatenate.h"
 
+#include <cstring>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/MeshTools/Implementation/parallelFor.h"
 #include "Magnum/MeshTools/Implementation/remapAttributeData.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+#ifndef CORRADE_NO_ASSERT
+/* Checks that the mesh can be copied into the output, prints a message and
+   returns false if not */
+bool checkMeshCompatible(const Trade::MeshData& out, const Trade::MeshData& mesh, const std::size_t i, const char* const assertPrefix) {
+    #ifdef CORRADE_STANDARD_ASSERT
+    static_cast<void>(i);
+    static_cast<void>(assertPrefix);
+    #endif
+
+    /* This won't fire for i == 0, as that's where out.primitive() comes
+       from */
+    CORRADE_ASSERT(mesh.primitive() == out.primitive(),
+        assertPrefix << "expected" << out.primitive() << "but got" << mesh.primitive() << "in mesh" << i, false);
+
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        assertPrefix << "mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), false);
+
+    for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
+        const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
+        if(!dst)
+            continue;
+
+        /* This won't fire for i == 0, as that's where the output attributes
+           come from */
+        CORRADE_ASSERT(out.attributeFormat(*dst) == mesh.attributeFormat(src),
+            assertPrefix << "expected" << out.attributeFormat(*dst) << "for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeFormat(src) << "in mesh" << i << "attribute" << src, false);
+        CORRADE_ASSERT(!out.attributeArraySize(*dst) == !mesh.attributeArraySize(src),
+            assertPrefix << "attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ")" << (out.attributeArraySize(*dst) ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << i << (mesh.attributeArraySize(src) ? "is" : "isn't"), false);
+        CORRADE_ASSERT(out.attributeArraySize(*dst) >= mesh.attributeArraySize(src),
+            assertPrefix << "expected array size" << out.attributeArraySize(*dst) << "or less for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << i << "attribute" << src, false);
+    }
+
+    return true;
+}
+#endif
+
+/* Copies indices and attributes of a single mesh to given index and vertex
+   offset in the output. If zeroHoles is set, the vertex data range is zeroed
+   first in case the mesh doesn't fill all output vertex bytes, otherwise the
+   output is assumed to be zero-initialized already. Expects that
+   checkMeshCompatible() passed for the mesh. */
+void copyMeshInto(Trade::MeshData& out, const Containers::ArrayView<UnsignedInt> indices, const Trade::MeshData& mesh, const std::size_t indexOffset, const std::size_t vertexOffset, const bool zeroHoles) {
+    /* If the mesh is indexed, copy the indices over, expanded to 32bit */
+    if(mesh.isIndexed()) {
+        Containers::ArrayView<UnsignedInt> dst = indices.slice(indexOffset, indexOffset + mesh.indexCount());
+        mesh.indicesInto(dst);
+
+        /* Adjust indices for current vertex offset */
+        for(UnsignedInt& index: dst) index += vertexOffset;
+
+    /* Otherwise, if we need an index buffer (meaning at least one of the
+       meshes is indexed), generate a trivial index buffer */
+    } else if(!indices.isEmpty()) {
+        MeshTools::generateTrivialIndicesInto(indices.sliceSize(indexOffset, mesh.vertexCount()), vertexOffset);
+    }
+
+    /* Attributes that are missing in the mesh, have a smaller array size or
+       padding between attributes would be left with whatever was in the
+       memory before, zero them out */
+    if(zeroHoles && out.attributeCount()) {
+        const std::size_t stride = out.attributeStride(0);
+        std::size_t copiedSize = 0;
+        for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src)
+            if(out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src)))
+                copiedSize += mesh.attribute(src).size()[1];
+        if(copiedSize != stride)
+            std::memset(out.mutableVertexData().data() + vertexOffset*stride, 0, mesh.vertexCount()*stride);
+    }
+
+    /* Copy attributes to their destination, skipping ones that don't have
+       any equivalent in the destination mesh */
+    for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
+        /* Try to find a matching attribute in the destination mesh (same
+           name, same set, same morph target ID). Skip if no such attribute is
+           found. This is a O(m + n) complexity (linear lookup in both the
+           source and the output mesh), but given the assumption that meshes
+           rarely have more than 8-16 attributes it should still be faster
+           than building a hashmap first and then doing a complex lookup in it
+           (which is how it used to be before, using
+           std::unordered_multimap). */
+        const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
+        if(!dst)
+            continue;
+
+        const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
+        const Containers::StridedArrayView2D<char> dstAttribute = out.mutableAttribute(*dst);
+
+        /* Copy the data to a slice of the output. For non-array attributes
+           the second dimension should be matching (because the format is
+           matching), for array attributes we may be copying to just a prefix
+           of the elements in dstAttribute. */
+        CORRADE_INTERNAL_ASSERT(out.attributeArraySize(*dst) || srcAttribute.size()[1] == dstAttribute.size()[1]);
+        Utility::copy(srcAttribute, dstAttribute.sliceSize(
+            {vertexOffset, 0},
+            {mesh.vertexCount(), srcAttribute.size()[1]}));
+    }
+}
+
+}
+
 namespace Implementation {
 
 Containers::Pair<UnsignedInt, UnsignedInt> concatenateIndexVertexCount(const Containers::Iterable<const Trade::MeshData>& meshes) {
@@ -94,73 +199,18 @@ Trade::MeshData concatenate(Containers::Array<char>&& indexData, const UnsignedI
     for(std::size_t i = 0; i != meshes.size(); ++i) {
         const Trade::MeshData& mesh = meshes[i];
 
-        /* This won't fire for i == ~std::size_t{}, as that's where
-           out.primitive() comes from */
-        CORRADE_ASSERT(mesh.primitive() == out.primitive(),
-            assertPrefix << "expected" << out.primitive() << "but got" << mesh.primitive() << "in mesh" << i,
-            (Trade::MeshData{MeshPrimitive{}, 0}));
+        #ifndef CORRADE_NO_ASSERT
+        if(!checkMeshCompatible(out, mesh, i, assertPrefix))
+            return Trade::MeshData{MeshPrimitive{}, 0};
+        #endif
 
-        /* If the mesh is indexed, copy the indices over, expanded to 32bit */
-        if(mesh.isIndexed()) {
-            CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
-                assertPrefix << "mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
-                (Trade::MeshData{MeshPrimitive{}, 0}));
+        copyMeshInto(out, indices, mesh, indexOffset, vertexOffset, false);
 
-            Containers::ArrayView<UnsignedInt> dst = indices.slice(indexOffset, indexOffset + mesh.indexCount());
-            mesh.indicesInto(dst);
+        /* Update index and vertex offset for the next mesh */
+        if(mesh.isIndexed())
             indexOffset += mesh.indexCount();
-
-            /* Adjust indices for current vertex offset */
-            for(UnsignedInt& index: dst) index += vertexOffset;
-
-        /* Otherwise, if we need an index buffer (meaning at least one of the
-           meshes is indexed), generate a trivial index buffer */
-        } else if(!indices.isEmpty()) {
-            MeshTools::generateTrivialIndicesInto(indices.sliceSize(indexOffset, mesh.vertexCount()), vertexOffset);
+        else if(!indices.isEmpty())
             indexOffset += mesh.vertexCount();
-        }
-
-        /* Copy attributes to their destination, skipping ones that don't have
-           any equivalent in the destination mesh */
-        for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
-            /* Try to find a matching attribute in the destination mesh (same
-               name, same set, same morph target ID). Skip if no such attribute
-               is found. This is a O(m + n) complexity (linear lookup in both
-               the source and the output mesh), but given the assumption that
-               meshes rarely have more than 8-16 attributes it should still be
-               faster than building a hashmap first and then doing a complex
-               lookup in it (which is how it used to be before, using
-               std::unordered_multimap). */
-            const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
-            if(!dst)
-                continue;
-
-            /* Check format compatibility. This won't fire for i == 0, as
-               that's where out.primitive() comes from */
-            CORRADE_ASSERT(out.attributeFormat(*dst) == mesh.attributeFormat(src),
-                assertPrefix << "expected" << out.attributeFormat(*dst) << "for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeFormat(src) << "in mesh" << i << "attribute" << src,
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-            CORRADE_ASSERT(!out.attributeArraySize(*dst) == !mesh.attributeArraySize(src),
-                assertPrefix << "attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ")" << (out.attributeArraySize(*dst) ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << i << (mesh.attributeArraySize(src) ? "is" : "isn't"),
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-            CORRADE_ASSERT(out.attributeArraySize(*dst) >= mesh.attributeArraySize(src),
-                assertPrefix << "expected array size" << out.attributeArraySize(*dst) << "or less for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << i << "attribute" << src,
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-
-            const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
-            const Containers::StridedArrayView2D<char> dstAttribute = out.mutableAttribute(*dst);
-
-            /* Copy the data to a slice of the output. For non-array attributes
-               the second dimension should be matching (because the format is
-               matching), for array attributes we may be copying to just a
-               prefix of the elements in dstAttribute. */
-            CORRADE_INTERNAL_ASSERT(out.attributeArraySize(*dst) || srcAttribute.size()[1] == dstAttribute.size()[1]);
-            Utility::copy(srcAttribute, dstAttribute.sliceSize(
-                {vertexOffset, 0},
-                {mesh.vertexCount(), srcAttribute.size()[1]}));
-        }
-
-        /* Update vertex offset for the next mesh */
         vertexOffset += mesh.vertexCount();
     }
 
@@ -207,4 +257,123 @@ Trade::MeshData concatenate(const Containers::Iterable<const Trade::MeshData>& m
     return Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenate():");
 }
 
+ConcatenateLayout concatenateLayout(const Containers::Iterable<const Trade::MeshData>& meshes, const InterleaveFlags flags) {
+    CORRADE_ASSERT(!meshes.isEmpty(),
+        "MeshTools::concatenateLayout(): expected at least one mesh",
+        (ConcatenateLayout{MeshPrimitive::Points, 0, 0, nullptr}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != meshes.front().attributeCount(); ++i) {
+        const VertexFormat format = meshes.front().attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::concatenateLayout(): attribute" << i << "of the first mesh has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (ConcatenateLayout{MeshPrimitive::Points, 0, 0, nullptr}));
+    }
+    #endif
+
+    /* Same as in concatenate() */
+    Containers::Array<Trade::MeshAttributeData> attributeData;
+    if(meshes.front().attributeCount())
+        attributeData = Implementation::interleavedLayout(Trade::MeshData{meshes.front().primitive(),
+            {}, meshes.front().vertexData(),
+            Trade::meshAttributeDataNonOwningArray(meshes.front().attributeData())}, {}, flags);
+    else attributeData =
+        Implementation::interleavedLayout(Trade::MeshData{meshes.front().primitive(),
+            meshes.front().vertexCount()}, {}, flags);
+
+    /* The attributes are offset-only with a placeholder zero vertex count,
+       set the actual vertex count so they can be directly used in a MeshData
+       instance */
+    const Containers::Pair<UnsignedInt, UnsignedInt> indexVertexCount = Implementation::concatenateIndexVertexCount(meshes);
+    for(Trade::MeshAttributeData& attribute: attributeData)
+        attribute = Trade::MeshAttributeData{attribute.name(),
+            attribute.format(), attribute.offset({}),
+            indexVertexCount.second(), attribute.stride(),
+            attribute.arraySize(), attribute.morphTargetId()};
+
+    return ConcatenateLayout{meshes.front().primitive(),
+        indexVertexCount.first(), indexVertexCount.second(),
+        Utility::move(attributeData)};
+}
+
+Trade::MeshData concatenateInto(const ConcatenateLayout& layout, const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::ArrayView<char> indexData, const Containers::ArrayView<char> vertexData, UnsignedInt threadCount) {
+    CORRADE_ASSERT(!meshes.isEmpty(),
+        "MeshTools::concatenateInto(): no meshes passed",
+        (Trade::MeshData{MeshPrimitive{}, 0}));
+    CORRADE_ASSERT(
+        layout.primitive != MeshPrimitive::LineStrip &&
+        layout.primitive != MeshPrimitive::LineLoop &&
+        layout.primitive != MeshPrimitive::TriangleStrip &&
+        layout.primitive != MeshPrimitive::TriangleFan,
+        "MeshTools::concatenateInto():" << layout.primitive << "is not supported, turn it into a plain indexed mesh first",
+        (Trade::MeshData{MeshPrimitive{}, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    const Containers::Pair<UnsignedInt, UnsignedInt> indexVertexCount = Implementation::concatenateIndexVertexCount(meshes);
+    CORRADE_ASSERT(indexVertexCount.first() == layout.indexCount && indexVertexCount.second() == layout.vertexCount,
+        "MeshTools::concatenateInto(): expected meshes with" << layout.indexCount << "indices and" << layout.vertexCount << "vertices but got" << indexVertexCount.first() << "and" << indexVertexCount.second(),
+        (Trade::MeshData{MeshPrimitive{}, 0}));
+    #endif
+    CORRADE_ASSERT(indexData.size() >= layout.indexDataSize(),
+        "MeshTools::concatenateInto(): expected index data of at least" << layout.indexDataSize() << "bytes but got" << indexData.size(),
+        (Trade::MeshData{MeshPrimitive{}, 0}));
+    CORRADE_ASSERT(vertexData.size() >= layout.vertexDataSize(),
+        "MeshTools::concatenateInto(): expected vertex data of at least" << layout.vertexDataSize() << "bytes but got" << vertexData.size(),
+        (Trade::MeshData{MeshPrimitive{}, 0}));
+
+    /* Wrap the caller-provided memory and the layout attributes in a
+       non-owning instance, which is used for convenient access to the
+       output and returned at the end. No allocation happens. */
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData.prefix(layout.indexDataSize()));
+    Trade::MeshData out{layout.primitive,
+        Trade::DataFlag::Mutable, indices,
+        /* If there are no indices, we're creating a non-indexed mesh (not an
+           indexed mesh with zero indices) */
+        indices.isEmpty() ? Trade::MeshIndexData{} : Trade::MeshIndexData{indices},
+        Trade::DataFlag::Mutable, vertexData.prefix(layout.vertexDataSize()),
+        Trade::meshAttributeDataNonOwningArray(layout.attributeData),
+        layout.vertexCount};
+
+    /* Check all meshes upfront so the copy itself can't fail midway and
+       doesn't need to report anything from multiple threads */
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != meshes.size(); ++i)
+        if(!checkMeshCompatible(out, meshes[i], i, "MeshTools::concatenateInto():"))
+            return Trade::MeshData{MeshPrimitive{}, 0};
+    #endif
+
+    /* Copies meshes in given range. The index and vertex offset of the first
+       mesh is calculated by going through all meshes before it, which is
+       cheap compared to the actual copy and doesn't need any extra storage
+       to pass the offsets from a serial prefix sum to the threads. */
+    const auto copy = [&](UnsignedInt, const std::size_t begin, const std::size_t end) {
+        std::size_t indexOffset = 0;
+        std::size_t vertexOffset = 0;
+        for(std::size_t i = 0; i != end; ++i) {
+            const Trade::MeshData& mesh = meshes[i];
+            if(i >= begin)
+                copyMeshInto(out, indices, mesh, indexOffset, vertexOffset, true);
+
+            if(mesh.isIndexed())
+                indexOffset += mesh.indexCount();
+            else if(!indices.isEmpty())
+                indexOffset += mesh.vertexCount();
+            vertexOffset += mesh.vertexCount();
+        }
+    };
+
+    #ifdef MAGNUM_MESHTOOLS_THREADS
+    /* Each thread should copy at least 16k vertices on average, otherwise
+       the overhead of spawning it isn't worth it */
+    threadCount = Implementation::clampThreadCount(threadCount, Math::min(meshes.size(), std::size_t(layout.vertexCount/16384)));
+    if(threadCount > 1) {
+        Implementation::parallelFor(threadCount, meshes.size(), copy);
+        return out;
+    }
+    #else
+    static_cast<void>(threadCount);
+    #endif
+
+    copy(0, 0, meshes.size());
+    return out;
+}
+
 }}
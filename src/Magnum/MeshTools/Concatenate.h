@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto()
+ * @brief Struct @ref Magnum::MeshTools::ConcatenateLayout, function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto(), @ref Magnum::MeshTools::concatenateLayout()
  * @m_since{2020,06}
  */
 
@@ -93,7 +93,8 @@ description.
 If an index buffer is needed, @ref MeshIndexType::UnsignedInt is always used.
 Call @ref compressIndices(const Trade::MeshData&, MeshIndexType) on the result
 to compress it to a smaller type, if desired.
-@see @ref concatenateInto(), @ref isMeshIndexTypeImplementationSpecific(),
+@see @ref concatenateInto(), @ref concatenateLayout(),
+    @ref isMeshIndexTypeImplementationSpecific(),
     @ref isVertexFormatImplementationSpecific(),
     @ref SceneTools::flattenMeshHierarchy2D(),
     @ref SceneTools::flattenMeshHierarchy3D(), @ref meshtools-concatenate
@@ -154,6 +155,107 @@ template<template<class> class Allocator = Containers::ArrayAllocator> void conc
     destination = Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenateInto():");
 }
 
+/**
+@brief Layout of concatenated meshes
+@m_since_latest
+
+Returned from @ref concatenateLayout(), see its documentation for more
+information.
+*/
+struct ConcatenateLayout {
+    /** @brief Primitive */
+    MeshPrimitive primitive;
+
+    /**
+     * @brief Index count
+     *
+     * If @cpp 0 @ce, none of the meshes is indexed and the concatenated mesh
+     * is non-indexed as well.
+     */
+    UnsignedInt indexCount;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+
+    /**
+     * @brief Attribute data
+     *
+     * Interleaved offset-only attributes with their vertex count set to
+     * @ref vertexCount.
+     */
+    Containers::Array<Trade::MeshAttributeData> attributeData;
+
+    /**
+     * @brief Index data size in bytes
+     *
+     * The index type is always @ref MeshIndexType::UnsignedInt.
+     */
+    std::size_t indexDataSize() const {
+        return std::size_t(indexCount)*sizeof(UnsignedInt);
+    }
+
+    /** @brief Vertex data size in bytes */
+    std::size_t vertexDataSize() const {
+        /* A cast to std::size_t is needed in order to allow sizes over 4 GB
+           on 64-bit */
+        return attributeData.isEmpty() ? 0 :
+            std::size_t(attributeData[0].stride())*vertexCount;
+    }
+};
+
+/**
+@brief Calculate layout of concatenated meshes
+@param meshes           Meshes to concatenate
+@param flags            Flags to pass to @ref interleavedLayout()
+@m_since_latest
+
+First phase of a two-phase alternative to @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags)
+meant for repeatedly concatenating many meshes into buffers owned by the
+caller. Calculates the resulting primitive, index and vertex count and the
+interleaved attribute layout in the same way as @ref concatenate() would,
+without allocating or copying any index or vertex data. Size the index and
+vertex buffers using @ref ConcatenateLayout::indexDataSize() and
+@relativeref{ConcatenateLayout,vertexDataSize()} and then fill them with
+@ref concatenateInto(const ConcatenateLayout&, const Containers::Iterable<const Trade::MeshData>&, Containers::ArrayView<char>, Containers::ArrayView<char>, UnsignedInt).
+
+Expects that @p meshes contains at least one item and that attributes of the
+first mesh don't have an implementation-specific format.
+@see @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT ConcatenateLayout concatenateLayout(const Containers::Iterable<const Trade::MeshData>& meshes, InterleaveFlags flags = InterleaveFlag::PreserveInterleavedAttributes);
+
+/**
+@brief Concatenate meshes into caller-owned buffers
+@param layout       Layout calculated by @ref concatenateLayout()
+@param meshes       Meshes to concatenate
+@param indexData    Where to put the index data
+@param vertexData   Where to put the vertex data
+@param threadCount  Count of threads to use. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@m_since_latest
+
+Second phase of @ref concatenateLayout(). Copies indices and attributes of
+@p meshes into @p indexData and @p vertexData, which are expected to be at
+least @ref ConcatenateLayout::indexDataSize() and
+@relativeref{ConcatenateLayout,vertexDataSize()} bytes large, and returns a
+mesh with @ref Trade::DataFlag::Mutable index and vertex data referencing
+them. The returned mesh additionally references
+@ref ConcatenateLayout::attributeData, so @p layout has to stay in scope for as
+long as the returned mesh is used. Apart from the layout calculated in the
+first phase, the function doesn't allocate anything, so the same buffers and
+layout can be reused for repeated concatenations with matching input.
+
+The @p meshes are expected to have the same total index and vertex count as
+the ones @p layout was calculated from, other expectations and the output is
+the same as with @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags).
+The meshes are split into @p threadCount contiguous ranges that are copied in
+parallel, each to a disjoint part of the output. Passing @cpp 1 @ce copies
+everything on the calling thread. The thread count is additionally limited so
+each thread copies at least 16384 vertices on average. On Emscripten builds
+without threading enabled the data are always processed on a single thread.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData concatenateInto(const ConcatenateLayout& layout, const Containers::Iterable<const Trade::MeshData>& meshes, Containers::ArrayView<char> indexData, Containers::ArrayView<char> vertexData, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
@@ -132,6 +132,52 @@ etc. overloads.
 */
 MAGNUM_MESHTOOLS_EXPORT void duplicateInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView2D<char>& out);
 
+/**
+@brief Duplicate type-erased data using an index array into given output array using multiple threads
+@param[in]  indices     Index array to use
+@param[in]  data        Input data
+@param[out] out         Where to store the output
+@param[in]  threadCount Count of threads to use. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@m_since_latest
+
+Like @ref duplicateInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView2D<char>&),
+but with the index range split into @p threadCount contiguous chunks that are
+copied in parallel. As every thread writes to a disjoint range of @p out, the
+output is the same regardless of @p threadCount. Passing @cpp 1 @ce is
+equivalent to calling the single-threaded variant. The thread count is
+additionally limited so each thread copies at least 16384 items on average. On
+Emscripten builds without threading enabled the data are always processed on a
+single thread.
+
+Both variants have dedicated code paths for items of 1, 2, 4, 8, 12, 16 and 32
+bytes, other sizes go through a generic loop.
+*/
+MAGNUM_MESHTOOLS_EXPORT void duplicateInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView2D<char>& out, UnsignedInt threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void duplicateInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView2D<char>& out, UnsignedInt threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void duplicateInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView2D<char>& out, UnsignedInt threadCount);
+
+/**
+@brief Duplicate type-erased data using a type-erased index array into given output array using multiple threads
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref duplicateInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView2D<char>&, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void duplicateInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView2D<char>& out, UnsignedInt threadCount);
+
 /**
 @brief Duplicate indexed mesh data
 @m_since{2020,06}
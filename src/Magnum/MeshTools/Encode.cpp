@@ -0,0 +1,558 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Encode.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* The first byte of encoded data, distinct for each encoding to catch
+   accidental mixups */
+enum: UnsignedByte {
+    IndexEncodingSequential = 0x10,
+    IndexEncodingTriangles = 0x11,
+    VertexEncoding = 0x20
+};
+
+/* Count of vertices processed at once. Each block stores all byte planes
+   after each other, so the decoder works on a small working set that fits
+   into the L1 cache for typical vertex sizes. */
+constexpr std::size_t VertexBlockSize = 256;
+
+/* Count of bytes in a byte plane sharing the same bit width. The block size
+   is a multiple of it, so the decoder can always unpack whole groups and four
+   groups share a single header byte. */
+constexpr std::size_t VertexGroupSize = 16;
+static_assert(VertexBlockSize % (VertexGroupSize*4) == 0, "vertex block size not a multiple of header byte group size");
+
+inline UnsignedInt zigzag(const UnsignedInt value, const UnsignedInt base) {
+    const UnsignedInt delta = value - base;
+    return (delta << 1) ^ (0u - (delta >> 31));
+}
+
+inline UnsignedInt unzigzag(const UnsignedInt value) {
+    return (value >> 1) ^ (0u - (value & 1));
+}
+
+/* LEB128, 7 bits per byte, at most 5 bytes for a 32-bit value */
+inline char* writeVarint(char* out, UnsignedInt value) {
+    while(value >= 0x80) {
+        *out++ = char(value|0x80);
+        value >>= 7;
+    }
+    *out++ = char(value);
+    return out;
+}
+
+/* Returns nullptr if the data end prematurely or the value doesn't fit into
+   32 bits */
+inline const char* readVarint(const char* in, const char* const end, UnsignedInt& value) {
+    UnsignedInt result = 0;
+    for(UnsignedInt shift = 0; ; shift += 7) {
+        if(in == end) return nullptr;
+        const UnsignedByte byte = *in++;
+        if(shift == 28 && byte > 0x0f) return nullptr;
+        result |= UnsignedInt(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) {
+            value = result;
+            return in;
+        }
+    }
+}
+
+template<class T> Containers::Array<char> encodeIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshPrimitive primitive) {
+    /* One byte for the encoding, at most five for the count and at most five
+       for each index */
+    Containers::Array<char> out;
+    arrayResize(out, NoInit, 1 + 5 + indices.size()*5);
+    char* data = out.data();
+
+    const bool triangles = primitive == MeshPrimitive::Triangles;
+    *data++ = char(triangles ? IndexEncodingTriangles : IndexEncodingSequential);
+    data = writeVarint(data, UnsignedInt(indices.size()));
+
+    std::size_t i = 0;
+    UnsignedInt previous = 0;
+    if(triangles) {
+        for(; i + 3 <= indices.size(); i += 3) {
+            const UnsignedInt first = indices[i];
+            data = writeVarint(data, zigzag(first, previous));
+            data = writeVarint(data, zigzag(indices[i + 1], first));
+            data = writeVarint(data, zigzag(indices[i + 2], first));
+            previous = first;
+        }
+
+        /* Incomplete triangles at the end are encoded relative to the last
+           index */
+        if(i) previous = indices[i - 1];
+    }
+    for(; i != indices.size(); ++i) {
+        data = writeVarint(data, zigzag(indices[i], previous));
+        previous = indices[i];
+    }
+
+    arrayResize(out, data - out.data());
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+template<class T> inline bool storeIndex(const Containers::StridedArrayView1D<T>& out, const std::size_t i, const UnsignedInt value) {
+    if(value > UnsignedInt(T(~T{}))) {
+        Error{} << "MeshTools::decodeIndicesInto(): decoded index" << value << "doesn't fit into a" << sizeof(T)*8 << Debug::nospace << "-bit type";
+        return false;
+    }
+
+    out[i] = T(value);
+    return true;
+}
+
+template<class T> bool decodeIndicesIntoImplementation(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<T>& out) {
+    const char* in = data.begin();
+    const char* const end = data.end();
+
+    UnsignedInt count;
+    if(data.isEmpty() || (UnsignedByte(*in) != IndexEncodingSequential && UnsignedByte(*in) != IndexEncodingTriangles) || !(in = readVarint(in + 1, end, count))) {
+        Error{} << "MeshTools::decodeIndicesInto(): invalid header";
+        return false;
+    }
+    if(count != out.size()) {
+        Error{} << "MeshTools::decodeIndicesInto(): encoded data contain" << count << "indices but the output has" << out.size();
+        return false;
+    }
+
+    std::size_t i = 0;
+    UnsignedInt previous = 0;
+    if(UnsignedByte(data[0]) == IndexEncodingTriangles) {
+        for(; i + 3 <= count; i += 3) {
+            UnsignedInt a, b, c;
+            if(!(in = readVarint(in, end, a)) ||
+               !(in = readVarint(in, end, b)) ||
+               !(in = readVarint(in, end, c)))
+            {
+                Error{} << "MeshTools::decodeIndicesInto(): data truncated or corrupted";
+                return false;
+            }
+
+            const UnsignedInt first = previous + unzigzag(a);
+            if(!storeIndex(out, i, first) ||
+               !storeIndex(out, i + 1, first + unzigzag(b)) ||
+               !storeIndex(out, i + 2, first + unzigzag(c)))
+                return false;
+            previous = first;
+        }
+
+        if(i) previous = out[i - 1];
+    }
+    for(; i != count; ++i) {
+        UnsignedInt value;
+        if(!(in = readVarint(in, end, value))) {
+            Error{} << "MeshTools::decodeIndicesInto(): data truncated or corrupted";
+            return false;
+        }
+
+        previous += unzigzag(value);
+        if(!storeIndex(out, i, previous))
+            return false;
+    }
+
+    if(in != end) {
+        Error{} << "MeshTools::decodeIndicesInto(): unexpected" << end - in << "bytes after the encoded data";
+        return false;
+    }
+
+    return true;
+}
+
+/* Calculates zigzag-encoded differences to the previous vertex and scatters
+   their bytes into consecutive byte planes */
+template<class T> void encodeComponent(const char* const vertices, const std::ptrdiff_t stride, const std::size_t count, UnsignedLong& previousStorage, UnsignedByte* const planes) {
+    T previous = T(previousStorage);
+    for(std::size_t i = 0; i != count; ++i) {
+        T value;
+        std::memcpy(&value, vertices + i*stride, sizeof(T));
+        const T delta = T(value - previous);
+        const T zigzag = T(T(delta << 1) ^ T(T(0) - T(delta >> (sizeof(T)*8 - 1))));
+        for(std::size_t j = 0; j != sizeof(T); ++j)
+            planes[j*VertexBlockSize + i] = UnsignedByte(zigzag >> 8*j);
+        previous = value;
+    }
+    previousStorage = previous;
+}
+
+/* Inverse of the above. The first loop gathers the byte planes for the whole
+   block, with no dependency between iterations so the compiler can vectorize
+   it, the second then does the prefix sum. */
+template<class T> void decodeComponent(const UnsignedByte* const planes, const std::size_t count, UnsignedLong& previousStorage, char* const vertices, const std::ptrdiff_t stride) {
+    T deltas[VertexBlockSize];
+    for(std::size_t i = 0; i != VertexBlockSize; ++i) {
+        T zigzag = planes[i];
+        for(std::size_t j = 1; j != sizeof(T); ++j)
+            zigzag |= T(T(planes[j*VertexBlockSize + i]) << 8*j);
+        deltas[i] = T(T(zigzag >> 1) ^ T(T(0) - T(zigzag & 1)));
+    }
+
+    T previous = T(previousStorage);
+    for(std::size_t i = 0; i != count; ++i) {
+        previous = T(previous + deltas[i]);
+        std::memcpy(vertices + i*stride, &previous, sizeof(T));
+    }
+    previousStorage = previous;
+}
+
+/* Each byte plane has a header with two bits per group of 16 bytes, stating
+   whether the group is all zeros or the bytes take 2, 4 or 8 bits. The plane
+   is expected to be padded with zeros to a multiple of the group size. */
+char* encodePlane(const UnsignedByte* const plane, const std::size_t count, char* out) {
+    const std::size_t groupCount = (count + VertexGroupSize - 1)/VertexGroupSize;
+    const std::size_t headerSize = (groupCount + 3)/4;
+    UnsignedByte* const header = reinterpret_cast<UnsignedByte*>(out);
+    std::memset(header, 0, headerSize);
+    out += headerSize;
+
+    for(std::size_t i = 0; i != groupCount; ++i) {
+        const UnsignedByte* const group = plane + i*VertexGroupSize;
+        UnsignedByte bits = 0;
+        for(std::size_t j = 0; j != VertexGroupSize; ++j)
+            bits |= group[j];
+
+        const UnsignedInt code = !bits ? 0 : bits < 4 ? 1 : bits < 16 ? 2 : 3;
+        header[i/4] |= code << (i%4)*2;
+        if(code == 1) {
+            for(std::size_t j = 0; j != VertexGroupSize/4; ++j)
+                *out++ = char(group[j*4] | group[j*4 + 1] << 2 | group[j*4 + 2] << 4 | group[j*4 + 3] << 6);
+        } else if(code == 2) {
+            for(std::size_t j = 0; j != VertexGroupSize/2; ++j)
+                *out++ = char(group[j*2] | group[j*2 + 1] << 4);
+        } else if(code == 3) {
+            std::memcpy(out, group, VertexGroupSize);
+            out += VertexGroupSize;
+        }
+    }
+
+    return out;
+}
+
+/* Returns nullptr if the data end prematurely. Always writes whole groups. */
+const char* decodePlane(const char* in, const char* const end, UnsignedByte* const plane, const std::size_t count) {
+    const std::size_t groupCount = (count + VertexGroupSize - 1)/VertexGroupSize;
+    const std::size_t headerSize = (groupCount + 3)/4;
+    if(std::size_t(end - in) < headerSize) return nullptr;
+    const UnsignedByte* const header = reinterpret_cast<const UnsignedByte*>(in);
+    in += headerSize;
+
+    for(std::size_t i = 0; i != groupCount; ++i) {
+        UnsignedByte* const group = plane + i*VertexGroupSize;
+        const UnsignedInt code = (header[i/4] >> (i%4)*2) & 3;
+        if(code == 0) {
+            std::memset(group, 0, VertexGroupSize);
+        } else if(code == 1) {
+            if(end - in < std::ptrdiff_t(VertexGroupSize/4)) return nullptr;
+            for(std::size_t j = 0; j != VertexGroupSize/4; ++j) {
+                const UnsignedByte byte = *in++;
+                group[j*4 + 0] = byte & 0x03;
+                group[j*4 + 1] = (byte >> 2) & 0x03;
+                group[j*4 + 2] = (byte >> 4) & 0x03;
+                group[j*4 + 3] = byte >> 6;
+            }
+        } else if(code == 2) {
+            if(end - in < std::ptrdiff_t(VertexGroupSize/2)) return nullptr;
+            for(std::size_t j = 0; j != VertexGroupSize/2; ++j) {
+                const UnsignedByte byte = *in++;
+                group[j*2 + 0] = byte & 0x0f;
+                group[j*2 + 1] = byte >> 4;
+            }
+        } else {
+            if(end - in < std::ptrdiff_t(VertexGroupSize)) return nullptr;
+            std::memcpy(group, in, VertexGroupSize);
+            in += VertexGroupSize;
+        }
+    }
+
+    return in;
+}
+
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const MeshPrimitive primitive) {
+    return encodeIndicesImplementation(indices, primitive);
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const MeshPrimitive primitive) {
+    return encodeIndicesImplementation(indices, primitive);
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const MeshPrimitive primitive) {
+    return encodeIndicesImplementation(indices, primitive);
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView2D<const char>& indices, const MeshPrimitive primitive) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::encodeIndices(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return encodeIndicesImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), primitive);
+    else if(indices.size()[1] == 2)
+        return encodeIndicesImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), primitive);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::encodeIndices(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return encodeIndicesImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), primitive);
+    }
+}
+
+Containers::Array<char> encodeIndices(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(mesh.isIndexed(), "MeshTools::encodeIndices(): mesh data not indexed", {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::encodeIndices(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+    return encodeIndices(mesh.indices(), mesh.primitive());
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedInt>& out) {
+    return decodeIndicesIntoImplementation(data, out);
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedShort>& out) {
+    return decodeIndicesIntoImplementation(data, out);
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedByte>& out) {
+    return decodeIndicesIntoImplementation(data, out);
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& out) {
+    CORRADE_ASSERT(out.isContiguous<1>(), "MeshTools::decodeIndicesInto(): second index view dimension is not contiguous", {});
+    if(out.size()[1] == 4)
+        return decodeIndicesIntoImplementation(data, Containers::arrayCast<1, UnsignedInt>(out));
+    else if(out.size()[1] == 2)
+        return decodeIndicesIntoImplementation(data, Containers::arrayCast<1, UnsignedShort>(out));
+    else {
+        CORRADE_ASSERT(out.size()[1] == 1, "MeshTools::decodeIndicesInto(): expected index type size 1, 2 or 4 but got" << out.size()[1], {});
+        return decodeIndicesIntoImplementation(data, Containers::arrayCast<1, UnsignedByte>(out));
+    }
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, Trade::MeshData& mesh) {
+    CORRADE_ASSERT(mesh.isIndexed(), "MeshTools::decodeIndicesInto(): mesh data not indexed", {});
+    CORRADE_ASSERT(mesh.indexDataFlags() & Trade::DataFlag::Mutable,
+        "MeshTools::decodeIndicesInto(): index data not mutable", {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::decodeIndicesInto(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+    return decodeIndicesInto(data, mesh.mutableIndices());
+}
+
+Containers::Array<char> encodeVertices(const Containers::StridedArrayView2D<const char>& vertices, const Containers::ArrayView<const UnsignedInt> componentSizes) {
+    CORRADE_ASSERT(vertices.isContiguous<1>(), "MeshTools::encodeVertices(): second vertex view dimension is not contiguous", {});
+    #ifndef CORRADE_NO_ASSERT
+    std::size_t componentSizeSum = 0;
+    for(const UnsignedInt size: componentSizes) {
+        CORRADE_ASSERT(size == 1 || size == 2 || size == 4 || size == 8,
+            "MeshTools::encodeVertices(): expected component size 1, 2, 4 or 8 but got" << size, {});
+        componentSizeSum += size;
+    }
+    CORRADE_ASSERT(componentSizeSum == vertices.size()[1],
+        "MeshTools::encodeVertices(): component sizes sum up to" << componentSizeSum << "bytes but the vertex size is" << vertices.size()[1], {});
+    #endif
+
+    const std::size_t vertexCount = vertices.size()[0];
+    const std::size_t vertexSize = vertices.size()[1];
+    const std::size_t blockCount = (vertexCount + VertexBlockSize - 1)/VertexBlockSize;
+
+    /* One byte for the encoding, at most five for vertex and component count
+       each, one byte for each component size and then for each byte plane in
+       each block a header and at most the original data */
+    Containers::Array<char> out;
+    arrayResize(out, NoInit, 1 + 5 + 5 + componentSizes.size() + blockCount*vertexSize*(VertexBlockSize/VertexGroupSize/4 + VertexBlockSize));
+    char* data = out.data();
+
+    *data++ = char(VertexEncoding);
+    data = writeVarint(data, UnsignedInt(vertexCount));
+    data = writeVarint(data, UnsignedInt(componentSizes.size()));
+    for(const UnsignedInt size: componentSizes)
+        *data++ = char(size);
+
+    Containers::Array<UnsignedByte> planes{ValueInit, vertexSize*VertexBlockSize};
+    Containers::Array<UnsignedLong> previous{ValueInit, componentSizes.size()};
+    const char* const vertexData = static_cast<const char*>(vertices.data());
+    const std::ptrdiff_t stride = vertices.stride()[0];
+    for(std::size_t block = 0; block != blockCount; ++block) {
+        const std::size_t begin = block*VertexBlockSize;
+        const std::size_t count = Math::min(VertexBlockSize, vertexCount - begin);
+
+        /* The last block needs zero padding up to a multiple of the group
+           size */
+        if(count != VertexBlockSize)
+            std::memset(planes.data(), 0, planes.size());
+
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != componentSizes.size(); ++i) {
+            const char* const src = vertexData + begin*stride + offset;
+            UnsignedByte* const dst = planes.data() + offset*VertexBlockSize;
+            if(componentSizes[i] == 1)
+                encodeComponent<UnsignedByte>(src, stride, count, previous[i], dst);
+            else if(componentSizes[i] == 2)
+                encodeComponent<UnsignedShort>(src, stride, count, previous[i], dst);
+            else if(componentSizes[i] == 4)
+                encodeComponent<UnsignedInt>(src, stride, count, previous[i], dst);
+            else
+                encodeComponent<UnsignedLong>(src, stride, count, previous[i], dst);
+            offset += componentSizes[i];
+        }
+
+        for(std::size_t i = 0; i != vertexSize; ++i)
+            data = encodePlane(planes.data() + i*VertexBlockSize, count, data);
+    }
+
+    arrayResize(out, data - out.data());
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+Containers::Array<char> encodeVertices(const Containers::StridedArrayView2D<const char>& vertices, const std::initializer_list<UnsignedInt> componentSizes) {
+    return encodeVertices(vertices, Containers::arrayView(componentSizes));
+}
+
+Containers::Array<char> encodeVertices(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(isInterleaved(mesh), "MeshTools::encodeVertices(): the mesh is not interleaved", {});
+    const Containers::StridedArrayView2D<const char> vertices = interleavedData(mesh);
+
+    std::size_t minOffset = ~std::size_t{};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        minOffset = Math::min(minOffset, mesh.attributeOffset(i));
+
+    /* Mark bytes where an attribute component starts with the component
+       size */
+    Containers::Array<UnsignedByte> componentStarts{ValueInit, vertices.size()[1]};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::encodeVertices(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), {});
+
+        const std::size_t offset = mesh.attributeOffset(i) - minOffset;
+        const std::size_t size = vertexFormatSize(format)*Math::max(mesh.attributeArraySize(i), UnsignedShort{1});
+        const UnsignedInt componentSize = vertexFormatSize(vertexFormatComponentFormat(format));
+        for(std::size_t j = 0; j + componentSize <= size; j += componentSize)
+            componentStarts[offset + j] = componentSize;
+    }
+
+    /* Bytes not covered by any attribute and bytes in the middle of
+       attributes that overlap others are treated as one-byte components */
+    Containers::Array<UnsignedInt> componentSizes;
+    for(std::size_t i = 0; i < componentStarts.size(); ) {
+        const UnsignedInt size = Math::max(UnsignedInt(componentStarts[i]), 1u);
+        arrayAppend(componentSizes, size);
+        i += size;
+    }
+
+    return encodeVertices(vertices, componentSizes);
+}
+
+bool decodeVerticesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& out) {
+    CORRADE_ASSERT(out.isContiguous<1>(), "MeshTools::decodeVerticesInto(): second vertex view dimension is not contiguous", {});
+
+    const char* in = data.begin();
+    const char* const end = data.end();
+
+    UnsignedInt vertexCount, componentCount;
+    if(data.isEmpty() || UnsignedByte(*in) != VertexEncoding ||
+       !(in = readVarint(in + 1, end, vertexCount)) ||
+       !(in = readVarint(in, end, componentCount)) ||
+       std::size_t(end - in) < componentCount)
+    {
+        Error{} << "MeshTools::decodeVerticesInto(): invalid header";
+        return false;
+    }
+
+    const Containers::ArrayView<const char> componentSizes{in, componentCount};
+    in += componentCount;
+    std::size_t vertexSize = 0;
+    for(const char size: componentSizes) {
+        if(size != 1 && size != 2 && size != 4 && size != 8) {
+            Error{} << "MeshTools::decodeVerticesInto(): invalid header";
+            return false;
+        }
+        vertexSize += size;
+    }
+
+    if(vertexCount != out.size()[0] || vertexSize != out.size()[1]) {
+        Error{} << "MeshTools::decodeVerticesInto(): encoded data contain" << vertexCount << "vertices of" << vertexSize << "bytes but the output has" << out.size()[0] << "vertices of" << out.size()[1] << "bytes";
+        return false;
+    }
+
+    /* Zero-initialized as decodeComponent() gathers the whole block even if
+       the last block is shorter */
+    Containers::Array<UnsignedByte> planes{ValueInit, vertexSize*VertexBlockSize};
+    Containers::Array<UnsignedLong> previous{ValueInit, componentCount};
+    char* const vertexData = static_cast<char*>(out.data());
+    const std::ptrdiff_t stride = out.stride()[0];
+    for(std::size_t begin = 0; begin < vertexCount; begin += VertexBlockSize) {
+        const std::size_t count = Math::min(VertexBlockSize, vertexCount - begin);
+
+        for(std::size_t i = 0; i != vertexSize; ++i) {
+            if(!(in = decodePlane(in, end, planes.data() + i*VertexBlockSize, count))) {
+                Error{} << "MeshTools::decodeVerticesInto(): data truncated or corrupted";
+                return false;
+            }
+        }
+
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != componentCount; ++i) {
+            const UnsignedByte* const src = planes.data() + offset*VertexBlockSize;
+            char* const dst = vertexData + begin*stride + offset;
+            if(componentSizes[i] == 1)
+                decodeComponent<UnsignedByte>(src, count, previous[i], dst, stride);
+            else if(componentSizes[i] == 2)
+                decodeComponent<UnsignedShort>(src, count, previous[i], dst, stride);
+            else if(componentSizes[i] == 4)
+                decodeComponent<UnsignedInt>(src, count, previous[i], dst, stride);
+            else
+                decodeComponent<UnsignedLong>(src, count, previous[i], dst, stride);
+            offset += componentSizes[i];
+        }
+    }
+
+    if(in != end) {
+        Error{} << "MeshTools::decodeVerticesInto(): unexpected" << end - in << "bytes after the encoded data";
+        return false;
+    }
+
+    return true;
+}
+
+bool decodeVerticesInto(const Containers::ArrayView<const char> data, Trade::MeshData& mesh) {
+    CORRADE_ASSERT(isInterleaved(mesh), "MeshTools::decodeVerticesInto(): the mesh is not interleaved", {});
+    CORRADE_ASSERT(mesh.vertexDataFlags() & Trade::DataFlag::Mutable,
+        "MeshTools::decodeVerticesInto(): vertex data not mutable", {});
+    return decodeVerticesInto(data, interleavedMutableData(mesh));
+}
+
+}}
@@ -0,0 +1,241 @@
+#ifndef Magnum_MeshTools_Encode_h
+#define Magnum_MeshTools_Encode_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::encodeIndices(), @ref Magnum::MeshTools::decodeIndicesInto(), @ref Magnum::MeshTools::encodeVertices(), @ref Magnum::MeshTools::decodeVerticesInto()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Encode an index array
+@param indices      Index array
+@param primitive    Mesh primitive the indices are for
+@m_since_latest
+
+Produces a lossless byte-oriented representation of @p indices that's
+typically several times smaller than the original and that's furthermore
+well compressible with general-purpose compressors such as zstd or deflate.
+Each index is stored as a difference to a preceding index, zigzag-encoded and
+written as a variable-length integer with 7 bits per byte, so indices close to
+each other take just a single byte. If @p primitive is
+@ref MeshPrimitive::Triangles, the first index of each triangle is stored
+relative to the first index of the previous triangle and the remaining two
+relative to the first index of the same triangle, which makes use of
+triangle locality in meshes optimized for the vertex cache, otherwise each
+index is stored relative to the previous one.
+
+The data contain the index count and can be decoded back with
+@ref decodeIndicesInto(). The original index type isn't stored, so the
+indices can be decoded to any type that's large enough.
+@see @ref compressIndices(), @ref optimizeVertexCacheInPlace(),
+    @ref encodeVertices()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, MeshPrimitive primitive = MeshPrimitive::Triangles);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, MeshPrimitive primitive = MeshPrimitive::Triangles);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, MeshPrimitive primitive = MeshPrimitive::Triangles);
+
+/**
+@brief Encode a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref encodeIndices(const Containers::StridedArrayView1D<const UnsignedInt>&, MeshPrimitive)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView2D<const char>& indices, MeshPrimitive primitive = MeshPrimitive::Triangles);
+
+/**
+@brief Encode mesh indices
+@m_since_latest
+
+Calls @ref encodeIndices(const Containers::StridedArrayView2D<const char>&, MeshPrimitive)
+with @ref Trade::MeshData::indices() and @ref Trade::MeshData::primitive().
+Expects that the mesh is indexed and the index type is not
+implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Trade::MeshData& mesh);
+
+/**
+@brief Decode an index array into an existing location
+@param[in]  data    Data produced by @ref encodeIndices()
+@param[out] out     Where to put the decoded indices
+@return @cpp true @ce on success, @cpp false @ce if the data are invalid
+@m_since_latest
+
+Decodes the indices in a single streaming pass, without any allocations. If
+the index count stored in @p data doesn't match size of @p out, the data
+are truncated or otherwise corrupted or any decoded index doesn't fit into the
+output type, prints a message to @relativeref{Magnum,Error} and returns
+@cpp false @ce, with contents of @p out being unspecified.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedInt>& out);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedShort>& out);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedByte>& out);
+
+/**
+@brief Decode an index array into an existing type-erased location
+@m_since_latest
+
+Expects that the second dimension of @p out is contiguous and represents the
+actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref decodeIndicesInto(Containers::ArrayView<const char>, const Containers::StridedArrayView1D<UnsignedInt>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& out);
+
+/**
+@brief Decode mesh indices into an existing mesh
+@m_since_latest
+
+Calls @ref decodeIndicesInto(Containers::ArrayView<const char>, const Containers::StridedArrayView2D<char>&)
+with @ref Trade::MeshData::mutableIndices(). Expects that the mesh is indexed,
+the index data are mutable and the index type is not implementation-specific.
+The mesh can be for example created with a @relativeref{Corrade,NoInit}
+index and vertex buffer and the final layout, and then filled with
+@ref decodeIndicesInto() and @ref decodeVerticesInto().
+@see @ref Trade::MeshData::indexDataFlags(),
+    @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, Trade::MeshData& mesh);
+
+/**
+@brief Encode a vertex array
+@param vertices         Vertex data
+@param componentSizes   Sizes of consecutive components in each vertex
+@m_since_latest
+
+Produces a lossless representation of @p vertices that's typically
+significantly smaller than the original and that's furthermore well
+compressible with general-purpose compressors such as zstd or deflate. The
+first dimension of @p vertices is the vertices, the second dimension is
+expected to be contiguous and its size equal to a sum of @p componentSizes,
+each of which is expected to be either @cpp 1 @ce, @cpp 2 @ce, @cpp 4 @ce or
+@cpp 8 @ce.
+
+Each component is treated as an integer of given size and stored as a
+zigzag-encoded wrapping difference to the same component in the previous
+vertex. This works for floating-point components as well, where the
+difference is calculated from the bit representation, and similar values
+then share the sign and exponent bits. The differences are split into byte
+planes, so for example all least significant bytes of a component in a block
+of 256 vertices are together, and each plane is then stored in groups of 16
+bytes with either 0, 2, 4 or 8 bits per byte, depending on the largest value
+in given group. Vertices that are close to each other in memory are thus
+expected to be close to each other in space as well, which is the case for
+example after @ref optimizeVertexFetch().
+
+The data contain the vertex count and the component layout and can be
+decoded back with @ref decodeVerticesInto().
+@see @ref encodeIndices(), @ref quantize()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeVertices(const Containers::StridedArrayView2D<const char>& vertices, Containers::ArrayView<const UnsignedInt> componentSizes);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeVertices(const Containers::StridedArrayView2D<const char>& vertices, std::initializer_list<UnsignedInt> componentSizes);
+
+/**
+@brief Encode mesh vertices
+@m_since_latest
+
+Calls @ref encodeVertices(const Containers::StridedArrayView2D<const char>&, Containers::ArrayView<const UnsignedInt>)
+with @ref interleavedData() and component sizes derived from
+@ref vertexFormatComponentFormat() of each attribute, with bytes not covered
+by any attribute treated as separate one-byte components. Expects that the
+mesh is interleaved and no attribute has an implementation-specific format.
+@see @ref isInterleaved(), @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeVertices(const Trade::MeshData& mesh);
+
+/**
+@brief Decode a vertex array into an existing location
+@param[in]  data    Data produced by @ref encodeVertices()
+@param[out] out     Where to put the decoded vertices
+@return @cpp true @ce on success, @cpp false @ce if the data are invalid
+@m_since_latest
+
+Decodes the vertices in a single streaming pass, block by block, with the
+only allocation being a temporary buffer for one block. Expects that the
+second dimension of @p out is contiguous. If the vertex count or the vertex
+size stored in @p data doesn't match size of @p out or the data are truncated
+or otherwise corrupted, prints a message to @relativeref{Magnum,Error} and
+returns @cpp false @ce, with contents of @p out being unspecified.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeVerticesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& out);
+
+/**
+@brief Decode mesh vertices into an existing mesh
+@m_since_latest
+
+Calls @ref decodeVerticesInto(Containers::ArrayView<const char>, const Containers::StridedArrayView2D<char>&)
+with @ref interleavedMutableData(). Expects that the mesh is interleaved and
+the vertex data are mutable. The mesh is expected to have the same layout as
+the mesh passed to @ref encodeVertices(const Trade::MeshData&), only the
+vertex count and the total vertex size is checked.
+@see @ref isInterleaved(), @ref Trade::MeshData::vertexDataFlags(),
+    @ref decodeIndicesInto(Containers::ArrayView<const char>, Trade::MeshData&)
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeVerticesInto(Containers::ArrayView<const char> data, Trade::MeshData& mesh);
+
+}}
+
+#endif
@@ -0,0 +1,379 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FindInstances.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+#include "Magnum/Math/Algorithms/SymmetricEigen.h"
+#include "Magnum/MeshTools/Copy.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+inline std::size_t hashKey(const char* const key, const std::size_t size) {
+    return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(key, size).byteArray());
+}
+
+/* Per-mesh data calculated upfront. The hash covers the layout and index
+   data, the rest are invariants of a rigid transformation, used to quickly
+   reject meshes that can't be identical. */
+struct MeshInfo {
+    std::size_t hash;
+    bool transformable;
+    Vector3d centroid;
+    Vector3d eigenvalues;
+    Double radius;
+    Double magnitude;
+};
+
+/* Returns a view on the first position attribute, converting it to a
+   temporary if it's not a Vector3 */
+Containers::StridedArrayView1D<const Vector3> positionsView(const Trade::MeshData& mesh, Containers::Array<Vector3>& storage) {
+    const UnsignedInt id = *mesh.findAttributeId(Trade::MeshAttribute::Position);
+    if(mesh.attributeFormat(id) == VertexFormat::Vector3)
+        return mesh.attribute<Vector3>(id);
+    storage = mesh.positions3DAsArray();
+    return storage;
+}
+
+/* Both views are expected to have the same size and be contiguous in the
+   second dimension */
+bool equalBytes(const Containers::StridedArrayView2D<const char>& a, const Containers::StridedArrayView2D<const char>& b) {
+    for(std::size_t i = 0; i != a.size()[0]; ++i)
+        if(std::memcmp(a[i].data(), b[i].data(), a.size()[1]) != 0)
+            return false;
+    return true;
+}
+
+MeshInfo meshInfo(const Trade::MeshData& mesh) {
+    MeshInfo info{};
+
+    /* Layout and index data hash. The layout is first gathered into an array
+       of integers which is then hashed as a whole. */
+    Containers::Array<UnsignedInt> layout;
+    arrayAppend(layout, {
+        UnsignedInt(mesh.primitive()),
+        UnsignedInt(mesh.isIndexed()),
+        mesh.vertexCount(),
+        mesh.attributeCount()
+    });
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) arrayAppend(layout, {
+        UnsignedInt(mesh.attributeName(i)),
+        UnsignedInt(mesh.attributeFormat(i)),
+        UnsignedInt(mesh.attributeArraySize(i)),
+        UnsignedInt(mesh.attributeMorphTargetId(i))
+    });
+    if(mesh.isIndexed()) {
+        const Containers::StridedArrayView2D<const char> indices = mesh.indices();
+        Containers::Array<char> indexData;
+        Containers::ArrayView<const char> contiguousIndices;
+        if(indices.isContiguous())
+            contiguousIndices = indices.asContiguous();
+        else {
+            indexData = Containers::Array<char>{NoInit, indices.size()[0]*indices.size()[1]};
+            Utility::copy(indices, Containers::StridedArrayView2D<char>{indexData, indices.size()});
+            contiguousIndices = indexData;
+        }
+        arrayAppend(layout, {
+            UnsignedInt(mesh.indexType()),
+            mesh.indexCount(),
+            UnsignedInt(hashKey(contiguousIndices.data(), contiguousIndices.size()))
+        });
+    }
+    info.hash = hashKey(reinterpret_cast<const char*>(layout.data()), layout.size()*sizeof(UnsignedInt));
+
+    /* Only meshes with 3D positions and without morph targets are considered
+       for a rigid transformation */
+    const Containers::Optional<UnsignedInt> positionId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+    info.transformable = positionId &&
+        vertexFormatComponentCount(mesh.attributeFormat(*positionId)) == 3 &&
+        mesh.attributeCount(-1) == mesh.attributeCount();
+    if(!info.transformable || !mesh.vertexCount()) return info;
+
+    Containers::Array<Vector3> positionStorage;
+    const Containers::StridedArrayView1D<const Vector3> positions = positionsView(mesh, positionStorage);
+
+    Vector3d sum;
+    for(const Vector3& position: positions)
+        sum += Vector3d{position};
+    info.centroid = sum/Double(positions.size());
+
+    Matrix3d covariance{Math::ZeroInit};
+    for(const Vector3& position: positions) {
+        const Vector3d relative = Vector3d{position} - info.centroid;
+        for(std::size_t i = 0; i != 3; ++i)
+            covariance[i] += relative*relative[i];
+        info.radius = Math::max(info.radius, relative.length());
+        info.magnitude = Math::max(info.magnitude, Double(Math::abs(position).max()));
+    }
+    info.eigenvalues = Math::Algorithms::symmetricEigen(covariance/Double(positions.size())).second();
+
+    return info;
+}
+
+/* Everything except vertex data is the same */
+bool sameLayout(const Trade::MeshData& a, const Trade::MeshData& b) {
+    if(a.primitive() != b.primitive() ||
+       a.isIndexed() != b.isIndexed() ||
+       a.vertexCount() != b.vertexCount() ||
+       a.attributeCount() != b.attributeCount())
+        return false;
+
+    for(UnsignedInt i = 0; i != a.attributeCount(); ++i) {
+        if(a.attributeName(i) != b.attributeName(i) ||
+           a.attributeFormat(i) != b.attributeFormat(i) ||
+           a.attributeArraySize(i) != b.attributeArraySize(i) ||
+           a.attributeMorphTargetId(i) != b.attributeMorphTargetId(i))
+            return false;
+    }
+
+    if(a.isIndexed()) {
+        if(a.indexType() != b.indexType() ||
+           a.indexCount() != b.indexCount() ||
+           !equalBytes(a.indices(), b.indices()))
+            return false;
+    }
+
+    return true;
+}
+
+/* Both meshes are rounded to the nearest representable value after the
+   pre-transformation, meaning each coordinate can be off by half an ULP of
+   the magnitude in either of them, plus whatever error the transformation
+   calculation itself introduced */
+constexpr Double ToleranceScale = 4.0;
+
+/* Returns a rigid transformation that maps the mesh a to the mesh b, or
+   NullOpt if there's none within the tolerance. The meshes are expected to
+   have the same layout. */
+Containers::Optional<Matrix4> rigidTransformation(const Trade::MeshData& a, const MeshInfo& aInfo, const Containers::StridedArrayView1D<const Vector3>& aPositions, const Trade::MeshData& b, const MeshInfo& bInfo, const Containers::StridedArrayView1D<const Vector3>& bPositions, const Float epsilon) {
+    /* If the mesh isn't transformable or there are no positions to calculate
+       the transformation from, all attributes have to be the same */
+    if(!aInfo.transformable || aPositions.isEmpty()) {
+        for(UnsignedInt i = 0; i != a.attributeCount(); ++i)
+            if(!equalBytes(a.attribute(i), b.attribute(i)))
+                return {};
+        return Matrix4{Math::IdentityInit};
+    }
+
+    /* Reject meshes with different rigid transformation invariants. If all
+       positions relative to the centroid differ by at most 2*tolerance, each
+       item of the covariance matrix differs by at most
+       4*radius*tolerance + 4*tolerance^2, and the eigenvalues at most by
+       three times that. */
+    const Double tolerance = ToleranceScale*epsilon*Math::max(aInfo.magnitude, bInfo.magnitude);
+    const Double radius = Math::max(aInfo.radius, bInfo.radius);
+    if(Math::abs(aInfo.radius - bInfo.radius) > 2.0*tolerance)
+        return {};
+    const Double eigenvalueTolerance = 12.0*(radius*tolerance + tolerance*tolerance) + 1.0e-9*Math::max(aInfo.eigenvalues.max(), bInfo.eigenvalues.max());
+    if((Math::abs(aInfo.eigenvalues - bInfo.eigenvalues) > Vector3d{eigenvalueTolerance}).any())
+        return {};
+
+    /* Kabsch algorithm -- the optimal rotation is the rotation part of the
+       polar decomposition of the cross-covariance matrix */
+    Matrix3d crossCovariance{Math::ZeroInit};
+    for(std::size_t i = 0; i != aPositions.size(); ++i) {
+        const Vector3d aRelative = Vector3d{aPositions[i]} - aInfo.centroid;
+        const Vector3d bRelative = Vector3d{bPositions[i]} - bInfo.centroid;
+        for(std::size_t j = 0; j != 3; ++j)
+            crossCovariance[j] += bRelative*aRelative[j];
+    }
+    const Matrix3d rotation = Math::Algorithms::polarDecomposition(crossCovariance).first();
+    const Vector3d translation = bInfo.centroid - rotation*aInfo.centroid;
+
+    for(std::size_t i = 0; i != aPositions.size(); ++i)
+        if((rotation*Vector3d{aPositions[i]} + translation - Vector3d{bPositions[i]}).dot() > tolerance*tolerance)
+            return {};
+
+    /* Directions are affected by the rotation only. An error in the
+       positions results in an error in the rotation relative to the mesh
+       size. */
+    const Double directionTolerance = epsilon + (radius > 0.0 ? 2.0*tolerance/radius : 0.0);
+    const auto sameDirections = [&](const Containers::Array<Vector3>& aDirections, const Containers::Array<Vector3>& bDirections) -> bool {
+        for(std::size_t i = 0; i != aDirections.size(); ++i)
+            if((rotation*Vector3d{aDirections[i]} - Vector3d{bDirections[i]}).dot() > directionTolerance*directionTolerance)
+                return false;
+        return true;
+    };
+
+    /* Check the remaining attributes. Morph targets aren't present in
+       transformable meshes, so the attribute ID can be used directly. */
+    UnsignedInt positionCount = 0;
+    UnsignedInt normalCount = 0;
+    UnsignedInt tangentCount = 0;
+    UnsignedInt bitangentCount = 0;
+    for(UnsignedInt i = 0; i != a.attributeCount(); ++i) {
+        const Trade::MeshAttribute name = a.attributeName(i);
+        const UnsignedInt componentCount = vertexFormatComponentCount(a.attributeFormat(i));
+
+        /* The first position attribute is checked above already */
+        if(name == Trade::MeshAttribute::Position && componentCount == 3) {
+            const UnsignedInt id = positionCount++;
+            if(!id) continue;
+            const Containers::Array<Vector3> aExtraPositions = a.positions3DAsArray(id);
+            const Containers::Array<Vector3> bExtraPositions = b.positions3DAsArray(id);
+            for(std::size_t j = 0; j != aExtraPositions.size(); ++j)
+                if((rotation*Vector3d{aExtraPositions[j]} + translation - Vector3d{bExtraPositions[j]}).dot() > tolerance*tolerance)
+                    return {};
+
+        } else if(name == Trade::MeshAttribute::Normal) {
+            const UnsignedInt id = normalCount++;
+            if(!sameDirections(a.normalsAsArray(id), b.normalsAsArray(id)))
+                return {};
+
+        } else if(name == Trade::MeshAttribute::Tangent) {
+            const UnsignedInt id = tangentCount++;
+            if(!sameDirections(a.tangentsAsArray(id), b.tangentsAsArray(id)))
+                return {};
+            if(componentCount == 4) {
+                const Containers::Array<Float> aSigns = a.bitangentSignsAsArray(id);
+                const Containers::Array<Float> bSigns = b.bitangentSignsAsArray(id);
+                for(std::size_t j = 0; j != aSigns.size(); ++j)
+                    if(aSigns[j] != bSigns[j]) return {};
+            }
+
+        } else if(name == Trade::MeshAttribute::Bitangent) {
+            const UnsignedInt id = bitangentCount++;
+            if(!sameDirections(a.bitangentsAsArray(id), b.bitangentsAsArray(id)))
+                return {};
+
+        } else if(!equalBytes(a.attribute(i), b.attribute(i)))
+            return {};
+    }
+
+    return Matrix4::from(Matrix3x3{rotation}, Vector3{translation});
+}
+
+}
+
+MeshInstances findInstances(const Containers::Iterable<const Trade::MeshData>& meshes, const Float epsilon) {
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData& mesh = meshes[i];
+        CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+            "MeshTools::findInstances(): mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+        for(UnsignedInt j = 0; j != mesh.attributeCount(); ++j) {
+            const VertexFormat format = mesh.attributeFormat(j);
+            CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+                "MeshTools::findInstances(): mesh" << i << "attribute" << j << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), {});
+        }
+    }
+    #endif
+
+    Containers::Array<MeshInfo> infos{NoInit, meshes.size()};
+    for(std::size_t i = 0; i != meshes.size(); ++i)
+        infos[i] = meshInfo(meshes[i]);
+
+    /* Group the meshes by their hash, keeping the input order in each group
+       so the first occurrence of each unique mesh is the one that gets
+       picked */
+    Containers::Array<UnsignedInt> order{NoInit, meshes.size()};
+    for(std::size_t i = 0; i != order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](UnsignedInt a, UnsignedInt b) {
+        return infos[a].hash < infos[b].hash;
+    });
+
+    /* For each mesh find the first occurrence of an identical one together
+       with the transformation from it */
+    Containers::Array<UnsignedInt> representatives{NoInit, meshes.size()};
+    MeshInstances out;
+    out.transformations = Containers::Array<Matrix4>{NoInit, meshes.size()};
+    Containers::Array<UnsignedInt> groupRepresentatives;
+    Containers::Array<Containers::StridedArrayView1D<const Vector3>> groupPositions;
+    Containers::Array<Containers::Array<Vector3>> groupPositionStorage;
+    for(std::size_t groupBegin = 0, groupEnd; groupBegin != order.size(); groupBegin = groupEnd) {
+        groupEnd = groupBegin + 1;
+        while(groupEnd != order.size() && infos[order[groupEnd]].hash == infos[order[groupBegin]].hash)
+            ++groupEnd;
+
+        arrayResize(groupRepresentatives, 0);
+        arrayResize(groupPositions, 0);
+        arrayResize(groupPositionStorage, 0);
+        for(std::size_t i = groupBegin; i != groupEnd; ++i) {
+            const UnsignedInt id = order[i];
+            const Trade::MeshData& mesh = meshes[id];
+            Containers::Array<Vector3> positionStorage;
+            const Containers::StridedArrayView1D<const Vector3> positions = infos[id].transformable ?
+                positionsView(mesh, positionStorage) : nullptr;
+
+            bool found = false;
+            for(std::size_t j = 0; j != groupRepresentatives.size(); ++j) {
+                const UnsignedInt representative = groupRepresentatives[j];
+                const Trade::MeshData& representativeMesh = meshes[representative];
+                if(!sameLayout(representativeMesh, mesh))
+                    continue;
+
+                if(const Containers::Optional<Matrix4> transformation = rigidTransformation(representativeMesh, infos[representative], groupPositions[j], mesh, infos[id], positions, epsilon)) {
+                    representatives[id] = representative;
+                    out.transformations[id] = *transformation;
+                    found = true;
+                    break;
+                }
+            }
+
+            if(!found) {
+                representatives[id] = id;
+                out.transformations[id] = Matrix4{Math::IdentityInit};
+                arrayAppend(groupRepresentatives, id);
+                /* Moving the storage doesn't change its data pointer, so the
+                   view stays valid */
+                arrayAppend(groupPositions, positions);
+                arrayAppend(groupPositionStorage, Utility::move(positionStorage));
+            }
+        }
+    }
+
+    /* Assign unique mesh IDs in order of first occurrence and copy the unique
+       meshes. A representative is always earlier in the input than meshes
+       that refer to it, so it has its ID assigned already. */
+    out.meshIds = Containers::Array<UnsignedInt>{NoInit, meshes.size()};
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        if(representatives[i] == i) {
+            out.meshIds[i] = out.meshes.size();
+            arrayAppend(out.meshes, copy(meshes[i]));
+        } else out.meshIds[i] = out.meshIds[representatives[i]];
+    }
+
+    /* Convert the growable array to a regular one so it can be used with
+       a default deleter */
+    arrayShrink(out.meshes, DefaultInit);
+
+    return out;
+}
+
+}}
@@ -0,0 +1,130 @@
+#ifndef Magnum_MeshTools_FindInstances_h
+#define Magnum_MeshTools_FindInstances_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::findInstances(), struct @ref Magnum::MeshTools::MeshInstances
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Mesh instances
+@m_since_latest
+
+Unique meshes and their instances found by @ref findInstances(). The
+@ref meshIds and @ref transformations arrays have one item for each input
+mesh, the @p i -th input mesh is equivalent to
+@cpp meshes[meshIds[i]] @ce transformed with @cpp transformations[i] @ce.
+*/
+struct MeshInstances {
+    /**
+     * @brief Unique meshes
+     *
+     * Owned copies of the first occurrence of each unique mesh in the input,
+     * in the order of their first occurrence.
+     */
+    Containers::Array<Trade::MeshData> meshes;
+
+    /**
+     * @brief Unique mesh IDs
+     *
+     * Index into @ref meshes for each input mesh.
+     */
+    Containers::Array<UnsignedInt> meshIds;
+
+    /**
+     * @brief Instance transformations
+     *
+     * Rigid transformation of the unique mesh for each input mesh. An
+     * identity for first occurrences of each unique mesh.
+     */
+    Containers::Array<Matrix4> transformations;
+};
+
+/**
+@brief Find meshes that are identical up to a rigid transformation
+@param meshes       Input meshes
+@param epsilon      Relative position tolerance
+@m_since_latest
+
+Meant for scenes where the same geometry is stored many times, each copy
+pre-transformed to its final placement, which is common for example in
+imported CAD models. Returns a list of unique meshes together with a unique
+mesh ID and a transformation for each input mesh, which can be then used to
+replace the mesh and multiply the transformation of each object referencing
+the input mesh in a @ref Trade::SceneData, or to render the meshes with
+instancing.
+
+Two meshes are considered identical if they have the same primitive, index
+buffer, vertex count and attribute layout, and there's a rotation and
+translation that maps positions of one mesh to the other. Vertices are
+matched by their index, i.e. the meshes are expected to differ only in the
+transformation and not in vertex or index order. The transformation is
+calculated as the least-squares fit using the Kabsch algorithm, with the
+rotation extracted by @ref Math::Algorithms::polarDecomposition(), and is
+then verified against all vertices. Reflections are not considered.
+
+Positions are compared with @p epsilon scaled by the largest absolute
+position coordinate of the two meshes, to account for precision lost in the
+pre-transformation, with an additional small constant factor covering
+rounding errors in both meshes. @ref Trade::MeshAttribute::Normal,
+@relativeref{Trade::MeshAttribute,Tangent} and
+@relativeref{Trade::MeshAttribute,Bitangent} are expected to be rotated in
+the same way, with a corresponding tolerance, and bitangent signs in
+four-component tangents have to match exactly. All other attributes are
+expected to be bit-exact. If a mesh has no 3D
+@ref Trade::MeshAttribute::Position attribute or contains morph targets, it's
+considered identical only to meshes that are bit-exact, with the
+transformation being an identity.
+
+Candidate meshes are first grouped by a hash of their layout and index
+data, and then filtered by rigid transformation invariants such as
+eigenvalues of the position covariance before the transformation is
+calculated, so the time spent on meshes that aren't identical is mostly
+linear in their count and size.
+
+Expects that the meshes don't have an implementation-specific index type or
+vertex formats.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref isVertexFormatImplementationSpecific(), @ref copy()
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshInstances findInstances(const Containers::Iterable<const Trade::MeshData>& meshes, Float epsilon = Math::TypeTraits<Float>::epsilon());
+
+}}
+
+#endif
@@ -0,0 +1,314 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMeshlets.h"
+
+#include <cmath>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Meshlet-local index of a vertex that's not in the current meshlet */
+constexpr UnsignedShort NotInMeshlet = 0xffff;
+
+template<class T> Meshlets generateMeshletsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateMeshlets(): index count not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256,
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256 but got" << maxVertexCount, {});
+    CORRADE_ASSERT(maxTriangleCount,
+        "MeshTools::generateMeshlets(): expected non-zero max triangle count", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::generateMeshlets(): index" << index << "out of range for" << positions.size() << "vertices", {});
+    #endif
+
+    const UnsignedInt vertexCount = positions.size();
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Live triangles of each vertex are kept at the front of its neighbor
+       range, emitted triangles get swapped out to the back */
+    Containers::Array<UnsignedInt> liveTriangleCount;
+    Containers::Array<UnsignedInt> neighborOffset;
+    Containers::Array<UnsignedInt> neighbors;
+    Implementation::buildAdjacency(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    Containers::Array<UnsignedShort> localIndex{DirectInit, vertexCount, NotInMeshlet};
+    Containers::BitArray emitted{ValueInit, triangleCount};
+
+    /* Scratch memory for calculating bounds of a single meshlet. For every
+       non-degenerate triangle a unit normal and one of its vertices is
+       remembered to calculate the normal cone. */
+    Containers::Array<Vector3> meshletPositions{NoInit, maxVertexCount};
+    Containers::Array<Vector3> meshletNormals{NoInit, maxTriangleCount};
+    Containers::Array<Vector3> meshletNormalPoints{NoInit, maxTriangleCount};
+
+    Containers::Array<UnsignedInt> vertexOffsets;
+    Containers::Array<UnsignedInt> vertices;
+    Containers::Array<UnsignedInt> triangleOffsets;
+    Containers::Array<Vector3ub> triangles;
+    Containers::Array<Vector3> boundingSphereCenters;
+    Containers::Array<Float> boundingSphereRadii;
+    Containers::Array<Vector3> coneApexes;
+    Containers::Array<Vector3> coneAxes;
+    Containers::Array<Float> coneCutoffs;
+    arrayAppend(vertexOffsets, 0u);
+    arrayAppend(triangleOffsets, 0u);
+
+    /* Count of vertices of given triangle that aren't in the current meshlet
+       yet, with duplicate vertices of degenerate triangles counted once */
+    const auto newVertexCount = [&](const std::size_t triangle) {
+        const UnsignedInt a = indices[triangle*3 + 0];
+        const UnsignedInt b = indices[triangle*3 + 1];
+        const UnsignedInt c = indices[triangle*3 + 2];
+        return UnsignedInt(localIndex[a] == NotInMeshlet) +
+               UnsignedInt(localIndex[b] == NotInMeshlet && b != a) +
+               UnsignedInt(localIndex[c] == NotInMeshlet && c != a && c != b);
+    };
+
+    const auto finishMeshlet = [&]() {
+        const UnsignedInt vertexBegin = vertexOffsets.back();
+        const UnsignedInt triangleBegin = triangleOffsets.back();
+        const UnsignedInt meshletVertexCount = vertices.size() - vertexBegin;
+
+        for(UnsignedInt i = 0; i != meshletVertexCount; ++i) {
+            const UnsignedInt vertex = vertices[vertexBegin + i];
+            localIndex[vertex] = NotInMeshlet;
+            meshletPositions[i] = positions[vertex];
+        }
+        arrayAppend(vertexOffsets, UnsignedInt(vertices.size()));
+        arrayAppend(triangleOffsets, UnsignedInt(triangles.size()));
+
+        const Containers::Pair<Vector3, Float> sphere = boundingSphereBouncingBubble(meshletPositions.prefix(meshletVertexCount));
+        arrayAppend(boundingSphereCenters, sphere.first());
+        arrayAppend(boundingSphereRadii, sphere.second());
+
+        /* Average of unit triangle normals is the cone axis, degenerate
+           triangles are skipped as they're never visible */
+        UnsignedInt normalCount = 0;
+        Vector3 axis;
+        for(std::size_t i = triangleBegin; i != triangles.size(); ++i) {
+            const Vector3 a = meshletPositions[triangles[i][0]];
+            const Vector3 b = meshletPositions[triangles[i][1]];
+            const Vector3 c = meshletPositions[triangles[i][2]];
+            const Vector3 normal = Math::cross(b - a, c - a);
+            const Float length = normal.length();
+            if(length == 0.0f) continue;
+            meshletNormals[normalCount] = normal/length;
+            meshletNormalPoints[normalCount] = a;
+            axis += meshletNormals[normalCount];
+            ++normalCount;
+        }
+
+        /* The cone has to contain all normals. If it's wider than a
+           hemisphere or there are no normals at all, the meshlet is visible
+           from everywhere. */
+        const Float axisLength = axis.length();
+        Float minDot = 1.0f;
+        if(axisLength > Math::TypeTraits<Float>::epsilon()) {
+            axis /= axisLength;
+            for(UnsignedInt i = 0; i != normalCount; ++i)
+                minDot = Math::min(minDot, Math::dot(meshletNormals[i], axis));
+        } else minDot = 0.0f;
+
+        if(minDot <= 0.0f) {
+            arrayAppend(coneApexes, sphere.first());
+            arrayAppend(coneAxes, Vector3{});
+            arrayAppend(coneCutoffs, 1.0f);
+            return;
+        }
+
+        /* Move the apex back along the axis so it's behind planes of all
+           triangles, which makes the culling test conservative also for a
+           camera close to the meshlet */
+        Float maxDistance = 0.0f;
+        for(UnsignedInt i = 0; i != normalCount; ++i) {
+            const Vector3 n = meshletNormals[i];
+            maxDistance = Math::max(maxDistance, Math::dot(sphere.first() - meshletNormalPoints[i], n)/Math::dot(axis, n));
+        }
+
+        arrayAppend(coneApexes, sphere.first() - axis*maxDistance);
+        arrayAppend(coneAxes, axis);
+        arrayAppend(coneCutoffs, std::sqrt(Math::max(0.0f, 1.0f - minDot*minDot)));
+    };
+
+    std::size_t remaining = triangleCount;
+    std::size_t cursor = 0;
+    std::size_t seed = ~std::size_t{};
+    while(remaining) {
+        const UnsignedInt vertexBegin = vertexOffsets.back();
+        const UnsignedInt meshletVertexCount = vertices.size() - vertexBegin;
+        const UnsignedInt meshletTriangleCount = triangles.size() - triangleOffsets.back();
+
+        /* Take the triangle that didn't fit into the previous meshlet, if
+           there's any. Otherwise pick a live triangle adjacent to the meshlet
+           that adds the least new vertices, and out of those the one whose
+           vertices have the least live triangles left, to not leave isolated
+           triangles behind. */
+        std::size_t next = seed;
+        seed = ~std::size_t{};
+        if(next == ~std::size_t{}) {
+            UnsignedInt bestNewVertexCount = 4;
+            UnsignedInt bestLiveTriangleCount = ~UnsignedInt{};
+            for(UnsignedInt i = 0; i != meshletVertexCount; ++i) {
+                const UnsignedInt vertex = vertices[vertexBegin + i];
+                for(UnsignedInt j = neighborOffset[vertex], end = j + liveTriangleCount[vertex]; j != end; ++j) {
+                    const UnsignedInt triangle = neighbors[j];
+                    const UnsignedInt candidateNewVertexCount = newVertexCount(triangle);
+                    if(candidateNewVertexCount > bestNewVertexCount) continue;
+                    const UnsignedInt candidateLiveTriangleCount =
+                        liveTriangleCount[indices[triangle*3 + 0]] +
+                        liveTriangleCount[indices[triangle*3 + 1]] +
+                        liveTriangleCount[indices[triangle*3 + 2]];
+                    if(candidateNewVertexCount < bestNewVertexCount || candidateLiveTriangleCount < bestLiveTriangleCount) {
+                        next = triangle;
+                        bestNewVertexCount = candidateNewVertexCount;
+                        bestLiveTriangleCount = candidateLiveTriangleCount;
+                    }
+                }
+            }
+
+            /* No adjacent triangle, take the next unused one in index
+               order */
+            if(next == ~std::size_t{}) {
+                while(emitted[cursor]) ++cursor;
+                next = cursor;
+            }
+        }
+
+        /* If the triangle doesn't fit, finish the meshlet and start the next
+           one from it. A triangle always fits into an empty meshlet. */
+        const UnsignedInt nextNewVertexCount = newVertexCount(next);
+        if(meshletTriangleCount + 1 > maxTriangleCount || meshletVertexCount + nextNewVertexCount > maxVertexCount) {
+            finishMeshlet();
+            seed = next;
+            continue;
+        }
+
+        Vector3ub triangle{NoInit};
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt vertex = indices[next*3 + i];
+            if(localIndex[vertex] == NotInMeshlet) {
+                localIndex[vertex] = UnsignedShort(vertices.size() - vertexBegin);
+                arrayAppend(vertices, vertex);
+            }
+            triangle[i] = UnsignedByte(localIndex[vertex]);
+
+            /* Swap the triangle out of the live range of the vertex. For
+               degenerate triangles the vertex is listed multiple times, so
+               each corner removes one occurence. */
+            const UnsignedInt begin = neighborOffset[vertex];
+            UnsignedInt& count = liveTriangleCount[vertex];
+            for(UnsignedInt j = begin, end = begin + count; j != end; ++j) {
+                if(neighbors[j] != next) continue;
+                Utility::swap(neighbors[j], neighbors[begin + count - 1]);
+                --count;
+                break;
+            }
+        }
+        arrayAppend(triangles, triangle);
+        emitted.set(next);
+        --remaining;
+    }
+
+    if(triangles.size() != triangleOffsets.back())
+        finishMeshlet();
+
+    /* Convert the growable arrays to ones with a default deleter */
+    arrayShrink(vertexOffsets, DefaultInit);
+    arrayShrink(vertices, DefaultInit);
+    arrayShrink(triangleOffsets, DefaultInit);
+    arrayShrink(triangles, DefaultInit);
+    arrayShrink(boundingSphereCenters, DefaultInit);
+    arrayShrink(boundingSphereRadii, DefaultInit);
+    arrayShrink(coneApexes, DefaultInit);
+    arrayShrink(coneAxes, DefaultInit);
+    arrayShrink(coneCutoffs, DefaultInit);
+    return Meshlets{
+        Utility::move(vertexOffsets),
+        Utility::move(vertices),
+        Utility::move(triangleOffsets),
+        Utility::move(triangles),
+        Utility::move(boundingSphereCenters),
+        Utility::move(boundingSphereRadii),
+        Utility::move(coneApexes),
+        Utility::move(coneAxes),
+        Utility::move(coneCutoffs)
+    };
+}
+
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateMeshlets(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return generateMeshletsImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, maxVertexCount, maxTriangleCount);
+    else if(indices.size()[1] == 2)
+        return generateMeshletsImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, maxVertexCount, maxTriangleCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateMeshlets(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return generateMeshletsImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, maxVertexCount, maxTriangleCount);
+    }
+}
+
+Meshlets generateMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateMeshlets(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), {});
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::generateMeshlets(): mesh data not indexed", {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateMeshlets(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::generateMeshlets(): the mesh has no positions", {});
+
+    return generateMeshlets(mesh.indices(), mesh.positions3DAsArray(), maxVertexCount, maxTriangleCount);
+}
+
+}}
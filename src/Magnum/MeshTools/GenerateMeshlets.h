@@ -0,0 +1,209 @@
+#ifndef Magnum_MeshTools_GenerateMeshlets_h
+#define Magnum_MeshTools_GenerateMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateMeshlets(), struct @ref Magnum::MeshTools::Meshlets
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlets
+@m_since_latest
+
+Triangle clusters produced by @ref generateMeshlets(), stored as flat
+arrays with one item per meshlet, or as ranges given by offset arrays. Vertices
+and triangles of the @p i -th meshlet are in range
+@cpp vertexOffsets[i] @ce to @cpp vertexOffsets[i + 1] @ce and
+@cpp triangleOffsets[i] @ce to @cpp triangleOffsets[i + 1] @ce of the
+@ref vertices and @ref triangles arrays, respectively. The triangles index
+the meshlet-local vertex list, which in turn indexes the original vertex data.
+
+The bounding spheres and normal cones can be used for culling whole
+meshlets on either the CPU or the GPU. A meshlet is completely back-facing
+and can be culled if the following holds for a camera at
+@f$ \boldsymbol{c} @f$, with @f$ \boldsymbol{a} @f$ being the cone apex,
+@f$ \boldsymbol{d} @f$ the cone axis and @f$ t @f$ the cone cutoff:
+
+@f[
+    \boldsymbol{d} \cdot \frac{\boldsymbol{a} - \boldsymbol{c}}{|\boldsymbol{a} - \boldsymbol{c}|} \ge t
+@f]
+
+For an orthographic projection or a cheaper but more conservative test, the
+normalized vector from the camera to the apex can be replaced with the view
+direction. Meshlets whose triangles face too many different directions, i.e.
+where the normals don't fit into a cone narrower than a hemisphere, have the
+axis set to a zero vector and the cutoff to @cpp 1.0f @ce, which makes the
+test never pass.
+*/
+struct Meshlets {
+    /**
+     * @brief Vertex offsets
+     *
+     * Has one item more than there's meshlets, with the first item being
+     * @cpp 0 @ce and the last the size of @ref vertices.
+     */
+    Containers::Array<UnsignedInt> vertexOffsets;
+
+    /**
+     * @brief Vertices
+     *
+     * Indices into the original vertex data.
+     */
+    Containers::Array<UnsignedInt> vertices;
+
+    /**
+     * @brief Triangle offsets
+     *
+     * Has one item more than there's meshlets, with the first item being
+     * @cpp 0 @ce and the last the size of @ref triangles.
+     */
+    Containers::Array<UnsignedInt> triangleOffsets;
+
+    /**
+     * @brief Triangles
+     *
+     * Each triangle indexes the vertex list of its meshlet, i.e. index
+     * @cpp j @ce in the @p i -th meshlet corresponds to
+     * @cpp vertices[vertexOffsets[i] + j] @ce.
+     */
+    Containers::Array<Vector3ub> triangles;
+
+    /**
+     * @brief Bounding sphere centers
+     *
+     * Calculated using @ref boundingSphereBouncingBubble().
+     */
+    Containers::Array<Vector3> boundingSphereCenters;
+
+    /** @brief Bounding sphere radii */
+    Containers::Array<Float> boundingSphereRadii;
+
+    /** @brief Normal cone apexes */
+    Containers::Array<Vector3> coneApexes;
+
+    /**
+     * @brief Normal cone axes
+     *
+     * Normalized, or a zero vector if the meshlet can't be culled.
+     */
+    Containers::Array<Vector3> coneAxes;
+
+    /**
+     * @brief Normal cone cutoffs
+     *
+     * Sine of the cone half-angle, or @cpp 1.0f @ce if the meshlet can't be
+     * culled.
+     */
+    Containers::Array<Float> coneCutoffs;
+
+    /** @brief Meshlet count */
+    std::size_t meshletCount() const {
+        return vertexOffsets.isEmpty() ? 0 : vertexOffsets.size() - 1;
+    }
+};
+
+/**
+@brief Split a triangle mesh into meshlets
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param maxVertexCount   Max count of vertices in a meshlet
+@param maxTriangleCount Max count of triangles in a meshlet
+@m_since_latest
+
+Greedily grows each meshlet from a seed triangle, always adding a live
+triangle adjacent to the meshlet that adds the least new vertices and,
+among those, has vertices with the least remaining triangles, so the
+meshlets are compact and don't leave isolated triangles behind. When a
+triangle doesn't fit anymore, it becomes the seed of the next meshlet,
+which makes consecutive meshlets spatially close. If there's no adjacent
+triangle left, the next unused triangle in index order is taken, which means
+disconnected parts of a mesh can end up in the same meshlet.
+
+Expects that the index count is divisible by 3, all indices are in bounds
+of @p positions, @p maxVertexCount is between @cpp 3 @ce and @cpp 256 @ce
+to fit the local indices into @ref Vector3ub and @p maxTriangleCount is not
+zero. The defaults match limits commonly used by mesh shader pipelines. Each
+meshlet then gets a bounding sphere and a normal cone for culling as
+described in the @ref Meshlets documentation. Degenerate triangles don't
+contribute to the normal cone.
+
+For best results, the input should be first processed with
+@ref optimizeVertexCacheInPlace(), as that gives the index order fallback
+better locality.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Split a triangle mesh with a type-erased index array into meshlets
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Split a triangle mesh data into meshlets
+@m_since_latest
+
+Expects that the mesh is indexed, is a @ref MeshPrimitive::Triangles and has
+a @ref Trade::MeshAttribute::Position attribute. The positions are converted
+using @ref Trade::MeshData::positions3DAsArray() and passed together with
+@ref Trade::MeshData::indices() to
+@ref generateMeshlets(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt).
+Expects that the index type is not implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+}}
+
+#endif
@@ -26,12 +26,15 @@
 
 #include "GenerateNormals.h"
 
+#include <algorithm> /* std::sort() */
+#include <atomic>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Implementation/parallelFor.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -63,6 +66,81 @@ namespace {
 using namespace Math::Literals;
 #endif
 
+/* Cross product and interior angles of a single face. Shared between the
+   single-threaded and multi-threaded variant so both give bit-exact same
+   results. */
+inline Containers::Pair<Vector3, Math::Vector3<Rad>> faceCrossAngles(const Vector3& v0, const Vector3& v1, const Vector3& v2) {
+    Containers::Pair<Vector3, Math::Vector3<Rad>> out;
+
+    /* Cross product */
+    out.first() = Math::cross(v2 - v1, v0 - v1);
+
+    /* If any of the vectors is zero, the normalization would result in a
+       NaN and the angle calculation will assert. This happens also when
+       any of the original positions is NaN. If that's the case, skip the
+       rest. Given triangle will then contribute with a zero total angle,
+       effectively getting ignored for normal calculation.
+
+       If, however, an angle
+       */
+    const Vector3 v10n = (v1 - v0).normalized();
+    const Vector3 v20n = (v2 - v0).normalized();
+    const Vector3 v21n = (v2 - v1).normalized();
+    if(Math::isNan(v10n) || Math::isNan(v20n) || Math::isNan(v21n)) {
+        out.second() = Math::Vector3<Rad>{Math::ZeroInit};
+        return out;
+    }
+
+    /* Inner angle at each vertex of the triangle. The last one can be
+       calculated as a remainder to 180°. */
+    /* This using namespace doesn't work with MSVC2019 with /permissive-
+       (it gets lost when instantiating?!), so it's duplicated above */
+    using namespace Math::Literals;
+    out.second()[0] = Math::angle(v10n, v20n);
+    out.second()[1] = Math::angle(-v10n, v21n);
+    out.second()[2] = Rad(180.0_degf) - out.second()[0] - out.second()[1];
+    return out;
+}
+
+/* Normal of vertex `v` calculated from all faces listed in `triangleIds`.
+   Shared between the single-threaded and multi-threaded variant, the faces
+   are expected to be in the same order in both. */
+template<class T, class U> inline Vector3 vertexNormal(const std::size_t v, const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<const U> triangleIds, const Containers::ArrayView<const Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles) {
+    /* Go through all triangles sharing this vertex */
+    Vector3 normal{Math::ZeroInit};
+    for(const U triangleId: triangleIds) {
+        const std::size_t baseIndex = std::size_t(triangleId)*3;
+        const T v0i = indices[baseIndex + 0];
+        const T v1i = indices[baseIndex + 1];
+        const T v2i = indices[baseIndex + 2];
+
+        /* Cross product is a vector in direction of the normal with length
+           equal to size of the parallelogram */
+        const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleId];
+
+        /* Angle between two sides of the triangle that share vertex `v`.
+           The shared vertex can be one of the three. */
+        Rad angle;
+        if(v == v0i) angle = crossAngle.second()[0];
+        else if(v == v1i) angle = crossAngle.second()[1];
+        else if(v == v2i) angle = crossAngle.second()[2];
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+        /* The normal is cross.normalized(), we need to multiply it it by
+           surface area which is cross.length()/2. Since normalization is
+           division by length, multiplying it by length again will be a
+           no-op. Then, since all normals are divided by 2, it doesn't
+           change their ratio for the final normalization so we can omit
+           that as well. Finally we need to weight by the angle, and in
+           that case only the ratio is important as well, so it doesn't
+           matter if degrees or radians. */
+        normal += crossAngle.first()*Float(angle);
+    }
+
+    /* Normalize the accumulated direction */
+    return normal.normalized();
+}
+
 template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
     CORRADE_ASSERT(indices.size() % 3 == 0,
         "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
@@ -113,80 +191,100 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
        below would otherwise calculate it for every vertex, which is at least
        3x as much work */
     Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
-        const Vector3 v0 = positions[indices[i*3 + 0]];
-        const Vector3 v1 = positions[indices[i*3 + 1]];
-        const Vector3 v2 = positions[indices[i*3 + 2]];
-
-        /* Cross product */
-        crossAngles[i].first() = Math::cross(v2 - v1, v0 - v1);
-
-        /* If any of the vectors is zero, the normalization would result in a
-           NaN and the angle calculation will assert. This happens also when
-           any of the original positions is NaN. If that's the case, skip the
-           rest. Given triangle will then contribute with a zero total angle,
-           effectively getting ignored for normal calculation.
-
-           If, however, an angle
-           */
-        const Vector3 v10n = (v1 - v0).normalized();
-        const Vector3 v20n = (v2 - v0).normalized();
-        const Vector3 v21n = (v2 - v1).normalized();
-        if(Math::isNan(v10n) || Math::isNan(v20n) || Math::isNan(v21n)) {
-            crossAngles[i].second() = Math::Vector3<Rad>{Math::ZeroInit};
-            continue;
-        }
-
-        /* Inner angle at each vertex of the triangle. The last one can be
-           calculated as a remainder to 180°. */
-        /* This using namespace doesn't work with MSVC2019 with /permissive-
-           (it gets lost when instantiating?!), so it's duplicated above */
-        using namespace Math::Literals;
-        crossAngles[i].second()[0] = Math::angle(v10n, v20n);
-        crossAngles[i].second()[1] = Math::angle(-v10n, v21n);
-        crossAngles[i].second()[2] = Rad(180.0_degf)
-            - crossAngles[i].second()[0] - crossAngles[i].second()[1];
-    }
+    for(std::size_t i = 0; i != crossAngles.size(); ++i)
+        crossAngles[i] = faceCrossAngles(
+            positions[indices[i*3 + 0]],
+            positions[indices[i*3 + 1]],
+            positions[indices[i*3 + 2]]);
 
     /* For every vertex v, calculate normals from all faces it belongs to and
        average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
-        /* normals are an external memory, ensure we accumulate from zero */
-        normals[v] = Vector3{Math::ZeroInit};
-
-        /* Go through all triangles sharing this vertex */
-        for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
-            const T v0i = indices[baseIndex + 0];
-            const T v1i = indices[baseIndex + 1];
-            const T v2i = indices[baseIndex + 2];
-
-            /* Cross product is a vector in direction of the normal with length
-               equal to size of the parallelogram */
-            const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
-
-            /* Angle between two sides of the triangle that share vertex `v`.
-               The shared vertex can be one of the three. */
-            Rad angle;
-            if(v == v0i) angle = crossAngle.second()[0];
-            else if(v == v1i) angle = crossAngle.second()[1];
-            else if(v == v2i) angle = crossAngle.second()[2];
-            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-
-            /* The normal is cross.normalized(), we need to multiply it it by
-               surface area which is cross.length()/2. Since normalization is
-               division by length, multiplying it by length again will be a
-               no-op. Then, since all normals are divided by 2, it doesn't
-               change their ratio for the final normalization so we can omit
-               that as well. Finally we need to weight by the angle, and in
-               that case only the ratio is important as well, so it doesn't
-               matter if degrees or radians. */
-            normals[v] += crossAngle.first()*Float(angle);
-        }
-
-        /* Normalize the accumulated direction */
-        normals[v] = normals[v].normalized();
+    for(std::size_t v = 0; v != positions.size(); ++v)
+        normals[v] = vertexNormal<T, T>(v, indices, triangleIds.slice(triangleOffset[v], triangleOffset[v + 1]), crossAngles);
+}
+
+template<class T> void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount) {
+    #ifdef MAGNUM_MESHTOOLS_THREADS
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+
+    /* Each thread should process at least 1024 triangles on average,
+       otherwise the overhead of spawning it isn't worth it */
+    const std::size_t faceCount = indices.size()/3;
+    threadCount = Implementation::clampThreadCount(threadCount, faceCount/1024);
+    if(threadCount > 1) {
+        /* Calculate face cross products and angles and count triangles for
+           every vertex. The counts are updated from multiple threads so
+           they're atomic and thus can't reuse the output storage like in the
+           single-threaded case. Every thread remembers position of the first
+           out-of-range index it encountered in order to report it the same
+           way as the single-threaded variant. */
+        Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, faceCount};
+        Containers::Array<std::atomic<UnsignedInt>> triangleCount{ValueInit, positions.size()};
+        Containers::Array<std::size_t> outOfRange{DirectInit, threadCount, ~std::size_t{}};
+        Implementation::parallelFor(threadCount, faceCount, [&](const UnsignedInt thread, const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const T i0 = indices[i*3 + 0];
+                const T i1 = indices[i*3 + 1];
+                const T i2 = indices[i*3 + 2];
+                if(i0 >= positions.size() || i1 >= positions.size() || i2 >= positions.size()) {
+                    outOfRange[thread] = i*3 + (i0 >= positions.size() ? 0 : i1 >= positions.size() ? 1 : 2);
+                    return;
+                }
+
+                crossAngles[i] = faceCrossAngles(positions[i0], positions[i1], positions[i2]);
+                triangleCount[i0].fetch_add(1, std::memory_order_relaxed);
+                triangleCount[i1].fetch_add(1, std::memory_order_relaxed);
+                triangleCount[i2].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        #ifndef CORRADE_NO_ASSERT
+        for(const std::size_t i: outOfRange)
+            CORRADE_ASSERT(i == ~std::size_t{}, "MeshTools::generateSmoothNormalsInto(): index" << indices[i] << "out of range for" << positions.size() << "elements", );
+        #endif
+
+        /* Turn that into a running offset array, same as in the
+           single-threaded case. This is a sequential dependency but it's
+           just a single addition per vertex. */
+        Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
+        triangleOffset[0] = 0;
+        for(std::size_t i = 0; i != triangleCount.size(); ++i)
+            triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i].load(std::memory_order_relaxed);
+
+        CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
+
+        /* Gather triangle IDs for every vertex. The order in which they're
+           written is nondeterministic here, it gets fixed below. */
+        Containers::Array<UnsignedInt> triangleIds{NoInit, indices.size()};
+        Implementation::parallelFor(threadCount, indices.size(), [&](UnsignedInt, const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const T vertexId = indices[i];
+                const UnsignedInt triangleIdsLeftForVertex = triangleCount[vertexId].fetch_sub(1, std::memory_order_relaxed);
+                triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = UnsignedInt(i/3);
+            }
+        });
+
+        /* For every vertex, sort its triangle IDs so they're accumulated in
+           the same order as in the single-threaded variant, making the output
+           deterministic and bit-exact, and calculate the normal. Each thread
+           writes to a disjoint range of the output. */
+        Implementation::parallelFor(threadCount, positions.size(), [&](UnsignedInt, const std::size_t begin, const std::size_t end) {
+            for(std::size_t v = begin; v != end; ++v) {
+                const Containers::ArrayView<UnsignedInt> vertexTriangleIds = triangleIds.slice(triangleOffset[v], triangleOffset[v + 1]);
+                std::sort(vertexTriangleIds.begin(), vertexTriangleIds.end());
+                normals[v] = vertexNormal<T, UnsignedInt>(v, indices, vertexTriangleIds, crossAngles);
+            }
+        });
+
+        return;
     }
+    #else
+    static_cast<void>(threadCount);
+    #endif
+
+    generateSmoothNormalsIntoImplementation(indices, positions, normals);
 }
 
 }
@@ -216,6 +314,28 @@ void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>&
     }
 }
 
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateSmoothNormalsInto(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, threadCount);
+    else if(indices.size()[1] == 2)
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, threadCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, threadCount);
+    }
+}
+
 namespace {
 
 template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
@@ -167,6 +167,55 @@ etc. overloads.
 */
 MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
 
+/**
+@brief Generate smooth normals into an existing array using multiple threads
+@param[in] indices      Triangle face indices
+@param[in] positions    Triangle vertex positions
+@param[out] normals     Where to put the generated normals
+@param[in] threadCount  Count of threads to use. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@m_since_latest
+
+Like @ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&),
+but with the face cross product and angle calculation, vertex-to-face
+adjacency build and per-vertex normal accumulation split across
+@p threadCount threads. Faces adjacent to each vertex are accumulated in the
+same order as in the single-threaded variant, so the output is bit-exact
+regardless of @p threadCount. Passing @cpp 1 @ce is equivalent to calling the
+single-threaded variant. The thread count is additionally limited so each
+thread processes at least 1024 triangles on average. On Emscripten builds
+without threading enabled the data are always processed on a single thread.
+
+Compared to the single-threaded variant, the per-vertex triangle counts are
+kept in an additional temporary array of atomic 32-bit integers instead of
+reusing the @p normals storage.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount);
+
+/**
+@brief Generate smooth normals into an existing array using a type-erased index array and multiple threads
+@m_since_latest
+
+Expects that @p normals has the same size as @p positions and that the second
+dimension of @p indices is contiguous and represents the actual 1/2/4-byte
+index type. Based on its size then calls one of the
+@ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount);
+
 }}
 
 #endif
@@ -0,0 +1,280 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateTangents.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Filter.h"
+#include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Angle between a and b, both projected to a plane given by normal n. Used
+   for weighting the per-corner contributions in the MikkTSpace mode. */
+inline Float projectedAngle(const Vector3& n, const Vector3& a, const Vector3& b) {
+    const Vector3 aProjected = (a - n*Math::dot(n, a)).normalized();
+    const Vector3 bProjected = (b - n*Math::dot(n, b)).normalized();
+    const Float cosine = Math::dot(aProjected, bProjected);
+    /* Degenerate edges, such as with two vertices at the same position or an
+       edge parallel to the normal, contribute with a zero weight */
+    if(Math::isNan(cosine)) return 0.0f;
+    return std::acos(Math::clamp(cosine, -1.0f, 1.0f));
+}
+
+/* Vector projected to a plane given by normal n and normalized, or a zero
+   vector if the projection is zero */
+inline Vector3 projectedNormalized(const Vector3& n, const Vector3& a) {
+    const Vector3 projected = a - n*Math::dot(n, a);
+    const Float lengthSquared = projected.dot();
+    return lengthSquared > 0.0f ? projected/std::sqrt(lengthSquared) : Vector3{};
+}
+
+template<class T> void generateTangentsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const GenerateTangentsFlags flags) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateTangentsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): expected" << positions.size() << "normals but got" << normals.size(), );
+    CORRADE_ASSERT(textureCoordinates.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): expected" << positions.size() << "texture coordinates but got" << textureCoordinates.size(), );
+    CORRADE_ASSERT(tangents.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): bad output size, expected" << positions.size() << "but got" << tangents.size(), );
+
+    /* Tangent directions are accumulated directly in the output, bitangent
+       directions, which are needed only to figure out the sign, in a
+       temporary array */
+    for(Vector4& tangent: tangents) tangent = {};
+    Containers::Array<Vector3> bitangents{ValueInit, positions.size()};
+
+    const bool mikkTSpace = flags & GenerateTangentsFlag::MikkTSpace;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const T i0 = indices[i + 0];
+        const T i1 = indices[i + 1];
+        const T i2 = indices[i + 2];
+        #ifndef CORRADE_NO_ASSERT
+        for(const T index: {i0, i1, i2})
+            CORRADE_ASSERT(index < positions.size(), "MeshTools::generateTangentsInto(): index" << index << "out of range for" << positions.size() << "elements", );
+        #endif
+
+        const Vector3 p0 = positions[i0];
+        const Vector3 p1 = positions[i1];
+        const Vector3 p2 = positions[i2];
+        const Vector2 uv0 = textureCoordinates[i0];
+        const Vector2 uv1 = textureCoordinates[i1];
+        const Vector2 uv2 = textureCoordinates[i2];
+
+        /* Solve for directions in which the U and V coordinates increase. The
+           determinant is twice the signed area of the face in texture space,
+           if it's zero, the face has no usable texture mapping and is
+           skipped. */
+        const Vector3 e1 = p1 - p0;
+        const Vector3 e2 = p2 - p0;
+        const Vector2 d1 = uv1 - uv0;
+        const Vector2 d2 = uv2 - uv0;
+        const Float determinant = Math::cross(d1, d2);
+        if(determinant == 0.0f) continue;
+        const Vector3 tangent = (e1*d2.y() - e2*d1.y())/determinant;
+        const Vector3 bitangent = (e2*d1.x() - e1*d2.x())/determinant;
+
+        if(!mikkTSpace) {
+            for(const T index: {i0, i1, i2}) {
+                tangents[index].xyz() += tangent;
+                bitangents[index] += bitangent;
+            }
+            continue;
+        }
+
+        /* MikkTSpace projects the directions to the tangent plane of each
+           corner, normalizes them and weights them by the corner angle */
+        const T cornerIndices[]{i0, i1, i2};
+        const Vector3 cornerPositions[]{p0, p1, p2};
+        for(std::size_t c = 0; c != 3; ++c) {
+            const T index = cornerIndices[c];
+            const Vector3 n = normals[index];
+            const Vector3& p = cornerPositions[c];
+            const Float angle = projectedAngle(n,
+                cornerPositions[(c + 1) % 3] - p,
+                cornerPositions[(c + 2) % 3] - p);
+            tangents[index].xyz() += projectedNormalized(n, tangent)*angle;
+            bitangents[index] += projectedNormalized(n, bitangent)*angle;
+        }
+    }
+
+    /* Orthonormalize the accumulated tangent against the normal using
+       Gram-Schmidt and calculate the bitangent sign from the accumulated
+       bitangent direction */
+    for(std::size_t i = 0; i != tangents.size(); ++i) {
+        const Vector3 n = normals[i];
+        Vector3 tangent = tangents[i].xyz() - n*Math::dot(n, tangents[i].xyz());
+        const Float lengthSquared = tangent.dot();
+
+        /* If the vertex got no contribution, pick an arbitrary direction
+           perpendicular to the normal, using the axis that's the least
+           aligned with it */
+        if(!(lengthSquared > 0.0f)) {
+            const Vector3 absN = Math::abs(n);
+            const Vector3 axis = absN.x() <= absN.y() && absN.x() <= absN.z() ? Vector3::xAxis() :
+                absN.y() <= absN.z() ? Vector3::yAxis() : Vector3::zAxis();
+            tangents[i] = {projectedNormalized(n, axis), 1.0f};
+            continue;
+        }
+
+        tangent /= std::sqrt(lengthSquared);
+        tangents[i] = {tangent, Math::dot(Math::cross(n, tangent), bitangents[i]) < 0.0f ? -1.0f : 1.0f};
+    }
+}
+
+}
+
+void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const GenerateTangentsFlags flags) {
+    generateTangentsIntoImplementation(indices, positions, normals, textureCoordinates, tangents, flags);
+}
+
+void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const GenerateTangentsFlags flags) {
+    generateTangentsIntoImplementation(indices, positions, normals, textureCoordinates, tangents, flags);
+}
+
+void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const GenerateTangentsFlags flags) {
+    generateTangentsIntoImplementation(indices, positions, normals, textureCoordinates, tangents, flags);
+}
+
+void generateTangentsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, const GenerateTangentsFlags flags) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTangentsInto(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return generateTangentsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, textureCoordinates, tangents, flags);
+    else if(indices.size()[1] == 2)
+        return generateTangentsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, textureCoordinates, tangents, flags);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateTangentsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return generateTangentsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, textureCoordinates, tangents, flags);
+    }
+}
+
+namespace {
+
+template<class T> inline Containers::Array<Vector4> generateTangentsImplementation(const T& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const GenerateTangentsFlags flags) {
+    Containers::Array<Vector4> out{NoInit, positions.size()};
+    generateTangentsInto(indices, positions, normals, textureCoordinates, out, flags);
+    return out;
+}
+
+}
+
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const GenerateTangentsFlags flags) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates, flags);
+}
+
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const GenerateTangentsFlags flags) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates, flags);
+}
+
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const GenerateTangentsFlags flags) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates, flags);
+}
+
+Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const GenerateTangentsFlags flags) {
+    return generateTangentsImplementation(indices, positions, normals, textureCoordinates, flags);
+}
+
+Trade::MeshData generateTangents(const Trade::MeshData& mesh, const GenerateTangentsFlags flags, const InterleaveFlags interleaveFlags) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateTangents(): expected" << MeshPrimitive::Triangles << "but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+    CORRADE_ASSERT(positionAttributeId,
+        "MeshTools::generateTangents(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    const VertexFormat positionAttributeFormat = mesh.attributeFormat(*positionAttributeId);
+    CORRADE_ASSERT(!isVertexFormatImplementationSpecific(positionAttributeFormat),
+        "MeshTools::generateTangents(): positions have an implementation-specific format" << Debug::hex << vertexFormatUnwrap(positionAttributeFormat),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(vertexFormatComponentCount(positionAttributeFormat) == 3,
+        "MeshTools::generateTangents(): expected 3D positions but got" << positionAttributeFormat,
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    const Containers::Optional<UnsignedInt> normalAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Normal);
+    CORRADE_ASSERT(normalAttributeId,
+        "MeshTools::generateTangents(): the mesh has no normals",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    const Containers::Optional<UnsignedInt> textureCoordinateAttributeId = mesh.findAttributeId(Trade::MeshAttribute::TextureCoordinates);
+    CORRADE_ASSERT(textureCoordinateAttributeId,
+        "MeshTools::generateTangents(): the mesh has no texture coordinates",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateTangents(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    /* Use the input attributes directly if they're in the desired format,
+       unpack them otherwise */
+    Containers::Array<Vector3> positionStorage;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    if(positionAttributeFormat == VertexFormat::Vector3)
+        positions = mesh.attribute<Vector3>(*positionAttributeId);
+    else positions = positionStorage = mesh.positions3DAsArray();
+    Containers::Array<Vector3> normalStorage;
+    Containers::StridedArrayView1D<const Vector3> normals;
+    if(mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3)
+        normals = mesh.attribute<Vector3>(*normalAttributeId);
+    else normals = normalStorage = mesh.normalsAsArray();
+    Containers::Array<Vector2> textureCoordinateStorage;
+    Containers::StridedArrayView1D<const Vector2> textureCoordinates;
+    if(mesh.attributeFormat(*textureCoordinateAttributeId) == VertexFormat::Vector2)
+        textureCoordinates = mesh.attribute<Vector2>(*textureCoordinateAttributeId);
+    else textureCoordinates = textureCoordinateStorage = mesh.textureCoordinates2DAsArray();
+
+    /* Copy original attributes to a mutable array so we can replace the
+       tangent attribute or add a new one. Not using Utility::copy() here as
+       the view returned by attributeData() might have offset-only attributes
+       which interleave() doesn't want. */
+    const Containers::Optional<UnsignedInt> tangentAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Tangent);
+    Containers::Array<Trade::MeshAttributeData> attributes{mesh.attributeCount() + (tangentAttributeId ? 0 : 1)};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        attributes[i] = mesh.attributeData(i);
+    const UnsignedInt outputTangentAttributeId = tangentAttributeId ? *tangentAttributeId : mesh.attributeCount();
+    attributes[outputTangentAttributeId] = Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, VertexFormat::Vector4, nullptr};
+
+    /* Create the output mesh with an empty placeholder for the tangents */
+    /** @todo isn't there some less silly way to take just the indices from the
+        mesh?! */
+    Trade::MeshData out = interleave(filterOnlyAttributes(mesh, Containers::ArrayView<const Trade::MeshAttribute>{}), attributes, interleaveFlags);
+
+    const Containers::StridedArrayView1D<Vector4> tangents = out.mutableAttribute<Vector4>(outputTangentAttributeId);
+    if(mesh.isIndexed())
+        generateTangentsInto(mesh.indices(), positions, normals, textureCoordinates, tangents, flags);
+    else
+        generateTangentsInto(generateTrivialIndices(mesh.vertexCount()), positions, normals, textureCoordinates, tangents, flags);
+
+    return out;
+}
+
+}}
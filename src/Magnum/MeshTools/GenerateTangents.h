@@ -0,0 +1,207 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents(), @ref Magnum::MeshTools::generateTangentsInto(), enum @ref Magnum::MeshTools::GenerateTangentsFlag, enum set @ref Magnum::MeshTools::GenerateTangentsFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/InterleaveFlags.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Tangent generation flag
+@m_since_latest
+
+@see @ref GenerateTangentsFlags, @ref generateTangents(),
+    @ref generateTangentsInto()
+*/
+enum class GenerateTangentsFlag: UnsignedByte {
+    /**
+     * Calculate the tangents the same way as the
+     * [MikkTSpace](http://www.mikktspace.com/) reference implementation, which
+     * is what most normal map bakers use. For every triangle corner, the face
+     * tangent and bitangent directions are projected onto the plane of the
+     * vertex normal and normalized, and then accumulated weighted by the
+     * corner angle.
+     *
+     * Unlike the reference implementation, vertices shared by faces with
+     * opposite texture coordinate winding, such as on mirrored UV seams,
+     * aren't split, as the functions never change the vertex count. The
+     * result thus matches the reference implementation for meshes that
+     * already have separate vertices along such seams, which is the case for
+     * most meshes coming from content creation tools.
+     *
+     * If not set, the unnormalized face tangent and bitangent directions are
+     * accumulated, which makes larger faces contribute more. That's slightly
+     * faster, but the result may differ from what a normal map was baked
+     * with.
+     */
+    MikkTSpace = 1 << 0
+};
+
+/**
+@brief Tangent generation flags
+@m_since_latest
+
+@see @ref generateTangents(), @ref generateTangentsInto()
+*/
+typedef Containers::EnumSet<GenerateTangentsFlag> GenerateTangentsFlags;
+
+CORRADE_ENUMSET_OPERATORS(GenerateTangentsFlags)
+
+/**
+@brief Generate tangents
+@param indices              Triangle face indices
+@param positions            Vertex positions
+@param normals              Vertex normals
+@param textureCoordinates   Vertex texture coordinates
+@param flags                Flags
+@return Per-vertex tangents with bitangent sign in the fourth component
+@m_since_latest
+
+For each triangle face calculates the direction in which the texture
+coordinates increase along the X and Y axis, accumulates the directions for all
+faces sharing a vertex and orthonormalizes the resulting tangent against the
+vertex normal. The fourth component is the bitangent sign, which is
+@cpp -1.0f @ce if the texture coordinates are mirrored on given vertex and
+@cpp 1.0f @ce otherwise. Bitangents can be then reconstructed as
+@cpp Math::cross(normal, tangent.xyz())*tangent.w() @ce, which is what
+@ref Shaders::PhongGL does with @ref Shaders::PhongGL::Tangent4.
+
+Expects that the index count is divisible by 3, all indices are in bounds of
+@p positions and that @p normals and @p textureCoordinates have the same size
+as @p positions. The normals are expected to be normalized. Faces with zero
+texture coordinate area don't contribute to the result. Vertices that don't get
+any contribution get an arbitrary tangent perpendicular to the normal with a
+positive bitangent sign.
+
+Use @ref generateTangentsInto() to place the result into existing memory,
+@ref generateTangents(const Trade::MeshData&, GenerateTangentsFlags, InterleaveFlags)
+operates directly on a @ref Trade::MeshData instance.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, GenerateTangentsFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, GenerateTangentsFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, GenerateTangentsFlags flags = {});
+
+/**
+@brief Generate tangents using a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref generateTangents(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&, GenerateTangentsFlags)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector4> generateTangents(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, GenerateTangentsFlags flags = {});
+
+/**
+@brief Generate tangents into an existing array
+@param[in] indices              Triangle face indices
+@param[in] positions            Vertex positions
+@param[in] normals              Vertex normals
+@param[in] textureCoordinates   Vertex texture coordinates
+@param[out] tangents            Where to put the generated tangents
+@param[in] flags                Flags
+@m_since_latest
+
+A variant of @ref generateTangents() that fills existing memory instead of
+allocating a new array. The @p tangents array is expected to have the same size
+as @p positions. The output array is used for accumulating the tangent
+directions, a single additional temporary array of @ref Vector3 is allocated
+for the bitangent directions.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, GenerateTangentsFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, GenerateTangentsFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, GenerateTangentsFlags flags = {});
+
+/**
+@brief Generate tangents into an existing array using a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref generateTangentsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<const Vector2>&, const Containers::StridedArrayView1D<Vector4>&, GenerateTangentsFlags)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateTangentsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Containers::StridedArrayView1D<Vector4>& tangents, GenerateTangentsFlags flags = {});
+
+/**
+@brief Generate tangents for a mesh data
+@m_since_latest
+
+Expects that the mesh is a @ref MeshPrimitive::Triangles and contains a
+three-dimensional @ref Trade::MeshAttribute::Position, a
+@ref Trade::MeshAttribute::Normal and a
+@ref Trade::MeshAttribute::TextureCoordinates, of which the first instances
+are used. The mesh can be both indexed and non-indexed. The attributes are used
+directly if they're @ref VertexFormat::Vector3 and @ref VertexFormat::Vector2,
+respectively, otherwise they're unpacked to a temporary array first.
+
+If the mesh already contains a @ref Trade::MeshAttribute::Tangent, the first
+instance is replaced with a @ref VertexFormat::Vector4 containing the
+generated tangents, otherwise a new @ref VertexFormat::Vector4 tangent
+attribute is added after all other attributes. The data layouting is done by
+@ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags)
+with the @p interleaveFlags parameter propagated to it, see its documentation
+for detailed behavior description. Other attributes, including a
+@ref Trade::MeshAttribute::Bitangent if present, and indices are passed through
+untouched.
+@see @ref generateTangentsInto(), @ref Trade::MeshData::attributeFormat()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData generateTangents(const Trade::MeshData& mesh, GenerateTangentsFlags flags = {}, InterleaveFlags interleaveFlags = InterleaveFlag::PreserveInterleavedAttributes);
+
+}}
+
+#endif
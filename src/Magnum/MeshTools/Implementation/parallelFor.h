@@ -0,0 +1,72 @@
+#ifndef Magnum_MeshTools_Implementation_parallelFor_h
+#define Magnum_MeshTools_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <thread>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+
+/* Emscripten can spawn threads only if built with -pthread, otherwise the
+   multi-threaded variants fall back to a single thread */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#define MAGNUM_MESHTOOLS_THREADS
+#endif
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+#ifdef MAGNUM_MESHTOOLS_THREADS
+/* Common helpers used by multi-threaded MeshTools algorithms.
+
+   Turns a zero thread count into the hardware concurrency and limits it to
+   given maximum, which is usually the amount of work divided by the smallest
+   amount worth spawning a thread for. */
+inline UnsignedInt clampThreadCount(const UnsignedInt threadCount, const std::size_t max) {
+    return UnsignedInt(Math::min(std::size_t(threadCount ? threadCount : Math::max(std::thread::hardware_concurrency(), 1u)), max));
+}
+
+/* Calls f(thread, begin, end) for count items split into threadCount
+   contiguous chunks, the first chunk is processed on the calling thread */
+template<class F> void parallelFor(const UnsignedInt threadCount, const std::size_t count, const F& f) {
+    const std::size_t chunkSize = (count + threadCount - 1)/threadCount;
+    const auto run = [&f, chunkSize, count](const UnsignedInt thread) {
+        const std::size_t begin = Math::min(thread*chunkSize, count);
+        f(thread, begin, Math::min(begin + chunkSize, count));
+    };
+
+    Containers::Array<std::thread> threads{threadCount - 1};
+    for(UnsignedInt i = 1; i != threadCount; ++i)
+        threads[i - 1] = std::thread{run, i};
+    run(0);
+    for(std::thread& thread: threads) thread.join();
+}
+#endif
+
+}}}
+
+#endif
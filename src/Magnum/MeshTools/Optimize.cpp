@@ -0,0 +1,485 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Optimize.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Implementation/remapAttributeData.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Size of the simulated LRU cache and the max live triangle count for which
+   the valence boost is tabulated, vertices with more live triangles get the
+   same boost as the last entry */
+constexpr std::size_t VertexCacheSize = 32;
+constexpr std::size_t MaxValence = 32;
+
+struct VertexScoreTables {
+    explicit VertexScoreTables() {
+        /* The three most recent vertices were used by the last triangle, give
+           them a fixed score so the algorithm doesn't prefer emitting the
+           same triangle again. The rest decays with a power curve. */
+        for(std::size_t i = 0; i != VertexCacheSize; ++i)
+            cache[i] = i < 3 ? 0.75f : std::pow(1.0f - Float(i - 3)/Float(VertexCacheSize - 3), 1.5f);
+
+        /* Boost vertices with few live triangles so lone triangles get
+           emitted early and don't leave expensive leftovers at the end */
+        valence[0] = 0.0f;
+        for(std::size_t i = 1; i != MaxValence + 1; ++i)
+            valence[i] = 2.0f*std::pow(Float(i), -0.5f);
+    }
+
+    Float vertexScore(const Int cachePosition, const UnsignedInt liveTriangleCount) const {
+        /* Vertices with no live triangles are never used again */
+        if(!liveTriangleCount) return -1.0f;
+        return (cachePosition < 0 ? 0.0f : cache[cachePosition]) +
+            valence[Math::min(liveTriangleCount, UnsignedInt(MaxValence))];
+    }
+
+    Float cache[VertexCacheSize];
+    Float valence[MaxValence + 1];
+};
+
+template<class T> void optimizeVertexCacheInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3", );
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::optimizeVertexCacheInPlace(): index" << index << "out of range for" << vertexCount << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    const VertexScoreTables tables;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count.
+       Emitted triangles get swapped to the end of each vertex neighbor list,
+       so the first liveTriangleCount[v] items are always the live ones. */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initial vertex and triangle scores, with nothing in the cache */
+    Containers::Array<Int> cachePosition{DirectInit, vertexCount, -1};
+    Containers::Array<Float> vertexScores{NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        vertexScores[i] = tables.vertexScore(-1, liveTriangleCount[i]);
+    Containers::Array<Float> triangleScores{NoInit, triangleCount};
+    std::size_t bestTriangle = 0;
+    Float bestScore = -1.0f;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        triangleScores[i] = vertexScores[indices[i*3 + 0]] +
+                            vertexScores[indices[i*3 + 1]] +
+                            vertexScores[indices[i*3 + 2]];
+        if(triangleScores[i] > bestScore) {
+            bestTriangle = i;
+            bestScore = triangleScores[i];
+        }
+    }
+
+    Containers::BitArray emitted{ValueInit, triangleCount};
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+
+    /* Simulated LRU cache, the new one has space for three extra vertices
+       that get pushed out after each emitted triangle */
+    UnsignedInt cache[VertexCacheSize];
+    UnsignedInt newCache[VertexCacheSize + 3];
+    std::size_t cacheCount = 0;
+
+    /* Cursor for picking the next triangle if none adjacent to the cache is
+       live anymore */
+    std::size_t cursor = 0;
+
+    for(std::size_t out = 0; out != triangleCount; ++out) {
+        if(bestScore < 0.0f) {
+            while(emitted[cursor]) ++cursor;
+            bestTriangle = cursor;
+        }
+
+        /* Emit the triangle and remove it from live neighbor lists of its
+           vertices */
+        emitted.set(bestTriangle);
+        const UnsignedInt triangle[3]{
+            UnsignedInt(indices[bestTriangle*3 + 0]),
+            UnsignedInt(indices[bestTriangle*3 + 1]),
+            UnsignedInt(indices[bestTriangle*3 + 2])
+        };
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = triangle[i];
+            outputIndices[out*3 + i] = T(v);
+
+            UnsignedInt* const vertexNeighbors = neighbors + neighborOffset[v];
+            const UnsignedInt last = --liveTriangleCount[v];
+            for(std::size_t j = 0; j != last; ++j) {
+                if(vertexNeighbors[j] != bestTriangle) continue;
+                std::swap(vertexNeighbors[j], vertexNeighbors[last]);
+                break;
+            }
+        }
+
+        /* Put the triangle vertices to the front of the cache, followed by
+           the previous cache contents without them */
+        std::size_t newCacheCount = 0;
+        for(const UnsignedInt v: triangle) {
+            if(std::find(newCache, newCache + newCacheCount, v) == newCache + newCacheCount)
+                newCache[newCacheCount++] = v;
+        }
+        for(std::size_t i = 0; i != cacheCount; ++i) {
+            const UnsignedInt v = cache[i];
+            if(v != triangle[0] && v != triangle[1] && v != triangle[2])
+                newCache[newCacheCount++] = v;
+        }
+
+        /* Update scores of all vertices that were touched, including the
+           ones that fell out of the cache, and propagate the difference to
+           their live triangles */
+        for(std::size_t i = 0; i != newCacheCount; ++i) {
+            const UnsignedInt v = newCache[i];
+            cachePosition[v] = i < VertexCacheSize ? Int(i) : -1;
+            const Float score = tables.vertexScore(cachePosition[v], liveTriangleCount[v]);
+            const Float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+            for(std::size_t j = 0; j != liveTriangleCount[v]; ++j)
+                triangleScores[neighbors[neighborOffset[v] + j]] += delta;
+        }
+
+        /* Pick the best live triangle among the ones that use the cached
+           vertices */
+        cacheCount = Math::min(newCacheCount, VertexCacheSize);
+        bestScore = -1.0f;
+        for(std::size_t i = 0; i != cacheCount; ++i) {
+            const UnsignedInt v = newCache[i];
+            cache[i] = v;
+            for(std::size_t j = 0; j != liveTriangleCount[v]; ++j) {
+                const UnsignedInt t = neighbors[neighborOffset[v] + j];
+                if(triangleScores[t] > bestScore) {
+                    bestTriangle = t;
+                    bestScore = triangleScores[t];
+                }
+            }
+        }
+    }
+
+    Utility::copy(outputIndices, indices);
+}
+
+/* Simulates a FIFO cache of given size for a single triangle, returns count of
+   cache misses. Similar to what tipsifyInPlace() does, the cache can be reset
+   by advancing time by cacheSize + 1. */
+UnsignedInt updateFifoCache(const UnsignedInt(&triangle)[3], const Containers::ArrayView<UnsignedInt> timestamps, UnsignedInt& time, const UnsignedInt cacheSize) {
+    UnsignedInt misses = 0;
+    for(const UnsignedInt v: triangle) {
+        if(time - timestamps[v] > cacheSize) {
+            timestamps[v] = time++;
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3", );
+    CORRADE_ASSERT(threshold >= 1.0f,
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1.0 but got" << threshold, );
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::optimizeOverdrawInPlace(): index" << index << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    constexpr UnsignedInt CacheSize = 16;
+    Containers::Array<UnsignedInt> timestamps{ValueInit, positions.size()};
+    UnsignedInt time = CacheSize + 1;
+    const auto triangleAt = [&indices](const std::size_t i, UnsignedInt(&out)[3]) {
+        out[0] = indices[i*3 + 0];
+        out[1] = indices[i*3 + 1];
+        out[2] = indices[i*3 + 2];
+    };
+
+    /* Hard boundaries, placed where the triangle misses all its vertices in
+       the cache -- starting a cluster there doesn't make the cache
+       efficiency any worse */
+    Containers::Array<UnsignedInt> hardClusters;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        UnsignedInt triangle[3];
+        triangleAt(i, triangle);
+        if(updateFifoCache(triangle, timestamps, time, CacheSize) == 3 || !i)
+            arrayAppend(hardClusters, UnsignedInt(i));
+    }
+    arrayAppend(hardClusters, UnsignedInt(triangleCount));
+
+    /* Soft boundaries. For each hard cluster calculate its ACMR, then split
+       it each time the ACMR of the running sub-cluster gets within the
+       threshold. */
+    Containers::Array<UnsignedInt> clusters;
+    for(std::size_t i = 0; i + 1 != hardClusters.size(); ++i) {
+        const UnsignedInt begin = hardClusters[i];
+        const UnsignedInt end = hardClusters[i + 1];
+
+        time += CacheSize + 1;
+        UnsignedInt clusterMisses = 0;
+        for(UnsignedInt j = begin; j != end; ++j) {
+            UnsignedInt triangle[3];
+            triangleAt(j, triangle);
+            clusterMisses += updateFifoCache(triangle, timestamps, time, CacheSize);
+        }
+        const Float clusterThreshold = threshold*Float(clusterMisses)/Float(end - begin);
+
+        time += CacheSize + 1;
+        arrayAppend(clusters, begin);
+        UnsignedInt runningMisses = 0;
+        UnsignedInt runningTriangleCount = 0;
+        for(UnsignedInt j = begin; j != end; ++j) {
+            UnsignedInt triangle[3];
+            triangleAt(j, triangle);
+            runningMisses += updateFifoCache(triangle, timestamps, time, CacheSize);
+            ++runningTriangleCount;
+            if(j + 1 != end && Float(runningMisses)/Float(runningTriangleCount) <= clusterThreshold) {
+                arrayAppend(clusters, j + 1);
+                time += CacheSize + 1;
+                runningMisses = 0;
+                runningTriangleCount = 0;
+            }
+        }
+
+        /* The leftover at the end didn't reach the target ACMR on its own,
+           merge it with the previous sub-cluster instead */
+        if(runningTriangleCount && clusters.back() != begin)
+            arrayRemoveSuffix(clusters);
+    }
+    arrayAppend(clusters, UnsignedInt(triangleCount));
+
+    /* Mesh centroid, used as a reference point for the occlusion potential */
+    Vector3 meshCentroid;
+    for(const Vector3& position: positions)
+        meshCentroid += position;
+    meshCentroid /= Float(positions.size());
+
+    /* Occlusion potential of each cluster -- clusters that face away from
+       the mesh center are more likely to occlude the rest */
+    const std::size_t clusterCount = clusters.size() - 1;
+    Containers::Array<Float> sortKeys{NoInit, clusterCount};
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        Vector3 centroid, normal, average;
+        Float area = 0.0f;
+        for(UnsignedInt j = clusters[i]; j != clusters[i + 1]; ++j) {
+            UnsignedInt triangle[3];
+            triangleAt(j, triangle);
+            const Vector3 a = positions[triangle[0]];
+            const Vector3 b = positions[triangle[1]];
+            const Vector3 c = positions[triangle[2]];
+            const Vector3 triangleNormal = Math::cross(b - a, c - a);
+            const Float triangleArea = triangleNormal.length();
+            centroid += (a + b + c)*triangleArea;
+            average += a + b + c;
+            normal += triangleNormal;
+            area += triangleArea;
+        }
+
+        /* If the cluster has zero area, fall back to a plain average. The
+           normal is zero in that case so the actual value doesn't really
+           matter. */
+        if(area > 0.0f)
+            centroid /= 3.0f*area;
+        else
+            centroid = average/Float(3*(clusters[i + 1] - clusters[i]));
+
+        const Float normalLength = normal.length();
+        sortKeys[i] = normalLength > 0.0f ?
+            Math::dot(centroid - meshCentroid, normal/normalLength) : 0.0f;
+    }
+
+    /* Sort the clusters by the potential, keeping the original order for
+       equal keys to not disturb the cache efficiency needlessly */
+    Containers::Array<UnsignedInt> clusterOrder{NoInit, clusterCount};
+    for(std::size_t i = 0; i != clusterCount; ++i)
+        clusterOrder[i] = i;
+    std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&sortKeys](const UnsignedInt a, const UnsignedInt b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    std::size_t outputIndex = 0;
+    for(const UnsignedInt cluster: clusterOrder)
+        for(std::size_t i = clusters[cluster]*3; i != clusters[cluster + 1]*3; ++i)
+            outputIndices[outputIndex++] = indices[i];
+    CORRADE_INTERNAL_ASSERT(outputIndex == indices.size());
+
+    Utility::copy(outputIndices, indices);
+}
+
+template<class T> std::size_t optimizeVertexFetchInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView2D<char>& data) {
+    CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
+        "MeshTools::optimizeVertexFetchInPlace(): second data view dimension is not contiguous", {});
+    const std::size_t vertexCount = data.size()[0];
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::optimizeVertexFetchInPlace(): index" << index << "out of range for" << vertexCount << "elements", {});
+    #endif
+
+    /* Assign new vertex IDs in order of first use, ~0 marks vertices not
+       referenced yet */
+    Containers::Array<UnsignedInt> remapping{DirectInit, vertexCount, ~UnsignedInt{}};
+    UnsignedInt count = 0;
+    for(T& index: indices) {
+        UnsignedInt& newIndex = remapping[index];
+        if(newIndex == ~UnsignedInt{}) newIndex = count++;
+        index = T(newIndex);
+    }
+
+    /* Scatter the referenced vertices to a temporary array and copy them back
+       to the prefix of the original data */
+    const std::size_t size = data.size()[1];
+    Containers::Array<char> reordered{NoInit, count*size};
+    for(std::size_t i = 0; i != vertexCount; ++i) {
+        if(remapping[i] == ~UnsignedInt{}) continue;
+        std::memcpy(reordered + remapping[i]*size, data[i].data(), size);
+    }
+    Utility::copy(Containers::StridedArrayView2D<const char>{reordered, {count, size}}, data.prefix(count));
+
+    return count;
+}
+
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, threshold);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data);
+    }
+}
+
+Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(mesh.attributeCount(),
+        "MeshTools::optimizeVertexFetch(): can't optimize an attributeless mesh",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeVertexFetch(): mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::optimizeVertexFetch(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    }
+    #endif
+
+    /* Turn the passed data into an interleaved owned mutable instance we can
+       operate on, tightly packed so the attribute rerouting below doesn't
+       need to take any padding into account */
+    Trade::MeshData ownedInterleaved = copy(interleave(mesh, {}, InterleaveFlags{}));
+
+    const Containers::StridedArrayView2D<char> vertexData = interleavedMutableData(ownedInterleaved);
+    CORRADE_INTERNAL_ASSERT(vertexData.size()[1] == std::size_t(ownedInterleaved.attributeStride(0)));
+
+    const UnsignedInt vertexCount = optimizeVertexFetchInPlace(ownedInterleaved.mutableIndices(), vertexData);
+
+    /* Allocate a new, shorter vertex data and copy the prefix, same as in
+       removeDuplicates() */
+    Containers::Array<char> optimizedVertexData{NoInit, vertexCount*vertexData.size()[1]};
+    Utility::copy(vertexData.prefix(vertexCount),
+        Containers::StridedArrayView2D<char>{optimizedVertexData, {vertexCount, vertexData.size()[1]}});
+
+    /* Route all attributes to the new vertex data */
+    Containers::Array<Trade::MeshAttributeData> attributeData{ownedInterleaved.attributeCount()};
+    for(UnsignedInt i = 0; i != ownedInterleaved.attributeCount(); ++i)
+        attributeData[i] = Implementation::remapAttributeData(ownedInterleaved.attributeData(i), vertexCount, ownedInterleaved.vertexData(), optimizedVertexData);
+
+    Containers::Array<char> indexData = ownedInterleaved.releaseIndexData();
+    const Trade::MeshIndexData indices{ownedInterleaved.indexType(), indexData};
+    return Trade::MeshData{ownedInterleaved.primitive(),
+        Utility::move(indexData), indices,
+        Utility::move(optimizedVertexData), Utility::move(attributeData),
+        vertexCount};
+}
+
+}}
@@ -0,0 +1,186 @@
+#ifndef Magnum_MeshTools_Optimize_h
+#define Magnum_MeshTools_Optimize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCacheInPlace(), @ref Magnum::MeshTools::optimizeOverdrawInPlace(), @ref Magnum::MeshTools::optimizeVertexFetchInPlace(), @ref Magnum::MeshTools::optimizeVertexFetch()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize a triangle mesh for post-transform vertex cache in-place
+@param[in,out] indices  Triangle indices to operate on
+@param[in] vertexCount  Vertex count
+@m_since_latest
+
+Rearranges the triangles in the index array for better usage of the
+post-transform vertex cache. Compared to @ref tipsifyInPlace(), which is tuned
+for a FIFO cache of a particular size, this algorithm doesn't depend on exact
+cache size and generally produces a better result on modern GPUs at the cost
+of being slower. Algorithm used: *Tom Forsyth --- Linear-Speed Vertex Cache
+Optimisation, 2006, https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*,
+with a simulated LRU cache of 32 entries.
+
+Expects that the index count is divisible by 3 and all indices are less than
+@p vertexCount. The vertex data are not touched and the set of triangles
+stays the same, only their order changes. The typical post-transform
+optimization pipeline is calling this function first, then
+@ref optimizeOverdrawInPlace() and finally @ref optimizeVertexFetchInPlace(),
+which reorders the vertex data to match the new triangle order.
+@see @relativeref{Trade,MeshOptimizerSceneConverter}
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Optimize a triangle mesh for reduced overdraw in-place
+@param[in,out] indices  Triangle indices to operate on, ideally already
+    optimized with @ref optimizeVertexCacheInPlace() or
+    @ref tipsifyInPlace()
+@param[in] positions    Vertex positions
+@param[in] threshold    Allowed vertex cache efficiency degradation
+@m_since_latest
+
+Splits the triangle sequence into clusters and reorders them so clusters that
+are likely to occlude other parts of the mesh are drawn first, independently
+of the view direction. Algorithm used: *Pedro V. Sander, Diego Nehab, and
+Joshua Barczak --- Fast Triangle Reordering for Vertex Locality and Reduced
+Overdraw, SIGGRAPH 2007, https://gfx.cs.princeton.edu/pubs/Sander_2007_%3eTR/tipsy.pdf*.
+
+Cluster boundaries are first placed where the triangle order already has a
+full miss in a simulated FIFO cache of 16 entries, so the reordering doesn't
+make the vertex cache efficiency any worse. These clusters are further split
+at places where the running average cache miss ratio is within @p threshold
+times the cluster average, allowing a @cpp threshold - 1.0f @ce relative
+degradation in exchange for finer-grained clusters --- the default
+@cpp 1.05f @ce allows a 5% degradation, @cpp 1.0f @ce splits only where the
+running average is not worse than the cluster average. The clusters are then
+sorted by their occlusion potential, which is a dot product of the
+area-weighted cluster normal and the direction from mesh centroid to the
+cluster centroid.
+
+Expects that the index count is divisible by 3, all indices are in bounds of
+@p positions and @p threshold is at least @cpp 1.0f @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+@brief Optimize vertex data for vertex fetch in-place
+@param[in,out] indices  Index array to operate on
+@param[in,out] data     Vertex data to operate on
+@return Count of vertices referenced by @p indices
+@m_since_latest
+
+Reorders items in @p data to the order in which they're first referenced by
+@p indices and updates @p indices to match, improving memory locality of the
+vertex fetch. Vertices that aren't referenced by any index are dropped, with
+the referenced vertices moved to a prefix of @p data of the size returned by
+this function. The primitive type doesn't matter for this operation, so it
+can be used on any indexed mesh. This function should be called after
+@ref optimizeVertexCacheInPlace() and @ref optimizeOverdrawInPlace(), as it
+depends on the final triangle order.
+
+Expects that all indices are less than size of @p data and that the second
+dimension of @p data is contiguous. Compared to
+@ref removeDuplicatesIndexedInPlace() the data are not compared, which means
+there's just one allocation of the index remapping table and one of a
+temporary copy of @p data. If you have a @ref Trade::MeshData, use
+@ref optimizeVertexFetch(const Trade::MeshData&) instead.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Optimize vertex data for vertex fetch in-place with a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Optimize mesh data for vertex fetch
+@m_since_latest
+
+Expects that the mesh is indexed and has at least one attribute. The mesh is
+first converted to a tightly packed interleaved layout using @ref interleave(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>, InterleaveFlags),
+then all attributes are reordered together using
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView2D<char>&).
+The index type is preserved and the vertex count of the returned mesh is the
+count of vertices actually referenced by the index buffer. Expects that the
+index type and all attribute formats are not implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh);
+
+}}
+
+#endif
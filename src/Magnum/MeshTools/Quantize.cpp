@@ -0,0 +1,222 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/MeshTools/Filter.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Returns the format given attribute gets quantized to, or the original format
+   if it's passed through */
+VertexFormat quantizedFormat(const Trade::MeshData& mesh, const UnsignedInt id, const QuantizeFlags flags, const bool quantizePositions) {
+    const VertexFormat format = mesh.attributeFormat(id);
+    if(mesh.attributeArraySize(id) || mesh.attributeMorphTargetId(id) != -1)
+        return format;
+
+    switch(mesh.attributeName(id)) {
+        case Trade::MeshAttribute::Position:
+            if(!quantizePositions)
+                break;
+            if(format == VertexFormat::Vector2)
+                return VertexFormat::Vector2usNormalized;
+            if(format == VertexFormat::Vector3)
+                return VertexFormat::Vector3usNormalized;
+            break;
+        case Trade::MeshAttribute::Normal:
+        case Trade::MeshAttribute::Tangent:
+        case Trade::MeshAttribute::Bitangent:
+            if(format == VertexFormat::Vector3)
+                return flags & QuantizeFlag::ByteNormals ? VertexFormat::Vector3bNormalized : VertexFormat::Vector3sNormalized;
+            /* Four-component tangents are checked when constructing the
+               MeshData already, so no need to check the name here */
+            if(format == VertexFormat::Vector4)
+                return flags & QuantizeFlag::ByteNormals ? VertexFormat::Vector4bNormalized : VertexFormat::Vector4sNormalized;
+            break;
+        case Trade::MeshAttribute::TextureCoordinates:
+            if(format == VertexFormat::Vector2) {
+                if(!(flags & QuantizeFlag::HalfTextureCoordinates)) {
+                    bool inUnitRange = true;
+                    for(const Vector2& i: mesh.attribute<Vector2>(id)) {
+                        /* Written this way to treat NaNs as out of range */
+                        if(!(i.min() >= 0.0f && i.max() <= 1.0f)) {
+                            inUnitRange = false;
+                            break;
+                        }
+                    }
+                    if(inUnitRange) return VertexFormat::Vector2usNormalized;
+                }
+                return VertexFormat::Vector2h;
+            }
+            break;
+        default:
+            break;
+    }
+
+    return format;
+}
+
+/* Packs the source floats into the destination and unpacks them back to the
+   source for error calculation */
+void packUnpack(const Containers::StridedArrayView2D<Float>& values, const VertexFormat format, const Containers::StridedArrayView2D<char>& destination) {
+    const VertexFormat componentFormat = vertexFormatComponentFormat(format);
+    if(componentFormat == VertexFormat::UnsignedShort) {
+        const Containers::StridedArrayView2D<UnsignedShort> destinationTyped = Containers::arrayCast<2, UnsignedShort>(destination);
+        Math::packInto(values, destinationTyped);
+        Math::unpackInto(destinationTyped, values);
+    } else if(componentFormat == VertexFormat::Short) {
+        const Containers::StridedArrayView2D<Short> destinationTyped = Containers::arrayCast<2, Short>(destination);
+        Math::packInto(values, destinationTyped);
+        Math::unpackInto(destinationTyped, values);
+    } else if(componentFormat == VertexFormat::Byte) {
+        const Containers::StridedArrayView2D<Byte> destinationTyped = Containers::arrayCast<2, Byte>(destination);
+        Math::packInto(values, destinationTyped);
+        Math::unpackInto(destinationTyped, values);
+    } else if(componentFormat == VertexFormat::Half) {
+        const Containers::StridedArrayView2D<UnsignedShort> destinationTyped = Containers::arrayCast<2, UnsignedShort>(destination);
+        Math::packHalfInto(values, destinationTyped);
+        Math::unpackHalfInto(destinationTyped, values);
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> quantize(const Trade::MeshData& mesh, const QuantizeFlags flags) {
+    /* Morph target positions are passed through, and the dequantization
+       transformation would apply to them as well, so if there are any, the
+       base positions have to be passed through too */
+    bool quantizePositions = true;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        if(mesh.attributeName(i) == Trade::MeshAttribute::Position &&
+           mesh.attributeMorphTargetId(i) != -1) {
+            quantizePositions = false;
+            break;
+        }
+    }
+
+    /* Decide on the output formats, gather a common bounding box for all
+       quantized position attributes */
+    Containers::Array<VertexFormat> formats{NoInit, mesh.attributeCount()};
+    Vector3 min{Constants::inf()};
+    Vector3 max{-Constants::inf()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        formats[i] = quantizedFormat(mesh, i, flags, quantizePositions);
+        if(formats[i] == mesh.attributeFormat(i) ||
+           mesh.attributeName(i) != Trade::MeshAttribute::Position)
+            continue;
+
+        const Containers::StridedArrayView2D<const Float> positions = Containers::arrayCast<2, const Float>(mesh.attribute(i));
+        for(std::size_t j = 0; j != positions.size()[0]; ++j) {
+            for(std::size_t k = 0; k != positions.size()[1]; ++k) {
+                min[k] = Math::min(min[k], positions[j][k]);
+                max[k] = Math::max(max[k], positions[j][k]);
+            }
+        }
+    }
+
+    /* Components that aren't present in any position attribute, such as Z
+       for 2D positions, or all of them if there are no vertices or no
+       quantized positions at all, are left untransformed */
+    Float scale = 0.0f;
+    for(std::size_t k = 0; k != 3; ++k) {
+        if(min[k] > max[k]) min[k] = max[k] = 0.0f;
+        scale = Math::max(scale, max[k] - min[k]);
+    }
+    if(scale == 0.0f) scale = 1.0f;
+
+    /* Layout of the output, padding each attribute to four bytes. Not using
+       Utility::copy() here as the view returned by attributeData() might have
+       offset-only attributes which interleave() doesn't want. */
+    Containers::Array<Trade::MeshAttributeData> attributes;
+    arrayReserve(attributes, mesh.attributeCount()*2);
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        if(formats[i] == mesh.attributeFormat(i))
+            arrayAppend(attributes, mesh.attributeData(i));
+        else
+            arrayAppend(attributes, Trade::MeshAttributeData{mesh.attributeName(i), formats[i], nullptr});
+
+        const UnsignedInt size = isVertexFormatImplementationSpecific(formats[i]) ? 0 :
+            vertexFormatSize(formats[i])*Math::max(mesh.attributeArraySize(i), UnsignedShort{1});
+        if(size % 4)
+            arrayAppend(attributes, Trade::MeshAttributeData{Int(4 - size % 4)});
+    }
+
+    /* Create the output mesh with empty placeholders for the quantized
+       attributes */
+    /** @todo isn't there some less silly way to take just the indices from the
+        mesh?! */
+    Trade::MeshData out = interleave(filterOnlyAttributes(mesh, Containers::ArrayView<const Trade::MeshAttribute>{}), attributes, InterleaveFlags{});
+
+    Containers::Array<Float> errors{ValueInit, mesh.attributeCount()};
+    Containers::Array<Float> values;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        if(formats[i] == mesh.attributeFormat(i)) continue;
+
+        const Containers::StridedArrayView2D<const Float> src = Containers::arrayCast<2, const Float>(mesh.attribute(i));
+        arrayResize(values, NoInit, src.size()[0]*src.size()[1]);
+        const Containers::StridedArrayView2D<Float> valuesView{values, src.size()};
+
+        /* Positions are normalized to the bounding box first */
+        const bool isPosition = mesh.attributeName(i) == Trade::MeshAttribute::Position;
+        for(std::size_t j = 0; j != src.size()[0]; ++j)
+            for(std::size_t k = 0; k != src.size()[1]; ++k)
+                valuesView[j][k] = isPosition ? (src[j][k] - min[k])/scale : src[j][k];
+
+        packUnpack(valuesView, formats[i], out.mutableAttribute(i));
+
+        /* Calculate the max distance of the dequantized value from the
+           original */
+        Float maxErrorSquared = 0.0f;
+        for(std::size_t j = 0; j != src.size()[0]; ++j) {
+            Float errorSquared = 0.0f;
+            for(std::size_t k = 0; k != src.size()[1]; ++k) {
+                const Float value = isPosition ? valuesView[j][k]*scale + min[k] : valuesView[j][k];
+                errorSquared += (value - src[j][k])*(value - src[j][k]);
+            }
+            maxErrorSquared = Math::max(maxErrorSquared, errorSquared);
+        }
+        errors[i] = Math::sqrt(maxErrorSquared);
+    }
+
+    return {Utility::move(out),
+        Matrix4::translation(min)*Matrix4::scaling(Vector3{scale}),
+        Utility::move(errors)};
+}
+
+}}
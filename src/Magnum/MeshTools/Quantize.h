@@ -0,0 +1,129 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantize(), enum @ref Magnum::MeshTools::QuantizeFlag, enum set @ref Magnum::MeshTools::QuantizeFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Mesh quantization flag
+@m_since_latest
+
+@see @ref QuantizeFlags, @ref quantize()
+*/
+enum class QuantizeFlag: UnsignedByte {
+    /**
+     * Quantize normals, tangents and bitangents to 8-bit normalized values
+     * instead of 16-bit. Halves their size at the cost of precision, which
+     * is usually still sufficient for lighting.
+     */
+    ByteNormals = 1 << 0,
+
+    /**
+     * Quantize texture coordinates to half-floats even if they're all in the
+     * @f$ [0, 1] @f$ range.
+     */
+    HalfTextureCoordinates = 1 << 1
+};
+
+/**
+@brief Mesh quantization flags
+@m_since_latest
+
+@see @ref quantize()
+*/
+typedef Containers::EnumSet<QuantizeFlag> QuantizeFlags;
+
+CORRADE_ENUMSET_OPERATORS(QuantizeFlags)
+
+/**
+@brief Quantize mesh vertex attributes
+@m_since_latest
+
+Returns a copy of @p mesh with floating-point vertex attributes converted to
+smaller packed formats using @ref Math::packInto() and
+@ref Math::packHalfInto(), a dequantization transformation and the maximum
+quantization error of each attribute:
+
+-   @ref Trade::MeshAttribute::Position in @ref VertexFormat::Vector2 or
+    @ref VertexFormat::Vector3 is converted to
+    @ref VertexFormat::Vector2usNormalized or
+    @ref VertexFormat::Vector3usNormalized. The positions are made relative
+    to their bounding box and scaled uniformly so the largest dimension spans
+    the whole @f$ [0, 1] @f$ range. The second returned value is a
+    transformation that converts them back to the original space, and it can
+    be applied as a part of the object transformation. Because the scale is
+    uniform, it doesn't affect normals. For 2D positions the Z component is
+    unused. If the mesh contains morph target positions, which are passed
+    through, all positions are passed through as well and the returned
+    transformation is an identity, as it would otherwise apply to the morph
+    targets too.
+-   @ref Trade::MeshAttribute::Normal, @ref Trade::MeshAttribute::Tangent and
+    @ref Trade::MeshAttribute::Bitangent in @ref VertexFormat::Vector3 or
+    @ref VertexFormat::Vector4 are converted to
+    @ref VertexFormat::Vector3sNormalized or
+    @ref VertexFormat::Vector4sNormalized, or to
+    @ref VertexFormat::Vector3bNormalized or
+    @ref VertexFormat::Vector4bNormalized if
+    @ref QuantizeFlag::ByteNormals is set.
+-   @ref Trade::MeshAttribute::TextureCoordinates in
+    @ref VertexFormat::Vector2 are converted to
+    @ref VertexFormat::Vector2usNormalized if all of them are in the
+    @f$ [0, 1] @f$ range and @ref QuantizeFlag::HalfTextureCoordinates isn't
+    set, and to @ref VertexFormat::Vector2h otherwise.
+
+All other attributes, as well as array attributes and morph target
+attributes, are passed through unchanged. The attributes are interleaved in
+the original order and each attribute is padded to a multiple of four bytes to
+keep them aligned. The index data are copied as well.
+
+The third returned value contains the maximum distance between an original and
+a dequantized value for each attribute in the returned mesh, or
+@cpp 0.0f @ce for attributes that were passed through. For positions the
+distance is in the original space, i.e. with the dequantization transformation
+applied.
+
+For a typical mesh with 32-bit positions, normals, four-component tangents and
+texture coordinates the vertex size goes from 48 to 28 bytes, or to 20 bytes
+with @ref QuantizeFlag::ByteNormals.
+@see @ref isVertexFormatNormalized(), @ref interleave()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> quantize(const Trade::MeshData& mesh, QuantizeFlags flags = {});
+
+}}
+
+#endif
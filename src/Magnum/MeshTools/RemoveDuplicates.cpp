@@ -28,7 +28,6 @@
 
 #include <cstring>
 #include <limits>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
@@ -40,32 +39,158 @@
 #include "Magnum/MeshTools/Copy.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Implementation/parallelFor.h"
 #include "Magnum/MeshTools/Implementation/remapAttributeData.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace MeshTools {
 
-struct ArrayEqual {
-    explicit ArrayEqual(std::size_t size): _size{size} {}
+namespace {
 
-    bool operator()(const void* a, const void* b) const {
-        return std::memcmp(a, b, _size) == 0;
-    }
+inline std::size_t hashKey(const char* const key, const std::size_t size) {
+    return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(key, size).byteArray());
+}
 
-    private: std::size_t _size;
-};
+/* Open-addressing hash table with linear probing, mapping keys to indices of
+   their first occurrence. Compared to a std::unordered_map it does just a
+   single allocation sized upfront for the max possible count of unique keys.
+   The keys themselves aren't stored in the table, each slot contains only an
+   index of the key in an external key array and the low 32 bits of its hash,
+   which filters out most mismatches without having to touch the key data. */
+class DuplicateTable {
+    public:
+        /* The table is never more than 3/4 full, which means there's always
+           an empty slot to terminate the probing */
+        explicit DuplicateTable(const std::size_t maxSize, const char* const keys, const std::ptrdiff_t keyStride, const std::size_t keySize): _keys{keys}, _keyStride{keyStride}, _keySize{keySize}, _size{} {
+            std::size_t capacity = 8;
+            while(capacity - capacity/4 < maxSize) capacity *= 2;
+            _slots = Containers::Array<Slot>{NoInit, capacity};
+            _mask = capacity - 1;
+            clear();
+        }
 
-struct ArrayHash {
-    explicit ArrayHash(std::size_t size): _size{size} {}
+        std::size_t size() const { return _size; }
 
-    std::size_t operator()(const void* a) const {
-        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
-    }
+        void clear() {
+            for(Slot& slot: _slots) slot.index = ~UnsignedInt{};
+            _size = 0;
+        }
+
+        const char* key(const UnsignedInt index) const {
+            return _keys + std::ptrdiff_t(index)*_keyStride;
+        }
+
+        /* If a key equal to the one at `index` is already present, returns
+           index of that key. Otherwise inserts `index` and returns it. */
+        UnsignedInt insert(const std::size_t hash, const UnsignedInt index) {
+            const char* const key = this->key(index);
+            for(std::size_t i = hash & _mask; ; i = (i + 1) & _mask) {
+                Slot& slot = _slots[i];
+                if(slot.index == ~UnsignedInt{}) {
+                    slot.hash = UnsignedInt(hash);
+                    slot.index = index;
+                    ++_size;
+                    return index;
+                }
+
+                if(slot.hash == UnsignedInt(hash) && std::memcmp(this->key(slot.index), key, _keySize) == 0)
+                    return slot.index;
+            }
+        }
 
-    private: std::size_t _size;
+    private:
+        struct Slot {
+            UnsignedInt hash;
+            UnsignedInt index;
+        };
+
+        Containers::Array<Slot> _slots;
+        const char* _keys;
+        std::ptrdiff_t _keyStride;
+        std::size_t _keySize;
+        std::size_t _mask;
+        std::size_t _size;
 };
 
+/* Fills indices with the index of first occurrence of each item, returns the
+   unique item count. Used by both removeDuplicatesInto() and, followed by a
+   compaction step, removeDuplicatesInPlaceInto().
+
+   Because all duplicates of given item have the same hash, the items can be
+   partitioned based on the hash and each partition processed independently.
+   Then, as each partition is processed in the original order, the first
+   occurrence found in each partition is the same as with a serial pass,
+   making the output identical regardless of the thread count. The hashes are
+   calculated in parallel first, the partition is picked from their top bits
+   so it's independent of the table slot, which is picked from the bottom
+   bits. */
+std::size_t removeDuplicatesFirstOccurrencesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt threadCount) {
+    const std::size_t dataSize = data.size()[0];
+    const std::size_t keySize = data.size()[1];
+    const char* const keys = static_cast<const char*>(data.data());
+    const std::ptrdiff_t keyStride = data.stride()[0];
+
+    #ifdef MAGNUM_MESHTOOLS_THREADS
+    /* Spawning a thread for just a few items isn't worth it */
+    threadCount = Implementation::clampThreadCount(threadCount, dataSize/1024);
+    if(threadCount > 1) {
+        /* The partitioning is done with a multiply-shift to avoid a division
+           or requiring a power-of-two thread count */
+        const auto partition = [threadCount](const std::size_t hash) {
+            return UnsignedInt((((UnsignedLong(hash) >> (sizeof(std::size_t)*8 - 32)) & 0xffffffffull)*threadCount) >> 32);
+        };
+
+        /* Calculate hashes of all items and count how many items from each
+           chunk fall into each partition, to size the per-partition tables
+           exactly */
+        Containers::Array<std::size_t> hashes{NoInit, dataSize};
+        Containers::Array<std::size_t> partitionSizes{ValueInit, std::size_t(threadCount)*threadCount};
+        Implementation::parallelFor(threadCount, dataSize, [&](const UnsignedInt thread, const std::size_t begin, const std::size_t end) {
+            const Containers::ArrayView<std::size_t> sizes = partitionSizes.sliceSize(std::size_t(thread)*threadCount, threadCount);
+            for(std::size_t i = begin; i != end; ++i) {
+                hashes[i] = hashKey(keys + std::ptrdiff_t(i)*keyStride, keySize);
+                ++sizes[partition(hashes[i])];
+            }
+        });
+
+        /* Each thread then goes through all hashes, processing just items in
+           its own partition. With as many items as threads, each thread gets
+           exactly one. */
+        Containers::Array<std::size_t> uniqueCounts{ValueInit, threadCount};
+        Implementation::parallelFor(threadCount, threadCount, [&](const UnsignedInt thread, std::size_t, std::size_t) {
+            std::size_t size = 0;
+            for(UnsignedInt i = 0; i != threadCount; ++i)
+                size += partitionSizes[std::size_t(i)*threadCount + thread];
+
+            DuplicateTable table{size, keys, keyStride, keySize};
+            for(std::size_t i = 0; i != dataSize; ++i)
+                if(partition(hashes[i]) == thread)
+                    indices[i] = table.insert(hashes[i], UnsignedInt(i));
+            uniqueCounts[thread] = table.size();
+        });
+
+        std::size_t count = 0;
+        for(const std::size_t uniqueCount: uniqueCounts)
+            count += uniqueCount;
+        return count;
+    }
+    #else
+    static_cast<void>(threadCount);
+    #endif
+
+    DuplicateTable table{dataSize, keys, keyStride, keySize};
+    for(std::size_t i = 0; i != dataSize; ++i)
+        indices[i] = table.insert(hashKey(table.key(UnsignedInt(i)), keySize), UnsignedInt(i));
+    return table.size();
+}
+
+}
+
 std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    return removeDuplicatesInto(data, indices, 1);
+}
+
+std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt threadCount) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
     CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
@@ -75,28 +200,9 @@ std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
-
-    /* Go through all entries */
-    for(std::size_t i = 0; i != dataSize; ++i) {
-        /* Try to insert new entry into the table. The inserted index points
-           into the original unchanged data array. */
-        const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
-
-        /* Put the (either new or already existing) index into the output
-           index array */
-        indices[i] = result.first->second;
-    }
-
-    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
-    return table.size();
+    const std::size_t size = removeDuplicatesFirstOccurrencesInto(data, indices, threadCount);
+    CORRADE_INTERNAL_ASSERT(dataSize >= size);
+    return size;
 }
 
 Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data) {
@@ -106,6 +212,10 @@ Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(c
 }
 
 std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    return removeDuplicatesInPlaceInto(data, indices, 1);
+}
+
+std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt threadCount) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
     CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
@@ -115,19 +225,36 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
-
-    /* Go through all entries and insert them into the table. Because the keys
-       have runtime size, the table doesn't store a copy of the keys, only a
-       reference. The reference is to the original data that we mutate
-       in-place, so extra care needs to be taken to prevent already-inserted
-       keys from getting modified. */
+    const std::size_t keySize = data.size()[1];
+
+    /* With more than one thread, find first occurrences of all items with the
+       data unchanged, and then compact the data and turn the first occurrence
+       indices into indices to the unique prefix in a serial pass. Because a
+       first occurrence is always earlier than or at the item itself, its
+       index was already updated when it's looked up. */
+    if(threadCount != 1) {
+        removeDuplicatesFirstOccurrencesInto(data, indices, threadCount);
+
+        std::size_t size = 0;
+        for(std::size_t i = 0; i != dataSize; ++i) {
+            if(indices[i] == i) {
+                if(i != size)
+                    Utility::copy(data[i].asContiguous(), data[size].asContiguous());
+                indices[i] = UnsignedInt(size++);
+            } else indices[i] = indices[indices[i]];
+        }
+
+        CORRADE_INTERNAL_ASSERT(dataSize >= size);
+        return size;
+    }
+
+    /* Table containing index of first occurrence for each unique entry. The
+       table doesn't store a copy of the keys, only an index into the data
+       that we mutate in-place, so extra care needs to be taken to prevent
+       already-inserted keys from getting modified. */
+    DuplicateTable table{dataSize, static_cast<const char*>(data.data()), data.stride()[0], keySize};
+
+    /* Go through all entries and insert them into the table */
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* First copy the key data to a potentially final no-longer-mutable
            place (except if the source and target location is the same). Data
@@ -137,20 +264,18 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
            it fails the location isn't used as a key anywhere and so it can be
            reused next time for a different key.
 
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
+           Alternatively we could first do a lookup and only then conditionally
+           do a copy() and insert, but that means the hash & search would be
            performed twice, which is never faster than a plain memory copy. */
-        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
-        if(i != table.size())
+        const std::size_t size = table.size();
+        const Containers::ArrayView<char> dst = data[size].asContiguous();
+        if(i != size)
             Utility::copy(data[i].asContiguous(), dst);
 
         /* Insert the new entry into the table. If it succeeds, dst is
-           guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
-
-        /* Put the (either new or already existing) index into the output index
-           array */
-        indices[i] = result.first->second;
+           guaranteed to not change anymore. Put the (either new or already
+           existing) index into the output index array. */
+        indices[i] = table.insert(hashKey(dst.data(), keySize), UnsignedInt(size));
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
@@ -240,20 +365,17 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
        bounds. */
     epsilon = Math::max(epsilon, range/T(~std::size_t{}));
 
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::size_t dataSize = data.size()[0];
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]*sizeof(std::size_t)},
-        ArrayEqual{data.size()[1]*sizeof(std::size_t)}};
-
     /* Index array that'll be filled in each pass and then used for remapping
-       the `indices`; discretized storage for all map keys. */
+       the `indices`; discretized storage for all table keys. */
+    std::size_t dataSize = data.size()[0];
     Containers::Array<UnsignedInt> remapping{NoInit, dataSize};
     Containers::Array<std::size_t> discretized{NoInit, dataSize*vectorSize};
 
+    /* Table containing unique vector index for each discretized vector. Sized
+       for the case of each vector being unique. */
+    const std::size_t keySize = vectorSize*sizeof(std::size_t);
+    DuplicateTable table{dataSize, reinterpret_cast<const char*>(discretized.data()), std::ptrdiff_t(keySize), keySize};
+
     /* First go with original coordinates, then move them by epsilon/2 in each
        dimension. */
     T moveAmount = T(0.0);
@@ -261,9 +383,12 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
         for(std::size_t i = 0; i != dataSize; ++i) {
             /* Take the original vector and discretize it -- append the move
                amount to given dimension, subtract the minmal offset and divide
-               by epsilon. */
+               by epsilon. The discretized vector is put right after the keys
+               already present in the table, if it's inserted it will stay
+               there, otherwise it gets overwritten by the next vector. */
+            const std::size_t size = table.size();
             const Containers::StridedArrayView1D<T> entry = data[i];
-            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(i*vectorSize, (i + 1)*vectorSize);
+            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.sliceSize(size*vectorSize, vectorSize);
             for(std::size_t vi = 0; vi != vectorSize; ++vi) {
                 T c = entry[vi];
                 /* In iteration `0` we're not moving in any dimension, in
@@ -277,18 +402,16 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
                points into the new data array that has all duplicates removed.
                This is a similar workflow to removeDuplicatesInPlaceInto() with
                the only difference that we're remapping an existing index array
-               several times over instead of creating a new one */
-            const auto result = table.emplace(discretizedEntry, table.size());
-
-            /* Add the (either new or already existing) index into the array */
-            remapping[i] = result.first->second;
+               several times over instead of creating a new one. Add the
+               (either new or already existing) index into the array. */
+            remapping[i] = table.insert(hashKey(reinterpret_cast<const char*>(discretizedEntry.data()), keySize), UnsignedInt(size));
 
             /* If this is a new combination, copy the data to new (earlier)
-               position in the array. Data in [table.size()-1, i) are already
-               present in the [0, table.size()-1) range from previous
-               iterations so we aren't overwriting anything. */
-            if(result.second && i != table.size() - 1)
-                Utility::copy(entry, data[table.size() - 1]);
+               position in the array. Data in [size, i) are already present in
+               the [0, size) range from previous iterations so we aren't
+               overwriting anything. */
+            if(table.size() != size && i != size)
+                Utility::copy(entry, data[size]);
         }
 
         /* Remap the resulting index array */
@@ -376,6 +499,179 @@ std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2
 
 namespace {
 
+template<class T> std::size_t removeDuplicatesFuzzyGridInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon) {
+    CORRADE_ASSERT(indices.size() == data.size()[0],
+        "MeshTools::removeDuplicatesFuzzyGridInPlaceInto(): output index array has" << indices.size() << "elements but expected" << data.size()[0], {});
+
+    const std::size_t dataSize = data.size()[0];
+    const std::size_t vectorSize = data.size()[1];
+
+    /* The grid is built from at most three components, for more the count of
+       neighbor cells to check would grow exponentially. Neighbors within
+       epsilon in all dimensions are within epsilon also in any three, so this
+       still finds them. Pick the three with the largest range, as items that
+       differ only in the remaining components end up in the same cell and
+       get compared with each other, which is quadratic in the worst case. It
+       happens for example for positions that are all the same and normals
+       that differ, so taking the first three would hit it easily. */
+    const std::size_t gridSize = Math::min(vectorSize, std::size_t{3});
+    std::size_t dimensions[3]{};
+    T offsets[3]{};
+    T ranges[3]{};
+    for(std::size_t i = 0; i != vectorSize; ++i) {
+        const Math::Range1D<T> minmax = Math::minmax(data.template transposed<0, 1>()[i]);
+        /* Keep the dimensions sorted by their range, insert this one if it
+           has a larger range than any of them. Ties keep the earlier
+           dimension, NaN ranges compare false and thus are never picked
+           over the existing ones. */
+        const T range = minmax.size();
+        std::size_t slot = Math::min(i, gridSize);
+        while(slot && range > ranges[slot - 1]) --slot;
+        if(slot == gridSize) continue;
+        for(std::size_t j = Math::min(i, gridSize - 1); j > slot; --j) {
+            dimensions[j] = dimensions[j - 1];
+            offsets[j] = offsets[j - 1];
+            ranges[j] = ranges[j - 1];
+        }
+        dimensions[slot] = i;
+        offsets[slot] = minmax.min();
+        ranges[slot] = range;
+    }
+
+    /* The cell size is at least epsilon but is made larger if needed so the
+       cell coordinates don't overflow. If it's zero, any cell size works, as
+       only bit-exact duplicates are merged in that case. */
+    T range = T(0.0);
+    for(std::size_t i = 0; i != gridSize; ++i)
+        range = Math::max(ranges[i], range);
+    T cellSize = Math::max(epsilon, range*T(1.0e-15));
+    if(!(cellSize > T(0.0)) || Math::isInf(cellSize)) cellSize = T(1.0);
+
+    /* Values outside of the bounds (i.e., infinities) or NaNs are clamped to
+       the border cells. That doesn't affect correctness, only the count of
+       items checked in those. */
+    const auto cellFor = [&](const Containers::StridedArrayView1D<const T>& item) {
+        Math::Vector3<Long> cell;
+        for(std::size_t i = 0; i != gridSize; ++i) {
+            const T position = (item[dimensions[i]] - offsets[i])/cellSize;
+            cell[i] = position >= T(1.0e15) ? Long(1.0e15) :
+                      position > T(0.0) ? Long(position) : 0;
+        }
+        return cell;
+    };
+    const auto cellHash = [](const Math::Vector3<Long>& cell) {
+        UnsignedLong hash = UnsignedLong(cell[0])*0x9e3779b97f4a7c15ull ^
+                            UnsignedLong(cell[1])*0xc2b2ae3d27d4eb4full ^
+                            UnsignedLong(cell[2])*0x165667b19e3779f9ull;
+        return hash ^ (hash >> 29);
+    };
+
+    /* Open-addressing hash table of non-empty cells, with each slot pointing
+       to the last unique item inserted into given cell. The cell coordinates
+       aren't stored, instead they're recalculated from the item when the
+       hashes match. The items in each cell form a singly-linked list through
+       the `next` array. There can't be more non-empty cells than unique
+       items, so the table is never more than 3/4 full. */
+    struct Slot {
+        UnsignedInt hash;
+        UnsignedInt head;
+    };
+    std::size_t capacity = 8;
+    while(capacity - capacity/4 < dataSize) capacity *= 2;
+    Containers::Array<Slot> slots{NoInit, capacity};
+    for(Slot& slot: slots) slot.head = ~UnsignedInt{};
+    Containers::Array<UnsignedInt> next{NoInit, dataSize};
+    const auto findCell = [&](const Math::Vector3<Long>& cell) -> Slot& {
+        const UnsignedLong hash = cellHash(cell);
+        for(std::size_t i = hash & (capacity - 1); ; i = (i + 1) & (capacity - 1)) {
+            Slot& slot = slots[i];
+            if(slot.head == ~UnsignedInt{} || (slot.hash == UnsignedInt(hash >> 32) && cellFor(data[slot.head]) == cell))
+                return slot;
+        }
+    };
+
+    /* Range of neighbor cell offsets in each dimension, the unused dimensions
+       stay at zero */
+    Math::Vector3<Long> neighborMin, neighborMax;
+    for(std::size_t i = 0; i != gridSize; ++i) {
+        neighborMin[i] = -1;
+        neighborMax[i] = 1;
+    }
+
+    const T epsilonSquared = epsilon*epsilon;
+    std::size_t size = 0;
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        const Containers::StridedArrayView1D<T> item = data[i];
+        const Math::Vector3<Long> cell = cellFor(item);
+
+        /* Find the earliest unique item within epsilon in all neighbor
+           cells */
+        UnsignedInt found = ~UnsignedInt{};
+        Math::Vector3<Long> neighbor;
+        for(neighbor.z() = neighborMin.z(); neighbor.z() <= neighborMax.z(); ++neighbor.z())
+        for(neighbor.y() = neighborMin.y(); neighbor.y() <= neighborMax.y(); ++neighbor.y())
+        for(neighbor.x() = neighborMin.x(); neighbor.x() <= neighborMax.x(); ++neighbor.x()) {
+            for(UnsignedInt unique = findCell(cell + neighbor).head; unique != ~UnsignedInt{}; unique = next[unique]) {
+                if(unique >= found) continue;
+
+                const Containers::StridedArrayView1D<const T> uniqueItem = data[unique];
+                T distanceSquared = T(0.0);
+                for(std::size_t j = 0; j != vectorSize; ++j) {
+                    const T difference = item[j] - uniqueItem[j];
+                    distanceSquared += difference*difference;
+                }
+                if(distanceSquared <= epsilonSquared) found = unique;
+            }
+        }
+
+        if(found != ~UnsignedInt{}) {
+            indices[i] = found;
+            continue;
+        }
+
+        /* Not found, this is a new unique item. Copy it to the end of the
+           unique prefix, data in [size, i) are already present in the
+           [0, size) range so we aren't overwriting anything, and add it to
+           the front of the list in its cell. */
+        if(i != size) Utility::copy(item, data[size]);
+        Slot& slot = findCell(cell);
+        if(slot.head == ~UnsignedInt{})
+            slot.hash = UnsignedInt(cellHash(cell) >> 32);
+        next[size] = slot.head;
+        slot.head = UnsignedInt(size);
+        indices[i] = UnsignedInt(size);
+        ++size;
+    }
+
+    return size;
+}
+
+template<class T> Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon) {
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()[0]};
+    const std::size_t size = removeDuplicatesFuzzyGridInPlaceIntoImplementation(data, indices, epsilon);
+    return {Utility::move(indices), size};
+}
+
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceImplementation(data, epsilon);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceImplementation(data, epsilon);
+}
+
+std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceIntoImplementation(data, indices, epsilon);
+}
+
+std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceIntoImplementation(data, indices, epsilon);
+}
+
+namespace {
+
 template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
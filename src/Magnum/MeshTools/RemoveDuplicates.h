@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::removeDuplicatesInPlace(), @ref Magnum::MeshTools::removeDuplicatesIndexedInPlace()
+ * @brief Function @ref Magnum::MeshTools::removeDuplicatesInPlace(), @ref Magnum::MeshTools::removeDuplicatesIndexedInPlace(), @ref Magnum::MeshTools::removeDuplicatesFuzzyGridInPlace()
  */
 
 #include "Magnum/Magnum.h"
@@ -106,6 +106,31 @@ size as @p data.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
 
+/**
+@brief Remove duplicate data from given array in-place into given output index array using multiple threads
+@param[in,out] data         Data array, duplicate items will be cut away with
+    order preserved
+@param[out]    indices      Where to put the resulting index array
+@param[in]     threadCount  Count of threads to use. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@return Size of unique prefix in the cleaned up @p data array
+@m_since_latest
+
+Like @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&),
+but with the data split into @p threadCount partitions based on a hash of each
+item, and each partition deduplicated on a separate thread. The unique items
+are then moved to the front of @p data in a single-threaded pass. The output is
+the same as with the single-threaded variant regardless of @p threadCount.
+Passing @cpp 1 @ce is equivalent to calling the single-threaded variant. The
+thread count is additionally limited so each thread processes at least 1024
+items on average. On Emscripten builds without threading enabled the data are
+always processed on a single thread.
+
+Compared to the single-threaded variant, an additional temporary array of
+one @ref std::size_t hash for each item is allocated.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt threadCount);
+
 /**
 @brief Remove duplicate data from given array
 @param[in] data     Data array
@@ -146,6 +171,23 @@ makes an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
 
+/**
+@brief Remove duplicate data from given array into given output index array using multiple threads
+@param[in]  data        Data array
+@param[out] indices     Where to put the resulting index array
+@param[in]  threadCount Count of threads to use. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@return Count of unique items in the original @p data array
+@m_since_latest
+
+Like @ref removeDuplicatesInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<UnsignedInt>&),
+but with the data split into @p threadCount partitions based on a hash of each
+item, and each partition deduplicated on a separate thread. See
+@ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt)
+for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt threadCount);
+
 /**
 @brief Remove duplicates from indexed data in-place
 @param[in,out] indices  Index array, which will get remapped to list just
@@ -267,6 +309,73 @@ MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Conta
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+@brief Remove duplicate data from given array using distance comparison on a spatial grid in-place
+@param[in,out] data Data array to process. Unique items get moved to the front,
+    preserving their relative order.
+@param[in] epsilon  Epsilon value, data with an Euclidean distance less than
+    or equal to this value will be deduplicated
+@return Resulting index array and size of the unique prefix in the processed
+    @p data array
+@m_since_latest
+
+Compared to @ref removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>&, Float),
+which collapses data into buckets of size @p epsilon and thus can miss near
+duplicates that happen to be on different sides of a bucket boundary, this
+function goes through the items in order and for each looks for an already
+found unique item in an @p epsilon-sized ball around it. If there are more, the
+one that's earliest in the array is used, otherwise the item becomes a new
+unique item. Items containing NaNs are never treated as duplicates.
+
+The lookup is done by putting the unique items into a hashed grid with cell
+size of at least @p epsilon, built from the three components with the largest
+range, and checking the cell containing the item together with all its
+neighbors. The remaining components, if any, are only used for the distance
+comparison. Apart from the returned index array, the only memory allocated is
+proportional to the count of unique items, no copy of the input is made.
+
+The items are compared only with unique items in the neighboring cells, which
+is linear in the item count for reasonably distributed data. In the worst case,
+when many unique items differ mainly in the components not used for the grid,
+they end up in the same few cells and the complexity degrades to
+@f$ \mathcal{O}(n^2) @f$.
+
+Note that the result depends on the item order --- for example, with an
+@p epsilon of @cpp 1.0f @ce, items @cpp {0.0f, 0.8f, 1.6f} @ce result in two
+unique items, as the third item is farther than @p epsilon from the first one,
+while @cpp {0.8f, 0.0f, 1.6f} @ce result in a single one.
+@see @ref removeDuplicatesFuzzyGridInPlaceInto(), @ref meshtools-duplicates
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+
+/**
+@brief Remove duplicate data from given array using distance comparison on a spatial grid in-place into given output index array
+@param[in,out] data Data array to process. Unique items get moved to the front,
+    preserving their relative order.
+@param[out] indices Where to put the resulting index array
+@param[in] epsilon  Epsilon value, data with an Euclidean distance less than
+    or equal to this value will be deduplicated
+@return Size of unique prefix in the cleaned up @p data array
+@m_since_latest
+
+Like @ref removeDuplicatesFuzzyGridInPlace(), except that the index array is
+not allocated but put into @p indices instead. Expects that @p indices has the
+same size as @p data.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon());
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Remove duplicate data from a STL vector using fuzzy comparison in-place
@@ -0,0 +1,616 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Implementation/remapAttributeData.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Sum of weighted squared distances to a set of planes, stored as the upper
+   triangle of a symmetric 4x4 matrix, together with the total weight */
+struct Quadric {
+    Float a00, a11, a22, a10, a20, a21;
+    Float b0, b1, b2;
+    Float c;
+    Float w;
+};
+
+Quadric planeQuadric(const Vector3& normal, const Float distance, const Float weight) {
+    Quadric q;
+    q.a00 = weight*normal.x()*normal.x();
+    q.a11 = weight*normal.y()*normal.y();
+    q.a22 = weight*normal.z()*normal.z();
+    q.a10 = weight*normal.y()*normal.x();
+    q.a20 = weight*normal.z()*normal.x();
+    q.a21 = weight*normal.z()*normal.y();
+    q.b0 = weight*normal.x()*distance;
+    q.b1 = weight*normal.y()*distance;
+    q.b2 = weight*normal.z()*distance;
+    q.c = weight*distance*distance;
+    q.w = weight;
+    return q;
+}
+
+void addQuadric(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00;
+    a.a11 += b.a11;
+    a.a22 += b.a22;
+    a.a10 += b.a10;
+    a.a20 += b.a20;
+    a.a21 += b.a21;
+    a.b0 += b.b0;
+    a.b1 += b.b1;
+    a.b2 += b.b2;
+    a.c += b.c;
+    a.w += b.w;
+}
+
+/* Weighted mean of squared distances of given point to the quadric planes */
+Float quadricError(const Quadric& q, const Vector3& p) {
+    if(q.w <= 0.0f) return 0.0f;
+    const Float rx = q.a00*p.x() + q.a10*p.y() + q.a20*p.z();
+    const Float ry = q.a10*p.x() + q.a11*p.y() + q.a21*p.z();
+    const Float rz = q.a20*p.x() + q.a21*p.y() + q.a22*p.z();
+    const Float error = rx*p.x() + ry*p.y() + rz*p.z() + 2.0f*(q.b0*p.x() + q.b1*p.y() + q.b2*p.z()) + q.c;
+    return Math::abs(error)/q.w;
+}
+
+/* Open edges are weighted more than triangle planes to keep the borders
+   from shrinking */
+constexpr Float BorderWeight = 2.0f;
+
+/* A collapse is rejected if the dot product of an adjacent triangle normal
+   before and after is not larger than this, i.e. if the triangle would rotate
+   by 90° or more, flipping it. The normals aren't normalized, so only zero
+   works as a threshold here, any other value would depend on triangle
+   size. */
+constexpr Float MinNormalDot = 0.0f;
+
+enum class VertexKind: UnsignedByte {
+    /* Has all edges shared by two triangles and no other vertex at the same
+       position, can be collapsed to any neighbor */
+    Manifold,
+    /* Lies on a single open border, can be collapsed only along it */
+    Border,
+    /* Lies on a single seam between two vertices at the same position, can
+       be collapsed only along it, together with its other side */
+    Seam,
+    /* Everything else, never moved */
+    Locked
+};
+
+/* Whether there's a triangle containing a half-edge from a to b */
+template<class T> bool hasHalfEdge(const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<const UnsignedInt> neighborOffset, const Containers::ArrayView<const UnsignedInt> neighbors, const UnsignedInt a, const UnsignedInt b) {
+    for(UnsignedInt i = neighborOffset[a], end = neighborOffset[a + 1]; i != end; ++i) {
+        const std::size_t triangle = neighbors[i]*3;
+        for(std::size_t j = 0; j != 3; ++j)
+            if(indices[triangle + j] == a && indices[triangle + (j + 1) % 3] == b)
+                return true;
+    }
+    return false;
+}
+
+/* For each vertex remembers the other end of an outgoing and an incoming
+   half-edge that doesn't have an opposite half-edge, and a count of such
+   half-edges. If the count is larger than 1, the remembered vertex is
+   arbitrary. */
+template<class T> void findOpenEdges(const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<const UnsignedInt> neighborOffset, const Containers::ArrayView<const UnsignedInt> neighbors, const Containers::ArrayView<UnsignedInt> openOut, const Containers::ArrayView<UnsignedInt> openIn, const Containers::ArrayView<UnsignedInt> openOutCount, const Containers::ArrayView<UnsignedInt> openInCount) {
+    for(UnsignedInt& i: openOut) i = ~UnsignedInt{};
+    for(UnsignedInt& i: openIn) i = ~UnsignedInt{};
+    for(UnsignedInt& i: openOutCount) i = 0;
+    for(UnsignedInt& i: openInCount) i = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt a = indices[i];
+        const UnsignedInt b = indices[i - i % 3 + (i + 1) % 3];
+        if(hasHalfEdge(indices, neighborOffset, neighbors, b, a)) continue;
+        openOut[a] = b;
+        ++openOutCount[a];
+        openIn[b] = a;
+        ++openInCount[b];
+    }
+}
+
+struct Collapse {
+    Float error;
+    UnsignedInt from;
+    UnsignedInt to;
+};
+
+template<class T> Containers::Pair<std::size_t, Float> simplifyInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::simplifyInPlace(): index" << index << "out of range for" << positions.size() << "vertices", {});
+    #endif
+
+    if(indices.size() <= targetIndexCount)
+        return {indices.size(), 0.0f};
+
+    const UnsignedInt vertexCount = positions.size();
+
+    /* Positions scaled to an unit cube so the error is relative to the mesh
+       size and is in a reasonable range for 32-bit floats */
+    const Range3D bounds = boundingRange(positions);
+    Float scale = bounds.size().max();
+    if(scale == 0.0f) scale = 1.0f;
+    Containers::Array<Vector3> scaledPositions{NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        scaledPositions[i] = (positions[i] - bounds.min())/scale;
+
+    /* Vertices at the same position, such as on texture coordinate or normal
+       seams, are welded together. Each vertex points to the first vertex at
+       the same position, and the vertices sharing a position form a circular
+       list. */
+    Containers::Array<UnsignedInt> weld{NoInit, vertexCount};
+    removeDuplicatesInto(Containers::arrayCast<2, const char>(positions), weld);
+    Containers::Array<UnsignedInt> nextInGroup{NoInit, vertexCount};
+    Containers::Array<UnsignedInt> groupSize{ValueInit, vertexCount};
+    for(UnsignedInt i = 0; i != vertexCount; ++i) {
+        const UnsignedInt first = weld[i];
+        ++groupSize[first];
+        if(first == i) {
+            nextInGroup[i] = i;
+        } else {
+            nextInGroup[i] = nextInGroup[first];
+            nextInGroup[first] = i;
+        }
+    }
+
+    const auto isDegenerate = [&](const UnsignedInt a, const UnsignedInt b, const UnsignedInt c) -> bool {
+        return weld[a] == weld[b] || weld[b] == weld[c] || weld[c] == weld[a];
+    };
+
+    /* Remove triangles that are degenerate to begin with, they'd only get in
+       the way */
+    std::size_t indexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const T a = indices[i + 0];
+        const T b = indices[i + 1];
+        const T c = indices[i + 2];
+        if(isDegenerate(a, b, c)) continue;
+        indices[indexCount++] = a;
+        indices[indexCount++] = b;
+        indices[indexCount++] = c;
+    }
+
+    Containers::Array<UnsignedInt> liveTriangleCount;
+    Containers::Array<UnsignedInt> neighborOffset;
+    Containers::Array<UnsignedInt> neighbors;
+    Containers::Array<UnsignedInt> openOut{NoInit, vertexCount};
+    Containers::Array<UnsignedInt> openIn{NoInit, vertexCount};
+    Containers::Array<UnsignedInt> openOutCount{NoInit, vertexCount};
+    Containers::Array<UnsignedInt> openInCount{NoInit, vertexCount};
+    Implementation::buildAdjacency<T>(indices.prefix(indexCount), vertexCount, liveTriangleCount, neighborOffset, neighbors);
+    findOpenEdges<T>(indices.prefix(indexCount), neighborOffset, neighbors, openOut, openIn, openOutCount, openInCount);
+
+    /* Classify the vertices. The kind is calculated just once on the input,
+       the open edges are then recalculated for every pass as the neighbors
+       change. */
+    Containers::Array<VertexKind> kinds{NoInit, vertexCount};
+    for(UnsignedInt i = 0; i != vertexCount; ++i) {
+        const UnsignedInt size = groupSize[weld[i]];
+        VertexKind kind = VertexKind::Locked;
+        if(size == 1 && !openOutCount[i] && !openInCount[i])
+            kind = VertexKind::Manifold;
+        else if(size == 1 && openOutCount[i] == 1 && openInCount[i] == 1) {
+            if(!(flags & SimplifyFlag::LockBorder))
+                kind = VertexKind::Border;
+        } else if(size == 2 && openOutCount[i] == 1 && openInCount[i] == 1) {
+            /* The other side of a seam goes in the opposite direction */
+            const UnsignedInt other = nextInGroup[i];
+            if(openOutCount[other] == 1 && openInCount[other] == 1 &&
+               weld[openIn[other]] == weld[openOut[i]] &&
+               weld[openOut[other]] == weld[openIn[i]])
+                kind = VertexKind::Seam;
+        }
+        kinds[i] = kind;
+    }
+
+    /* Quadrics for each welded vertex, made from planes of all adjacent
+       triangles weighted by their area, and planes perpendicular to open
+       edges to preserve the border and seam shape */
+    Containers::Array<Quadric> quadrics{ValueInit, vertexCount};
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        const Vector3 a = scaledPositions[indices[i + 0]];
+        const Vector3 b = scaledPositions[indices[i + 1]];
+        const Vector3 c = scaledPositions[indices[i + 2]];
+        Vector3 normal = Math::cross(b - a, c - a);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+        normal /= length;
+
+        const Quadric q = planeQuadric(normal, -Math::dot(normal, a), length*0.5f);
+        for(std::size_t j = 0; j != 3; ++j)
+            addQuadric(quadrics[weld[indices[i + j]]], q);
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt from = indices[i + j];
+            const UnsignedInt to = indices[i + (j + 1) % 3];
+            if(hasHalfEdge<T>(indices.prefix(indexCount), neighborOffset, neighbors, to, from))
+                continue;
+
+            const Vector3 edge = scaledPositions[to] - scaledPositions[from];
+            Vector3 edgeNormal = Math::cross(edge, normal);
+            const Float edgeNormalLength = edgeNormal.length();
+            if(edgeNormalLength == 0.0f) continue;
+            edgeNormal /= edgeNormalLength;
+
+            const Quadric edgeQ = planeQuadric(edgeNormal, -Math::dot(edgeNormal, scaledPositions[from]), edge.dot()*BorderWeight);
+            addQuadric(quadrics[weld[from]], edgeQ);
+            addQuadric(quadrics[weld[to]], edgeQ);
+        }
+    }
+
+    /* For a seam vertex collapsing to given target finds a vertex the other
+       side of the seam collapses to, ~0 if there's none */
+    const auto seamTarget = [&](const UnsignedInt from, const UnsignedInt to) -> UnsignedInt {
+        const UnsignedInt other = nextInGroup[from];
+        if(openOut[other] != ~UnsignedInt{} && weld[openOut[other]] == weld[to])
+            return openOut[other];
+        if(openIn[other] != ~UnsignedInt{} && weld[openIn[other]] == weld[to])
+            return openIn[other];
+        return ~UnsignedInt{};
+    };
+
+    const auto canCollapse = [&](const UnsignedInt from, const UnsignedInt to) -> bool {
+        switch(kinds[from]) {
+            case VertexKind::Manifold:
+                return true;
+            case VertexKind::Border:
+                return openOut[from] == to || openIn[from] == to;
+            case VertexKind::Seam:
+                return (openOut[from] == to || openIn[from] == to) &&
+                    seamTarget(from, to) != ~UnsignedInt{};
+            case VertexKind::Locked:
+                return false;
+        }
+        CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    };
+
+    /* Gathers offsets of all triangles adjacent to any vertex welded with
+       given one */
+    const auto gatherGroupTriangles = [&](const UnsignedInt vertex, Containers::Array<std::size_t>& out) {
+        arrayResize(out, NoInit, 0);
+        UnsignedInt i = vertex;
+        do {
+            for(UnsignedInt j = neighborOffset[i], end = neighborOffset[i + 1]; j != end; ++j)
+                arrayAppend(out, std::size_t(neighbors[j])*3);
+            i = nextInGroup[i];
+        } while(i != vertex);
+    };
+
+    Containers::Array<Collapse> collapses;
+    Containers::Array<UnsignedInt> collapseTarget{NoInit, vertexCount};
+    Containers::BitArray locked{NoInit, vertexCount};
+    Containers::Array<std::size_t> fromTriangles;
+    Containers::Array<std::size_t> toTriangles;
+    Containers::Array<UnsignedInt> fromNeighbors;
+    Containers::Array<UnsignedInt> toNeighbors;
+    const Float targetErrorSquared = targetError*targetError;
+    Float maxErrorSquared = 0.0f;
+    while(indexCount > targetIndexCount) {
+        const Containers::StridedArrayView1D<const T> live = indices.prefix(indexCount);
+        Implementation::buildAdjacency<T>(live, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+        findOpenEdges<T>(live, neighborOffset, neighbors, openOut, openIn, openOutCount, openInCount);
+
+        /* Pick the cheaper direction of each allowed edge collapse. Edges
+           shared by two triangles are considered twice, which is harmless as
+           the second occurence gets skipped below. */
+        arrayResize(collapses, NoInit, 0);
+        for(std::size_t i = 0; i != indexCount; ++i) {
+            const UnsignedInt a = live[i];
+            const UnsignedInt b = live[i - i % 3 + (i + 1) % 3];
+            Collapse collapse{Constants::inf(), 0, 0};
+            if(canCollapse(a, b))
+                collapse = Collapse{quadricError(quadrics[weld[a]], scaledPositions[b]), a, b};
+            if(canCollapse(b, a)) {
+                const Float error = quadricError(quadrics[weld[b]], scaledPositions[a]);
+                if(error < collapse.error)
+                    collapse = Collapse{error, b, a};
+            }
+            if(collapse.error != Constants::inf())
+                arrayAppend(collapses, collapse);
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            if(a.error != b.error) return a.error < b.error;
+            if(a.from != b.from) return a.from < b.from;
+            return a.to < b.to;
+        });
+
+        /* Each collapse removes usually two triangles. To avoid doing
+           expensive collapses while cheaper ones are blocked only by other
+           collapses in this pass, limit the error to a bit more than the
+           collapse that would reach the target if all succeeded. */
+        const std::size_t trianglesToRemove = (indexCount - targetIndexCount + 2)/3;
+        const std::size_t collapseGoal = (trianglesToRemove + 1)/2;
+        const Float errorLimit = Math::min(targetErrorSquared,
+            collapseGoal < collapses.size() ? collapses[collapseGoal].error*1.5f : Constants::inf());
+
+        for(UnsignedInt i = 0; i != vertexCount; ++i)
+            collapseTarget[i] = i;
+        locked.resetAll();
+
+        std::size_t removedTriangleCount = 0;
+        std::size_t collapseCount = 0;
+        for(const Collapse& collapse: collapses) {
+            if(collapse.error > errorLimit || removedTriangleCount >= trianglesToRemove)
+                break;
+
+            const UnsignedInt from = weld[collapse.from];
+            const UnsignedInt to = weld[collapse.to];
+            if(locked[from] || locked[to]) continue;
+
+            /* Reject the collapse if it would flip any of the remaining
+               triangles. Triangles containing both vertices get removed. */
+            const Vector3 target = scaledPositions[collapse.to];
+            bool flips = false;
+            std::size_t sharedTriangleCount = 0;
+            arrayResize(fromNeighbors, NoInit, 0);
+            gatherGroupTriangles(collapse.from, fromTriangles);
+            for(const std::size_t triangle: fromTriangles) {
+                Vector3 original[3];
+                Vector3 collapsed[3];
+                bool shared = false;
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt vertex = weld[live[triangle + j]];
+                    if(vertex == to) shared = true;
+                    if(vertex != from) arrayAppend(fromNeighbors, vertex);
+                    original[j] = scaledPositions[live[triangle + j]];
+                    collapsed[j] = vertex == from ? target : original[j];
+                }
+                if(shared) {
+                    ++sharedTriangleCount;
+                    continue;
+                }
+                const Vector3 originalNormal = Math::cross(original[1] - original[0], original[2] - original[0]);
+                const Vector3 collapsedNormal = Math::cross(collapsed[1] - collapsed[0], collapsed[2] - collapsed[0]);
+                if(Math::dot(originalNormal, collapsedNormal) <= MinNormalDot && !originalNormal.isZero())
+                    flips = true;
+            }
+            if(flips) continue;
+
+            /* Reject the collapse if the vertices have more common neighbors
+               than triangles they share, as that would create non-manifold
+               edges or duplicate triangles */
+            arrayResize(toNeighbors, NoInit, 0);
+            gatherGroupTriangles(collapse.to, toTriangles);
+            for(const std::size_t triangle: toTriangles) {
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt vertex = weld[live[triangle + j]];
+                    if(vertex != to) arrayAppend(toNeighbors, vertex);
+                }
+            }
+            std::sort(fromNeighbors.begin(), fromNeighbors.end());
+            std::sort(toNeighbors.begin(), toNeighbors.end());
+            const std::size_t fromNeighborCount = std::unique(fromNeighbors.begin(), fromNeighbors.end()) - fromNeighbors.begin();
+            const std::size_t toNeighborCount = std::unique(toNeighbors.begin(), toNeighbors.end()) - toNeighbors.begin();
+            std::size_t commonNeighborCount = 0;
+            for(std::size_t j = 0, k = 0; j != fromNeighborCount && k != toNeighborCount; ) {
+                if(fromNeighbors[j] < toNeighbors[k]) ++j;
+                else if(fromNeighbors[j] > toNeighbors[k]) ++k;
+                else {
+                    ++commonNeighborCount;
+                    ++j;
+                    ++k;
+                }
+            }
+            if(commonNeighborCount != sharedTriangleCount) continue;
+
+            collapseTarget[collapse.from] = collapse.to;
+            if(kinds[collapse.from] == VertexKind::Seam)
+                collapseTarget[nextInGroup[collapse.from]] = seamTarget(collapse.from, collapse.to);
+            addQuadric(quadrics[to], quadrics[from]);
+            maxErrorSquared = Math::max(maxErrorSquared, collapse.error);
+            removedTriangleCount += sharedTriangleCount;
+            ++collapseCount;
+
+            /* Lock the whole neighborhood for the rest of this pass, as the
+               flip and neighbor checks above would be invalid otherwise */
+            for(const std::size_t triangle: fromTriangles)
+                for(std::size_t j = 0; j != 3; ++j)
+                    locked.set(weld[live[triangle + j]]);
+        }
+
+        if(!collapseCount) break;
+
+        /* Apply the collapses and remove triangles that became degenerate */
+        std::size_t newIndexCount = 0;
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            const UnsignedInt a = collapseTarget[indices[i + 0]];
+            const UnsignedInt b = collapseTarget[indices[i + 1]];
+            const UnsignedInt c = collapseTarget[indices[i + 2]];
+            if(isDegenerate(a, b, c)) continue;
+            indices[newIndexCount++] = T(a);
+            indices[newIndexCount++] = T(b);
+            indices[newIndexCount++] = T(c);
+        }
+        indexCount = newIndexCount;
+    }
+
+    return {indexCount, Math::sqrt(maxErrorSquared)};
+}
+
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError, flags);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError, flags);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError, flags);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::simplifyInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), positions, targetIndexCount, targetError, flags);
+    else if(indices.size()[1] == 2)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), positions, targetIndexCount, targetError, flags);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), positions, targetIndexCount, targetError, flags);
+    }
+}
+
+namespace {
+
+/* Makes a new mesh with given index data and vertex data of the original,
+   transferring their ownership if possible */
+Trade::MeshData meshWithIndices(Trade::MeshData&& mesh, Containers::Array<char>&& indexData, const Trade::MeshIndexData& indices) {
+    const Containers::ArrayView<const char> originalVertexData = mesh.vertexData();
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    Containers::Array<char> vertexData;
+    if(mesh.vertexDataFlags() & Trade::DataFlag::Owned)
+        vertexData = mesh.releaseVertexData();
+    else {
+        vertexData = Containers::Array<char>{NoInit, originalVertexData.size()};
+        Utility::copy(originalVertexData, vertexData);
+    }
+
+    Containers::Array<Trade::MeshAttributeData> attributeData{mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != attributeData.size(); ++i)
+        attributeData[i] = Implementation::remapAttributeData(mesh.attributeData(i), vertexCount, originalVertexData, vertexData);
+
+    return Trade::MeshData{mesh.primitive(),
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributeData),
+        vertexCount};
+}
+
+}
+
+Containers::Pair<Trade::MeshData, Float> simplify(Trade::MeshData&& mesh, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::simplify(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(),
+        (Containers::Pair<Trade::MeshData, Float>{Trade::MeshData{MeshPrimitive::Triangles, 0}, 0.0f}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::simplify(): mesh data not indexed",
+        (Containers::Pair<Trade::MeshData, Float>{Trade::MeshData{MeshPrimitive::Triangles, 0}, 0.0f}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::simplify(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Containers::Pair<Trade::MeshData, Float>{Trade::MeshData{MeshPrimitive::Triangles, 0}, 0.0f}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::simplify(): the mesh has no positions",
+        (Containers::Pair<Trade::MeshData, Float>{Trade::MeshData{MeshPrimitive::Triangles, 0}, 0.0f}));
+
+    /* Simplify a tightly packed copy of the index buffer */
+    const MeshIndexType indexType = mesh.indexType();
+    const UnsignedInt indexTypeSize = meshIndexTypeSize(indexType);
+    Containers::Array<char> indexData{NoInit, mesh.indexCount()*indexTypeSize};
+    const Containers::StridedArrayView2D<char> indices{indexData, {mesh.indexCount(), indexTypeSize}};
+    Utility::copy(mesh.indices(), indices);
+    const Containers::Pair<std::size_t, Float> result = simplifyInPlace(indices, mesh.positions3DAsArray(), targetIndexCount, targetError, flags);
+
+    Containers::Array<char> simplifiedIndexData{NoInit, result.first()*indexTypeSize};
+    Utility::copy(indexData.prefix(simplifiedIndexData.size()), simplifiedIndexData);
+    const Trade::MeshIndexData simplifiedIndices{indexType, simplifiedIndexData};
+    return {meshWithIndices(Utility::move(mesh), Utility::move(simplifiedIndexData), simplifiedIndices), result.second()};
+}
+
+Containers::Pair<Trade::MeshData, Float> simplify(const Trade::MeshData& mesh, const std::size_t targetIndexCount, const Float targetError, const SimplifyFlags flags) {
+    /* Pass through to the && overload, which then decides whether to reuse
+       anything based on the DataFlags */
+    return simplify(reference(mesh), targetIndexCount, targetError, flags);
+}
+
+Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>> simplifyLodChain(const Trade::MeshData& mesh, const UnsignedInt lodCount, const Float indexCountRatio, const Float targetError, const SimplifyFlags flags) {
+    CORRADE_ASSERT(lodCount,
+        "MeshTools::simplifyLodChain(): expected at least one level", (Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(indexCountRatio >= 0.0f && indexCountRatio <= 1.0f,
+        "MeshTools::simplifyLodChain(): expected index count ratio to be between 0 and 1 but got" << indexCountRatio, (Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::simplifyLodChain(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), (Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::simplifyLodChain(): mesh data not indexed", (Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::simplifyLodChain(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), (Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::simplifyLodChain(): the mesh has no positions", (Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+
+    const MeshIndexType indexType = mesh.indexType();
+    const UnsignedInt indexTypeSize = meshIndexTypeSize(indexType);
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    /* The first level is the original index buffer, the scratch buffer is
+       then simplified in-place, with each level appended to the output */
+    Containers::Array<char> indexData;
+    Containers::Array<SimplifyLod> lods;
+    arrayAppend(indexData, NoInit, mesh.indexCount()*indexTypeSize);
+    Utility::copy(mesh.indices(), Containers::StridedArrayView2D<char>{indexData, {mesh.indexCount(), indexTypeSize}});
+    arrayAppend(lods, SimplifyLod{0, mesh.indexCount(), 0.0f});
+
+    Containers::Array<char> scratch{NoInit, indexData.size()};
+    Utility::copy(indexData, scratch);
+    std::size_t indexCount = mesh.indexCount();
+    Float error = 0.0f;
+    while(lods.size() < lodCount && error < targetError) {
+        const std::size_t targetIndexCount = std::size_t(indexCount*indexCountRatio)/3*3;
+        const Containers::Pair<std::size_t, Float> result = simplifyInPlace(
+            Containers::StridedArrayView2D<char>{scratch, {indexCount, indexTypeSize}},
+            positions, targetIndexCount, targetError - error, flags);
+        if(result.first() >= indexCount || !result.first())
+            break;
+
+        indexCount = result.first();
+        error += result.second();
+        arrayAppend(lods, SimplifyLod{UnsignedInt(indexData.size()/indexTypeSize), UnsignedInt(indexCount), error});
+        arrayAppend(indexData, scratch.prefix(indexCount*indexTypeSize));
+    }
+
+    /* Convert the growable arrays to ones with a default deleter */
+    arrayShrink(indexData, DefaultInit);
+    arrayShrink(lods, DefaultInit);
+
+    const Trade::MeshIndexData indices{indexType, indexData.prefix(mesh.indexCount()*indexTypeSize)};
+    return {meshWithIndices(reference(mesh), Utility::move(indexData), indices), Utility::move(lods)};
+}
+
+}}
@@ -0,0 +1,219 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplifyInPlace(), @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::simplifyLodChain(), struct @ref Magnum::MeshTools::SimplifyLod, enum @ref Magnum::MeshTools::SimplifyFlag, enum set @ref Magnum::MeshTools::SimplifyFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Mesh simplification flag
+@m_since_latest
+
+@see @ref SimplifyFlags, @ref simplifyInPlace(), @ref simplify(),
+    @ref simplifyLodChain()
+*/
+enum class SimplifyFlag: UnsignedByte {
+    /**
+     * Don't move any vertices on open mesh borders. By default, border
+     * vertices can be collapsed along the border, with the border shape
+     * being preserved by the error metric. Vertices on attribute seams are
+     * unaffected by this flag.
+     */
+    LockBorder = 1 << 0
+};
+
+/**
+@brief Mesh simplification flags
+@m_since_latest
+
+@see @ref simplifyInPlace(), @ref simplify(), @ref simplifyLodChain()
+*/
+typedef Containers::EnumSet<SimplifyFlag> SimplifyFlags;
+
+CORRADE_ENUMSET_OPERATORS(SimplifyFlags)
+
+/**
+@brief Simplify a triangle mesh in-place
+@param[in,out] indices      Triangle indices to operate on
+@param[in] positions        Vertex positions
+@param[in] targetIndexCount Index count to stop at
+@param[in] targetError      Max error relative to the mesh size
+@param[in] flags            Flags
+@return Resulting index count and the error, relative to the mesh size
+@m_since_latest
+
+Reduces the triangle count using edge collapses ordered by a quadric error
+metric (QEM) until the index count is at or below @p targetIndexCount or
+until the next collapse would exceed @p targetError. The size of the mesh is
+the largest dimension of the axis-aligned bounding box of @p positions, the
+error is then approximately the distance by which the simplified surface
+deviates from the original, divided by that size. Passing @cpp 0 @ce for
+@p targetIndexCount makes the process stop only on the error limit, passing
+@cpp 1.0f @ce or more for @p targetError makes it stop only on the index
+count.
+
+The collapses always move a vertex to the position of an existing neighbor
+vertex, so the vertex data stay untouched and the simplified mesh references
+a subset of the original vertices. This means several levels of detail can
+share a single vertex buffer, see @ref simplifyLodChain() for a convenience
+utility that builds such a chain.
+
+Vertices that have the same position but differ in other attributes, such as
+at texture coordinate or normal discontinuities, are treated as a single
+vertex for the error metric and collapses along such seams move both sides
+together, keeping the seam watertight. Open mesh borders are allowed to
+collapse only along themselves, unless @ref SimplifyFlag::LockBorder is set,
+in which case they're kept. Vertices where more than two seams or borders
+meet are never moved. Collapses that would flip a triangle or make the
+topology non-manifold are rejected. Triangles that were degenerate in the
+input are removed.
+
+The resulting triangles are written to the prefix of @p indices, in an
+unspecified order. Use @ref optimizeVertexCacheInPlace() afterwards to
+reorder them for rendering, and @ref optimizeVertexFetchInPlace() to remove
+vertices that are no longer referenced. Expects that the index count is
+divisible by 3 and all indices are in bounds of @p positions.
+@see @ref simplify(const Trade::MeshData&, std::size_t, Float, SimplifyFlags)
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError, SimplifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError, SimplifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError, SimplifyFlags flags = {});
+
+/**
+@brief Simplify a triangle mesh with a type-erased index array in-place
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float, SimplifyFlags)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError, SimplifyFlags flags = {});
+
+/**
+@brief Simplify a triangle mesh
+@param mesh             Input mesh
+@param targetIndexCount Index count to stop at
+@param targetError      Max error relative to the mesh size
+@param flags            Flags
+@return Simplified mesh and the error, relative to the mesh size
+@m_since_latest
+
+Expects that the mesh is indexed, is a @ref MeshPrimitive::Triangles and has
+a @ref Trade::MeshAttribute::Position attribute. The positions are converted
+using @ref Trade::MeshData::positions3DAsArray() and passed together with a
+copy of @ref Trade::MeshData::indices() to
+@ref simplifyInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float, SimplifyFlags).
+The returned mesh has a tightly packed index buffer of the same type as the
+original, vertex data are passed through unchanged, including vertices that
+are no longer referenced. Use
+@ref optimizeVertexFetch(const Trade::MeshData&) to get rid of them. Expects
+that the index type is not implementation-specific.
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Float> simplify(const Trade::MeshData& mesh, std::size_t targetIndexCount, Float targetError, SimplifyFlags flags = {});
+
+/**
+@brief Simplify a triangle mesh
+@m_since_latest
+
+Compared to @ref simplify(const Trade::MeshData&, std::size_t, Float, SimplifyFlags)
+this function can transfer ownership of @p mesh vertex data to the returned
+instance, if they're owned and mutable.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Float> simplify(Trade::MeshData&& mesh, std::size_t targetIndexCount, Float targetError, SimplifyFlags flags = {});
+
+/**
+@brief Level of detail in a chain produced by @ref simplifyLodChain()
+@m_since_latest
+*/
+struct SimplifyLod {
+    /** @brief Offset of the first index */
+    UnsignedInt indexOffset;
+
+    /** @brief Index count */
+    UnsignedInt indexCount;
+
+    /** @brief Error relative to the original mesh size */
+    Float error;
+};
+
+/**
+@brief Build a chain of simplified levels of detail
+@param mesh             Input mesh
+@param lodCount         Max count of levels of detail, including the
+    original
+@param indexCountRatio  Index count of each level relative to the previous
+    one
+@param targetError      Max error relative to the mesh size
+@param flags            Flags
+@return Mesh with all levels in its index buffer and their ranges
+@m_since_latest
+
+The first level is the original mesh, each next level is made by calling
+@ref simplifyInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float, SimplifyFlags)
+on the previous level with @p indexCountRatio times its index count as the
+target. The error of each level is accumulated from the errors of the
+previous levels. The chain ends when @p lodCount levels are made, when the
+next level wouldn't have fewer indices than the previous one or when it
+would exceed @p targetError.
+
+All levels are put into a single index buffer of the same type as the
+original, one after another. The returned mesh shares the vertex data with
+all levels and has its index view set to the first level, ranges of all
+levels, in indices, are in the returned array. A renderer can then upload the
+index buffer just once and switch between the levels using
+@ref GL::Mesh::setIndexOffset() and @ref GL::Mesh::setCount(), for example.
+Expects that @p lodCount is at least @cpp 1 @ce, @p indexCountRatio is
+between @cpp 0.0f @ce and @cpp 1.0f @ce, plus the same expectations as
+@ref simplify(const Trade::MeshData&, std::size_t, Float, SimplifyFlags).
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>> simplifyLodChain(const Trade::MeshData& mesh, UnsignedInt lodCount, Float indexCountRatio = 0.5f, Float targetError = 0.01f, SimplifyFlags flags = {});
+
+}}
+
+#endif
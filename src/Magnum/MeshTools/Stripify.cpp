@@ -0,0 +1,252 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Stripify.h"
+
+#include <algorithm>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* How many most recently emitted vertices are considered for starting a new
+   strip with StripifyFlag::VertexCacheOrder */
+constexpr std::size_t RecentVertexCount = 16;
+
+template<class T> std::size_t stripifyIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::stripifyInto(): index count not divisible by 3", {});
+    CORRADE_ASSERT(restartIndex >= vertexCount,
+        "MeshTools::stripifyInto(): restart index" << restartIndex << "is in range for" << vertexCount << "vertices", {});
+    CORRADE_ASSERT(output.size() >= indices.size()/3*4,
+        "MeshTools::stripifyInto(): expected output to have at least" << indices.size()/3*4 << "items but got" << output.size(), {});
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::stripifyInto(): index" << index << "out of range for" << vertexCount << "vertices", {});
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return 0;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count.
+       Same as in optimizeVertexCacheInPlace(), emitted triangles get swapped
+       to the end of each vertex neighbor list, so the first
+       liveTriangleCount[v] items are always the live ones. */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    Containers::BitArray emitted{ValueInit, triangleCount};
+    const auto emit = [&](const std::size_t triangle) {
+        emitted.set(triangle);
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[triangle*3 + i];
+            UnsignedInt* const vertexNeighbors = neighbors + neighborOffset[v];
+            const UnsignedInt last = --liveTriangleCount[v];
+            for(std::size_t j = 0; j != last; ++j) {
+                if(vertexNeighbors[j] != triangle) continue;
+                std::swap(vertexNeighbors[j], vertexNeighbors[last]);
+                break;
+            }
+        }
+    };
+
+    /* Returns a live triangle that contains the from -> to edge in its
+       winding order together with its third vertex, or ~std::size_t{} if
+       there's none */
+    const auto findTriangle = [&](const UnsignedInt from, const UnsignedInt to, UnsignedInt& third) -> std::size_t {
+        for(std::size_t i = 0; i != liveTriangleCount[from]; ++i) {
+            const UnsignedInt t = neighbors[neighborOffset[from] + i];
+            for(std::size_t j = 0; j != 3; ++j) {
+                if(indices[t*3 + j] != from || indices[t*3 + (j + 1) % 3] != to)
+                    continue;
+                third = indices[t*3 + (j + 2) % 3];
+                return t;
+            }
+        }
+        return ~std::size_t{};
+    };
+
+    /* Degenerate triangles wouldn't render anything, drop them right away */
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const T a = indices[i*3 + 0];
+        const T b = indices[i*3 + 1];
+        const T c = indices[i*3 + 2];
+        if(a == b || b == c || c == a) emit(i);
+    }
+
+    /* Ring buffer of most recently emitted vertices */
+    UnsignedInt recent[RecentVertexCount];
+    std::size_t recentCount = 0;
+
+    /* Cursor for picking the next triangle in input order */
+    std::size_t cursor = 0;
+
+    std::size_t outputCount = 0;
+    for(;;) {
+        /* Pick a triangle to start a new strip with. With VertexCacheOrder
+           take the one with least live neighbors among triangles adjacent to
+           recently emitted vertices, as leaving isolated triangles for later
+           would mean they each end up in a separate strip. */
+        std::size_t start = ~std::size_t{};
+        if(flags & StripifyFlag::VertexCacheOrder) {
+            UnsignedInt bestScore = ~UnsignedInt{};
+            for(std::size_t i = 0; i != Math::min(recentCount, RecentVertexCount); ++i) {
+                const UnsignedInt v = recent[(recentCount - i - 1) % RecentVertexCount];
+                for(std::size_t j = 0; j != liveTriangleCount[v]; ++j) {
+                    const UnsignedInt t = neighbors[neighborOffset[v] + j];
+                    const UnsignedInt score =
+                        liveTriangleCount[indices[t*3 + 0]] +
+                        liveTriangleCount[indices[t*3 + 1]] +
+                        liveTriangleCount[indices[t*3 + 2]];
+                    if(score < bestScore) {
+                        start = t;
+                        bestScore = score;
+                    }
+                }
+            }
+        }
+
+        /* Otherwise, or if there's nothing adjacent, take the first remaining
+           triangle in input order */
+        if(start == ~std::size_t{}) {
+            while(cursor != triangleCount && emitted[cursor]) ++cursor;
+            if(cursor == triangleCount) break;
+            start = cursor;
+        }
+
+        /* For a strip starting with (a, b, c) the second triangle is
+           (c, b, d), so pick a rotation of the first triangle for which
+           there's a live triangle with the c -> b edge */
+        UnsignedInt triangle[3]{
+            UnsignedInt(indices[start*3 + 0]),
+            UnsignedInt(indices[start*3 + 1]),
+            UnsignedInt(indices[start*3 + 2])
+        };
+        emit(start);
+        for(std::size_t rotation = 0; rotation != 3; ++rotation) {
+            UnsignedInt third;
+            if(findTriangle(triangle[2], triangle[1], third) != ~std::size_t{})
+                break;
+            std::rotate(triangle, triangle + 1, triangle + 3);
+        }
+
+        if(outputCount) output[outputCount++] = restartIndex;
+        for(const UnsignedInt v: triangle) {
+            output[outputCount++] = v;
+            recent[recentCount++ % RecentVertexCount] = v;
+        }
+
+        /* Continue the strip for as long as possible. Strip triangle k is
+           (v[k], v[k + 1], v[k + 2]) for even k and (v[k + 1], v[k],
+           v[k + 2]) for odd k, so the next triangle has to contain the last
+           strip edge in the order given by parity of k. */
+        UnsignedInt a = triangle[1];
+        UnsignedInt b = triangle[2];
+        for(std::size_t k = 1; ; ++k) {
+            UnsignedInt c;
+            const std::size_t next = k % 2 ?
+                findTriangle(b, a, c) : findTriangle(a, b, c);
+            if(next == ~std::size_t{}) break;
+
+            emit(next);
+            output[outputCount++] = c;
+            recent[recentCount++ % RecentVertexCount] = c;
+            a = b;
+            b = c;
+        }
+    }
+
+    return outputCount;
+}
+
+template<class T> Containers::Array<UnsignedInt> stripifyImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    /* Allocate for the worst case first, then copy to an array of the actual
+       size */
+    Containers::Array<UnsignedInt> output{NoInit, indices.size()/3*4};
+    const std::size_t outputCount = stripifyIntoImplementation(indices, vertexCount, output, restartIndex, flags);
+    Containers::Array<UnsignedInt> out{NoInit, outputCount};
+    Utility::copy(output.prefix(outputCount), out);
+    return out;
+}
+
+}
+
+std::size_t stripifyInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    return stripifyIntoImplementation(indices, vertexCount, output, restartIndex, flags);
+}
+
+std::size_t stripifyInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    return stripifyIntoImplementation(indices, vertexCount, output, restartIndex, flags);
+}
+
+std::size_t stripifyInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    return stripifyIntoImplementation(indices, vertexCount, output, restartIndex, flags);
+}
+
+std::size_t stripifyInto(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::stripifyInto(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return stripifyIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, output, restartIndex, flags);
+    else if(indices.size()[1] == 2)
+        return stripifyIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, output, restartIndex, flags);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::stripifyInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return stripifyIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, output, restartIndex, flags);
+    }
+}
+
+Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    return stripifyImplementation(indices, vertexCount, restartIndex, flags);
+}
+
+Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    return stripifyImplementation(indices, vertexCount, restartIndex, flags);
+}
+
+Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    return stripifyImplementation(indices, vertexCount, restartIndex, flags);
+}
+
+Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const UnsignedInt restartIndex, const StripifyFlags flags) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::stripify(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return stripifyImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, restartIndex, flags);
+    else if(indices.size()[1] == 2)
+        return stripifyImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, restartIndex, flags);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::stripify(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return stripifyImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, restartIndex, flags);
+    }
+}
+
+}}
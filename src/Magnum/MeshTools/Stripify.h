@@ -0,0 +1,162 @@
+#ifndef Magnum_MeshTools_Stripify_h
+#define Magnum_MeshTools_Stripify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::stripify(), @ref Magnum::MeshTools::stripifyInto(), enum @ref Magnum::MeshTools::StripifyFlag, enum set @ref Magnum::MeshTools::StripifyFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Triangle strip conversion flag
+@m_since_latest
+
+@see @ref StripifyFlags, @ref stripify(), @ref stripifyInto()
+*/
+enum class StripifyFlag: UnsignedByte {
+    /**
+     * Start each new strip with a triangle adjacent to one of the most
+     * recently emitted vertices instead of the first remaining triangle in
+     * the input order, preferring triangles that have the fewest remaining
+     * neighbors. Keeps consecutive strips spatially close together, which
+     * improves post-transform vertex cache hit rate and leaves less isolated
+     * triangles that would each need a separate strip.
+     */
+    VertexCacheOrder = 1 << 0
+};
+
+/**
+@brief Triangle strip conversion flags
+@m_since_latest
+
+@see @ref stripify(), @ref stripifyInto()
+*/
+typedef Containers::EnumSet<StripifyFlag> StripifyFlags;
+
+CORRADE_ENUMSET_OPERATORS(StripifyFlags)
+
+/**
+@brief Convert a triangle list to triangle strips joined with primitive restart indices
+@param[in] indices      Triangle indices
+@param[in] vertexCount  Vertex count
+@param[out] output      Where to put the strip indices
+@param[in] restartIndex Primitive restart index
+@param[in] flags        Flags
+@return Count of indices written to @p output
+@m_since_latest
+
+Greedily walks over triangles sharing an edge, emitting a single new index for
+each triangle that continues the current strip. A strip ends once there's no
+unused triangle adjacent to its last edge with a matching winding, after which
+@p restartIndex is written and a new strip is started. The output is meant to
+be rendered as @ref MeshPrimitive::TriangleStrip with primitive restart
+enabled, with the triangles having the same winding as in the input.
+Degenerate triangles are dropped, as they wouldn't be rendered anyway.
+
+The default restart index is the maximum value of a 32-bit index type, which
+is what GL and Vulkan use when drawing with @ref MeshIndexType::UnsignedInt.
+If you want to compress the result to @ref MeshIndexType::UnsignedShort,
+pass @cpp 0xffff @ce instead. A new strip starts at the first remaining
+triangle in input order, so it's beneficial to call
+@ref optimizeVertexCacheInPlace() on the input first. Alternatively, enable
+@ref StripifyFlag::VertexCacheOrder to pick triangles near recently emitted
+vertices.
+
+Expects that the index count is divisible by 3, all indices are less than
+@p vertexCount, @p restartIndex is not less than @p vertexCount and @p output
+has at least @cpp indices.size()/3*4 @ce items, which is enough for the worst
+case of every triangle being a separate strip.
+@see @ref generateTriangleStripIndices()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t stripifyInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t stripifyInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t stripifyInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+@brief Convert a type-erased triangle list to triangle strips joined with primitive restart indices
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref stripifyInto(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt, StripifyFlags)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t stripifyInto(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+@brief Convert a triangle list to triangle strips joined with primitive restart indices
+@m_since_latest
+
+Same as @ref stripifyInto(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt, StripifyFlags)
+but allocates the output. Size of the returned array is the resulting index
+count.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+/**
+@brief Convert a type-erased triangle list to triangle strips joined with primitive restart indices
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref stripify(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, UnsignedInt, StripifyFlags)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> stripify(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, UnsignedInt restartIndex = 0xffffffffu, StripifyFlags flags = {});
+
+}}
+
+#endif
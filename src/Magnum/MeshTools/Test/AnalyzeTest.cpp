@@ -0,0 +1,473 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Analyze.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct AnalyzeTest: TestSuite::Tester {
+    explicit AnalyzeTest();
+
+    template<class T> void vertexCache();
+    void vertexCacheZeroSize();
+    void vertexCacheEmpty();
+    void vertexCacheWrongIndexCount();
+    void vertexCacheIndexOutOfRange();
+    template<class T> void vertexCacheErased();
+    void vertexCacheErasedNonContiguous();
+    void vertexCacheErasedWrongIndexSize();
+    void vertexCacheMeshData();
+    void vertexCacheMeshDataNotTriangles();
+    void vertexCacheMeshDataNotIndexed();
+    void vertexCacheMeshDataImplementationSpecificIndexType();
+
+    template<class T> void vertexFetch();
+    void vertexFetchConflict();
+    void vertexFetchStraddling();
+    void vertexFetchEmpty();
+    void vertexFetchIndexOutOfRange();
+    void vertexFetchInvalidCacheSize();
+    template<class T> void vertexFetchErased();
+    void vertexFetchErasedNonContiguous();
+    void vertexFetchErasedWrongIndexSize();
+    void vertexFetchMeshData();
+    void vertexFetchMeshDataInterleaved();
+    void vertexFetchMeshDataNotIndexed();
+    void vertexFetchMeshDataImplementationSpecificIndexType();
+    void vertexFetchMeshDataImplementationSpecificVertexFormat();
+};
+
+const struct {
+    const char* name;
+    VertexCacheModel model;
+    UnsignedInt expectedTransformCount;
+} VertexCacheData[]{
+    /* The second triangle evicts vertex 0 in the FIFO but not in the LRU, as
+       there it got moved to the front by the hit */
+    {"FIFO", VertexCacheModel::Fifo, 8},
+    {"LRU", VertexCacheModel::Lru, 7},
+};
+
+AnalyzeTest::AnalyzeTest() {
+    addInstancedTests<AnalyzeTest>({
+        &AnalyzeTest::vertexCache<UnsignedByte>,
+        &AnalyzeTest::vertexCache<UnsignedShort>,
+        &AnalyzeTest::vertexCache<UnsignedInt>,
+        &AnalyzeTest::vertexCacheZeroSize,
+        &AnalyzeTest::vertexCacheEmpty},
+        Containers::arraySize(VertexCacheData));
+
+    addTests({&AnalyzeTest::vertexCacheWrongIndexCount,
+              &AnalyzeTest::vertexCacheIndexOutOfRange,
+              &AnalyzeTest::vertexCacheErased<UnsignedByte>,
+              &AnalyzeTest::vertexCacheErased<UnsignedShort>,
+              &AnalyzeTest::vertexCacheErased<UnsignedInt>,
+              &AnalyzeTest::vertexCacheErasedNonContiguous,
+              &AnalyzeTest::vertexCacheErasedWrongIndexSize,
+              &AnalyzeTest::vertexCacheMeshData,
+              &AnalyzeTest::vertexCacheMeshDataNotTriangles,
+              &AnalyzeTest::vertexCacheMeshDataNotIndexed,
+              &AnalyzeTest::vertexCacheMeshDataImplementationSpecificIndexType,
+
+              &AnalyzeTest::vertexFetch<UnsignedByte>,
+              &AnalyzeTest::vertexFetch<UnsignedShort>,
+              &AnalyzeTest::vertexFetch<UnsignedInt>,
+              &AnalyzeTest::vertexFetchConflict,
+              &AnalyzeTest::vertexFetchStraddling,
+              &AnalyzeTest::vertexFetchEmpty,
+              &AnalyzeTest::vertexFetchIndexOutOfRange,
+              &AnalyzeTest::vertexFetchInvalidCacheSize,
+              &AnalyzeTest::vertexFetchErased<UnsignedByte>,
+              &AnalyzeTest::vertexFetchErased<UnsignedShort>,
+              &AnalyzeTest::vertexFetchErased<UnsignedInt>,
+              &AnalyzeTest::vertexFetchErasedNonContiguous,
+              &AnalyzeTest::vertexFetchErasedWrongIndexSize,
+              &AnalyzeTest::vertexFetchMeshData,
+              &AnalyzeTest::vertexFetchMeshDataInterleaved,
+              &AnalyzeTest::vertexFetchMeshDataNotIndexed,
+              &AnalyzeTest::vertexFetchMeshDataImplementationSpecificIndexType,
+              &AnalyzeTest::vertexFetchMeshDataImplementationSpecificVertexFormat});
+}
+
+template<class T> void AnalyzeTest::vertexCache() {
+    auto&& data = VertexCacheData[testCaseInstanceId()];
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    /* With a cache of size 3, the first triangle is three misses, the second
+       hits vertex 0 and the third misses everything in FIFO, but hits vertex 0
+       in LRU */
+    const T indices[]{
+        0, 1, 2,
+        0, 3, 4,
+        0, 1, 2
+    };
+
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 5, data.model, 3);
+    CORRADE_COMPARE(out.vertexTransformCount, data.expectedTransformCount);
+    CORRADE_COMPARE(out.acmr, data.expectedTransformCount/3.0f);
+    CORRADE_COMPARE(out.atvr, data.expectedTransformCount/5.0f);
+
+    /* With the default size everything fits */
+    VertexCacheStatistics outDefault = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 5, data.model);
+    CORRADE_COMPARE(outDefault.vertexTransformCount, 5);
+    CORRADE_COMPARE(outDefault.acmr, 5.0f/3.0f);
+    CORRADE_COMPARE(outDefault.atvr, 1.0f);
+}
+
+void AnalyzeTest::vertexCacheZeroSize() {
+    auto&& data = VertexCacheData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Every index is a miss. Vertex 3 isn't referenced, so it doesn't count
+       into the ATVR. */
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 4};
+
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(indices, 5, data.model, 0);
+    CORRADE_COMPARE(out.vertexTransformCount, 6);
+    CORRADE_COMPARE(out.acmr, 3.0f);
+    CORRADE_COMPARE(out.atvr, 1.5f);
+}
+
+void AnalyzeTest::vertexCacheEmpty() {
+    auto&& data = VertexCacheData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* No NaNs from the divisions */
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(Containers::StridedArrayView1D<const UnsignedInt>{}, 5, data.model);
+    CORRADE_COMPARE(out.vertexTransformCount, 0);
+    CORRADE_COMPARE(out.acmr, 0.0f);
+    CORRADE_COMPARE(out.atvr, 0.0f);
+}
+
+void AnalyzeTest::vertexCacheWrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(indices, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3\n");
+}
+
+void AnalyzeTest::vertexCacheIndexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(indices, 3);
+    MeshTools::analyzeVertexCache(indices, 3, VertexCacheModel::Lru);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): index 3 out of range for 3 vertices\n"
+        "MeshTools::analyzeVertexCache(): index 3 out of range for 3 vertices\n");
+}
+
+template<class T> void AnalyzeTest::vertexCacheErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{
+        0, 1, 2,
+        0, 3, 4,
+        0, 1, 2
+    };
+
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 5, VertexCacheModel::Fifo, 3);
+    CORRADE_COMPARE(out.vertexTransformCount, 8);
+    CORRADE_COMPARE(out.acmr, 8.0f/3.0f);
+    CORRADE_COMPARE(out.atvr, 8.0f/5.0f);
+}
+
+void AnalyzeTest::vertexCacheErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): second index view dimension is not contiguous\n");
+}
+
+void AnalyzeTest::vertexCacheErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void AnalyzeTest::vertexCacheMeshData() {
+    const UnsignedShort indices[]{
+        0, 1, 2,
+        0, 3, 4,
+        0, 1, 2
+    };
+    const Vector3 positions[5];
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(mesh, VertexCacheModel::Lru, 3);
+    CORRADE_COMPARE(out.vertexTransformCount, 7);
+    CORRADE_COMPARE(out.acmr, 7.0f/3.0f);
+    CORRADE_COMPARE(out.atvr, 7.0f/5.0f);
+}
+
+void AnalyzeTest::vertexCacheMeshDataNotTriangles() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Trade::MeshData{MeshPrimitive::TriangleFan,
+        {}, indices, Trade::MeshIndexData{indices}, 1});
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleFan\n");
+}
+
+void AnalyzeTest::vertexCacheMeshDataNotIndexed() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): mesh data not indexed\n");
+}
+
+void AnalyzeTest::vertexCacheMeshDataImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 0});
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+template<class T> void AnalyzeTest::vertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 16-byte vertices, so four of them fit into a 64-byte line. The first
+       four vertices are in line 0, vertex 4 in line 1, and both lines fit
+       into the cache so vertex 0 is still there when fetched again. */
+    const T indices[]{0, 1, 2, 3, 4, 0};
+
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(Containers::stridedArrayView(indices), 16, 16, 64, 128);
+    CORRADE_COMPARE(out.bytesFetched, 128);
+    CORRADE_COMPARE(out.overfetch, 128.0f/(5*16));
+}
+
+void AnalyzeTest::vertexFetchConflict() {
+    /* Vertex 8 is in line 2, which maps to the same slot as line 0 in a
+       two-line direct-mapped cache, so vertex 0 gets fetched twice */
+    const UnsignedInt indices[]{0, 8, 0};
+
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(indices, 16, 16, 64, 128);
+    CORRADE_COMPARE(out.bytesFetched, 192);
+    CORRADE_COMPARE(out.overfetch, 192.0f/(2*16));
+}
+
+void AnalyzeTest::vertexFetchStraddling() {
+    /* Vertex 2 spans bytes 48 to 72, which means two lines have to be
+       fetched */
+    const UnsignedInt indices[]{2};
+
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(indices, 3, 24);
+    CORRADE_COMPARE(out.bytesFetched, 128);
+    CORRADE_COMPARE(out.overfetch, 128.0f/24);
+}
+
+void AnalyzeTest::vertexFetchEmpty() {
+    /* No NaNs from the division */
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(Containers::StridedArrayView1D<const UnsignedInt>{}, 5, 16);
+    CORRADE_COMPARE(out.bytesFetched, 0);
+    CORRADE_COMPARE(out.overfetch, 0.0f);
+}
+
+void AnalyzeTest::vertexFetchIndexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 3, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(indices, 3, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): index 3 out of range for 3 vertices\n");
+}
+
+void AnalyzeTest::vertexFetchInvalidCacheSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(indices, 1, 16, 0, 1024);
+    MeshTools::analyzeVertexFetch(indices, 1, 16, 64, 0);
+    MeshTools::analyzeVertexFetch(indices, 1, 16, 64, 1000);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): expected cache size to be a non-zero multiple of cache line size but got 1024 and 0\n"
+        "MeshTools::analyzeVertexFetch(): expected cache size to be a non-zero multiple of cache line size but got 0 and 64\n"
+        "MeshTools::analyzeVertexFetch(): expected cache size to be a non-zero multiple of cache line size but got 1000 and 64\n");
+}
+
+template<class T> void AnalyzeTest::vertexFetchErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 3, 4, 0};
+
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 16, 16, 64, 128);
+    CORRADE_COMPARE(out.bytesFetched, 128);
+    CORRADE_COMPARE(out.overfetch, 128.0f/(5*16));
+}
+
+void AnalyzeTest::vertexFetchErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 1, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): second index view dimension is not contiguous\n");
+}
+
+void AnalyzeTest::vertexFetchErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, 1, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void AnalyzeTest::vertexFetchMeshData() {
+    /* Non-interleaved, positions occupy bytes 0 to 96 and texture coordinates
+       bytes 96 to 160. Fetching the first three vertices thus needs line 0
+       for positions and line 1 for texture coordinates, even though a single
+       line would be enough for 3*20 bytes. */
+    struct Vertex {
+        Vector3 positions[8];
+        Vector2 textureCoordinates[8];
+    } vertexData[1]{};
+    const UnsignedShort indices[]{0, 1, 2};
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(vertexData->positions)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, Containers::arrayView(vertexData->textureCoordinates)}
+        }};
+
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(mesh);
+    CORRADE_COMPARE(out.bytesFetched, 128);
+    CORRADE_COMPARE(out.overfetch, 128.0f/(3*20));
+}
+
+void AnalyzeTest::vertexFetchMeshDataInterleaved() {
+    /* Same as above, but interleaved, so all three vertices are in line 0 */
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertexData[8]{};
+    const UnsignedShort indices[]{0, 1, 2};
+    Containers::StridedArrayView1D<Vertex> vertices = vertexData;
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, vertices.slice(&Vertex::textureCoordinates)}
+        }};
+
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(mesh);
+    CORRADE_COMPARE(out.bytesFetched, 64);
+    CORRADE_COMPARE(out.overfetch, 64.0f/(3*20));
+}
+
+void AnalyzeTest::vertexFetchMeshDataNotIndexed() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): mesh data not indexed\n");
+}
+
+void AnalyzeTest::vertexFetchMeshDataImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 0});
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+void AnalyzeTest::vertexFetchMeshDataImplementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{MeshIndexType::UnsignedInt, nullptr},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xcaca), nullptr}
+        }});
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexFetch(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::AnalyzeTest)
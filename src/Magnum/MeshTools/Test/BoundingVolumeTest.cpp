@@ -26,18 +26,22 @@
 */
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/TypeTraits.h"
 #include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/BoundingVolume.h"
 #include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Test/multipleThreadsData.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/Primitives/Capsule.h"
 #include "Magnum/Primitives/Cube.h"
@@ -55,18 +59,67 @@ struct BoundingVolumeTest: TestSuite::Tester {
     void sphereBouncingBubble();
     void sphereBouncingBubbleNaN();
 
+    void sphereWelzl();
+    void sphereWelzlNaN();
+    void sphereWelzlInto();
+    void sphereWelzlIntoWrongOutputSize();
+
+    void boxOriented();
+    void boxOrientedRotated();
+    void boxOrientedNaN();
+    void boxOrientedInto();
+    void boxOrientedIntoWrongOutputSize();
+
     void benchmarkRange();
     void benchmarkSphereBouncingBubble();
+    void benchmarkSphereWelzl();
+    void benchmarkBoxOriented();
+
+    void benchmarkSphereBouncingBubbleIcosphere();
+    void benchmarkSphereWelzlIcosphere();
+    void benchmarkSphereWelzlInto();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BenchmarkIntoData[]{
+    {"1 thread", 1},
+    {"4 threads", 4},
+    {"hardware concurrency", 0}
 };
 
 BoundingVolumeTest::BoundingVolumeTest() {
     addTests({&BoundingVolumeTest::range,
               &BoundingVolumeTest::rangeNaN,
               &BoundingVolumeTest::sphereBouncingBubble,
-              &BoundingVolumeTest::sphereBouncingBubbleNaN});
+              &BoundingVolumeTest::sphereBouncingBubbleNaN,
+              &BoundingVolumeTest::sphereWelzl,
+              &BoundingVolumeTest::sphereWelzlNaN});
+
+    addInstancedTests({&BoundingVolumeTest::sphereWelzlInto},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({&BoundingVolumeTest::sphereWelzlIntoWrongOutputSize,
+              &BoundingVolumeTest::boxOriented,
+              &BoundingVolumeTest::boxOrientedRotated,
+              &BoundingVolumeTest::boxOrientedNaN});
+
+    addInstancedTests({&BoundingVolumeTest::boxOrientedInto},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({&BoundingVolumeTest::boxOrientedIntoWrongOutputSize});
 
     addBenchmarks({&BoundingVolumeTest::benchmarkRange,
-                   &BoundingVolumeTest::benchmarkSphereBouncingBubble}, 150);
+                   &BoundingVolumeTest::benchmarkSphereBouncingBubble,
+                   &BoundingVolumeTest::benchmarkSphereWelzl,
+                   &BoundingVolumeTest::benchmarkBoxOriented}, 150);
+
+    addBenchmarks({&BoundingVolumeTest::benchmarkSphereBouncingBubbleIcosphere,
+                   &BoundingVolumeTest::benchmarkSphereWelzlIcosphere}, 10);
+
+    addInstancedBenchmarks({&BoundingVolumeTest::benchmarkSphereWelzlInto}, 10,
+        Containers::arraySize(BenchmarkIntoData));
 }
 
 void BoundingVolumeTest::range() {
@@ -231,6 +284,340 @@ void BoundingVolumeTest::sphereBouncingBubbleNaN() {
     }
 }
 
+void BoundingVolumeTest::sphereWelzl() {
+    /* Empty positions -- unlike with the bouncing bubble the radius is zero */
+    {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::StridedArrayView1D<const Vector3>{});
+        CORRADE_COMPARE(sphere.first(), (Vector3{}));
+        CORRADE_COMPARE(sphere.second(), 0.0f);
+
+    /* Identical positions */
+    } {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::stridedArrayView({
+                Vector3{1.0f, 2.0f, 3.0f}
+            }));
+        CORRADE_COMPARE(sphere.first(), (Vector3{1.0f, 2.0f, 3.0f}));
+        CORRADE_COMPARE(sphere.second(), 0.0f);
+    } {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::stridedArrayView({
+                Vector3{3.0f, 1.0f, 2.0f},
+                Vector3{3.0f, 1.0f, 2.0f},
+                Vector3{3.0f, 1.0f, 2.0f}
+            }));
+        CORRADE_COMPARE(sphere.first(), (Vector3{3.0f, 1.0f, 2.0f}));
+        CORRADE_COMPARE(sphere.second(), 0.0f);
+
+    /* Simple cases */
+    } {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::stridedArrayView({
+                Vector3{1.0f, 1.0f, 1.0f},
+                Vector3{2.0f, 2.0f, 2.0f}
+            }));
+        CORRADE_COMPARE(sphere.first(), (Vector3{1.5f}));
+        CORRADE_COMPARE(sphere.second(), Vector3{0.5f}.length());
+    } {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::stridedArrayView({
+                Vector3{2.0f, 0.0f, 0.0f},
+                Vector3{-2.0f, 0.0f, 0.0f},
+                Vector3{0.0f, 2.0f, 0.0f},
+                Vector3{0.0f, -2.0f, 0.0f}
+            }));
+        CORRADE_COMPARE(sphere.first(), (Vector3{0.0f, 0.0f, 0.0f}));
+        CORRADE_COMPARE(sphere.second(), 2.0f);
+
+    /* Collinear points, the sphere is given by the two outermost */
+    } {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::stridedArrayView({
+                Vector3{1.0f, 0.0f, 0.0f},
+                Vector3{4.0f, 0.0f, 0.0f},
+                Vector3{-2.0f, 0.0f, 0.0f},
+                Vector3{0.0f, 0.0f, 0.0f}
+            }));
+        CORRADE_COMPARE(sphere.first(), (Vector3{1.0f, 0.0f, 0.0f}));
+        CORRADE_COMPARE(sphere.second(), 3.0f);
+
+    /* Coplanar points, the sphere is given by a circle through three of
+       them */
+    } {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(Containers::stridedArrayView({
+                Vector3{0.0f, 0.0f, 0.0f},
+                Vector3{4.0f, 0.0f, 0.0f},
+                Vector3{0.0f, 4.0f, 0.0f},
+                Vector3{4.0f, 4.0f, 0.0f},
+                Vector3{2.0f, 2.0f, 0.0f},
+                Vector3{1.0f, 3.0f, 0.0f}
+            }));
+        CORRADE_COMPARE(sphere.first(), (Vector3{2.0f, 2.0f, 0.0f}));
+        CORRADE_COMPARE(sphere.second(), Constants::sqrt2()*2.0f);
+
+    /* Icosphere -- all vertices are on the unit sphere */
+    } {
+        const Trade::MeshData sphereMesh = Primitives::icosphereSolid(1);
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(sphereMesh.attribute<Vector3>(Trade::MeshAttribute::Position));
+        CORRADE_COMPARE(sphere.first(), (Vector3{0.0f, 0.0f, 0.0f}));
+        CORRADE_COMPARE(sphere.second(), 1.0f);
+
+    /* Icosphere translated and scaled -- the ellipsoid poles along the
+       longest axis are vertices of the icosphere, so they define the sphere.
+       The bouncing bubble has a noticeable error here. */
+    } {
+        Trade::MeshData sphereMesh = Primitives::icosphereSolid(1);
+        constexpr Vector3 translation{1.0f, 2.0f, 3.0f};
+        constexpr Vector3 scale{0.5f, 1.2f, 2.8f};
+        transform3DInPlace(sphereMesh, Matrix4::translation(translation)*Matrix4::scaling(scale));
+        const Containers::StridedArrayView1D<const Vector3> positions = sphereMesh.attribute<Vector3>(Trade::MeshAttribute::Position);
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(positions);
+        CORRADE_COMPARE(sphere.first(), translation);
+        CORRADE_COMPARE(sphere.second(), scale.max());
+
+        /* All points are inside even with rounding errors */
+        for(const Vector3& position: positions) {
+            CORRADE_ITERATION(position);
+            CORRADE_COMPARE_AS((position - sphere.first()).length(), sphere.second(),
+                TestSuite::Compare::LessOrEqual);
+        }
+
+    /* Cube -- translated and scaled, unlike with the bouncing bubble there's
+       no error */
+    } {
+        Trade::MeshData cubeMesh = copy(Primitives::cubeSolid());
+        constexpr Vector3 translation{1.0f, 2.0f, 3.0f};
+        constexpr Float scale = 13.2f;
+        transform3DInPlace(cubeMesh, Matrix4::translation(translation)*Matrix4::scaling(Vector3{scale}));
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(cubeMesh.attribute<Vector3>(Trade::MeshAttribute::Position));
+        CORRADE_COMPARE(sphere.first(), translation);
+        CORRADE_COMPARE(sphere.second(), Constants::sqrt3()*scale);
+    }
+
+    /* Radius is rotationally invariant */
+    using namespace Math::Literals;
+
+    for(Deg degrees = 0.0_degf; degrees < 360.0_degf; degrees += 60.0_degf) {
+        CORRADE_ITERATION(degrees);
+        Trade::MeshData cubeMesh = copy(Primitives::cubeSolid());
+        constexpr Vector3 translation{1.0f, 2.0f, 3.0f};
+        transform3DInPlace(cubeMesh, Matrix4::rotationY(degrees)*Matrix4::translation(translation));
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(cubeMesh.attribute<Vector3>(Trade::MeshAttribute::Position));
+        CORRADE_COMPARE(sphere.second(), Constants::sqrt3());
+    }
+}
+
+void BoundingVolumeTest::sphereWelzlNaN() {
+    /* NaNs are ignored, including the first position */
+    const Containers::Pair<Vector3, Float> sphere =
+        boundingSphereWelzl(Containers::stridedArrayView({
+            Vector3{Constants::nan()},
+            Vector3{1.0f, 1.0f, 1.0f},
+            Vector3{Constants::nan()},
+            Vector3{2.0f, 2.0f, 2.0f},
+            Vector3{Constants::nan()}
+        }));
+    CORRADE_COMPARE(sphere.first(), (Vector3{1.5f}));
+    CORRADE_COMPARE(sphere.second(), Vector3{0.5f}.length());
+
+    /* All NaNs is the same as empty */
+    const Containers::Pair<Vector3, Float> empty =
+        boundingSphereWelzl(Containers::stridedArrayView({
+            Vector3{Constants::nan()},
+            Vector3{Constants::nan()}
+        }));
+    CORRADE_COMPARE(empty.first(), (Vector3{}));
+    CORRADE_COMPARE(empty.second(), 0.0f);
+}
+
+/* Icospheres with 10242 vertices each, transformed differently, in total
+   enough to make the batch functions spawn threads */
+Containers::Array<Trade::MeshData> transformedIcospheres() {
+    Containers::Array<Trade::MeshData> meshes;
+    for(std::size_t i = 0; i != 8; ++i) {
+        Trade::MeshData mesh = Primitives::icosphereSolid(5);
+        transform3DInPlace(mesh,
+            Matrix4::translation({Float(i), 2.0f, -Float(i)*0.5f})*
+            Matrix4::rotation(Deg(Float(i)*25.0f), Vector3{1.0f, 2.0f, 3.0f}.normalized())*
+            Matrix4::scaling({1.0f + Float(i)*0.25f, 1.0f, 0.5f}));
+        arrayAppend(meshes, Utility::move(mesh));
+    }
+    return meshes;
+}
+
+void BoundingVolumeTest::sphereWelzlInto() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Trade::MeshData> meshes = transformedIcospheres();
+    Containers::Array<Containers::StridedArrayView1D<const Vector3>> positions{meshes.size()};
+    for(std::size_t i = 0; i != meshes.size(); ++i)
+        positions[i] = meshes[i].attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Containers::Pair<Vector3, Float> spheres[8];
+    boundingSphereWelzlInto(positions, spheres, data.threadCount);
+
+    /* The result should be the same as when calculated one by one,
+       regardless of the thread count */
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const Containers::Pair<Vector3, Float> expected = boundingSphereWelzl(positions[i]);
+        CORRADE_COMPARE(spheres[i].first(), expected.first());
+        CORRADE_COMPARE(spheres[i].second(), expected.second());
+    }
+}
+
+void BoundingVolumeTest::sphereWelzlIntoWrongOutputSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const Containers::StridedArrayView1D<const Vector3> views[]{
+        positions, positions
+    };
+    Containers::Pair<Vector3, Float> spheres[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    boundingSphereWelzlInto(views, spheres);
+    CORRADE_COMPARE(out, "MeshTools::boundingSphereWelzlInto(): expected 2 output items but got 3\n");
+}
+
+void BoundingVolumeTest::boxOriented() {
+    /* Empty positions, zero scaling */
+    {
+        CORRADE_COMPARE(boundingBoxOriented(Containers::StridedArrayView1D<const Vector3>{}),
+            Matrix4::scaling(Vector3{0.0f}));
+
+    /* Single point, zero scaling with a translation */
+    } {
+        CORRADE_COMPARE(boundingBoxOriented(Containers::stridedArrayView({
+                Vector3{1.0f, 2.0f, 3.0f},
+                Vector3{1.0f, 2.0f, 3.0f}
+            })),
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling(Vector3{0.0f}));
+
+    /* Collinear points, the first axis goes along the line in an unspecified
+       direction and the other two are zero */
+    } {
+        const Matrix4 box = boundingBoxOriented(Containers::stridedArrayView({
+            Vector3{0.0f, 0.0f, 0.0f},
+            Vector3{2.0f, 2.0f, 2.0f},
+            Vector3{0.5f, 0.5f, 0.5f}
+        }));
+        CORRADE_COMPARE(Math::abs(box[0].xyz()), (Vector3{1.0f, 1.0f, 1.0f}));
+        CORRADE_COMPARE(box[1].xyz(), Vector3{});
+        CORRADE_COMPARE(box[2].xyz(), Vector3{});
+        CORRADE_COMPARE(box.translation(), (Vector3{1.0f, 1.0f, 1.0f}));
+
+    /* Axis-aligned box stays axis-aligned */
+    } {
+        Trade::MeshData cubeMesh = copy(Primitives::cubeSolid());
+        const Matrix4 transformation = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling({1.0f, 2.0f, 4.0f});
+        transform3DInPlace(cubeMesh, transformation);
+        CORRADE_COMPARE(boundingBoxOriented(cubeMesh.attribute<Vector3>(Trade::MeshAttribute::Position)),
+            transformation);
+    }
+}
+
+void BoundingVolumeTest::boxOrientedRotated() {
+    using namespace Math::Literals;
+
+    Trade::MeshData cubeMesh = copy(Primitives::cubeSolid());
+    constexpr Vector3 translation{1.0f, 2.0f, 3.0f};
+    transform3DInPlace(cubeMesh,
+        Matrix4::translation(translation)*
+        Matrix4::rotation(35.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized())*
+        Matrix4::scaling({1.0f, 2.0f, 4.0f}));
+    const Containers::StridedArrayView1D<const Vector3> positions = cubeMesh.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    const Matrix4 box = boundingBoxOriented(positions);
+
+    /* The axes are orthogonal and right-handed, and the box is the original
+       one, with the axes in an unspecified order */
+    const Vector3 halfSize{box[0].xyz().length(), box[1].xyz().length(), box[2].xyz().length()};
+    CORRADE_COMPARE(Math::dot(box[0].xyz(), box[1].xyz()), 0.0f);
+    CORRADE_COMPARE(Math::dot(box[1].xyz(), box[2].xyz()), 0.0f);
+    CORRADE_COMPARE(Math::dot(box[2].xyz(), box[0].xyz()), 0.0f);
+    CORRADE_COMPARE_AS(box.rotationScaling().determinant(), 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(halfSize.product(), 8.0f);
+    CORRADE_COMPARE(halfSize.min(), 1.0f);
+    CORRADE_COMPARE(halfSize.max(), 4.0f);
+    CORRADE_COMPARE(box.translation(), translation);
+
+    /* Significantly smaller than the axis-aligned box */
+    CORRADE_COMPARE_AS(box.rotationScaling().determinant()*8.0f, boundingRange(positions).size().product()*0.5f,
+        TestSuite::Compare::Less);
+
+    /* All points are inside */
+    const Matrix4 inverted = box.inverted();
+    for(const Vector3& position: positions) {
+        CORRADE_ITERATION(position);
+        CORRADE_COMPARE_AS(Math::abs(inverted.transformPoint(position)).max(), 1.0f + 1.0e-4f,
+            TestSuite::Compare::Less);
+    }
+}
+
+void BoundingVolumeTest::boxOrientedNaN() {
+    /* NaNs are ignored, including the first position */
+    CORRADE_COMPARE(boundingBoxOriented(Containers::stridedArrayView({
+            Vector3{Constants::nan()},
+            Vector3{1.0f, 1.0f, 1.0f},
+            Vector3{Constants::nan()},
+            Vector3{3.0f, 1.0f, 1.0f},
+            Vector3{Constants::nan()}
+        })),
+        Matrix4::translation({2.0f, 1.0f, 1.0f})*Matrix4::scaling({1.0f, 0.0f, 0.0f}));
+
+    /* All NaNs is the same as empty */
+    CORRADE_COMPARE(boundingBoxOriented(Containers::stridedArrayView({
+            Vector3{Constants::nan()},
+            Vector3{Constants::nan()}
+        })),
+        Matrix4::scaling(Vector3{0.0f}));
+}
+
+void BoundingVolumeTest::boxOrientedInto() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Trade::MeshData> meshes = transformedIcospheres();
+    Containers::Array<Containers::StridedArrayView1D<const Vector3>> positions{meshes.size()};
+    for(std::size_t i = 0; i != meshes.size(); ++i)
+        positions[i] = meshes[i].attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Matrix4 boxes[8];
+    boundingBoxOrientedInto(positions, boxes, data.threadCount);
+
+    /* The result should be the same as when calculated one by one,
+       regardless of the thread count */
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(boxes[i], boundingBoxOriented(positions[i]));
+    }
+}
+
+void BoundingVolumeTest::boxOrientedIntoWrongOutputSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const Containers::StridedArrayView1D<const Vector3> views[]{
+        positions, positions
+    };
+    Matrix4 boxes[1];
+
+    Containers::String out;
+    Error redirectError{&out};
+    boundingBoxOrientedInto(views, boxes);
+    CORRADE_COMPARE(out, "MeshTools::boundingBoxOrientedInto(): expected 2 output items but got 1\n");
+}
+
 void BoundingVolumeTest::benchmarkRange() {
     Containers::Array<Vector3> points{NoInit, 500};
     for(size_t i = 0; i < points.size(); ++i) {
@@ -262,6 +649,82 @@ void BoundingVolumeTest::benchmarkSphereBouncingBubble() {
     CORRADE_COMPARE_AS(r, 1.0f, TestSuite::Compare::Greater);
 }
 
+void BoundingVolumeTest::benchmarkSphereWelzl() {
+    Containers::Array<Vector3> points{NoInit, 500};
+    for(size_t i = 0; i < points.size(); ++i) {
+        points[i] = Vector3{Float(i)*0.01f};
+    }
+
+    Float r = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(points);
+        r += sphere.second();
+    }
+
+    CORRADE_COMPARE_AS(r, 1.0f, TestSuite::Compare::Greater);
+}
+
+void BoundingVolumeTest::benchmarkBoxOriented() {
+    Containers::Array<Vector3> points{NoInit, 500};
+    for(size_t i = 0; i < points.size(); ++i) {
+        points[i] = Vector3{Float(i)*0.01f};
+    }
+
+    Float r = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        const Matrix4 box = boundingBoxOriented(points);
+        r += box[0].xyz().length();
+    }
+
+    CORRADE_COMPARE_AS(r, 1.0f, TestSuite::Compare::Greater);
+}
+
+void BoundingVolumeTest::benchmarkSphereBouncingBubbleIcosphere() {
+    const Trade::MeshData mesh = Primitives::icosphereSolid(5);
+    const Containers::StridedArrayView1D<const Vector3> positions = mesh.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Float r = 0.0f;
+    CORRADE_BENCHMARK(5) {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereBouncingBubble(positions);
+        r += sphere.second();
+    }
+
+    CORRADE_COMPARE_AS(r, 1.0f, TestSuite::Compare::Greater);
+}
+
+void BoundingVolumeTest::benchmarkSphereWelzlIcosphere() {
+    const Trade::MeshData mesh = Primitives::icosphereSolid(5);
+    const Containers::StridedArrayView1D<const Vector3> positions = mesh.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Float r = 0.0f;
+    CORRADE_BENCHMARK(5) {
+        const Containers::Pair<Vector3, Float> sphere =
+            boundingSphereWelzl(positions);
+        r += sphere.second();
+    }
+
+    CORRADE_COMPARE_AS(r, 1.0f, TestSuite::Compare::Greater);
+}
+
+void BoundingVolumeTest::benchmarkSphereWelzlInto() {
+    auto&& data = BenchmarkIntoData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Trade::MeshData> meshes = transformedIcospheres();
+    Containers::Array<Containers::StridedArrayView1D<const Vector3>> positions{meshes.size()};
+    for(std::size_t i = 0; i != meshes.size(); ++i)
+        positions[i] = meshes[i].attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Containers::Array<Containers::Pair<Vector3, Float>> spheres{meshes.size()};
+    CORRADE_BENCHMARK(1) {
+        boundingSphereWelzlInto(positions, spheres, data.threadCount);
+    }
+
+    CORRADE_COMPARE_AS(spheres[0].second(), 0.5f, TestSuite::Compare::Greater);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BoundingVolumeTest)
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -32,6 +33,7 @@
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/MeshTools/Concatenate.h"
+#include "Magnum/MeshTools/Test/multipleThreadsData.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
 
@@ -56,6 +58,16 @@ struct ConcatenateTest: TestSuite::Tester {
     void concatenateImplementationSpecificIndexType();
     void concatenateImplementationSpecificVertexFormat();
     void concatenateIntoNoMeshes();
+
+    void concatenateLayoutInto();
+    void concatenateLayoutIntoNotIndexed();
+    void concatenateLayoutIntoMultipleThreads();
+    void concatenateLayoutNoMeshes();
+    void concatenateLayoutIntoInvalid();
+    void concatenateLayoutIntoInconsistentPrimitive();
+
+    void benchmarkConcatenate();
+    void benchmarkConcatenateLayoutInto();
 };
 
 const struct {
@@ -67,6 +79,15 @@ const struct {
     {"don't preserve layout", InterleaveFlags{}, false},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BenchmarkConcatenateLayoutIntoData[]{
+    {"1 thread", 1},
+    {"4 threads", 4},
+    {"hardware concurrency", 0}
+};
+
 ConcatenateTest::ConcatenateTest() {
     addInstancedTests({&ConcatenateTest::concatenate},
         Containers::arraySize(ConcatenateData));
@@ -87,7 +108,22 @@ ConcatenateTest::ConcatenateTest() {
               &ConcatenateTest::concatenateTooLargeAttributeArraySize,
               &ConcatenateTest::concatenateImplementationSpecificIndexType,
               &ConcatenateTest::concatenateImplementationSpecificVertexFormat,
-              &ConcatenateTest::concatenateIntoNoMeshes});
+              &ConcatenateTest::concatenateIntoNoMeshes,
+
+              &ConcatenateTest::concatenateLayoutInto,
+              &ConcatenateTest::concatenateLayoutIntoNotIndexed});
+
+    addInstancedTests({&ConcatenateTest::concatenateLayoutIntoMultipleThreads},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({&ConcatenateTest::concatenateLayoutNoMeshes,
+              &ConcatenateTest::concatenateLayoutIntoInvalid,
+              &ConcatenateTest::concatenateLayoutIntoInconsistentPrimitive});
+
+    addBenchmarks({&ConcatenateTest::benchmarkConcatenate}, 10);
+
+    addInstancedBenchmarks({&ConcatenateTest::benchmarkConcatenateLayoutInto}, 10,
+        Containers::arraySize(BenchmarkConcatenateLayoutIntoData));
 }
 
 /* MSVC 2015 doesn't like unnamed bitfields in local structs, so this has to
@@ -101,6 +137,40 @@ struct VertexDataA {
     Short data[3];
 };
 
+struct SmallMeshVertex {
+    Vector3 position;
+    Vector2 textureCoordinates;
+};
+
+/* A triangle mesh with given vertex count. Odd meshes are indexed, meshes
+   with id % 3 == 1 don't have texture coordinates. */
+Trade::MeshData smallMesh(const UnsignedInt id, const UnsignedInt vertexCount) {
+    Containers::Array<char> vertexData{NoInit, vertexCount*sizeof(SmallMeshVertex)};
+    const Containers::ArrayView<SmallMeshVertex> vertices = Containers::arrayCast<SmallMeshVertex>(vertexData);
+    for(UnsignedInt i = 0; i != vertexCount; ++i) {
+        vertices[i].position = {Float(id), Float(i), Float(id*i)};
+        vertices[i].textureCoordinates = {Float(i)/vertexCount, Float(id)};
+    }
+
+    Containers::Array<Trade::MeshAttributeData> attributeData;
+    arrayAppend(attributeData, Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+        Containers::stridedArrayView(vertices).slice(&SmallMeshVertex::position)});
+    if(id % 3 != 1)
+        arrayAppend(attributeData, Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            Containers::stridedArrayView(vertices).slice(&SmallMeshVertex::textureCoordinates)});
+
+    if(!(id % 2))
+        return Trade::MeshData{MeshPrimitive::Triangles, Utility::move(vertexData), Utility::move(attributeData)};
+
+    Containers::Array<char> indexData{NoInit, vertexCount*sizeof(UnsignedShort)};
+    const Containers::ArrayView<UnsignedShort> indices = Containers::arrayCast<UnsignedShort>(indexData);
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        indices[i] = vertexCount - i - 1;
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        Utility::move(indexData), Trade::MeshIndexData{indices},
+        Utility::move(vertexData), Utility::move(attributeData)};
+}
+
 void ConcatenateTest::concatenate() {
     auto&& data = ConcatenateData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -841,6 +911,213 @@ void ConcatenateTest::concatenateIntoNoMeshes() {
     CORRADE_COMPARE(out, "MeshTools::concatenateInto(): no meshes passed\n");
 }
 
+void ConcatenateTest::concatenateLayoutInto() {
+    Containers::Array<Trade::MeshData> meshes;
+    arrayAppend(meshes, smallMesh(0, 3));
+    arrayAppend(meshes, smallMesh(1, 4));
+    arrayAppend(meshes, smallMesh(2, 2));
+
+    ConcatenateLayout layout = MeshTools::concatenateLayout(meshes);
+    CORRADE_COMPARE(layout.primitive, MeshPrimitive::Triangles);
+    CORRADE_COMPARE(layout.indexCount, 9);
+    CORRADE_COMPARE(layout.vertexCount, 9);
+    CORRADE_COMPARE(layout.attributeData.size(), 2);
+    CORRADE_COMPARE(layout.indexDataSize(), 9*4);
+    CORRADE_COMPARE(layout.vertexDataSize(), 9*sizeof(SmallMeshVertex));
+
+    /* Fill the memory with garbage to verify holes get zeroed. Make the
+       buffers larger to verify just the prefix is used. */
+    Containers::Array<char> indexData{DirectInit, layout.indexDataSize() + 7, '\xcd'};
+    Containers::Array<char> vertexData{DirectInit, layout.vertexDataSize() + 13, '\xcd'};
+    Trade::MeshData dst = MeshTools::concatenateInto(layout, meshes, indexData, vertexData);
+    CORRADE_COMPARE(dst.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(dst.indexDataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(dst.vertexDataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(dst.indexData().data(), indexData.data());
+    CORRADE_COMPARE(dst.indexData().size(), layout.indexDataSize());
+    CORRADE_COMPARE(dst.vertexData().data(), vertexData.data());
+    CORRADE_COMPARE(dst.vertexData().size(), layout.vertexDataSize());
+    CORRADE_COMPARE(dst.attributeData().data(), layout.attributeData.data());
+
+    CORRADE_VERIFY(dst.isIndexed());
+    CORRADE_COMPARE(dst.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 2,        /* implicit for the first nonindexed mesh */
+            6, 5, 4, 3,     /* offset for the second indexed mesh */
+            7, 8            /* implicit + offset for the third mesh */
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f},
+            {0.0f, 2.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 1.0f},
+            {1.0f, 2.0f, 2.0f},
+            {1.0f, 3.0f, 3.0f},
+            {2.0f, 0.0f, 0.0f},
+            {2.0f, 1.0f, 2.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.0f, 0.0f},
+            {1.0f/3.0f, 0.0f},
+            {2.0f/3.0f, 0.0f},
+            {}, {}, {}, {}, /* Missing in the second mesh */
+            {0.0f, 2.0f},
+            {0.5f, 2.0f}
+        }), TestSuite::Compare::Container);
+
+    /* The output should be the same as with the allocating variant */
+    Trade::MeshData expected = MeshTools::concatenate(meshes);
+    CORRADE_COMPARE_AS(dst.indexData(),
+        expected.indexData(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.vertexData(),
+        expected.vertexData(),
+        TestSuite::Compare::Container);
+
+    /* The memory after isn't touched */
+    CORRADE_COMPARE(indexData.back(), '\xcd');
+    CORRADE_COMPARE(vertexData.back(), '\xcd');
+}
+
+void ConcatenateTest::concatenateLayoutIntoNotIndexed() {
+    Containers::Array<Trade::MeshData> meshes;
+    arrayAppend(meshes, smallMesh(0, 3));
+    arrayAppend(meshes, smallMesh(2, 2));
+
+    ConcatenateLayout layout = MeshTools::concatenateLayout(meshes);
+    CORRADE_COMPARE(layout.indexCount, 0);
+    CORRADE_COMPARE(layout.vertexCount, 5);
+    CORRADE_COMPARE(layout.indexDataSize(), 0);
+
+    Containers::Array<char> vertexData{NoInit, layout.vertexDataSize()};
+    Trade::MeshData dst = MeshTools::concatenateInto(layout, meshes, nullptr, vertexData);
+    CORRADE_VERIFY(!dst.isIndexed());
+    CORRADE_COMPARE(dst.vertexCount(), 5);
+    CORRADE_COMPARE_AS(dst.vertexData(),
+        MeshTools::concatenate(meshes).vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenateLayoutIntoMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* 64 meshes with over 64k vertices in total, enough for four threads */
+    Containers::Array<Trade::MeshData> meshes;
+    for(UnsignedInt i = 0; i != 64; ++i)
+        arrayAppend(meshes, smallMesh(i, 1000 + (i*37) % 100));
+
+    Trade::MeshData expected = MeshTools::concatenate(meshes);
+
+    ConcatenateLayout layout = MeshTools::concatenateLayout(meshes);
+    Containers::Array<char> indexData{DirectInit, layout.indexDataSize(), '\xcd'};
+    Containers::Array<char> vertexData{DirectInit, layout.vertexDataSize(), '\xcd'};
+    Trade::MeshData dst = MeshTools::concatenateInto(layout, meshes, indexData, vertexData, data.threadCount);
+    CORRADE_COMPARE(dst.indexCount(), expected.indexCount());
+    CORRADE_COMPARE(dst.vertexCount(), expected.vertexCount());
+    CORRADE_VERIFY(std::memcmp(dst.indexData().data(), expected.indexData().data(), expected.indexData().size()) == 0);
+    CORRADE_VERIFY(std::memcmp(dst.vertexData().data(), expected.vertexData().data(), expected.vertexData().size()) == 0);
+
+    /* Doing it again with the same buffers and layout gives the same
+       result */
+    Trade::MeshData dst2 = MeshTools::concatenateInto(layout, meshes, indexData, vertexData, data.threadCount);
+    CORRADE_COMPARE(dst2.vertexData().data(), dst.vertexData().data());
+    CORRADE_VERIFY(std::memcmp(dst2.vertexData().data(), expected.vertexData().data(), expected.vertexData().size()) == 0);
+}
+
+void ConcatenateTest::concatenateLayoutNoMeshes() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::concatenateLayout({});
+    CORRADE_COMPARE(out, "MeshTools::concatenateLayout(): expected at least one mesh\n");
+}
+
+void ConcatenateTest::concatenateLayoutIntoInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData a = smallMesh(0, 3);
+    Trade::MeshData b = smallMesh(1, 4);
+    Trade::MeshData strip{MeshPrimitive::TriangleStrip, 0};
+
+    ConcatenateLayout layout = MeshTools::concatenateLayout({a, b});
+    ConcatenateLayout stripLayout = MeshTools::concatenateLayout({strip});
+    char indexData[7*4];
+    char vertexData[7*sizeof(SmallMeshVertex)];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::concatenateInto(layout, {}, indexData, vertexData);
+    MeshTools::concatenateInto(stripLayout, {strip}, nullptr, nullptr);
+    MeshTools::concatenateInto(layout, {a}, indexData, vertexData);
+    MeshTools::concatenateInto(layout, {a, b}, Containers::arrayView(indexData).exceptSuffix(1), vertexData);
+    MeshTools::concatenateInto(layout, {a, b}, indexData, Containers::arrayView(vertexData).exceptSuffix(1));
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::concatenateInto(): no meshes passed\n"
+        "MeshTools::concatenateInto(): MeshPrimitive::TriangleStrip is not supported, turn it into a plain indexed mesh first\n"
+        "MeshTools::concatenateInto(): expected meshes with 7 indices and 7 vertices but got 0 and 3\n"
+        "MeshTools::concatenateInto(): expected index data of at least 28 bytes but got 27\n"
+        "MeshTools::concatenateInto(): expected vertex data of at least 140 bytes but got 139\n",
+        TestSuite::Compare::String);
+}
+
+void ConcatenateTest::concatenateLayoutIntoInconsistentPrimitive() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData a = smallMesh(0, 3);
+    Trade::MeshData b{MeshPrimitive::Lines, 0};
+
+    ConcatenateLayout layout = MeshTools::concatenateLayout({a, b});
+    char vertexData[3*sizeof(SmallMeshVertex)];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::concatenateInto(layout, {a, b}, nullptr, vertexData);
+    CORRADE_COMPARE(out, "MeshTools::concatenateInto(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines in mesh 1\n");
+}
+
+void ConcatenateTest::benchmarkConcatenate() {
+    /* Many small meshes, a quarter million vertices in total */
+    Containers::Array<Trade::MeshData> meshes;
+    for(UnsignedInt i = 0; i != 4096; ++i)
+        arrayAppend(meshes, smallMesh(i, 64));
+
+    Trade::MeshData dst{MeshPrimitive::Triangles, 0};
+    CORRADE_BENCHMARK(1) {
+        dst = MeshTools::concatenate(meshes);
+    }
+
+    CORRADE_COMPARE(dst.vertexCount(), 4096*64);
+}
+
+void ConcatenateTest::benchmarkConcatenateLayoutInto() {
+    auto&& data = BenchmarkConcatenateLayoutIntoData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Trade::MeshData> meshes;
+    for(UnsignedInt i = 0; i != 4096; ++i)
+        arrayAppend(meshes, smallMesh(i, 64));
+
+    /* The layout and the buffers are calculated and allocated just once and
+       reused for every iteration */
+    ConcatenateLayout layout = MeshTools::concatenateLayout(meshes);
+    Containers::Array<char> indexData{NoInit, layout.indexDataSize()};
+    Containers::Array<char> vertexData{NoInit, layout.vertexDataSize()};
+
+    Trade::MeshData dst{MeshPrimitive::Triangles, 0};
+    CORRADE_BENCHMARK(1) {
+        dst = MeshTools::concatenateInto(layout, meshes, indexData, vertexData, data.threadCount);
+    }
+
+    Trade::MeshData expected = MeshTools::concatenate(meshes);
+    CORRADE_VERIFY(std::memcmp(dst.vertexData().data(), expected.vertexData().data(), expected.vertexData().size()) == 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ConcatenateTest)
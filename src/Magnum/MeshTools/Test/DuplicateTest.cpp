@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -33,6 +35,7 @@
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Test/multipleThreadsData.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
@@ -52,6 +55,11 @@ struct DuplicateTest: TestSuite::Tester {
     template<class T> void duplicateIntoErased();
     void duplicateIntoErasedWrongTypeSize();
     void duplicateIntoErasedNonContiguous();
+    void duplicateIntoErasedTypeSize();
+
+    template<class T> void duplicateIntoMultipleThreads();
+    void duplicateIntoMultipleThreadsErased();
+    void duplicateIntoMultipleThreadsOutOfRange();
 
     template<class T> void duplicateErasedIndicesIntoErased();
     void duplicateErasedIndicesIntoErasedNonContiguous();
@@ -67,6 +75,47 @@ struct DuplicateTest: TestSuite::Tester {
     void duplicateMeshDataExtraOffsetOnly();
     void duplicateMeshDataExtraImplementationSpecificVertexFormat();
     void duplicateMeshDataNoAttributes();
+
+    void benchmarkGenericLoop();
+    void benchmarkDuplicateInto();
+};
+
+const struct {
+    const char* name;
+    std::size_t typeSize;
+} TypeSizeData[] {
+    {"1 byte", 1},
+    {"2 bytes", 2},
+    {"3 bytes", 3},
+    {"4 bytes", 4},
+    {"6 bytes", 6},
+    {"8 bytes", 8},
+    {"12 bytes", 12},
+    {"16 bytes", 16},
+    {"24 bytes", 24},
+    {"32 bytes", 32},
+    {"64 bytes", 64}
+};
+
+const struct {
+    const char* name;
+    std::size_t typeSize;
+    UnsignedInt threadCount;
+} BenchmarkData[] {
+    {"4 bytes, 1 thread", 4, 1},
+    {"12 bytes, 1 thread", 12, 1},
+    {"24 bytes, 1 thread", 24, 1},
+    {"12 bytes, 4 threads", 12, 4},
+    {"12 bytes, hardware concurrency", 12, 0}
+};
+
+const struct {
+    const char* name;
+    std::size_t typeSize;
+} BenchmarkGenericLoopData[] {
+    {"4 bytes", 4},
+    {"12 bytes", 12},
+    {"24 bytes", 24}
 };
 
 DuplicateTest::DuplicateTest() {
@@ -83,7 +132,17 @@ DuplicateTest::DuplicateTest() {
               &DuplicateTest::duplicateIntoErased<UnsignedShort>,
               &DuplicateTest::duplicateIntoErased<UnsignedInt>,
               &DuplicateTest::duplicateIntoErasedWrongTypeSize,
-              &DuplicateTest::duplicateIntoErasedNonContiguous,
+              &DuplicateTest::duplicateIntoErasedNonContiguous});
+
+    addInstancedTests({&DuplicateTest::duplicateIntoErasedTypeSize},
+        Containers::arraySize(TypeSizeData));
+
+    addInstancedTests({&DuplicateTest::duplicateIntoMultipleThreads<UnsignedShort>,
+                       &DuplicateTest::duplicateIntoMultipleThreads<UnsignedInt>,
+                       &DuplicateTest::duplicateIntoMultipleThreadsErased},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({&DuplicateTest::duplicateIntoMultipleThreadsOutOfRange,
 
               &DuplicateTest::duplicateErasedIndicesIntoErased<UnsignedByte>,
               &DuplicateTest::duplicateErasedIndicesIntoErased<UnsignedShort>,
@@ -103,6 +162,28 @@ DuplicateTest::DuplicateTest() {
               &DuplicateTest::duplicateMeshDataExtraOffsetOnly,
               &DuplicateTest::duplicateMeshDataExtraImplementationSpecificVertexFormat,
               &DuplicateTest::duplicateMeshDataNoAttributes});
+
+    addInstancedBenchmarks({&DuplicateTest::benchmarkGenericLoop}, 10,
+        Containers::arraySize(BenchmarkGenericLoopData));
+
+    addInstancedBenchmarks({&DuplicateTest::benchmarkDuplicateInto}, 10,
+        Containers::arraySize(BenchmarkData));
+}
+
+/* Data with every byte of every item different, indices scattered over the
+   whole range with every item referenced a few times */
+Containers::Array<char> typeSizeData(const std::size_t count, const std::size_t typeSize) {
+    Containers::Array<char> data{NoInit, count*typeSize};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = char(i*7 + i/typeSize);
+    return data;
+}
+
+template<class T> Containers::Array<T> scatteredIndices(const std::size_t count, const std::size_t vertexCount) {
+    Containers::Array<T> indices{NoInit, count};
+    for(std::size_t i = 0; i != count; ++i)
+        indices[i] = T((i*7919) % vertexCount);
+    return indices;
 }
 
 void DuplicateTest::duplicate() {
@@ -220,6 +301,92 @@ void DuplicateTest::duplicateIntoErasedNonContiguous() {
         "MeshTools::duplicateInto(): second output view dimension is not contiguous\n");
 }
 
+void DuplicateTest::duplicateIntoErasedTypeSize() {
+    auto&& data = TypeSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Enough items to have non-trivial index patterns, output with a padded
+       stride to verify that's respected by the specialized code paths */
+    Containers::Array<char> input = typeSizeData(37, data.typeSize);
+    Containers::Array<UnsignedInt> indices = scatteredIndices<UnsignedInt>(100, 37);
+    const std::size_t outputStride = data.typeSize + 5;
+    Containers::Array<char> output{DirectInit, indices.size()*outputStride, '\xcd'};
+
+    MeshTools::duplicateInto(indices,
+        Containers::StridedArrayView2D<const char>{input, {37, data.typeSize}},
+        Containers::StridedArrayView2D<char>{output, {indices.size(), data.typeSize}, {std::ptrdiff_t(outputStride), 1}});
+
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(std::memcmp(output.data() + i*outputStride, input.data() + indices[i]*data.typeSize, data.typeSize) == 0);
+        /* The padding is left untouched */
+        for(std::size_t j = data.typeSize; j != outputStride; ++j)
+            CORRADE_COMPARE(output[i*outputStride + j], '\xcd');
+    }
+}
+
+template<class T> void DuplicateTest::duplicateIntoMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 131072 items, enough for seven threads */
+    Containers::Array<char> input = typeSizeData(1000, 12);
+    Containers::Array<T> indices = scatteredIndices<T>(131072, 1000);
+    const Containers::StridedArrayView2D<const char> inputView{input, {1000, 12}};
+
+    Containers::Array<char> expected{NoInit, indices.size()*12};
+    MeshTools::duplicateInto(Containers::stridedArrayView(indices), inputView,
+        Containers::StridedArrayView2D<char>{expected, {indices.size(), 12}});
+
+    Containers::Array<char> output{NoInit, indices.size()*12};
+    MeshTools::duplicateInto(Containers::stridedArrayView(indices), inputView,
+        Containers::StridedArrayView2D<char>{output, {indices.size(), 12}},
+        data.threadCount);
+    CORRADE_VERIFY(std::memcmp(output.data(), expected.data(), output.size()) == 0);
+}
+
+void DuplicateTest::duplicateIntoMultipleThreadsErased() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> input = typeSizeData(1000, 24);
+    Containers::Array<UnsignedInt> indices = scatteredIndices<UnsignedInt>(131072, 1000);
+    const Containers::StridedArrayView2D<const char> inputView{input, {1000, 24}};
+
+    Containers::Array<char> expected{NoInit, indices.size()*24};
+    MeshTools::duplicateInto(Containers::stridedArrayView(indices), inputView,
+        Containers::StridedArrayView2D<char>{expected, {indices.size(), 24}});
+
+    Containers::Array<char> output{NoInit, indices.size()*24};
+    MeshTools::duplicateInto(
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)),
+        inputView,
+        Containers::StridedArrayView2D<char>{output, {indices.size(), 24}},
+        data.threadCount);
+    CORRADE_VERIFY(std::memcmp(output.data(), expected.data(), output.size()) == 0);
+}
+
+void DuplicateTest::duplicateIntoMultipleThreadsOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* Enough items for four threads, the invalid indices are in the second
+       and third chunk and the first of them should be reported */
+    Containers::Array<UnsignedInt> indices{ValueInit, 65536};
+    indices[20000] = 2;
+    indices[40000] = 3;
+    const Int data[2]{};
+    Containers::Array<Int> output{NoInit, indices.size()};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::duplicateInto(Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(data)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(output)),
+        4);
+    CORRADE_COMPARE(out, "MeshTools::duplicateInto(): index 2 out of range for 2 elements\n");
+}
+
 template<class T> void DuplicateTest::duplicateErasedIndicesIntoErased() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -494,6 +661,51 @@ void DuplicateTest::duplicateMeshDataNoAttributes() {
     CORRADE_VERIFY(!duplicated.vertexData());
 }
 
+void DuplicateTest::benchmarkGenericLoop() {
+    auto&& data = BenchmarkGenericLoopData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A million indices into a quarter million vertices */
+    Containers::Array<char> input = typeSizeData(262144, data.typeSize);
+    Containers::Array<UnsignedInt> indices = scatteredIndices<UnsignedInt>(1048576, 262144);
+    const Containers::StridedArrayView2D<const char> inputView{input, {262144, data.typeSize}};
+
+    /* A plain per-item memcpy() with the size known only at runtime, for
+       comparison with the specialized code paths. Always single-threaded. */
+    Containers::Array<char> output{NoInit, indices.size()*data.typeSize};
+    const Containers::StridedArrayView2D<char> outputView{output, {indices.size(), data.typeSize}};
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            std::memcpy(outputView[i].data(), inputView[indices[i]].data(), data.typeSize);
+    }
+
+    Containers::Array<char> expected{NoInit, indices.size()*data.typeSize};
+    MeshTools::duplicateInto(indices, inputView,
+        Containers::StridedArrayView2D<char>{expected, {indices.size(), data.typeSize}});
+    CORRADE_VERIFY(std::memcmp(output.data(), expected.data(), output.size()) == 0);
+}
+
+void DuplicateTest::benchmarkDuplicateInto() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> input = typeSizeData(262144, data.typeSize);
+    Containers::Array<UnsignedInt> indices = scatteredIndices<UnsignedInt>(1048576, 262144);
+    const Containers::StridedArrayView2D<const char> inputView{input, {262144, data.typeSize}};
+
+    Containers::Array<char> expected{NoInit, indices.size()*data.typeSize};
+    MeshTools::duplicateInto(indices, inputView,
+        Containers::StridedArrayView2D<char>{expected, {indices.size(), data.typeSize}});
+
+    Containers::Array<char> output{NoInit, indices.size()*data.typeSize};
+    const Containers::StridedArrayView2D<char> outputView{output, {indices.size(), data.typeSize}};
+    CORRADE_BENCHMARK(1) {
+        MeshTools::duplicateInto(indices, inputView, outputView, data.threadCount);
+    }
+
+    CORRADE_VERIFY(std::memcmp(output.data(), expected.data(), output.size()) == 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::DuplicateTest)
@@ -0,0 +1,739 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <cstring>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Encode.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct EncodeTest: TestSuite::Tester {
+    explicit EncodeTest();
+
+    void indicesEncoding();
+    template<class T> void indices();
+    void indicesDifferentType();
+    void indicesIncompleteTriangle();
+    void indicesEmpty();
+    void indicesErased();
+    void indicesErasedNotContiguous();
+    void indicesErasedWrongIndexSize();
+    void indicesMeshData();
+    void indicesMeshDataNotIndexed();
+    void indicesMeshDataNotMutable();
+    void indicesMeshDataImplementationSpecificIndexType();
+    void decodeIndicesInvalid();
+
+    void verticesEncoding();
+    void vertices();
+    void verticesStrided();
+    void verticesEmpty();
+    void verticesInvalidComponentSize();
+    void verticesNotContiguous();
+    void verticesMeshData();
+    void verticesMeshDataComponentSizes();
+    void verticesMeshDataNotInterleaved();
+    void verticesMeshDataNotMutable();
+    void verticesMeshDataImplementationSpecificVertexFormat();
+    void decodeVerticesInvalid();
+
+    void benchmarkIndices();
+    void benchmarkVertices();
+
+    void ratioBenchmarkBegin();
+    std::uint64_t ratioBenchmarkEnd();
+    void throughputBenchmarkBegin();
+    std::uint64_t throughputBenchmarkEnd();
+
+    private:
+        std::size_t _originalSize, _encodedSize;
+        std::chrono::high_resolution_clock::time_point _begin;
+};
+
+using namespace Containers::Literals;
+
+const struct {
+    const char* name;
+    MeshPrimitive primitive;
+} IndicesData[]{
+    {"triangles", MeshPrimitive::Triangles},
+    {"triangle strip", MeshPrimitive::TriangleStrip},
+    {"lines", MeshPrimitive::Lines},
+};
+
+const struct {
+    const char* name;
+    Containers::StringView data;
+    const char* message;
+} DecodeIndicesInvalidData[]{
+    {"empty", ""_s,
+        "invalid header"},
+    {"vertex data", "\x20\x03\x00\x02\x04"_s,
+        "invalid header"},
+    {"count not fitting into 32 bits", "\x11\xff\xff\xff\xff\x1f"_s,
+        "invalid header"},
+    {"count truncated", "\x11\x83"_s,
+        "invalid header"},
+    {"count mismatch", "\x11\x04\x00\x02\x04\x00"_s,
+        "encoded data contain 4 indices but the output has 3"},
+    {"triangle truncated", "\x11\x03\x00\x02"_s,
+        "data truncated or corrupted"},
+    {"index truncated", "\x10\x03\x00\x02\x82"_s,
+        "data truncated or corrupted"},
+    {"trailing data", "\x11\x03\x00\x02\x04\x00\x00"_s,
+        "unexpected 2 bytes after the encoded data"},
+    {"index not fitting into the type", "\x10\x03\x00\x02\x80\x80\x08"_s,
+        "decoded index 65537 doesn't fit into a 16-bit type"},
+};
+
+const struct {
+    const char* name;
+    Containers::StringView data;
+    const char* message;
+} DecodeVerticesInvalidData[]{
+    {"empty", ""_s,
+        "invalid header"},
+    {"index data", "\x11\x02\x01\x04\x00\x00\x00\x00"_s,
+        "invalid header"},
+    {"component count out of bounds", "\x20\x02\x05\x04"_s,
+        "invalid header"},
+    {"invalid component size", "\x20\x02\x02\x03\x01\x00\x00\x00\x00"_s,
+        "invalid header"},
+    {"count mismatch", "\x20\x03\x01\x04\x00\x00\x00\x00"_s,
+        "encoded data contain 3 vertices of 4 bytes but the output has 2 vertices of 4 bytes"},
+    {"size mismatch", "\x20\x02\x02\x02\x01\x00\x00\x00"_s,
+        "encoded data contain 2 vertices of 3 bytes but the output has 2 vertices of 4 bytes"},
+    {"plane header truncated", "\x20\x02\x01\x04\x00\x00\x00"_s,
+        "data truncated or corrupted"},
+    {"plane data truncated", "\x20\x02\x01\x04\x00\x00\x00\x03\x00\x00"_s,
+        "data truncated or corrupted"},
+    {"trailing data", "\x20\x02\x01\x04\x00\x00\x00\x00\x00"_s,
+        "unexpected 1 bytes after the encoded data"},
+};
+
+const struct {
+    const char* name;
+    Trade::MeshData(*mesh)();
+} BenchmarkData[]{
+    {"icosphere", []() {
+        return Primitives::icosphereSolid(6);
+    }},
+    {"grid with texture coordinates", []() {
+        return Primitives::grid3DSolid({511, 511}, Primitives::GridFlag::Normals|Primitives::GridFlag::TextureCoordinates);
+    }},
+};
+
+EncodeTest::EncodeTest() {
+    addTests({&EncodeTest::indicesEncoding});
+
+    addInstancedTests<EncodeTest>({
+        &EncodeTest::indices<UnsignedByte>,
+        &EncodeTest::indices<UnsignedShort>,
+        &EncodeTest::indices<UnsignedInt>},
+        Containers::arraySize(IndicesData));
+
+    addTests({&EncodeTest::indicesDifferentType,
+              &EncodeTest::indicesIncompleteTriangle,
+              &EncodeTest::indicesEmpty,
+              &EncodeTest::indicesErased,
+              &EncodeTest::indicesErasedNotContiguous,
+              &EncodeTest::indicesErasedWrongIndexSize,
+              &EncodeTest::indicesMeshData,
+              &EncodeTest::indicesMeshDataNotIndexed,
+              &EncodeTest::indicesMeshDataNotMutable,
+              &EncodeTest::indicesMeshDataImplementationSpecificIndexType});
+
+    addInstancedTests({&EncodeTest::decodeIndicesInvalid},
+        Containers::arraySize(DecodeIndicesInvalidData));
+
+    addTests({&EncodeTest::verticesEncoding,
+              &EncodeTest::vertices,
+              &EncodeTest::verticesStrided,
+              &EncodeTest::verticesEmpty,
+              &EncodeTest::verticesInvalidComponentSize,
+              &EncodeTest::verticesNotContiguous,
+              &EncodeTest::verticesMeshData,
+              &EncodeTest::verticesMeshDataComponentSizes,
+              &EncodeTest::verticesMeshDataNotInterleaved,
+              &EncodeTest::verticesMeshDataNotMutable,
+              &EncodeTest::verticesMeshDataImplementationSpecificVertexFormat});
+
+    addInstancedTests({&EncodeTest::decodeVerticesInvalid},
+        Containers::arraySize(DecodeVerticesInvalidData));
+
+    addCustomInstancedBenchmarks({&EncodeTest::benchmarkIndices,
+                                  &EncodeTest::benchmarkVertices}, 1,
+        Containers::arraySize(BenchmarkData),
+        &EncodeTest::ratioBenchmarkBegin,
+        &EncodeTest::ratioBenchmarkEnd,
+        BenchmarkUnits::PercentageThousandths);
+
+    /* Run the benchmarks again but with decoding throughput instead of the
+       compression ratio */
+    addCustomInstancedBenchmarks({&EncodeTest::benchmarkIndices,
+                                  &EncodeTest::benchmarkVertices}, 5,
+        Containers::arraySize(BenchmarkData),
+        &EncodeTest::throughputBenchmarkBegin,
+        &EncodeTest::throughputBenchmarkEnd,
+        BenchmarkUnits::Bytes);
+}
+
+template<class> struct NameTraits;
+#define _c(type) template<> struct NameTraits<type> {                       \
+    static const char* name() { return #type; }                            \
+};
+_c(UnsignedByte)
+_c(UnsignedShort)
+_c(UnsignedInt)
+#undef _c
+
+void EncodeTest::indicesEncoding() {
+    /* To ensure the format doesn't change accidentally. First index of a
+       triangle is relative to the first index of the previous triangle, the
+       others relative to the first, all zigzag-encoded. */
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 300};
+    Containers::Array<char> encoded = encodeIndices(indices, MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(encoded, Containers::arrayView<char>({
+        '\x11', '\x06', '\x00', '\x02', '\x04', '\x04', '\x01', '\xd4',
+        '\x04'
+    }), TestSuite::Compare::Container);
+
+    /* Otherwise each index is relative to the previous */
+    encoded = encodeIndices(indices, MeshPrimitive::Points);
+    CORRADE_COMPARE_AS(encoded, Containers::arrayView<char>({
+        '\x10', '\x06', '\x00', '\x02', '\x02', '\x00', '\x01', '\xd6',
+        '\x04'
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void EncodeTest::indices() {
+    auto&& data = IndicesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    /* A 15x15 vertex grid, with indices going both forward and backward.
+       The max index fits into 8 bits. */
+    Containers::Array<T> indices;
+    for(UnsignedInt y = 0; y != 14; ++y) {
+        for(UnsignedInt x = 0; x != 14; ++x) {
+            const T i = T(y*15 + x);
+            arrayAppend(indices, {i, T(i + 1), T(i + 15),
+                                  T(i + 1), T(i + 16), T(i + 15)});
+        }
+    }
+
+    /* All differences are small enough to fit into a single byte, plus
+       there's one byte for the encoding and two for the count */
+    Containers::Array<char> encoded = encodeIndices(indices, data.primitive);
+    CORRADE_COMPARE(encoded.size(), 3 + indices.size());
+
+    Containers::Array<T> decoded{NoInit, indices.size()};
+    CORRADE_VERIFY(decodeIndicesInto(encoded, decoded));
+    CORRADE_COMPARE_AS(decoded, indices,
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indicesDifferentType() {
+    /* The type isn't stored, so it's possible to decode to a larger type or
+       a smaller type if the values fit */
+    const UnsignedShort indices[]{3, 65535, 0, 12, 15, 11};
+    Containers::Array<char> encoded = encodeIndices(indices);
+
+    UnsignedInt decoded[6];
+    CORRADE_VERIFY(decodeIndicesInto(encoded, decoded));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView<UnsignedInt>({3, 65535, 0, 12, 15, 11}),
+        TestSuite::Compare::Container);
+
+    const UnsignedInt smallIndices[]{3, 255, 0, 12, 15, 11};
+    encoded = encodeIndices(smallIndices);
+
+    UnsignedByte decodedSmall[6];
+    CORRADE_VERIFY(decodeIndicesInto(encoded, decodedSmall));
+    CORRADE_COMPARE_AS(Containers::arrayView(decodedSmall),
+        Containers::arrayView<UnsignedByte>({3, 255, 0, 12, 15, 11}),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indicesIncompleteTriangle() {
+    /* The last two indices don't form a whole triangle and are encoded
+       relative to the previous index */
+    const UnsignedInt indices[]{7, 5, 6, 4, 0xffffffffu};
+    Containers::Array<char> encoded = encodeIndices(indices);
+
+    UnsignedInt decoded[5];
+    CORRADE_VERIFY(decodeIndicesInto(encoded, decoded));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indicesEmpty() {
+    Containers::Array<char> encoded = encodeIndices(Containers::StridedArrayView1D<const UnsignedInt>{});
+    CORRADE_COMPARE_AS(encoded, Containers::arrayView<char>({
+        '\x11', '\x00'
+    }), TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(decodeIndicesInto(encoded, Containers::StridedArrayView1D<UnsignedInt>{}));
+}
+
+void EncodeTest::indicesErased() {
+    const UnsignedShort indices[]{3, 4, 2, 0, 17, 5};
+    Containers::Array<char> encoded = encodeIndices(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)));
+    Containers::Array<char> expected = encodeIndices(indices);
+    CORRADE_COMPARE_AS(encoded, expected,
+        TestSuite::Compare::Container);
+
+    UnsignedShort decoded[6];
+    CORRADE_VERIFY(decodeIndicesInto(encoded, Containers::arrayCast<2, char>(Containers::stridedArrayView(decoded))));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indicesErasedNotContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+    Containers::StridedArrayView2D<char> view{indices, {6, 2}, {4, 2}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeIndices(view);
+    decodeIndicesInto(nullptr, view);
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeIndices(): second index view dimension is not contiguous\n"
+        "MeshTools::decodeIndicesInto(): second index view dimension is not contiguous\n");
+}
+
+void EncodeTest::indicesErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+    Containers::StridedArrayView2D<char> view{indices, {6, 3}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeIndices(view);
+    decodeIndicesInto(nullptr, view);
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeIndices(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::decodeIndicesInto(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void EncodeTest::indicesMeshData() {
+    const Trade::MeshData mesh = Primitives::icosphereSolid(2);
+    Containers::Array<char> encodedIndices = encodeIndices(mesh);
+    Containers::Array<char> encodedVertices = encodeVertices(mesh);
+
+    /* Decode into a mesh with the same layout but cleared data */
+    Trade::MeshData decoded = copy(mesh);
+    std::memset(decoded.mutableIndexData().data(), 0, decoded.mutableIndexData().size());
+    std::memset(decoded.mutableVertexData().data(), 0, decoded.mutableVertexData().size());
+    CORRADE_VERIFY(decodeIndicesInto(encodedIndices, decoded));
+    CORRADE_VERIFY(decodeVerticesInto(encodedVertices, decoded));
+    CORRADE_COMPARE_AS(decoded.indexData(), mesh.indexData(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(decoded.vertexData(), mesh.vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::indicesMeshDataNotIndexed() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeIndices(mesh);
+    decodeIndicesInto(nullptr, mesh);
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeIndices(): mesh data not indexed\n"
+        "MeshTools::decodeIndicesInto(): mesh data not indexed\n");
+}
+
+void EncodeTest::indicesMeshDataNotMutable() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedShort indices[3]{};
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    decodeIndicesInto(nullptr, mesh);
+    CORRADE_COMPARE(out, "MeshTools::decodeIndicesInto(): index data not mutable\n");
+}
+
+void EncodeTest::indicesMeshDataImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        Trade::DataFlag::Mutable, nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeIndices(mesh);
+    decodeIndicesInto(nullptr, mesh);
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeIndices(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::decodeIndicesInto(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+void EncodeTest::decodeIndicesInvalid() {
+    auto&& data = DecodeIndicesInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    UnsignedShort decoded[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!decodeIndicesInto(data.data, decoded));
+    CORRADE_COMPARE(out, Utility::format("MeshTools::decodeIndicesInto(): {}\n", data.message));
+}
+
+void EncodeTest::verticesEncoding() {
+    /* To ensure the format doesn't change accidentally. Deltas are 1 and 2,
+       zigzag-encoded to 2 and 4, which fit into four bits. */
+    const UnsignedByte vertices[]{1, 3};
+    Containers::Array<char> encoded = encodeVertices(Containers::arrayCast<2, const char>(Containers::stridedArrayView(vertices)), {1});
+    CORRADE_COMPARE_AS(encoded, Containers::arrayView<char>({
+        /* Encoding, vertex count, component count and sizes */
+        '\x20', '\x02', '\x01', '\x01',
+        /* One group with four bits per byte */
+        '\x02',
+        '\x42', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+}
+
+struct Vertex {
+    Vector3 position;
+    Color4ub color;
+    Vector2us textureCoordinates;
+    UnsignedShort padding;
+    /* Two bytes of implicit padding */
+    Double weight;
+};
+
+Containers::Array<Vertex> generateVertices() {
+    /* 1000 vertices, so there's three full blocks and one partial, and a
+       variety of value ranges */
+    Containers::Array<Vertex> vertices{ValueInit, 1000};
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        vertices[i].position = {Float(i%37)*0.25f, -Float(i/37)*1.5f, Float(i)};
+        vertices[i].color = {UnsignedByte(i*7), 255, 0, UnsignedByte(i)};
+        vertices[i].textureCoordinates = {UnsignedShort(i*100), UnsignedShort(65535 - i)};
+        vertices[i].padding = 0xcece;
+        vertices[i].weight = i%2 ? 1.0/Double(i) : -Double(i);
+    }
+    return vertices;
+}
+
+constexpr UnsignedInt VertexComponentSizes[]{4, 4, 4, 1, 1, 1, 1, 2, 2, 2, 2, 8};
+
+void EncodeTest::vertices() {
+    Containers::Array<Vertex> vertices = generateVertices();
+    Containers::Array<char> encoded = encodeVertices(Containers::arrayCast<2, const char>(Containers::stridedArrayView(vertices)), VertexComponentSizes);
+    CORRADE_COMPARE_AS(encoded.size(), vertices.size()*sizeof(Vertex),
+        TestSuite::Compare::Less);
+
+    Containers::Array<Vertex> decoded{ValueInit, vertices.size()};
+    CORRADE_VERIFY(decodeVerticesInto(encoded, Containers::arrayCast<2, char>(Containers::stridedArrayView(decoded))));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const char>(Containers::arrayView(decoded)),
+        Containers::arrayCast<const char>(Containers::arrayView(vertices)),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::verticesStrided() {
+    /* Encode just the position and color, decode to a view with a different
+       stride */
+    Containers::Array<Vertex> vertices = generateVertices();
+    const Containers::StridedArrayView2D<const char> view = Containers::arrayCast<2, const char>(Containers::stridedArrayView(vertices)).sliceSize({0, 0}, {vertices.size(), 16});
+    Containers::Array<char> encoded = encodeVertices(view, {4, 4, 4, 1, 1, 1, 1});
+
+    Containers::Array<char> decoded{DirectInit, vertices.size()*20, '\xcd'};
+    Containers::StridedArrayView2D<char> decodedView{decoded, {vertices.size(), 16}, {20, 1}};
+    CORRADE_VERIFY(decodeVerticesInto(encoded, decodedView));
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(decodedView[i], view[i],
+            TestSuite::Compare::Container);
+        /* The gaps stay untouched */
+        CORRADE_COMPARE(decoded[i*20 + 16], '\xcd');
+        CORRADE_COMPARE(decoded[i*20 + 19], '\xcd');
+    }
+}
+
+void EncodeTest::verticesEmpty() {
+    Containers::Array<char> encoded = encodeVertices(Containers::StridedArrayView2D<const char>{nullptr, {0, 4}}, {4});
+    CORRADE_COMPARE_AS(encoded, Containers::arrayView<char>({
+        '\x20', '\x00', '\x01', '\x04'
+    }), TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(decodeVerticesInto(encoded, Containers::StridedArrayView2D<char>{nullptr, {0, 4}}));
+}
+
+void EncodeTest::verticesInvalidComponentSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char vertices[2*12]{};
+    Containers::StridedArrayView2D<const char> view{vertices, {2, 12}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeVertices(view, {4, 4, 3, 1});
+    encodeVertices(view, {4, 4, 2});
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeVertices(): expected component size 1, 2, 4 or 8 but got 3\n"
+        "MeshTools::encodeVertices(): component sizes sum up to 10 bytes but the vertex size is 12\n");
+}
+
+void EncodeTest::verticesNotContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char vertices[2*12]{};
+    Containers::StridedArrayView2D<char> view{vertices, {2, 6}, {12, 2}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeVertices(view, {2, 2, 2});
+    decodeVerticesInto(nullptr, view);
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeVertices(): second vertex view dimension is not contiguous\n"
+        "MeshTools::decodeVerticesInto(): second vertex view dimension is not contiguous\n");
+}
+
+void EncodeTest::verticesMeshData() {
+    const Trade::MeshData mesh = Primitives::grid3DSolid({15, 15}, Primitives::GridFlag::Normals|Primitives::GridFlag::Tangents|Primitives::GridFlag::TextureCoordinates);
+    Containers::Array<char> encoded = encodeVertices(mesh);
+    CORRADE_COMPARE_AS(encoded.size(), mesh.vertexData().size(),
+        TestSuite::Compare::Less);
+
+    Trade::MeshData decoded = copy(mesh);
+    std::memset(decoded.mutableVertexData().data(), 0, decoded.mutableVertexData().size());
+    CORRADE_VERIFY(decodeVerticesInto(encoded, decoded));
+    CORRADE_COMPARE_AS(decoded.vertexData(), mesh.vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::verticesMeshDataComponentSizes() {
+    /* Offset by eight bytes to verify the component sizes are calculated
+       relative to the first attribute */
+    Containers::Array<char> vertexData{ValueInit, 8 + 3*sizeof(Vertex)};
+    const Containers::StridedArrayView1D<Vertex> vertices = Containers::arrayCast<Vertex>(vertexData.exceptPrefix(8));
+    const Containers::Array<Vertex> source = generateVertices();
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i] = source[i];
+
+    Trade::MeshData mesh{MeshPrimitive::Points, Utility::move(vertexData), {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color,
+            VertexFormat::Vector4ubNormalized, vertices.slice(&Vertex::color)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            VertexFormat::Vector2usNormalized, vertices.slice(&Vertex::textureCoordinates)},
+        /* The padding isn't covered by any attribute, neither is the
+           implicit padding before the double */
+        Trade::MeshAttributeData{Trade::meshAttributeCustom(0),
+            VertexFormat::Double, vertices.slice(&Vertex::weight)},
+    }};
+
+    Containers::Array<char> encoded = encodeVertices(mesh);
+    CORRADE_COMPARE_AS(encoded.prefix(17), Containers::arrayView<char>({
+        /* Encoding, vertex count, component count */
+        '\x20', '\x03', '\x0e',
+        /* Position */
+        '\x04', '\x04', '\x04',
+        /* Color */
+        '\x01', '\x01', '\x01', '\x01',
+        /* Texture coordinates */
+        '\x02', '\x02',
+        /* Padding */
+        '\x01', '\x01', '\x01', '\x01',
+        /* Custom attribute */
+        '\x08'
+    }), TestSuite::Compare::Container);
+
+    /* The one-byte padding components get decoded the same as anything
+       else */
+    Trade::MeshData decoded = copy(mesh);
+    std::memset(decoded.mutableVertexData().data(), 0, decoded.mutableVertexData().size());
+    CORRADE_VERIFY(decodeVerticesInto(encoded, decoded));
+    CORRADE_COMPARE_AS(decoded.vertexData(), mesh.vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::verticesMeshDataNotInterleaved() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct {
+        Vector3 positions[3];
+        Vector2 textureCoordinates[3];
+    } vertexData{};
+    Trade::MeshData mesh{MeshPrimitive::Points, Trade::DataFlag::Mutable, Containers::ArrayView<const void>{&vertexData, sizeof(vertexData)}, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(vertexData.positions)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            Containers::arrayView(vertexData.textureCoordinates)},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeVertices(mesh);
+    decodeVerticesInto(nullptr, mesh);
+    CORRADE_COMPARE(out,
+        "MeshTools::encodeVertices(): the mesh is not interleaved\n"
+        "MeshTools::decodeVerticesInto(): the mesh is not interleaved\n");
+}
+
+void EncodeTest::verticesMeshDataNotMutable() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    decodeVerticesInto(nullptr, mesh);
+    CORRADE_COMPARE(out, "MeshTools::decodeVerticesInto(): vertex data not mutable\n");
+}
+
+void EncodeTest::verticesMeshDataImplementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct ObjectVertex {
+        Vector3 position;
+        UnsignedInt objectId;
+    } vertexData[3]{};
+    const Containers::StridedArrayView1D<const ObjectVertex> vertices = vertexData;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, vertexData, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&ObjectVertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId,
+            vertexFormatWrap(0xcaca), vertices.slice(&ObjectVertex::objectId)},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    encodeVertices(mesh);
+    CORRADE_COMPARE(out, "MeshTools::encodeVertices(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+void EncodeTest::decodeVerticesInvalid() {
+    auto&& data = DecodeVerticesInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    UnsignedInt decoded[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!decodeVerticesInto(data.data, Containers::arrayCast<2, char>(Containers::stridedArrayView(decoded))));
+    CORRADE_COMPARE(out, Utility::format("MeshTools::decodeVerticesInto(): {}\n", data.message));
+}
+
+void EncodeTest::benchmarkIndices() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = data.mesh();
+    const Containers::Array<char> encoded = encodeIndices(mesh);
+    Containers::Array<char> decoded{NoInit, mesh.indexData().size()};
+    const Containers::StridedArrayView2D<char> decodedView{decoded, {mesh.indexCount(), meshIndexTypeSize(mesh.indexType())}};
+
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(decodeIndicesInto(encoded, decodedView));
+        _originalSize = decoded.size();
+        _encodedSize = encoded.size();
+    }
+
+    CORRADE_COMPARE_AS(Containers::arrayView<const char>(decoded), mesh.indexData(),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::benchmarkVertices() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = data.mesh();
+    const Containers::Array<char> encoded = encodeVertices(mesh);
+    Trade::MeshData decoded = copy(mesh);
+
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(decodeVerticesInto(encoded, decoded));
+        _originalSize = decoded.vertexData().size();
+        _encodedSize = encoded.size();
+    }
+
+    CORRADE_COMPARE_AS(decoded.vertexData(), mesh.vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::ratioBenchmarkBegin() {
+    setBenchmarkName("encoded size");
+    _originalSize = 0;
+    _encodedSize = 0;
+}
+
+std::uint64_t EncodeTest::ratioBenchmarkEnd() {
+    /* If the test failed, exit early as continuing would cause a division by
+       zero */
+    if(!_originalSize) return {};
+
+    return _encodedSize*100000ull/_originalSize;
+}
+
+void EncodeTest::throughputBenchmarkBegin() {
+    setBenchmarkName("decoded bytes per second");
+    _originalSize = 0;
+    _begin = std::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t EncodeTest::throughputBenchmarkEnd() {
+    const std::uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _begin).count();
+    if(!duration) return {};
+
+    return _originalSize*1000000000ull/duration;
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::EncodeTest)
@@ -0,0 +1,361 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/FindInstances.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct FindInstancesTest: TestSuite::Tester {
+    explicit FindInstancesTest();
+
+    void rigid();
+    void many();
+    void farFromOrigin();
+    void scaled();
+    void mirrored();
+    void differentAttribute();
+    void differentVertexOrder();
+    void differentLayout();
+    void notTransformable();
+    void empty();
+
+    void implementationSpecificIndexType();
+    void implementationSpecificVertexFormat();
+
+    void benchmark();
+};
+
+FindInstancesTest::FindInstancesTest() {
+    addTests({&FindInstancesTest::rigid,
+              &FindInstancesTest::many,
+              &FindInstancesTest::farFromOrigin,
+              &FindInstancesTest::scaled,
+              &FindInstancesTest::mirrored,
+              &FindInstancesTest::differentAttribute,
+              &FindInstancesTest::differentVertexOrder,
+              &FindInstancesTest::differentLayout,
+              &FindInstancesTest::notTransformable,
+              &FindInstancesTest::empty,
+
+              &FindInstancesTest::implementationSpecificIndexType,
+              &FindInstancesTest::implementationSpecificVertexFormat});
+
+    addBenchmarks({&FindInstancesTest::benchmark}, 5);
+}
+
+using namespace Math::Literals;
+
+void FindInstancesTest::rigid() {
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Trade::MeshData sphere = Primitives::icosphereSolid(1);
+
+    const Matrix4 a = Matrix4::translation({5.0f, -2.0f, 3.0f})*Matrix4::rotation(35.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized());
+    const Matrix4 b = Matrix4::rotationZ(-120.0_degf)*Matrix4::translation({0.0f, 1.5f, 0.0f});
+    const Trade::MeshData cubeA = transform3D(cube, a);
+    const Trade::MeshData sphereB = transform3D(sphere, b);
+    const Trade::MeshData cubeB = transform3D(cube, b);
+
+    const MeshInstances instances = findInstances({cube, cubeA, sphereB, sphere, cubeB});
+
+    /* Unique meshes are the first occurrences, in order */
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+    CORRADE_COMPARE(instances.meshes[0].vertexCount(), cube.vertexCount());
+    CORRADE_COMPARE(instances.meshes[1].vertexCount(), sphere.vertexCount());
+    CORRADE_COMPARE_AS(instances.meshes[1].attribute<Vector3>(Trade::MeshAttribute::Position),
+        sphereB.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+
+    /* The meshes are owned copies */
+    CORRADE_COMPARE(instances.meshes[0].vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(instances.meshes[1].vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 0, 1, 1, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(instances.transformations.size(), 5);
+    CORRADE_COMPARE(instances.transformations[0], Matrix4{});
+    CORRADE_COMPARE(instances.transformations[1], a);
+    CORRADE_COMPARE(instances.transformations[2], Matrix4{});
+    CORRADE_COMPARE(instances.transformations[3], b.inverted());
+    CORRADE_COMPARE(instances.transformations[4], b);
+}
+
+void FindInstancesTest::many() {
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+
+    /* Interleaved copies of two meshes with different transformations */
+    Containers::Array<Trade::MeshData> meshes;
+    for(std::size_t i = 0; i != 100; ++i) {
+        const Matrix4 transformation =
+            Matrix4::translation({Float(i), Float(i % 7)*3.0f, -Float(i % 3)})*
+            Matrix4::rotation(Deg(Float(i)*17.0f), Vector3{Float(i % 5), 1.0f, Float(i % 2)}.normalized());
+        arrayAppend(meshes, transform3D(i % 3 ? cube : sphere, transformation));
+    }
+
+    const MeshInstances instances = findInstances(meshes);
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+    CORRADE_COMPARE(instances.meshes[0].vertexCount(), sphere.vertexCount());
+    CORRADE_COMPARE(instances.meshes[1].vertexCount(), cube.vertexCount());
+
+    /* Transforming the unique mesh gives back the input */
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(instances.meshIds[i], i % 3 ? 1 : 0);
+        const Trade::MeshData transformed = transform3D(instances.meshes[instances.meshIds[i]], instances.transformations[i]);
+        CORRADE_COMPARE_AS(transformed.attribute<Vector3>(Trade::MeshAttribute::Position),
+            meshes[i].attribute<Vector3>(Trade::MeshAttribute::Position),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(transformed.attribute<Vector3>(Trade::MeshAttribute::Normal),
+            meshes[i].attribute<Vector3>(Trade::MeshAttribute::Normal),
+            TestSuite::Compare::Container);
+    }
+}
+
+void FindInstancesTest::farFromOrigin() {
+    /* A mesh far from the origin loses precision in the pre-transformation,
+       which should be accounted for */
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Matrix4 a = Matrix4::translation({10000.0f, -5000.0f, 2000.0f})*Matrix4::rotationX(33.0_degf);
+    const Matrix4 b = Matrix4::translation({-7000.0f, 3000.0f, 100.0f})*Matrix4::rotationY(-71.0_degf);
+    const Trade::MeshData cubeA = transform3D(cube, a);
+    const Trade::MeshData cubeB = transform3D(cube, b);
+
+    const MeshInstances instances = findInstances({cubeA, cubeB});
+    CORRADE_COMPARE(instances.meshes.size(), 1);
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(instances.transformations[1].translation(), (b*a.inverted()).translation());
+}
+
+void FindInstancesTest::scaled() {
+    /* Scaling isn't a rigid transformation */
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Trade::MeshData cubeScaled = transform3D(cube, Matrix4::scaling(Vector3{2.0f}));
+
+    const MeshInstances instances = findInstances({cube, cubeScaled});
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(instances.transformations[1], Matrix4{});
+}
+
+void FindInstancesTest::mirrored() {
+    /* Reflections aren't considered, as they'd flip the face winding */
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Trade::MeshData cubeMirrored = transform3D(cube, Matrix4::scaling({-1.0f, 1.0f, 1.0f}));
+
+    const MeshInstances instances = findInstances({cube, cubeMirrored});
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 1}),
+        TestSuite::Compare::Container);
+}
+
+void FindInstancesTest::differentAttribute() {
+    /* Texture coordinates aren't affected by the transformation, so they have
+       to match exactly */
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } verticesA[]{
+        {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
+        {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f}},
+        {{0.0f, 1.0f, 0.0f}, {0.0f, 1.0f}},
+        {{0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}},
+    };
+    /* The same, just translated along X */
+    Vertex verticesB[Containers::arraySize(verticesA)];
+    Utility::copy(verticesA, verticesB);
+    for(Vertex& i: verticesB) i.position.x() += 3.0f;
+    /* Translated, and with different texture coordinates */
+    Vertex verticesC[Containers::arraySize(verticesA)];
+    Utility::copy(verticesB, verticesC);
+    verticesC[3].textureCoordinates = {0.5f, 0.5f};
+
+    const auto mesh = [](Containers::ArrayView<const Vertex> vertices) {
+        const Containers::StridedArrayView1D<const Vertex> view = vertices;
+        return Trade::MeshData{MeshPrimitive::Points, {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+        }};
+    };
+
+    const MeshInstances instances = findInstances({mesh(verticesA), mesh(verticesB), mesh(verticesC)});
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(instances.transformations[1], Matrix4::translation(Vector3::xAxis(3.0f)));
+    CORRADE_COMPARE(instances.transformations[2], Matrix4{});
+}
+
+void FindInstancesTest::differentVertexOrder() {
+    /* Vertices are matched by their index, so the same point set in a
+       different order is not an instance */
+    const Vector3 positionsA[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+    };
+    const Vector3 positionsB[]{
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+    };
+    const Trade::MeshData a{MeshPrimitive::Triangles, {}, positionsA, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positionsA)}
+    }};
+    const Trade::MeshData b{MeshPrimitive::Triangles, {}, positionsB, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positionsB)}
+    }};
+
+    const MeshInstances instances = findInstances({a, b});
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+}
+
+void FindInstancesTest::differentLayout() {
+    /* Same positions but a different primitive, or one of the meshes being
+       indexed */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+    };
+    const UnsignedShort indices[]{0, 1, 2};
+    const Trade::MeshData a{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+    const Trade::MeshData b{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+    const Trade::MeshData c{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    const MeshInstances instances = findInstances({a, b, c, a});
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0}),
+        TestSuite::Compare::Container);
+}
+
+void FindInstancesTest::notTransformable() {
+    /* 2D meshes are deduplicated only if they're exactly the same */
+    const Trade::MeshData circle = Primitives::circle2DSolid(8);
+    const Trade::MeshData circleTranslated = transform2D(circle, Matrix3::translation({1.0f, 0.0f}));
+
+    const MeshInstances instances = findInstances({circle, circleTranslated, circle});
+    CORRADE_COMPARE(instances.meshes.size(), 2);
+    CORRADE_COMPARE_AS(instances.meshIds,
+        Containers::arrayView<UnsignedInt>({0, 1, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(instances.transformations[1], Matrix4{});
+    CORRADE_COMPARE(instances.transformations[2], Matrix4{});
+}
+
+void FindInstancesTest::empty() {
+    const MeshInstances instances = findInstances(Containers::Iterable<const Trade::MeshData>{});
+    CORRADE_VERIFY(instances.meshes.isEmpty());
+    CORRADE_VERIFY(instances.meshIds.isEmpty());
+    CORRADE_VERIFY(instances.transformations.isEmpty());
+}
+
+void FindInstancesTest::implementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData a{MeshPrimitive::Lines, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+    }};
+    const Trade::MeshData b{MeshPrimitive::Lines,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                VertexFormat::Vector3, nullptr},
+        }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    findInstances({a, b});
+    CORRADE_COMPARE(out, "MeshTools::findInstances(): mesh 1 has an implementation-specific index type 0xcaca\n");
+}
+
+void FindInstancesTest::implementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData a{MeshPrimitive::Lines, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+            vertexFormatWrap(0xcaca), nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    findInstances({a});
+    CORRADE_COMPARE(out, "MeshTools::findInstances(): mesh 0 attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+void FindInstancesTest::benchmark() {
+    /* A thousand transformed copies of a few different meshes */
+    const Trade::MeshData cube = Primitives::cubeSolid();
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    Containers::Array<Trade::MeshData> meshes;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Matrix4 transformation =
+            Matrix4::translation({Float(i % 10), Float(i/10), 0.0f})*
+            Matrix4::rotationZ(Deg(Float(i)));
+        arrayAppend(meshes, transform3D(i % 2 ? cube : sphere, transformation));
+    }
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        count += findInstances(meshes).meshes.size();
+    }
+
+    CORRADE_COMPARE(count, 2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::FindInstancesTest)
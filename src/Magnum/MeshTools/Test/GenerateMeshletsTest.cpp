@@ -0,0 +1,565 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct GenerateMeshletsTest: TestSuite::Tester {
+    explicit GenerateMeshletsTest();
+
+    template<class T> void quad();
+    void quadSplit();
+    template<class T> void grid();
+    void degenerate();
+    void oppositeFacing();
+    void folded();
+    void empty();
+    void wrongIndexCount();
+    void indexOutOfRange();
+    void invalidMaxVertexCount();
+    void invalidMaxTriangleCount();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void meshData();
+    void meshDataNotTriangles();
+    void meshDataNotIndexed();
+    void meshDataImplementationSpecificIndexType();
+    void meshDataNoPositions();
+
+    void benchmark();
+};
+
+GenerateMeshletsTest::GenerateMeshletsTest() {
+    addTests({&GenerateMeshletsTest::quad<UnsignedByte>,
+              &GenerateMeshletsTest::quad<UnsignedShort>,
+              &GenerateMeshletsTest::quad<UnsignedInt>,
+              &GenerateMeshletsTest::quadSplit,
+              &GenerateMeshletsTest::grid<UnsignedByte>,
+              &GenerateMeshletsTest::grid<UnsignedShort>,
+              &GenerateMeshletsTest::grid<UnsignedInt>,
+              &GenerateMeshletsTest::degenerate,
+              &GenerateMeshletsTest::oppositeFacing,
+              &GenerateMeshletsTest::folded,
+              &GenerateMeshletsTest::empty,
+              &GenerateMeshletsTest::wrongIndexCount,
+              &GenerateMeshletsTest::indexOutOfRange,
+              &GenerateMeshletsTest::invalidMaxVertexCount,
+              &GenerateMeshletsTest::invalidMaxTriangleCount,
+
+              &GenerateMeshletsTest::erased<UnsignedByte>,
+              &GenerateMeshletsTest::erased<UnsignedShort>,
+              &GenerateMeshletsTest::erased<UnsignedInt>,
+              &GenerateMeshletsTest::erasedNonContiguous,
+              &GenerateMeshletsTest::erasedWrongIndexSize,
+
+              &GenerateMeshletsTest::meshData,
+              &GenerateMeshletsTest::meshDataNotTriangles,
+              &GenerateMeshletsTest::meshDataNotIndexed,
+              &GenerateMeshletsTest::meshDataImplementationSpecificIndexType,
+              &GenerateMeshletsTest::meshDataNoPositions});
+
+    addBenchmarks({&GenerateMeshletsTest::benchmark}, 5);
+}
+
+const Vector3 QuadPositions[]{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f}
+};
+
+/* Triangles referenced by the meshlets, converted back to the original vertex
+   indices and sorted, to check that each input triangle is there exactly once
+   and with the same winding */
+Containers::Array<Vector3ui> sortedTriangles(const Meshlets& meshlets) {
+    Containers::Array<Vector3ui> out{NoInit, meshlets.triangles.size()};
+    for(std::size_t i = 0; i != meshlets.meshletCount(); ++i) {
+        for(UnsignedInt j = meshlets.triangleOffsets[i]; j != meshlets.triangleOffsets[i + 1]; ++j) {
+            const Vector3ub triangle = meshlets.triangles[j];
+            out[j] = {meshlets.vertices[meshlets.vertexOffsets[i] + triangle[0]],
+                      meshlets.vertices[meshlets.vertexOffsets[i] + triangle[1]],
+                      meshlets.vertices[meshlets.vertexOffsets[i] + triangle[2]]};
+        }
+    }
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        return std::make_tuple(a[0], a[1], a[2]) < std::make_tuple(b[0], b[1], b[2]);
+    });
+    return out;
+}
+
+Containers::Array<Vector3ui> sortedTriangles(const Containers::StridedArrayView1D<const UnsignedInt>& indices) {
+    Containers::Array<Vector3ui> out{NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = {indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        return std::make_tuple(a[0], a[1], a[2]) < std::make_tuple(b[0], b[1], b[2]);
+    });
+    return out;
+}
+
+template<class T> void GenerateMeshletsTest::quad() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 0, 2, 3};
+
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), QuadPositions);
+    CORRADE_COMPARE(meshlets.meshletCount(), 1);
+    CORRADE_COMPARE_AS(meshlets.vertexOffsets,
+        Containers::arrayView<UnsignedInt>({0, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.vertices,
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangleOffsets,
+        Containers::arrayView<UnsignedInt>({0, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles,
+        Containers::arrayView<Vector3ub>({{0, 1, 2}, {0, 2, 3}}),
+        TestSuite::Compare::Container);
+
+    const Containers::Pair<Vector3, Float> sphere = MeshTools::boundingSphereBouncingBubble(QuadPositions);
+    CORRADE_COMPARE_AS(meshlets.boundingSphereCenters,
+        Containers::arrayView<Vector3>({sphere.first()}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.boundingSphereRadii,
+        Containers::arrayView<Float>({sphere.second()}),
+        TestSuite::Compare::Container);
+
+    /* A flat quad is visible only from the front half-space, with the apex
+       lying in its plane */
+    CORRADE_COMPARE_AS(meshlets.coneApexes,
+        Containers::arrayView<Vector3>({sphere.first()}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneAxes,
+        Containers::arrayView<Vector3>({Vector3::zAxis()}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneCutoffs,
+        Containers::arrayView<Float>({0.0f}),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::quadSplit() {
+    const UnsignedInt indices[]{0, 1, 2, 0, 2, 3};
+
+    /* With a limit of three vertices each triangle is a separate meshlet, the
+       shared vertices are duplicated */
+    Meshlets meshlets = MeshTools::generateMeshlets(indices, QuadPositions, 3);
+    CORRADE_COMPARE(meshlets.meshletCount(), 2);
+    CORRADE_COMPARE_AS(meshlets.vertexOffsets,
+        Containers::arrayView<UnsignedInt>({0, 3, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.vertices,
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangleOffsets,
+        Containers::arrayView<UnsignedInt>({0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles,
+        Containers::arrayView<Vector3ub>({{0, 1, 2}, {0, 1, 2}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(meshlets.boundingSphereCenters.size(), 2);
+    CORRADE_COMPARE(meshlets.boundingSphereRadii.size(), 2);
+    CORRADE_COMPARE(meshlets.coneApexes.size(), 2);
+    CORRADE_COMPARE_AS(meshlets.coneAxes,
+        Containers::arrayView<Vector3>({Vector3::zAxis(), Vector3::zAxis()}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneCutoffs,
+        Containers::arrayView<Float>({0.0f, 0.0f}),
+        TestSuite::Compare::Container);
+
+    /* Same with a limit of one triangle */
+    Meshlets meshlets1 = MeshTools::generateMeshlets(indices, QuadPositions, 64, 1);
+    CORRADE_COMPARE_AS(meshlets1.vertices,
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets1.triangleOffsets,
+        Containers::arrayView<UnsignedInt>({0, 1, 2}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void GenerateMeshletsTest::grid() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 15x15 vertices to fit into 8-bit indices, 392 triangles */
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13});
+    CORRADE_COMPARE(grid.vertexCount(), 225);
+    const Containers::Array<UnsignedInt> gridIndices = grid.indicesAsArray();
+    Containers::Array<T> indices{NoInit, gridIndices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = T(gridIndices[i]);
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), positions, 32, 40);
+
+    /* The triangle limit alone needs at least 10 meshlets. Growing compact
+       patches means the vertex limit doesn't add any more, with each vertex
+       referenced by ~1.4 meshlets on average. */
+    CORRADE_COMPARE(meshlets.meshletCount(), 10);
+    CORRADE_COMPARE(meshlets.vertices.size(), 314);
+    CORRADE_COMPARE(meshlets.vertexOffsets.size(), 11);
+    CORRADE_COMPARE(meshlets.triangleOffsets.size(), 11);
+    CORRADE_COMPARE(meshlets.vertexOffsets.front(), 0);
+    CORRADE_COMPARE(meshlets.vertexOffsets.back(), meshlets.vertices.size());
+    CORRADE_COMPARE(meshlets.triangleOffsets.front(), 0);
+    CORRADE_COMPARE(meshlets.triangleOffsets.back(), meshlets.triangles.size());
+    CORRADE_COMPARE(meshlets.boundingSphereCenters.size(), 10);
+    CORRADE_COMPARE(meshlets.boundingSphereRadii.size(), 10);
+    CORRADE_COMPARE(meshlets.coneApexes.size(), 10);
+    CORRADE_COMPARE(meshlets.coneAxes.size(), 10);
+    CORRADE_COMPARE(meshlets.coneCutoffs.size(), 10);
+
+    for(std::size_t i = 0; i != meshlets.meshletCount(); ++i) {
+        CORRADE_ITERATION(i);
+
+        const UnsignedInt vertexCount = meshlets.vertexOffsets[i + 1] - meshlets.vertexOffsets[i];
+        const UnsignedInt triangleCount = meshlets.triangleOffsets[i + 1] - meshlets.triangleOffsets[i];
+        CORRADE_COMPARE_AS(vertexCount, 32u,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(triangleCount, 40u,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(triangleCount, 0u,
+            TestSuite::Compare::Greater);
+
+        /* Local indices are all in range */
+        for(UnsignedInt j = meshlets.triangleOffsets[i]; j != meshlets.triangleOffsets[i + 1]; ++j)
+            CORRADE_COMPARE_AS(UnsignedInt(meshlets.triangles[j].max()), vertexCount,
+                TestSuite::Compare::Less);
+
+        /* The sphere is calculated from exactly the meshlet vertices */
+        Containers::Array<Vector3> meshletPositions{NoInit, vertexCount};
+        for(UnsignedInt j = 0; j != vertexCount; ++j)
+            meshletPositions[j] = positions[meshlets.vertices[meshlets.vertexOffsets[i] + j]];
+        const Containers::Pair<Vector3, Float> sphere = MeshTools::boundingSphereBouncingBubble(meshletPositions);
+        CORRADE_COMPARE(meshlets.boundingSphereCenters[i], sphere.first());
+        CORRADE_COMPARE(meshlets.boundingSphereRadii[i], sphere.second());
+
+        /* The grid is flat, facing +Z */
+        CORRADE_COMPARE(meshlets.coneApexes[i], sphere.first());
+        CORRADE_COMPARE(meshlets.coneAxes[i], Vector3::zAxis());
+        CORRADE_COMPARE(meshlets.coneCutoffs[i], 0.0f);
+    }
+
+    CORRADE_COMPARE_AS(sortedTriangles(meshlets),
+        sortedTriangles(gridIndices),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::degenerate() {
+    /* Degenerate triangles get included in the meshlet but don't contribute
+       to the normal cone */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 0, 1,
+        0, 1, 2,
+        2, 2, 2
+    };
+
+    Meshlets meshlets = MeshTools::generateMeshlets(indices, positions);
+    CORRADE_COMPARE(meshlets.meshletCount(), 1);
+    CORRADE_COMPARE_AS(meshlets.vertices,
+        Containers::arrayView<UnsignedInt>({0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles,
+        Containers::arrayView<Vector3ub>({{0, 0, 1}, {0, 1, 2}, {2, 2, 2}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneAxes,
+        Containers::arrayView<Vector3>({Vector3::zAxis()}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneCutoffs,
+        Containers::arrayView<Float>({0.0f}),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::oppositeFacing() {
+    /* Two triangles facing in the opposite direction, the meshlet is visible
+       from everywhere */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        0, 2, 1
+    };
+
+    Meshlets meshlets = MeshTools::generateMeshlets(indices, positions);
+    CORRADE_COMPARE(meshlets.meshletCount(), 1);
+    CORRADE_COMPARE_AS(meshlets.coneApexes,
+        meshlets.boundingSphereCenters,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneAxes,
+        Containers::arrayView<Vector3>({Vector3{}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneCutoffs,
+        Containers::arrayView<Float>({1.0f}),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::folded() {
+    /* A valley along Y, slopes at 45 degrees facing +X+Z and -X+Z */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {2.0f, 0.0f, 1.0f},
+        {2.0f, 1.0f, 1.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 2, 1,
+        2, 3, 1,
+        2, 4, 3,
+        4, 5, 3
+    };
+
+    Meshlets meshlets = MeshTools::generateMeshlets(indices, positions);
+    CORRADE_COMPARE(meshlets.meshletCount(), 1);
+    CORRADE_COMPARE_AS(meshlets.coneAxes,
+        Containers::arrayView<Vector3>({Vector3::zAxis()}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.coneCutoffs,
+        Containers::arrayView<Float>({Constants::sqrtHalf()}),
+        TestSuite::Compare::Container);
+
+    /* The sphere center is in front of both slopes, so the apex is moved down
+       to be behind them, which keeps the culling test conservative even when
+       the camera is inside the valley */
+    const Vector3 apex = meshlets.coneApexes[0];
+    const Vector3 center = meshlets.boundingSphereCenters[0];
+    CORRADE_COMPARE(apex.xy(), center.xy());
+    CORRADE_COMPARE_AS(apex.z(), center.z(),
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(Math::dot(apex - positions[0], Vector3{1.0f, 0.0f, 1.0f}.normalized()), 1.0e-6f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(Math::dot(apex - positions[4], Vector3{-1.0f, 0.0f, 1.0f}.normalized()), 1.0e-6f,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void GenerateMeshletsTest::empty() {
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::StridedArrayView1D<const UnsignedInt>{}, nullptr);
+    CORRADE_COMPARE(meshlets.meshletCount(), 0);
+    CORRADE_COMPARE_AS(meshlets.vertexOffsets,
+        Containers::arrayView<UnsignedInt>({0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangleOffsets,
+        Containers::arrayView<UnsignedInt>({0}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(meshlets.vertices.isEmpty());
+    CORRADE_VERIFY(meshlets.triangles.isEmpty());
+    CORRADE_VERIFY(meshlets.boundingSphereCenters.isEmpty());
+    CORRADE_VERIFY(meshlets.coneCutoffs.isEmpty());
+}
+
+void GenerateMeshletsTest::wrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(indices, QuadPositions);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): index count not divisible by 3\n");
+}
+
+void GenerateMeshletsTest::indexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(indices, QuadPositions);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): index 4 out of range for 4 vertices\n");
+}
+
+void GenerateMeshletsTest::invalidMaxVertexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(indices, QuadPositions, 2);
+    MeshTools::generateMeshlets(indices, QuadPositions, 257);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256 but got 2\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256 but got 257\n");
+}
+
+void GenerateMeshletsTest::invalidMaxTriangleCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(indices, QuadPositions, 64, 0);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected non-zero max triangle count\n");
+}
+
+template<class T> void GenerateMeshletsTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 0, 2, 3};
+
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), QuadPositions, 3);
+    CORRADE_COMPARE_AS(meshlets.vertices,
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles,
+        Containers::arrayView<Vector3ub>({{0, 1, 2}, {0, 1, 2}}),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::erasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, QuadPositions);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): second index view dimension is not contiguous\n");
+}
+
+void GenerateMeshletsTest::erasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, QuadPositions);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void GenerateMeshletsTest::meshData() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13});
+
+    /* With the default limits the 392 triangles fit into 5 meshlets, one more
+       than the minimum given by the triangle limit */
+    Meshlets meshlets = MeshTools::generateMeshlets(grid);
+    CORRADE_COMPARE(meshlets.meshletCount(), 5);
+    CORRADE_COMPARE(meshlets.vertices.size(), 275);
+    CORRADE_COMPARE(meshlets.triangles.size(), 392);
+    CORRADE_COMPARE_AS(sortedTriangles(meshlets),
+        sortedTriangles(grid.indicesAsArray()),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::meshDataNotTriangles() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::TriangleFan,
+        {}, indices, Trade::MeshIndexData{indices}, 1});
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleFan\n");
+}
+
+void GenerateMeshletsTest::meshDataNotIndexed() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): mesh data not indexed\n");
+}
+
+void GenerateMeshletsTest::meshDataImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 0});
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+void GenerateMeshletsTest::meshDataNoPositions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 3});
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): the mesh has no positions\n");
+}
+
+void GenerateMeshletsTest::benchmark() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({255, 255});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Meshlets meshlets;
+    CORRADE_BENCHMARK(1) {
+        meshlets = MeshTools::generateMeshlets(indices, positions);
+    }
+
+    CORRADE_COMPARE(meshlets.triangles.size(), indices.size()/3);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateMeshletsTest)
@@ -24,8 +24,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring> /* std::memcmp() */
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -35,6 +37,7 @@
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/GenerateNormals.h"
+#include "Magnum/MeshTools/Test/multipleThreadsData.h"
 #include "Magnum/Primitives/Cylinder.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -61,8 +64,22 @@ struct GenerateNormalsTest: TestSuite::Tester {
     void smoothErasedNonContiguous();
     void smoothErasedWrongIndexSize();
 
+    template<class T> void smoothMultipleThreads();
+    void smoothMultipleThreadsErased();
+    void smoothMultipleThreadsOutOfRange();
+
     void benchmarkFlat();
     void benchmarkSmooth();
+    void benchmarkSmoothLarge();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BenchmarkSmoothLargeData[] {
+    {"1 thread", 1},
+    {"4 threads", 4},
+    {"hardware concurrency", 0}
 };
 
 GenerateNormalsTest::GenerateNormalsTest() {
@@ -88,8 +105,46 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothErasedNonContiguous,
               &GenerateNormalsTest::smoothErasedWrongIndexSize});
 
+    addInstancedTests({&GenerateNormalsTest::smoothMultipleThreads<UnsignedShort>,
+                       &GenerateNormalsTest::smoothMultipleThreads<UnsignedInt>,
+                       &GenerateNormalsTest::smoothMultipleThreadsErased},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({&GenerateNormalsTest::smoothMultipleThreadsOutOfRange});
+
     addBenchmarks({&GenerateNormalsTest::benchmarkFlat,
                    &GenerateNormalsTest::benchmarkSmooth}, 150);
+
+    addInstancedBenchmarks({&GenerateNormalsTest::benchmarkSmoothLarge}, 10,
+        Containers::arraySize(BenchmarkSmoothLargeData));
+}
+
+/* A bumpy terrain-like grid of size x size vertices, with vertices
+   referenced by up to six triangles */
+template<class T> Containers::Pair<Containers::Array<T>, Containers::Array<Vector3>> terrain(const UnsignedInt size) {
+    Containers::Array<Vector3> positions{NoInit, std::size_t(size)*size};
+    for(UnsignedInt y = 0; y != size; ++y)
+        for(UnsignedInt x = 0; x != size; ++x)
+            positions[y*size + x] = {Float(x), Float(y), Math::sin(Rad(x*0.37f))*Math::cos(Rad(y*0.23f))*2.0f};
+
+    Containers::Array<T> indices{NoInit, std::size_t(size - 1)*(size - 1)*6};
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != size - 1; ++y) {
+        for(UnsignedInt x = 0; x != size - 1; ++x) {
+            const T a = y*size + x;
+            const T b = a + 1;
+            const T c = a + size;
+            const T d = c + 1;
+            indices[i++] = a;
+            indices[i++] = b;
+            indices[i++] = d;
+            indices[i++] = a;
+            indices[i++] = d;
+            indices[i++] = c;
+        }
+    }
+
+    return {Utility::move(indices), Utility::move(positions)};
 }
 
 /* Two vertices connected by one edge, each wound in another direction */
@@ -454,6 +509,73 @@ void GenerateNormalsTest::smoothErasedWrongIndexSize() {
         "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got 3\n");
 }
 
+template<class T> void GenerateNormalsTest::smoothMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 2*63*63 triangles, enough for seven threads */
+    Containers::Pair<Containers::Array<T>, Containers::Array<Vector3>> mesh = terrain<T>(64);
+
+    Containers::Array<Vector3> expected = generateSmoothNormals(mesh.first(), mesh.second());
+
+    Containers::Array<Vector3> normals{NoInit, mesh.second().size()};
+    generateSmoothNormalsInto(mesh.first(), mesh.second(), normals, data.threadCount);
+
+    /* The output should be bit-exact, not just fuzzy-equal */
+    CORRADE_COMPARE_AS(Containers::arrayView(normals),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(std::memcmp(normals.data(), expected.data(), normals.size()*sizeof(Vector3)) == 0);
+}
+
+void GenerateNormalsTest::smoothMultipleThreadsErased() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<Vector3>> mesh = terrain<UnsignedInt>(64);
+
+    Containers::Array<Vector3> expected = generateSmoothNormals(mesh.first(), mesh.second());
+
+    Containers::Array<Vector3> normals{NoInit, mesh.second().size()};
+    generateSmoothNormalsInto(Containers::arrayCast<2, const char>(Containers::stridedArrayView(mesh.first())), mesh.second(), normals, data.threadCount);
+    CORRADE_VERIFY(std::memcmp(normals.data(), expected.data(), normals.size()*sizeof(Vector3)) == 0);
+}
+
+void GenerateNormalsTest::smoothMultipleThreadsOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* Enough triangles for four threads, the invalid indices are in the
+       second and third chunk and the first of them should be reported */
+    Containers::Array<UnsignedInt> indices{ValueInit, 4096*3};
+    indices[1500*3 + 1] = 2;
+    indices[2500*3 + 0] = 3;
+    const Vector3 positions[2];
+    Vector3 normals[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateSmoothNormalsInto(indices, positions, normals, 4);
+    CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): index 2 out of range for 2 elements\n");
+}
+
+void GenerateNormalsTest::benchmarkSmoothLarge() {
+    auto&& data = BenchmarkSmoothLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Roughly half a million triangles */
+    Containers::Pair<Containers::Array<UnsignedInt>, Containers::Array<Vector3>> mesh = terrain<UnsignedInt>(512);
+
+    Containers::Array<Vector3> expected = generateSmoothNormals(mesh.first(), mesh.second());
+
+    Containers::Array<Vector3> normals{NoInit, mesh.second().size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(mesh.first(), mesh.second(), normals, data.threadCount);
+    }
+
+    CORRADE_VERIFY(std::memcmp(normals.data(), expected.data(), normals.size()*sizeof(Vector3)) == 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateNormalsTest)
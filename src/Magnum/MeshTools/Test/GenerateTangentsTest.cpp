@@ -0,0 +1,567 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct GenerateTangentsTest: TestSuite::Tester {
+    explicit GenerateTangentsTest();
+
+    template<class T> void tangents();
+    void mirrored();
+    void rotated();
+    void weighting();
+    void zeroArea();
+    void noContribution();
+
+    void wrongIndexCount();
+    void indexOutOfRange();
+    void wrongSize();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void meshData();
+    void meshDataNonIndexed();
+    void meshDataReplaceTangents();
+    void meshDataPackedAttributes();
+    void meshDataNotTriangles();
+    void meshDataNoAttribute();
+
+    void benchmark();
+};
+
+const struct {
+    const char* name;
+    GenerateTangentsFlags flags;
+} FlagsData[] {
+    {"", {}},
+    {"MikkTSpace", GenerateTangentsFlag::MikkTSpace}
+};
+
+const struct {
+    const char* name;
+    GenerateTangentsFlags flags;
+    Vector3 expected;
+} WeightingData[] {
+    /* The second face has twice as long tangent direction, so it contributes
+       twice as much */
+    {"", {}, Vector3{1.0f, -2.0f, 0.0f}.normalized()},
+    /* Both corners have the same angle, so the normalized directions
+       contribute equally */
+    {"MikkTSpace", GenerateTangentsFlag::MikkTSpace, Vector3{1.0f, -1.0f, 0.0f}.normalized()}
+};
+
+const struct {
+    const char* name;
+    Trade::MeshAttribute attribute;
+} MeshDataNoAttributeData[] {
+    {"positions", Trade::MeshAttribute::Position},
+    {"normals", Trade::MeshAttribute::Normal},
+    {"texture coordinates", Trade::MeshAttribute::TextureCoordinates}
+};
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addInstancedTests<GenerateTangentsTest>({
+        &GenerateTangentsTest::tangents<UnsignedByte>,
+        &GenerateTangentsTest::tangents<UnsignedShort>,
+        &GenerateTangentsTest::tangents<UnsignedInt>,
+        &GenerateTangentsTest::mirrored,
+        &GenerateTangentsTest::rotated},
+        Containers::arraySize(FlagsData));
+
+    addInstancedTests({&GenerateTangentsTest::weighting},
+        Containers::arraySize(WeightingData));
+
+    addInstancedTests({&GenerateTangentsTest::zeroArea,
+                       &GenerateTangentsTest::noContribution},
+        Containers::arraySize(FlagsData));
+
+    addTests({&GenerateTangentsTest::wrongIndexCount,
+              &GenerateTangentsTest::indexOutOfRange,
+              &GenerateTangentsTest::wrongSize,
+
+              &GenerateTangentsTest::erased<UnsignedByte>,
+              &GenerateTangentsTest::erased<UnsignedShort>,
+              &GenerateTangentsTest::erased<UnsignedInt>,
+              &GenerateTangentsTest::erasedNonContiguous,
+              &GenerateTangentsTest::erasedWrongIndexSize});
+
+    addInstancedTests({&GenerateTangentsTest::meshData},
+        Containers::arraySize(FlagsData));
+
+    addTests({&GenerateTangentsTest::meshDataNonIndexed,
+              &GenerateTangentsTest::meshDataReplaceTangents,
+              &GenerateTangentsTest::meshDataPackedAttributes,
+              &GenerateTangentsTest::meshDataNotTriangles});
+
+    addInstancedTests({&GenerateTangentsTest::meshDataNoAttribute},
+        Containers::arraySize(MeshDataNoAttributeData));
+
+    addInstancedBenchmarks({&GenerateTangentsTest::benchmark}, 10,
+        Containers::arraySize(FlagsData));
+}
+
+/* A quad in the XY plane, texture coordinates matching the positions */
+constexpr Vector3 QuadPositions[]{
+    {0.0f, 0.0f, 0.0f},
+    {2.0f, 0.0f, 0.0f},
+    {2.0f, 2.0f, 0.0f},
+    {0.0f, 2.0f, 0.0f}
+};
+constexpr Vector3 QuadNormals[]{
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f}
+};
+constexpr Vector2 QuadTextureCoordinates[]{
+    {0.0f, 0.0f},
+    {1.0f, 0.0f},
+    {1.0f, 1.0f},
+    {0.0f, 1.0f}
+};
+constexpr UnsignedInt QuadIndices[]{
+    0, 1, 2, 0, 2, 3
+};
+
+template<class T> void GenerateTangentsTest::tangents() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 0, 2, 3};
+
+    CORRADE_COMPARE_AS(generateTangents(indices, QuadPositions, QuadNormals, QuadTextureCoordinates, data.flags),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::mirrored() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The U coordinate decreases along X, so the tangent points in the
+       opposite direction and the bitangent sign is negative */
+    const Vector2 textureCoordinates[]{
+        {1.0f, 0.0f},
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 1.0f}
+    };
+
+    CORRADE_COMPARE_AS(generateTangents(QuadIndices, QuadPositions, QuadNormals, textureCoordinates, data.flags),
+        Containers::arrayView<Vector4>({
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::rotated() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The texture is rotated by 90°, the U coordinate increases along Y */
+    const Vector2 textureCoordinates[]{
+        {0.0f, 1.0f},
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f}
+    };
+
+    CORRADE_COMPARE_AS(generateTangents(QuadIndices, QuadPositions, QuadNormals, textureCoordinates, data.flags),
+        Containers::arrayView<Vector4>({
+            {0.0f, 1.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::weighting() {
+    auto&& data = WeightingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Two faces sharing the first vertex, both with a right angle at it. The
+       first has the tangent along +X, the second along -Y with the texture
+       coordinates scaled by a half. */
+    const Vector3 positions[]{
+        { 0.0f,  0.0f, 0.0f},
+        { 1.0f,  0.0f, 0.0f},
+        { 0.0f,  1.0f, 0.0f},
+        {-1.0f,  0.0f, 0.0f},
+        { 0.0f, -1.0f, 0.0f}
+    };
+    const Vector3 normals[]{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f}
+    };
+    const Vector2 textureCoordinates[]{
+        {0.0f,  0.0f},
+        {1.0f,  0.0f},
+        {0.0f,  1.0f},
+        {0.0f, -0.5f},
+        {0.5f,  0.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        0, 3, 4
+    };
+
+    Containers::Array<Vector4> tangents = generateTangents(indices, positions, normals, textureCoordinates, data.flags);
+    CORRADE_COMPARE(tangents[0], (Vector4{data.expected, 1.0f}));
+    CORRADE_COMPARE(tangents[1], (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(tangents[3], (Vector4{0.0f, -1.0f, 0.0f, 1.0f}));
+}
+
+void GenerateTangentsTest::zeroArea() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The second face has all texture coordinates on a line, so it shouldn't
+       contribute to the tangent of the shared vertices */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}
+    };
+    const Vector2 textureCoordinates[]{
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {0.0f, 1.0f},
+        {2.0f, 0.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        0, 1, 3
+    };
+
+    Containers::Array<Vector4> tangents = generateTangents(indices, positions, QuadNormals, textureCoordinates, data.flags);
+    CORRADE_COMPARE(tangents[0], (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(tangents[1], (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+}
+
+void GenerateTangentsTest::noContribution() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The only face has zero texture coordinate area and the last two
+       vertices aren't referenced by any face, so all get an arbitrary tangent
+       perpendicular to the normal. For the last vertex the normal points
+       along X, so it gets a tangent along Y. */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {5.0f, 5.0f, 5.0f},
+        {5.0f, 5.0f, 5.0f}
+    };
+    const Vector3 normals[]{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f}
+    };
+    const Vector2 textureCoordinates[5]{};
+    const UnsignedInt indices[]{
+        0, 1, 2
+    };
+
+    CORRADE_COMPARE_AS(generateTangents(indices, positions, normals, textureCoordinates, data.flags),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::wrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[7]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(indices, QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): index count not divisible by 3\n");
+}
+
+void GenerateTangentsTest::indexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 3, 4, 0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(indices, QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out, "MeshTools::generateTangentsInto(): index 4 out of range for 4 elements\n");
+}
+
+void GenerateTangentsTest::wrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 normals[3];
+    const Vector2 textureCoordinates[5];
+    Vector4 tangents[4];
+    Vector4 tangentsWrong[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangentsInto(QuadIndices, QuadPositions, normals, QuadTextureCoordinates, tangents);
+    generateTangentsInto(QuadIndices, QuadPositions, QuadNormals, textureCoordinates, tangents);
+    generateTangentsInto(QuadIndices, QuadPositions, QuadNormals, QuadTextureCoordinates, tangentsWrong);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateTangentsInto(): expected 4 normals but got 3\n"
+        "MeshTools::generateTangentsInto(): expected 4 texture coordinates but got 5\n"
+        "MeshTools::generateTangentsInto(): bad output size, expected 4 but got 3\n");
+}
+
+template<class T> void GenerateTangentsTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 0, 2, 3};
+
+    CORRADE_COMPARE_AS(generateTangents(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), QuadPositions, QuadNormals, QuadTextureCoordinates),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::erasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateTangentsInto(): second index view dimension is not contiguous\n");
+}
+
+void GenerateTangentsTest::erasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Containers::StridedArrayView2D<const char>{indices, {6, 3}}.every(2), QuadPositions, QuadNormals, QuadTextureCoordinates);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateTangentsInto(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void GenerateTangentsTest::meshData() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData expected = Primitives::grid3DSolid({3, 2}, Primitives::GridFlag::TextureCoordinates|Primitives::GridFlag::Normals|Primitives::GridFlag::Tangents);
+
+    Trade::MeshData mesh = generateTangents(Primitives::grid3DSolid({3, 2}, Primitives::GridFlag::TextureCoordinates|Primitives::GridFlag::Normals), data.flags);
+    CORRADE_VERIFY(mesh.isIndexed());
+    CORRADE_COMPARE(mesh.indexCount(), expected.indexCount());
+    CORRADE_COMPARE(mesh.attributeCount(), 4);
+    CORRADE_COMPARE(mesh.attributeName(3), Trade::MeshAttribute::Tangent);
+    CORRADE_COMPARE(mesh.attributeFormat(3), VertexFormat::Vector4);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+        expected.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(Trade::MeshAttribute::Position),
+        expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::meshDataNonIndexed() {
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+        {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+        {{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}}
+    };
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    Trade::MeshData mesh = generateTangents(Trade::MeshData{MeshPrimitive::Triangles, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+    }});
+    CORRADE_VERIFY(!mesh.isIndexed());
+    CORRADE_COMPARE(mesh.vertexCount(), 3);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+        Containers::arrayView<Vector4>({
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f},
+            {-1.0f, 0.0f, 0.0f, -1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::meshDataReplaceTangents() {
+    struct Vertex {
+        Vector3 position;
+        Vector3 tangent;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+        {{1.0f, 0.0f, 0.0f}, {}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+        {{0.0f, 1.0f, 0.0f}, {}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}}
+    };
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+    const UnsignedShort indices[]{0, 1, 2};
+
+    /* The existing three-component tangents get replaced with
+       four-component ones, other attributes stay in place */
+    Trade::MeshData mesh = generateTangents(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, view.slice(&Vertex::tangent)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+        }});
+    CORRADE_COMPARE(mesh.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh.attributeCount(), 4);
+    CORRADE_COMPARE(mesh.attributeName(1), Trade::MeshAttribute::Tangent);
+    CORRADE_COMPARE(mesh.attributeFormat(1), VertexFormat::Vector4);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector4>(1),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        view.slice(&Vertex::textureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::meshDataPackedAttributes() {
+    struct Vertex {
+        Vector3s position;
+        Vector3b normal;
+        Vector2us textureCoordinates;
+    } vertices[]{
+        {{0, 0, 0}, {0, 0, 127}, {0, 0}},
+        {{2, 0, 0}, {0, 0, 127}, {0, 65535}},
+        {{0, 2, 0}, {0, 0, 127}, {65535, 0}}
+    };
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    /* The U coordinate increases along Y and V along X, which is a mirrored
+       mapping */
+    Trade::MeshData mesh = generateTangents(Trade::MeshData{MeshPrimitive::Triangles, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3s, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2usNormalized, view.slice(&Vertex::textureCoordinates)}
+    }});
+    CORRADE_COMPARE_AS(mesh.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+        Containers::arrayView<Vector4>({
+            {0.0f, 1.0f, 0.0f, -1.0f},
+            {0.0f, 1.0f, 0.0f, -1.0f},
+            {0.0f, 1.0f, 0.0f, -1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateTangentsTest::meshDataNotTriangles() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Trade::MeshData{MeshPrimitive::TriangleStrip, 0});
+    CORRADE_COMPARE(out, "MeshTools::generateTangents(): expected MeshPrimitive::Triangles but got MeshPrimitive::TriangleStrip\n");
+}
+
+void GenerateTangentsTest::meshDataNoAttribute() {
+    auto&& data = MeshDataNoAttributeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData mesh = Primitives::grid3DSolid({1, 1}, Primitives::GridFlag::TextureCoordinates|Primitives::GridFlag::Normals);
+    Containers::Array<Trade::MeshAttributeData> attributes;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        if(mesh.attributeName(i) != data.attribute)
+            arrayAppend(attributes, mesh.attributeData(i));
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateTangents(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, mesh.indexData(), Trade::MeshIndexData{mesh.indices<UnsignedInt>()},
+        {}, mesh.vertexData(), Utility::move(attributes)});
+    CORRADE_COMPARE(out, Utility::format("MeshTools::generateTangents(): the mesh has no {}\n", data.name));
+}
+
+void GenerateTangentsTest::benchmark() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = Primitives::grid3DSolid({255, 255}, Primitives::GridFlag::TextureCoordinates|Primitives::GridFlag::Normals);
+    Containers::Array<Vector4> tangents{NoInit, mesh.vertexCount()};
+    CORRADE_BENCHMARK(1) {
+        generateTangentsInto(mesh.indices(),
+            mesh.attribute<Vector3>(Trade::MeshAttribute::Position),
+            mesh.attribute<Vector3>(Trade::MeshAttribute::Normal),
+            mesh.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+            tangents, data.flags);
+    }
+
+    CORRADE_COMPARE(tangents[0], (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
@@ -0,0 +1,591 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Optimize.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeTest: TestSuite::Tester {
+    explicit OptimizeTest();
+
+    template<class T> void vertexCache();
+    void vertexCacheDegenerate();
+    void vertexCacheEmpty();
+    void vertexCacheWrongIndexCount();
+    void vertexCacheIndexOutOfRange();
+
+    template<class T> void overdraw();
+    void overdrawIcosphere();
+    void overdrawEmpty();
+    void overdrawWrongIndexCount();
+    void overdrawIndexOutOfRange();
+    void overdrawInvalidThreshold();
+
+    template<class T> void vertexFetch();
+    void vertexFetchEmpty();
+    void vertexFetchIndexOutOfRange();
+    void vertexFetchNonContiguous();
+    template<class T> void vertexFetchErased();
+    void vertexFetchErasedNonContiguous();
+    void vertexFetchErasedWrongIndexSize();
+
+    void vertexFetchMeshData();
+    void vertexFetchMeshDataAttributeless();
+    void vertexFetchMeshDataNotIndexed();
+    void vertexFetchMeshDataImplementationSpecificIndexType();
+    void vertexFetchMeshDataImplementationSpecificVertexFormat();
+
+    void benchmarkVertexCache();
+    void benchmarkOverdraw();
+    void benchmarkVertexFetch();
+};
+
+OptimizeTest::OptimizeTest() {
+    addTests({&OptimizeTest::vertexCache<UnsignedByte>,
+              &OptimizeTest::vertexCache<UnsignedShort>,
+              &OptimizeTest::vertexCache<UnsignedInt>,
+              &OptimizeTest::vertexCacheDegenerate,
+              &OptimizeTest::vertexCacheEmpty,
+              &OptimizeTest::vertexCacheWrongIndexCount,
+              &OptimizeTest::vertexCacheIndexOutOfRange,
+
+              &OptimizeTest::overdraw<UnsignedByte>,
+              &OptimizeTest::overdraw<UnsignedShort>,
+              &OptimizeTest::overdraw<UnsignedInt>,
+              &OptimizeTest::overdrawIcosphere,
+              &OptimizeTest::overdrawEmpty,
+              &OptimizeTest::overdrawWrongIndexCount,
+              &OptimizeTest::overdrawIndexOutOfRange,
+              &OptimizeTest::overdrawInvalidThreshold,
+
+              &OptimizeTest::vertexFetch<UnsignedByte>,
+              &OptimizeTest::vertexFetch<UnsignedShort>,
+              &OptimizeTest::vertexFetch<UnsignedInt>,
+              &OptimizeTest::vertexFetchEmpty,
+              &OptimizeTest::vertexFetchIndexOutOfRange,
+              &OptimizeTest::vertexFetchNonContiguous,
+              &OptimizeTest::vertexFetchErased<UnsignedByte>,
+              &OptimizeTest::vertexFetchErased<UnsignedShort>,
+              &OptimizeTest::vertexFetchErased<UnsignedInt>,
+              &OptimizeTest::vertexFetchErasedNonContiguous,
+              &OptimizeTest::vertexFetchErasedWrongIndexSize,
+
+              &OptimizeTest::vertexFetchMeshData,
+              &OptimizeTest::vertexFetchMeshDataAttributeless,
+              &OptimizeTest::vertexFetchMeshDataNotIndexed,
+              &OptimizeTest::vertexFetchMeshDataImplementationSpecificIndexType,
+              &OptimizeTest::vertexFetchMeshDataImplementationSpecificVertexFormat});
+
+    addBenchmarks({&OptimizeTest::benchmarkVertexCache,
+                   &OptimizeTest::benchmarkOverdraw,
+                   &OptimizeTest::benchmarkVertexFetch}, 5);
+}
+
+/* Average cache miss ratio with a simulated FIFO cache of 16 entries */
+template<class T> Float acmr(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount) {
+    Containers::Array<UnsignedInt> timestamps{ValueInit, vertexCount};
+    UnsignedInt time = 17;
+    UnsignedInt misses = 0;
+    for(const T index: indices) {
+        if(time - timestamps[index] > 16) {
+            timestamps[index] = time++;
+            ++misses;
+        }
+    }
+    return Float(misses)/Float(indices.size()/3);
+}
+
+/* Triangles rotated to start with the smallest index and sorted, to check
+   that the output has the same triangles with the same winding, just in a
+   different order */
+template<class T> Containers::Array<Vector3ui> sortedTriangles(const Containers::StridedArrayView1D<const T>& indices) {
+    Containers::Array<Vector3ui> out{NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        Vector3ui triangle{indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+        while(triangle[0] != triangle.min())
+            triangle = {triangle[1], triangle[2], triangle[0]};
+        out[i] = triangle;
+    }
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        return std::make_tuple(a[0], a[1], a[2]) < std::make_tuple(b[0], b[1], b[2]);
+    });
+    return out;
+}
+
+/* A 16x16 grid, which has exactly 256 vertices, with triangles shuffled to
+   have a bad cache efficiency */
+template<class T> Containers::Array<T> shuffledGrid(const Trade::MeshData& grid) {
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const std::size_t triangleCount = indices.size()/3;
+    Containers::Array<T> shuffled{NoInit, indices.size()};
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        /* 97 is coprime with the triangle count so this is a permutation */
+        const std::size_t j = (i*97) % triangleCount;
+        for(std::size_t k = 0; k != 3; ++k)
+            shuffled[i*3 + k] = T(indices[j*3 + k]);
+    }
+    return shuffled;
+}
+
+template<class T> void OptimizeTest::vertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({14, 14});
+    CORRADE_COMPARE(grid.vertexCount(), 256);
+    Containers::Array<T> indices = shuffledGrid<T>(grid);
+    Containers::Array<Vector3ui> expectedTriangles = sortedTriangles<T>(indices);
+
+    /* The shuffled triangles don't share any vertices with their neighbors */
+    CORRADE_COMPARE(acmr<T>(indices, grid.vertexCount()), 3.0f);
+
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), grid.vertexCount());
+
+    /* Same triangles, just reordered, and better than the row-by-row order
+       the grid is generated in, which is slightly above 1. Theoretical
+       optimum for a regular grid is 0.5. */
+    CORRADE_COMPARE_AS(sortedTriangles<T>(indices), expectedTriangles,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(acmr<T>(indices, grid.vertexCount()), 0.75f,
+        TestSuite::Compare::Less);
+}
+
+void OptimizeTest::vertexCacheDegenerate() {
+    /* Degenerate triangles, an unreferenced vertex and a disconnected
+       triangle shouldn't cause any issues with the adjacency updates */
+    UnsignedInt indices[]{
+        0, 0, 0,
+        1, 2, 1,
+        5, 6, 7,
+        0, 1, 2,
+        2, 1, 3,
+        3, 3, 2
+    };
+    Containers::Array<Vector3ui> expectedTriangles = sortedTriangles<UnsignedInt>(indices);
+
+    MeshTools::optimizeVertexCacheInPlace(indices, 8);
+    CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(indices), expectedTriangles,
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::vertexCacheEmpty() {
+    /* Shouldn't crash or assert */
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, 0);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeTest::vertexCacheWrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(indices, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3\n");
+}
+
+void OptimizeTest::vertexCacheIndexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(indices, 3);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCacheInPlace(): index 3 out of range for 3 vertices\n");
+}
+
+template<class T> void OptimizeTest::overdraw() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two parallel quads facing +Z, the one at Z = -1 is drawn first. As they
+       don't share any vertices, the second one starts with a full cache miss
+       and thus they're two separate clusters. The one further along +Z is
+       more likely to occlude the other, so it should get drawn first. */
+    const Vector3 positions[]{
+        {-1.0f, -1.0f, -1.0f},
+        { 1.0f, -1.0f, -1.0f},
+        { 1.0f,  1.0f, -1.0f},
+        {-1.0f,  1.0f, -1.0f},
+
+        {-1.0f, -1.0f,  1.0f},
+        { 1.0f, -1.0f,  1.0f},
+        { 1.0f,  1.0f,  1.0f},
+        {-1.0f,  1.0f,  1.0f},
+    };
+    T indices[]{
+        0, 1, 2, 0, 2, 3,
+        4, 5, 6, 4, 6, 7
+    };
+
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        4, 5, 6, 4, 6, 7,
+        0, 1, 2, 0, 2, 3
+    }), TestSuite::Compare::Container);
+
+    /* Running it again shouldn't change anything */
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        4, 5, 6, 4, 6, 7,
+        0, 1, 2, 0, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::overdrawIcosphere() {
+    const Trade::MeshData icosphere = Primitives::icosphereSolid(3);
+    Containers::Array<UnsignedInt> indices = icosphere.indicesAsArray();
+    Containers::Array<Vector3ui> expectedTriangles = sortedTriangles<UnsignedInt>(indices);
+
+    MeshTools::optimizeVertexCacheInPlace(indices, icosphere.vertexCount());
+    const Float acmrBefore = acmr<UnsignedInt>(indices, icosphere.vertexCount());
+    Containers::Array<UnsignedInt> cacheOptimized{NoInit, indices.size()};
+    Utility::copy(indices, cacheOptimized);
+
+    MeshTools::optimizeOverdrawInPlace(indices, icosphere.attribute<Vector3>(Trade::MeshAttribute::Position), 1.5f);
+
+    /* Same triangles, but in a different order. With a 50% degradation
+       allowed the ACMR is still way below the 3.0 of a completely random
+       order. */
+    CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(indices), expectedTriangles,
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(!std::equal(indices.begin(), indices.end(), cacheOptimized.begin()));
+    CORRADE_COMPARE_AS(acmr<UnsignedInt>(indices, icosphere.vertexCount()), 2.0f*acmrBefore,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void OptimizeTest::overdrawEmpty() {
+    /* Shouldn't crash or assert */
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeTest::overdrawWrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[4]{};
+    Vector3 positions[1];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(indices, positions);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3\n");
+}
+
+void OptimizeTest::overdrawIndexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+    Vector3 positions[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(indices, positions);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): index 3 out of range for 3 vertices\n");
+}
+
+void OptimizeTest::overdrawInvalidThreshold() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2};
+    Vector3 positions[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(indices, positions, 0.95f);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1.0 but got 0.95\n");
+}
+
+template<class T> void OptimizeTest::vertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Int data[]{10, 11, 12, 13, 14};
+    T indices[]{3, 1, 3, 4, 1, 0};
+
+    /* Vertex 2 isn't referenced by anything and gets dropped */
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<T>({0, 1, 0, 2, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(4),
+        Containers::arrayView<Int>({13, 11, 14, 10}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::vertexFetchEmpty() {
+    Int data[3]{};
+
+    /* Nothing referenced, so everything gets dropped */
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchInPlace(
+        Containers::StridedArrayView1D<UnsignedInt>{},
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 0);
+}
+
+void OptimizeTest::vertexFetchIndexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Int data[3]{};
+    UnsignedInt indices[]{0, 3, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(indices,
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): index 3 out of range for 3 elements\n");
+}
+
+void OptimizeTest::vertexFetchNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[3*4]{};
+    UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(indices,
+        Containers::StridedArrayView2D<char>{data, {3, 2}, {4, 2}});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): second data view dimension is not contiguous\n");
+}
+
+template<class T> void OptimizeTest::vertexFetchErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Int data[]{10, 11, 12, 13, 14};
+    T indices[]{3, 1, 3, 4, 1, 0};
+
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchInPlace(
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<T>({0, 1, 0, 2, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(4),
+        Containers::arrayView<Int>({13, 11, 14, 10}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::vertexFetchErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+    Int data[1]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(
+        Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}},
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeTest::vertexFetchErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+    Int data[1]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(
+        Containers::StridedArrayView2D<char>{indices, {6, 3}},
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void OptimizeTest::vertexFetchMeshData() {
+    /* Deliberately not owned and not interleaved to verify that the function
+       will handle this */
+    struct Vertex {
+        Vector2 positions[5]{
+            {0.0f, 0.0f},
+            {1.0f, 1.0f},
+            {2.0f, 2.0f},
+            {3.0f, 3.0f},
+            {4.0f, 4.0f}
+        };
+        Short ids[5]{100, 101, 102, 103, 104};
+    } vertexData[1];
+
+    const UnsignedShort indices[]{3, 1, 3, 4, 1, 0};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertexData, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(vertexData->positions)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(15), Containers::arrayView(vertexData->ids)}
+        }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(mesh);
+    CORRADE_COMPARE(optimized.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(optimized.isIndexed());
+    CORRADE_COMPARE(optimized.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 1, 0, 2, 1, 3}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(optimized.vertexCount(), 4);
+    CORRADE_COMPARE(optimized.vertexData().size(), 4*(sizeof(Vector2) + sizeof(Short)));
+    CORRADE_COMPARE(optimized.attributeCount(), 2);
+    CORRADE_COMPARE_AS(optimized.attribute<Vector2>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector2>({
+            {3.0f, 3.0f},
+            {1.0f, 1.0f},
+            {4.0f, 4.0f},
+            {0.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(optimized.attribute<Short>(Trade::meshAttributeCustom(15)),
+        Containers::arrayView<Short>({103, 101, 104, 100}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::vertexFetchMeshDataAttributeless() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 3});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetch(): can't optimize an attributeless mesh\n");
+}
+
+void OptimizeTest::vertexFetchMeshDataNotIndexed() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetch(): mesh data not indexed\n");
+}
+
+void OptimizeTest::vertexFetchMeshDataImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+        }});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+void OptimizeTest::vertexFetchMeshDataImplementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{MeshIndexType::UnsignedInt, nullptr},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xcaca), nullptr}
+        }});
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetch(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+void OptimizeTest::benchmarkVertexCache() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({255, 255});
+    const Containers::Array<UnsignedInt> shuffled = shuffledGrid<UnsignedInt>(grid);
+    Containers::Array<UnsignedInt> indices{NoInit, shuffled.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(shuffled, indices);
+        MeshTools::optimizeVertexCacheInPlace(indices, grid.vertexCount());
+    }
+
+    CORRADE_COMPARE_AS(acmr<UnsignedInt>(indices, grid.vertexCount()), 0.75f,
+        TestSuite::Compare::Less);
+}
+
+void OptimizeTest::benchmarkOverdraw() {
+    const Trade::MeshData icosphere = Primitives::icosphereSolid(6);
+    Containers::Array<UnsignedInt> optimized = icosphere.indicesAsArray();
+    MeshTools::optimizeVertexCacheInPlace(optimized, icosphere.vertexCount());
+    Containers::Array<UnsignedInt> indices{NoInit, optimized.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(optimized, indices);
+        MeshTools::optimizeOverdrawInPlace(indices, icosphere.attribute<Vector3>(Trade::MeshAttribute::Position));
+    }
+
+    CORRADE_COMPARE(indices.size(), optimized.size());
+}
+
+void OptimizeTest::benchmarkVertexFetch() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({255, 255});
+    const Containers::Array<UnsignedInt> shuffled = shuffledGrid<UnsignedInt>(grid);
+    Containers::Array<UnsignedInt> indices{NoInit, shuffled.size()};
+    Containers::Array<Vector3> positions{NoInit, grid.vertexCount()};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(shuffled, indices);
+        Utility::copy(grid.attribute<Vector3>(Trade::MeshAttribute::Position), positions);
+        count = MeshTools::optimizeVertexFetchInPlace(indices,
+            Containers::arrayCast<2, char>(Containers::stridedArrayView(positions)));
+    }
+
+    CORRADE_COMPARE(count, grid.vertexCount());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeTest)
@@ -0,0 +1,321 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Quantize.h"
+#include "Magnum/Primitives/Square.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void sphere();
+    void sphereByteNormals();
+    void textureCoordinatesOutOfRange();
+    void textureCoordinatesHalf();
+    void positions2D();
+    void passthrough();
+    void noPositions();
+};
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::sphere,
+              &QuantizeTest::sphereByteNormals,
+              &QuantizeTest::textureCoordinatesOutOfRange,
+              &QuantizeTest::textureCoordinatesHalf,
+              &QuantizeTest::positions2D,
+              &QuantizeTest::passthrough,
+              &QuantizeTest::noPositions});
+}
+
+void QuantizeTest::sphere() {
+    const Trade::MeshData sphere = Primitives::uvSphereSolid(8, 16, Primitives::UVSphereFlag::TextureCoordinates|Primitives::UVSphereFlag::Tangents);
+    CORRADE_COMPARE(sphere.attributeCount(), 4);
+
+    Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> out = MeshTools::quantize(sphere);
+    const Trade::MeshData& mesh = out.first();
+    CORRADE_COMPARE(mesh.primitive(), sphere.primitive());
+    CORRADE_COMPARE(mesh.vertexCount(), sphere.vertexCount());
+    CORRADE_COMPARE(mesh.attributeCount(), 4);
+    CORRADE_COMPARE(mesh.attributeName(0), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(mesh.attributeFormat(0), VertexFormat::Vector3usNormalized);
+    CORRADE_COMPARE(mesh.attributeName(1), Trade::MeshAttribute::Normal);
+    CORRADE_COMPARE(mesh.attributeFormat(1), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(mesh.attributeName(2), Trade::MeshAttribute::Tangent);
+    CORRADE_COMPARE(mesh.attributeFormat(2), VertexFormat::Vector4sNormalized);
+    CORRADE_COMPARE(mesh.attributeName(3), Trade::MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(mesh.attributeFormat(3), VertexFormat::Vector2usNormalized);
+
+    /* Each attribute is padded to four bytes, the original stride is 48 */
+    CORRADE_COMPARE(mesh.attributeStride(0), 28);
+    CORRADE_COMPARE(mesh.attributeOffset(0), 0);
+    CORRADE_COMPARE(mesh.attributeOffset(1), 8);
+    CORRADE_COMPARE(mesh.attributeOffset(2), 16);
+    CORRADE_COMPARE(mesh.attributeOffset(3), 24);
+
+    /* Index data are copied */
+    CORRADE_VERIFY(mesh.isIndexed());
+    CORRADE_COMPARE(mesh.indexType(), sphere.indexType());
+    CORRADE_COMPARE_AS(mesh.indicesAsArray(),
+        sphere.indicesAsArray(),
+        TestSuite::Compare::Container);
+
+    /* The sphere has a radius of 1, so the dequantization transform scales by
+       two and translates by -1 */
+    CORRADE_COMPARE(out.second(), Matrix4::translation(Vector3{-1.0f})*Matrix4::scaling(Vector3{2.0f}));
+
+    /* The errors are non-zero but less than half of the quantization step in
+       each dimension */
+    CORRADE_COMPARE(out.third().size(), 4);
+    CORRADE_COMPARE_AS(out.third()[0], 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(out.third()[0], 2.0f*0.5f/65535.0f*Constants::sqrt3()*1.01f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(out.third()[1], 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(out.third()[1], 0.5f/32767.0f*Constants::sqrt3()*1.01f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(out.third()[2], 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(out.third()[2], 0.5f/32767.0f*2.0f*1.01f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(out.third()[3], 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(out.third()[3], 0.5f/65535.0f*Constants::sqrt2()*1.01f,
+        TestSuite::Compare::LessOrEqual);
+
+    /* Dequantized positions match the originals within the reported error */
+    const Containers::Array<Vector3> originalPositions = sphere.positions3DAsArray();
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS((out.second().transformPoint(positions[i]) - originalPositions[i]).length(), out.third()[0] + 1.0e-6f,
+            TestSuite::Compare::LessOrEqual);
+    }
+    const Containers::Array<Vector3> originalNormals = sphere.normalsAsArray();
+    const Containers::Array<Vector3> normals = mesh.normalsAsArray();
+    for(std::size_t i = 0; i != normals.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS((normals[i] - originalNormals[i]).length(), out.third()[1] + 1.0e-6f,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void QuantizeTest::sphereByteNormals() {
+    const Trade::MeshData sphere = Primitives::uvSphereSolid(8, 16, Primitives::UVSphereFlag::TextureCoordinates|Primitives::UVSphereFlag::Tangents);
+
+    Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> out = MeshTools::quantize(sphere, QuantizeFlag::ByteNormals);
+    const Trade::MeshData& mesh = out.first();
+    CORRADE_COMPARE(mesh.attributeCount(), 4);
+    CORRADE_COMPARE(mesh.attributeFormat(0), VertexFormat::Vector3usNormalized);
+    CORRADE_COMPARE(mesh.attributeFormat(1), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(mesh.attributeFormat(2), VertexFormat::Vector4bNormalized);
+    CORRADE_COMPARE(mesh.attributeFormat(3), VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE(mesh.attributeStride(0), 20);
+
+    CORRADE_COMPARE_AS(out.third()[1], 0.5f/127.0f*Constants::sqrt3()*1.01f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(out.third()[2], 0.5f/127.0f*2.0f*1.01f,
+        TestSuite::Compare::LessOrEqual);
+    /* The 8-bit error is larger than the 16-bit one */
+    CORRADE_COMPARE_AS(out.third()[1], 0.5f/32767.0f*Constants::sqrt3(),
+        TestSuite::Compare::Greater);
+}
+
+void QuantizeTest::textureCoordinatesOutOfRange() {
+    const Vector2 textureCoordinates[]{
+        {0.0f, 0.5f},
+        {1.0f, 1.0f},
+        {-0.5f, 2.0f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, textureCoordinates, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, Containers::arrayView(textureCoordinates)}
+    }};
+
+    /* Values outside of [0, 1] can't be represented as normalized, so half
+       floats are used. They're all exactly representable. */
+    Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> out = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out.first().attributeFormat(0), VertexFormat::Vector2h);
+    CORRADE_COMPARE(out.first().attributeStride(0), 4);
+    CORRADE_COMPARE(out.second(), Matrix4{});
+    CORRADE_COMPARE_AS(out.third(),
+        Containers::arrayView<Float>({0.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first().textureCoordinates2DAsArray(),
+        Containers::arrayView(textureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void QuantizeTest::textureCoordinatesHalf() {
+    const Vector2 textureCoordinates[]{
+        {0.0f, 0.5f},
+        {1.0f, 0.25f},
+        {0.75f, 1.0f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, textureCoordinates, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, Containers::arrayView(textureCoordinates)}
+    }};
+
+    CORRADE_COMPARE(MeshTools::quantize(mesh).first().attributeFormat(0), VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE(MeshTools::quantize(mesh, QuantizeFlag::HalfTextureCoordinates).first().attributeFormat(0), VertexFormat::Vector2h);
+}
+
+void QuantizeTest::positions2D() {
+    const Trade::MeshData square = Primitives::squareSolid();
+    CORRADE_COMPARE(square.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector2);
+
+    Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> out = MeshTools::quantize(square);
+    CORRADE_VERIFY(!out.first().isIndexed());
+    CORRADE_COMPARE(out.first().attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector2usNormalized);
+
+    /* The Z component is left untransformed */
+    CORRADE_COMPARE(out.second(), Matrix4::translation({-1.0f, -1.0f, 0.0f})*Matrix4::scaling(Vector3{2.0f}));
+
+    /* Corners of the square are exactly representable */
+    CORRADE_COMPARE_AS(out.third(),
+        Containers::arrayView<Float>({0.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first().positions2DAsArray(),
+        Containers::arrayView<Vector2>({
+            {1.0f, 0.0f},
+            {1.0f, 1.0f},
+            {0.0f, 0.0f},
+            {0.0f, 1.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::passthrough() {
+    struct Vertex {
+        Vector3 position;
+        Vector3 morphTargetPosition;
+        Color4 color;
+        UnsignedShort objectId;
+        Vector3b normal;
+        Vector3 weights;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {7.0f, 8.0f, 9.0f}, 0xff3366cc_rgbaf, 3, {127, 0, 0}, {0.25f, 0.5f, 0.25f}},
+        {{4.0f, 4.0f, 0.0f}, {-7.0f, 8.0f, 9.0f}, 0x3366ccff_rgbaf, 5, {0, 127, 0}, {1.0f, 0.0f, 0.0f}},
+        {{0.0f, 4.0f, 4.0f}, {7.0f, -8.0f, 9.0f}, 0x66ccff33_rgbaf, 7, {0, 0, 127}, {0.0f, 0.0f, 1.0f}}
+    };
+    const auto view = Containers::stridedArrayView(vertices);
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::morphTargetPosition), 0},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::color)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId, view.slice(&Vertex::objectId)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Weights, VertexFormat::Float, view.slice(&Vertex::weights), 3}
+    }};
+
+    Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> out = MeshTools::quantize(mesh);
+    const Trade::MeshData& quantized = out.first();
+    CORRADE_COMPARE(quantized.attributeCount(), 6);
+    /* Morph targets are passed through, and because the dequantization
+       transformation would apply to them as well, the base positions are
+       passed through too */
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::Vector3);
+    CORRADE_COMPARE(quantized.attributeMorphTargetId(1), 0);
+    CORRADE_COMPARE(quantized.attributeFormat(2), VertexFormat::Vector4);
+    CORRADE_COMPARE(quantized.attributeFormat(3), VertexFormat::UnsignedShort);
+    CORRADE_COMPARE(quantized.attributeFormat(4), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(5), VertexFormat::Float);
+    CORRADE_COMPARE(quantized.attributeArraySize(5), 3);
+
+    /* The object ID and the already-packed normal get padded */
+    CORRADE_COMPARE(quantized.attributeOffset(1), 12);
+    CORRADE_COMPARE(quantized.attributeOffset(2), 24);
+    CORRADE_COMPARE(quantized.attributeOffset(3), 40);
+    CORRADE_COMPARE(quantized.attributeOffset(4), 44);
+    CORRADE_COMPARE(quantized.attributeOffset(5), 48);
+    CORRADE_COMPARE(quantized.attributeStride(0), 60);
+
+    CORRADE_COMPARE(out.second(), Matrix4{});
+    CORRADE_COMPARE_AS(out.third(),
+        Containers::arrayView<Float>({0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}),
+        TestSuite::Compare::Container);
+
+    /* Both the base and the morph target positions match the originals with
+       the transformation applied */
+    const Containers::Array<Vector3> positions = quantized.positions3DAsArray();
+    const Containers::Array<Vector3> morphTargetPositions = quantized.positions3DAsArray(0, 0);
+    for(std::size_t i = 0; i != Containers::arraySize(vertices); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out.second().transformPoint(positions[i]), vertices[i].position);
+        CORRADE_COMPARE(out.second().transformPoint(morphTargetPositions[i]), vertices[i].morphTargetPosition);
+    }
+
+    CORRADE_COMPARE_AS(quantized.colorsAsArray(),
+        mesh.colorsAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.objectIdsAsArray(),
+        mesh.objectIdsAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.normalsAsArray(),
+        mesh.normalsAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.weightsAsArray(),
+        mesh.weightsAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void QuantizeTest::noPositions() {
+    const Vector3 normals[]{
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, normals, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(normals)}
+    }};
+
+    Containers::Triple<Trade::MeshData, Matrix4, Containers::Array<Float>> out = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(out.first().attributeFormat(0), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(out.second(), Matrix4{});
+    CORRADE_COMPARE_AS(out.third(),
+        Containers::arrayView<Float>({0.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first().normalsAsArray(),
+        Containers::arrayView(normals),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
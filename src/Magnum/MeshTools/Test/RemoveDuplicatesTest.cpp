@@ -25,15 +25,21 @@
 */
 
 #include <algorithm> /* std::shuffle() */
+#include <cstring> /* std::memcmp() */
 #include <random> /* random device for std::shuffle() */
+#include <unordered_map> /* for the baseline in benchmarkLarge() */
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Test/multipleThreadsData.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
@@ -45,6 +51,7 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicates();
     void removeDuplicatesNonContiguous();
     void removeDuplicatesIntoWrongOutputSize();
+    void removeDuplicatesMultipleThreads();
 
     template<class T> void removeDuplicatesIndexedInPlace();
     void removeDuplicatesIndexedInPlaceSmallType();
@@ -69,6 +76,15 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicatesFuzzyIndexedInPlaceErasedNonContiguous();
     void removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize();
 
+    template<class T> void removeDuplicatesFuzzyGridInPlaceOneDimension();
+    template<class T> void removeDuplicatesFuzzyGridInPlaceBall();
+    template<class T> void removeDuplicatesFuzzyGridInPlaceMoreDimensions();
+    void removeDuplicatesFuzzyGridInPlaceNaN();
+    void removeDuplicatesFuzzyGridInPlaceEmpty();
+    template<class T> void removeDuplicatesFuzzyGridInPlaceInto();
+    void removeDuplicatesFuzzyGridInPlaceIntoWrongOutputSize();
+    void removeDuplicatesFuzzyGridConsistentWithBruteForce();
+
     /* this is additionally regression-tested in PrimitivesIcosphereTest */
 
     void removeDuplicatesMeshData();
@@ -88,6 +104,19 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     void benchmark();
     void benchmarkFuzzy();
+    void benchmarkFuzzyGrid();
+    void benchmarkLargeStl();
+    void benchmarkLarge();
+    void benchmarkLargeInPlace();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BenchmarkLargeData[] {
+    {"1 thread", 1},
+    {"4 threads", 4},
+    {"hardware concurrency", 0}
 };
 
 const struct {
@@ -198,7 +227,12 @@ const struct {
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::removeDuplicates,
               &RemoveDuplicatesTest::removeDuplicatesNonContiguous,
-              &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize,
+              &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize});
+
+    addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMultipleThreads},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedByte>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedShort>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedInt>,
@@ -237,7 +271,21 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErased<UnsignedInt, Float>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErased<UnsignedInt, Double>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedNonContiguous,
-              &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize});
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize,
+
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceOneDimension<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceOneDimension<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceBall<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceBall<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceMoreDimensions<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceMoreDimensions<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceNaN,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceEmpty,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInto<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInto<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceIntoWrongOutputSize});
+
+    addRepeatedTests({&RemoveDuplicatesTest::removeDuplicatesFuzzyGridConsistentWithBruteForce}, 10);
 
     addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMeshData},
         Containers::arraySize(RemoveDuplicatesMeshDataData));
@@ -261,7 +309,13 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
                       &RemoveDuplicatesTest::soakTestFuzzy}, 10);
 
     addBenchmarks({&RemoveDuplicatesTest::benchmark,
-                   &RemoveDuplicatesTest::benchmarkFuzzy}, 10);
+                   &RemoveDuplicatesTest::benchmarkFuzzy,
+                   &RemoveDuplicatesTest::benchmarkFuzzyGrid,
+                   &RemoveDuplicatesTest::benchmarkLargeStl}, 10);
+
+    addInstancedBenchmarks({&RemoveDuplicatesTest::benchmarkLarge,
+                            &RemoveDuplicatesTest::benchmarkLargeInPlace}, 10,
+        Containers::arraySize(BenchmarkLargeData));
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -317,6 +371,45 @@ void RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize() {
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has 7 elements but expected 8\n");
 }
 
+void RemoveDuplicatesTest::removeDuplicatesMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* 1237 unique items, each duplicated a few times, randomly shuffled */
+    Containers::Array<Vector3i> input{NoInit, 10000};
+    for(std::size_t i = 0; i != input.size(); ++i)
+        input[i] = {Int(i % 1237), -Int(i % 1237), 7};
+    std::shuffle(input.begin(), input.end(), std::minstd_rand{12345});
+
+    /* The output should be the same as with the single-threaded variant */
+    Containers::Array<UnsignedInt> expected{NoInit, input.size()};
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(
+        Containers::arrayCast<2, const char>(Containers::arrayView(input)),
+        expected), 1237);
+
+    Containers::Array<UnsignedInt> indices{NoInit, input.size()};
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(
+        Containers::arrayCast<2, const char>(Containers::arrayView(input)),
+        indices, data.threadCount), 1237);
+    CORRADE_COMPARE_AS(indices, expected,
+        TestSuite::Compare::Container);
+
+    Containers::Array<Vector3i> expectedInPlace{NoInit, input.size()};
+    Utility::copy(input, expectedInPlace);
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(expectedInPlace)),
+        expected), 1237);
+
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(input)),
+        indices, data.threadCount), 1237);
+    CORRADE_COMPARE_AS(indices, expected,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(input.prefix(1237),
+        expectedInPlace.prefix(1237),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void RemoveDuplicatesTest::removeDuplicatesIndexedInPlace() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -632,6 +725,202 @@ void RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSi
         "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): expected index type size 1, 2 or 4 but got 3\n");
 }
 
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceOneDimension() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Item 3 is close to item 1 but with the grid origin at 0.99 and cell
+       size equal to epsilon it falls into a neighbor cell, it should get
+       merged nevertheless */
+    T data[]{
+        T(0.99),
+        T(2.01),
+        T(1.01),
+        T(1.99),
+        T(3.5)
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyGridInPlace(
+            Containers::arrayCast<2, T>(Containers::arrayView(data)),
+            T(0.1));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result.second()),
+        (Containers::arrayView<T>({T(0.99), T(2.01), T(3.5)})),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceBall() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Item 1 is within epsilon in each component but not in the Euclidean
+       distance so it's kept. Item 2 is within epsilon of both item 0 and 1,
+       the earlier one is picked. Item 3 is within epsilon of item 1 only. */
+    Math::Vector2<T> data[]{
+        {T(0.0), T(0.0)},
+        {T(0.08), T(0.08)},
+        {T(0.04), T(0.04)},
+        {T(0.1), T(0.15)},
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyGridInPlace(
+            Containers::arrayCast<2, T>(Containers::arrayView(data)),
+            T(0.1));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result.second()),
+        (Containers::arrayView<Math::Vector2<T>>({
+            {T(0.0), T(0.0)},
+            {T(0.08), T(0.08)}
+        })), TestSuite::Compare::Container);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceMoreDimensions() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Only the three components with the largest range, i.e. the last three,
+       are used for the grid, the rest should be still taken into account for
+       the distance */
+    Math::Vector<5, T> data[]{
+        {T(1.0), T(0.0), T(2.0), T(0.0), T(-1.0)},
+        {T(1.0), T(0.0), T(2.0), T(0.0), T(1.0)},
+        {T(1.0), T(0.0), T(2.05), T(0.0), T(-1.05)},
+        {T(1.0), T(0.0), T(2.0), T(0.05), T(1.0)},
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyGridInPlace(
+            Containers::arrayCast<2, T>(Containers::arrayView(data)),
+            T(0.1));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second(), 2);
+    CORRADE_COMPARE(data[1], (Math::Vector<5, T>{T(1.0), T(0.0), T(2.0), T(0.0), T(1.0)}));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceNaN() {
+    /* NaNs are never equal to anything, so items containing them are always
+       unique. The rest should be handled as usual. */
+    Vector2 data[]{
+        {1.0f, 0.0f},
+        {Constants::nan(), 0.0f},
+        {1.0f, 0.0f},
+        {Constants::nan(), 0.0f},
+        {5.0f, 5.0f},
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyGridInPlace(
+            Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+            0.1f);
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second(), 4);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceEmpty() {
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyGridInPlace(
+            Containers::StridedArrayView2D<Float>{nullptr, {0, 3}});
+    CORRADE_COMPARE(result.first().size(), 0);
+    CORRADE_COMPARE(result.second(), 0);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Same as removeDuplicatesFuzzyGridInPlaceOneDimension(), with a zero
+       epsilon only the bit-exact duplicate is merged */
+    T data[]{
+        T(0.99),
+        T(2.01),
+        T(1.01),
+        T(2.01),
+        T(3.5)
+    };
+    UnsignedInt indices[Containers::arraySize(data)];
+
+    std::size_t count = MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::arrayCast<2, T>(Containers::arrayView(data)),
+        indices, T(0.0));
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(count),
+        (Containers::arrayView<T>({T(0.99), T(2.01), T(1.01), T(3.5)})),
+        TestSuite::Compare::Container);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceIntoWrongOutputSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector2 data[8]{};
+    UnsignedInt output[7];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+        output);
+    CORRADE_COMPARE(out,
+        "MeshTools::removeDuplicatesFuzzyGridInPlaceInto(): output index array has 7 elements but expected 8\n");
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridConsistentWithBruteForce() {
+    /* Random points in a 10x10x10 cube, with a fair amount of them being
+       within epsilon of each other. Seeded with the repeat ID to have each
+       repeat different but still reproducible. */
+    std::minstd_rand rand{12345 + testCaseRepeatId()};
+    std::uniform_real_distribution<Float> distribution{0.0f, 10.0f};
+    Vector3 data[2000];
+    for(Vector3& i: data)
+        i = {distribution(rand), distribution(rand), distribution(rand)};
+    Vector3 original[Containers::arraySize(data)];
+    Utility::copy(data, original);
+
+    const Float epsilon = 0.5f;
+    UnsignedInt indices[Containers::arraySize(data)];
+    const std::size_t count = MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+        indices, epsilon);
+
+    /* Each item is mapped to the earliest unique item within epsilon, or
+       becomes a new unique item */
+    Containers::Array<UnsignedInt> expectedUnique;
+    for(std::size_t i = 0; i != Containers::arraySize(original); ++i) {
+        CORRADE_ITERATION(i);
+
+        UnsignedInt expected = ~UnsignedInt{};
+        for(std::size_t j = 0; j != expectedUnique.size(); ++j) {
+            if((original[i] - original[expectedUnique[j]]).dot() <= epsilon*epsilon) {
+                expected = j;
+                break;
+            }
+        }
+        if(expected == ~UnsignedInt{}) {
+            expected = expectedUnique.size();
+            arrayAppend(expectedUnique, UnsignedInt(i));
+        }
+
+        CORRADE_COMPARE(indices[i], expected);
+    }
+
+    CORRADE_COMPARE(count, expectedUnique.size());
+    for(std::size_t i = 0; i != count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i], original[expectedUnique[i]]);
+    }
+
+    /* Make sure the test isn't testing something trivial */
+    CORRADE_COMPARE_AS(count, 100, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(count, Containers::arraySize(data), TestSuite::Compare::Less);
+}
+
 void RemoveDuplicatesTest::removeDuplicatesMeshData() {
     auto&& data = RemoveDuplicatesMeshDataData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -1270,6 +1559,93 @@ void RemoveDuplicatesTest::benchmarkFuzzy() {
     CORRADE_COMPARE(count, 100);
 }
 
+/* Reference implementation with a std::unordered_map, which was used by
+   removeDuplicatesInto() originally */
+struct StlArrayEqual {
+    bool operator()(const void* a, const void* b) const {
+        return std::memcmp(a, b, sizeof(Vector3i)) == 0;
+    }
+};
+
+struct StlArrayHash {
+    std::size_t operator()(const void* a) const {
+        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), sizeof(Vector3i)).byteArray());
+    }
+};
+
+/* A million items, a quarter of them unique, shuffled */
+Containers::Array<Vector3i> benchmarkLargeData() {
+    Containers::Array<Vector3i> data{NoInit, 1000000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Int(i % 250000), Int(i % 250000)*3, 7};
+    std::shuffle(data.begin(), data.end(), std::minstd_rand{std::random_device{}()});
+    return data;
+}
+
+void RemoveDuplicatesTest::benchmarkFuzzyGrid() {
+    /* Same as benchmarkFuzzy() */
+    Vector3 data[10000];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i].x() = i/100;
+    std::shuffle(std::begin(data), std::end(data), std::minstd_rand{std::random_device{}()});
+
+    std::size_t count = 0;
+    UnsignedInt indices[10000];
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+            Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+            indices);
+
+    CORRADE_COMPARE(count, 100);
+}
+
+void RemoveDuplicatesTest::benchmarkLargeStl() {
+    Containers::Array<Vector3i> data = benchmarkLargeData();
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()};
+    CORRADE_BENCHMARK(1) {
+        std::unordered_map<const void*, UnsignedInt, StlArrayHash, StlArrayEqual> table{data.size()};
+        for(std::size_t i = 0; i != data.size(); ++i)
+            indices[i] = table.emplace(&data[i], UnsignedInt(i)).first->second;
+        count = table.size();
+    }
+
+    CORRADE_COMPARE(count, 250000);
+}
+
+void RemoveDuplicatesTest::benchmarkLarge() {
+    auto&& data = BenchmarkLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Vector3i> input = benchmarkLargeData();
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, input.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(
+            Containers::arrayCast<2, const char>(Containers::arrayView(input)),
+            indices, data.threadCount);
+
+    CORRADE_COMPARE(count, 250000);
+}
+
+void RemoveDuplicatesTest::benchmarkLargeInPlace() {
+    auto&& data = BenchmarkLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Vector3i> input = benchmarkLargeData();
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, input.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInPlaceInto(
+            Containers::arrayCast<2, char>(Containers::arrayView(input)),
+            indices, data.threadCount);
+
+    CORRADE_COMPARE(count, 250000);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,595 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    template<class T> void grid();
+    void gridLockBorder();
+    void seam();
+    void sphere();
+    void sphereZeroError();
+    void degenerate();
+    void targetAlreadyReached();
+    void empty();
+    void wrongIndexCount();
+    void indexOutOfRange();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void meshData();
+    void meshDataNotTriangles();
+    void meshDataNotIndexed();
+    void meshDataImplementationSpecificIndexType();
+    void meshDataNoPositions();
+
+    void lodChain();
+    void lodChainErrorBudget();
+    void lodChainInvalidLodCount();
+    void lodChainInvalidRatio();
+
+    void benchmark();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::grid<UnsignedByte>,
+              &SimplifyTest::grid<UnsignedShort>,
+              &SimplifyTest::grid<UnsignedInt>,
+              &SimplifyTest::gridLockBorder,
+              &SimplifyTest::seam,
+              &SimplifyTest::sphere,
+              &SimplifyTest::sphereZeroError,
+              &SimplifyTest::degenerate,
+              &SimplifyTest::targetAlreadyReached,
+              &SimplifyTest::empty,
+              &SimplifyTest::wrongIndexCount,
+              &SimplifyTest::indexOutOfRange,
+
+              &SimplifyTest::erased<UnsignedByte>,
+              &SimplifyTest::erased<UnsignedShort>,
+              &SimplifyTest::erased<UnsignedInt>,
+              &SimplifyTest::erasedNonContiguous,
+              &SimplifyTest::erasedWrongIndexSize,
+
+              &SimplifyTest::meshData,
+              &SimplifyTest::meshDataNotTriangles,
+              &SimplifyTest::meshDataNotIndexed,
+              &SimplifyTest::meshDataImplementationSpecificIndexType,
+              &SimplifyTest::meshDataNoPositions,
+
+              &SimplifyTest::lodChain,
+              &SimplifyTest::lodChainErrorBudget,
+              &SimplifyTest::lodChainInvalidLodCount,
+              &SimplifyTest::lodChainInvalidRatio});
+
+    addBenchmarks({&SimplifyTest::benchmark}, 5);
+}
+
+const Vector3 QuadPositions[]{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f}
+};
+
+/* Total area of all triangles, with the count of triangles that don't face
+   the +Z direction */
+template<class T> Containers::Pair<Float, std::size_t> areaNotFacingZ(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    Float area = 0.0f;
+    std::size_t notFacingZ = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 normal = Math::cross(
+            positions[indices[i + 1]] - positions[indices[i]],
+            positions[indices[i + 2]] - positions[indices[i]]);
+        area += normal.length()*0.5f;
+        if(normal.z() <= 0.0f) ++notFacingZ;
+    }
+    return {area, notFacingZ};
+}
+
+/* Whether each half-edge has an opposite half-edge and there are no
+   duplicate half-edges */
+bool isClosed(const Containers::StridedArrayView1D<const UnsignedInt>& indices) {
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt a = indices[i];
+        const UnsignedInt b = indices[i - i % 3 + (i + 1) % 3];
+        std::size_t sameCount = 0, oppositeCount = 0;
+        for(std::size_t j = 0; j != indices.size(); ++j) {
+            const UnsignedInt c = indices[j];
+            const UnsignedInt d = indices[j - j % 3 + (j + 1) % 3];
+            if(c == a && d == b) ++sameCount;
+            if(c == b && d == a) ++oppositeCount;
+        }
+        if(sameCount != 1 || oppositeCount != 1) return false;
+    }
+    return true;
+}
+
+template<class T> void SimplifyTest::grid() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13});
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    const Containers::Array<UnsignedInt> originalIndices = grid.indicesAsArray();
+    Containers::Array<T> indices{NoInit, originalIndices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = originalIndices[i];
+    CORRADE_COMPARE(indices.size(), 392*3);
+
+    /* The grid is flat, so it can be collapsed all the way to two triangles
+       without introducing any error and without changing the outline */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 1.0e-4f);
+    CORRADE_COMPARE(result.first(), 6);
+    CORRADE_COMPARE(result.second(), 0.0f);
+
+    Containers::Pair<Float, std::size_t> area = areaNotFacingZ<T>(indices.prefix(result.first()), positions);
+    CORRADE_COMPARE(area.first(), 4.0f);
+    CORRADE_COMPARE(area.second(), 0);
+}
+
+void SimplifyTest::gridLockBorder() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13});
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+
+    /* With the 56 border vertices locked, only the inner ones can be
+       collapsed */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 1.0e-4f, SimplifyFlag::LockBorder);
+    CORRADE_COMPARE(result.first(), 56*3);
+    CORRADE_COMPARE(result.second(), 0.0f);
+
+    Containers::Pair<Float, std::size_t> area = areaNotFacingZ<UnsignedInt>(indices.prefix(result.first()), positions);
+    CORRADE_COMPARE(area.first(), 4.0f);
+    CORRADE_COMPARE(area.second(), 0);
+
+    /* All border vertices are still referenced */
+    Containers::Array<bool> referenced{ValueInit, positions.size()};
+    for(std::size_t i = 0; i != result.first(); ++i)
+        referenced[indices[i]] = true;
+    std::size_t referencedBorderCount = 0;
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        if(referenced[i] && (Math::abs(positions[i].x()) == 1.0f || Math::abs(positions[i].y()) == 1.0f))
+            ++referencedBorderCount;
+    CORRADE_COMPARE(referencedBorderCount, 56);
+}
+
+void SimplifyTest::seam() {
+    /* Two flat 5x5 vertex charts next to each other, with the column at X = 4
+       being present in both, like with a texture coordinate seam */
+    Vector3 positions[2*25];
+    UnsignedInt indices[2*16*6];
+    std::size_t i = 0;
+    for(UnsignedInt chart = 0; chart != 2; ++chart) {
+        for(UnsignedInt y = 0; y != 5; ++y)
+            for(UnsignedInt x = 0; x != 5; ++x)
+                positions[chart*25 + y*5 + x] = {Float(chart*4 + x), Float(y), 0.0f};
+        for(UnsignedInt y = 0; y != 4; ++y) {
+            for(UnsignedInt x = 0; x != 4; ++x) {
+                const UnsignedInt a = chart*25 + y*5 + x;
+                indices[i++] = a;
+                indices[i++] = a + 1;
+                indices[i++] = a + 6;
+                indices[i++] = a;
+                indices[i++] = a + 6;
+                indices[i++] = a + 5;
+            }
+        }
+    }
+
+    /* Each chart gets collapsed to two triangles, with vertices at the seam
+       being collapsed together on both sides */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 1.0e-4f);
+    CORRADE_COMPARE(result.first(), 4*3);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(result.first()),
+        Containers::arrayView<UnsignedInt>({
+            4, 24, 0,
+            0, 24, 20,
+            25, 29, 45,
+            45, 29, 49
+        }), TestSuite::Compare::Container);
+}
+
+void SimplifyTest::sphere() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(3);
+    const Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    CORRADE_COMPARE(indices.size(), 1280*3);
+
+    /* The target index count gets reached and the mesh stays closed */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 320*3, 1.0f);
+    CORRADE_COMPARE_AS(result.first(), std::size_t{320*3},
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(result.first(), std::size_t{300*3},
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(result.second(), 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(result.second(), 0.05f,
+        TestSuite::Compare::Less);
+    CORRADE_VERIFY(isClosed(indices.prefix(result.first())));
+
+    /* Simplifying further with an error limit stops before the target */
+    Containers::Pair<std::size_t, Float> result2 = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(result.first()), positions, 0, 0.05f);
+    CORRADE_COMPARE_AS(result2.first(), result.first(),
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(result2.first(), std::size_t{},
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(result2.second(), 0.05f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_VERIFY(isClosed(indices.prefix(result2.first())));
+}
+
+void SimplifyTest::sphereZeroError() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    const Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+
+    /* Every collapse on a sphere introduces an error, so nothing is done */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 0.0f);
+    CORRADE_COMPARE(result.first(), indices.size());
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(indices,
+        sphere.indicesAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::degenerate() {
+    UnsignedInt indices[]{
+        0, 1, 2,
+        1, 1, 3, /* degenerate */
+        0, 2, 3
+    };
+
+    /* Degenerate triangles get removed even if there's no collapse done */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), QuadPositions, 6, 1.0f);
+    CORRADE_COMPARE(result.first(), 6);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(6),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::targetAlreadyReached() {
+    UnsignedInt indices[]{
+        0, 1, 2,
+        1, 1, 3,
+        0, 2, 3
+    };
+
+    /* If the index count is already at the target, nothing is done, not even
+       the degenerate triangle removal */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), QuadPositions, 9, 1.0f);
+    CORRADE_COMPARE(result.first(), 9);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 1, 1, 3, 0, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::empty() {
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, nullptr, 0, 1.0f);
+    CORRADE_COMPARE(result.first(), 0);
+    CORRADE_COMPARE(result.second(), 0.0f);
+}
+
+void SimplifyTest::wrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), QuadPositions, 0, 1.0f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3\n");
+}
+
+void SimplifyTest::indexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), QuadPositions, 0, 1.0f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): index 4 out of range for 4 vertices\n");
+}
+
+template<class T> void SimplifyTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[]{0, 1, 2, 0, 2, 3};
+
+    /* A quad has only border vertices, collapsing a corner along the border
+       changes the outline, so this is a no-op with a zero error limit */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), QuadPositions, 0, 0.0f);
+    CORRADE_COMPARE(result.first(), 6);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<T>({0, 1, 2, 0, 2, 3}),
+        TestSuite::Compare::Container);
+
+    /* With a large enough error limit it collapses to a single triangle */
+    Containers::Pair<std::size_t, Float> result2 = MeshTools::simplifyInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), QuadPositions, 3, 1.0f);
+    CORRADE_COMPARE(result2.first(), 3);
+    CORRADE_COMPARE_AS(result2.second(), 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(3),
+        Containers::arrayView<T>({1, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::erasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, QuadPositions, 0, 1.0f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): second index view dimension is not contiguous\n");
+}
+
+void SimplifyTest::erasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, QuadPositions, 0, 1.0f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void SimplifyTest::meshData() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13});
+
+    Containers::Pair<Trade::MeshData, Float> simplified = MeshTools::simplify(grid, 0, 1.0e-4f);
+    CORRADE_COMPARE(simplified.second(), 0.0f);
+    CORRADE_COMPARE(simplified.first().primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(simplified.first().indexType(), grid.indexType());
+    CORRADE_COMPARE(simplified.first().indexCount(), 6);
+
+    /* The vertex data and attributes are passed through unchanged */
+    CORRADE_COMPARE(simplified.first().vertexCount(), grid.vertexCount());
+    CORRADE_COMPARE(simplified.first().attributeCount(), grid.attributeCount());
+    CORRADE_COMPARE_AS(simplified.first().vertexData(),
+        grid.vertexData(),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(simplified.first().hasAttribute(Trade::MeshAttribute::Normal));
+    CORRADE_COMPARE_AS(simplified.first().positions3DAsArray(),
+        grid.positions3DAsArray(),
+        TestSuite::Compare::Container);
+
+    Containers::Pair<Float, std::size_t> area = areaNotFacingZ<UnsignedInt>(simplified.first().indicesAsArray(), simplified.first().positions3DAsArray());
+    CORRADE_COMPARE(area.first(), 4.0f);
+    CORRADE_COMPARE(area.second(), 0);
+}
+
+void SimplifyTest::meshDataNotTriangles() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::TriangleFan,
+        {}, indices, Trade::MeshIndexData{indices}, 1}, 0, 1.0f);
+    MeshTools::simplifyLodChain(Trade::MeshData{MeshPrimitive::TriangleFan,
+        {}, indices, Trade::MeshIndexData{indices}, 1}, 2);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplify(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleFan\n"
+        "MeshTools::simplifyLodChain(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleFan\n");
+}
+
+void SimplifyTest::meshDataNotIndexed() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles, 3}, 0, 1.0f);
+    MeshTools::simplifyLodChain(Trade::MeshData{MeshPrimitive::Triangles, 3}, 2);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplify(): mesh data not indexed\n"
+        "MeshTools::simplifyLodChain(): mesh data not indexed\n");
+}
+
+void SimplifyTest::meshDataImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 0}, 0, 1.0f);
+    MeshTools::simplifyLodChain(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 0}, 2);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplify(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::simplifyLodChain(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+void SimplifyTest::meshDataNoPositions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 3}, 0, 1.0f);
+    MeshTools::simplifyLodChain(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 3}, 2);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplify(): the mesh has no positions\n"
+        "MeshTools::simplifyLodChain(): the mesh has no positions\n");
+}
+
+void SimplifyTest::lodChain() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13});
+
+    /* Each level has half the indices of the previous one, until the grid
+       can't be simplified any further */
+    Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>> lods = MeshTools::simplifyLodChain(grid, 10);
+    CORRADE_COMPARE(lods.second().size(), 8);
+    const UnsignedInt expectedCounts[]{1176, 588, 294, 144, 69, 33, 15, 6};
+    UnsignedInt offset = 0;
+    for(std::size_t i = 0; i != lods.second().size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(lods.second()[i].indexOffset, offset);
+        CORRADE_COMPARE(lods.second()[i].indexCount, expectedCounts[i]);
+        CORRADE_COMPARE(lods.second()[i].error, 0.0f);
+        offset += lods.second()[i].indexCount;
+    }
+
+    /* All levels are in a single index buffer of the original type, with the
+       mesh index view covering just the first level, which is the original */
+    const Trade::MeshData& mesh = lods.first();
+    CORRADE_COMPARE(mesh.indexType(), grid.indexType());
+    CORRADE_COMPARE(mesh.indexData().size(), offset*meshIndexTypeSize(grid.indexType()));
+    CORRADE_COMPARE_AS(mesh.indicesAsArray(),
+        grid.indicesAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh.vertexCount(), grid.vertexCount());
+    CORRADE_COMPARE_AS(mesh.vertexData(),
+        grid.vertexData(),
+        TestSuite::Compare::Container);
+
+    /* Every level covers the same area */
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    const Containers::ArrayView<const UnsignedInt> allIndices = Containers::arrayCast<const UnsignedInt>(mesh.indexData());
+    for(std::size_t i = 0; i != lods.second().size(); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Pair<Float, std::size_t> area = areaNotFacingZ<UnsignedInt>(allIndices.sliceSize(lods.second()[i].indexOffset, lods.second()[i].indexCount), positions);
+        CORRADE_COMPARE(area.first(), 4.0f);
+        CORRADE_COMPARE(area.second(), 0);
+    }
+
+    /* Asking for less levels stops early */
+    Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>> lods3 = MeshTools::simplifyLodChain(grid, 3);
+    CORRADE_COMPARE(lods3.second().size(), 3);
+    CORRADE_COMPARE(lods3.second()[2].indexCount, 294);
+    CORRADE_COMPARE(lods3.first().indexData().size(), (1176 + 588 + 294)*4);
+
+    /* A single level is just a copy of the original */
+    Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>> lods1 = MeshTools::simplifyLodChain(grid, 1);
+    CORRADE_COMPARE(lods1.second().size(), 1);
+    CORRADE_COMPARE(lods1.second()[0].indexOffset, 0);
+    CORRADE_COMPARE(lods1.second()[0].indexCount, 1176);
+    CORRADE_COMPARE_AS(lods1.first().indicesAsArray(),
+        grid.indicesAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::lodChainErrorBudget() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(3);
+
+    /* The errors accumulate across the levels and the chain stops once the
+       budget is exhausted */
+    Containers::Pair<Trade::MeshData, Containers::Array<SimplifyLod>> lods = MeshTools::simplifyLodChain(sphere, 10, 0.5f, 0.02f);
+    CORRADE_COMPARE_AS(lods.second().size(), std::size_t{2},
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(lods.second().size(), std::size_t{10},
+        TestSuite::Compare::Less);
+    for(std::size_t i = 1; i != lods.second().size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(lods.second()[i].indexCount, lods.second()[i - 1].indexCount,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(lods.second()[i].error, lods.second()[i - 1].error,
+            TestSuite::Compare::Greater);
+    }
+    CORRADE_COMPARE_AS(lods.second().back().error, 0.02f,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void SimplifyTest::lodChainInvalidLodCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({1, 1});
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyLodChain(grid, 0);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyLodChain(): expected at least one level\n");
+}
+
+void SimplifyTest::lodChainInvalidRatio() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({1, 1});
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyLodChain(grid, 2, -0.5f);
+    MeshTools::simplifyLodChain(grid, 2, 1.5f);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyLodChain(): expected index count ratio to be between 0 and 1 but got -0.5\n"
+        "MeshTools::simplifyLodChain(): expected index count ratio to be between 0 and 1 but got 1.5\n");
+}
+
+void SimplifyTest::benchmark() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(5);
+    const Containers::Array<UnsignedInt> originalIndices = sphere.indicesAsArray();
+    const Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices{NoInit, originalIndices.size()};
+
+    Containers::Pair<std::size_t, Float> result;
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(originalIndices, indices);
+        result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, indices.size()/4/3*3, 1.0f);
+    }
+
+    CORRADE_COMPARE_AS(result.first(), indices.size()/4,
+        TestSuite::Compare::LessOrEqual);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
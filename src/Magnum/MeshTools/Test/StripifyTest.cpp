@@ -0,0 +1,411 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Stripify.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct StripifyTest: TestSuite::Tester {
+    explicit StripifyTest();
+
+    template<class T> void twoTriangles();
+    void disconnected();
+    void customRestartIndex();
+    void degenerate();
+    void empty();
+    template<class T> void erased();
+    void into();
+    void grid();
+
+    void wrongIndexCount();
+    void indexOutOfRange();
+    void restartIndexInRange();
+    void outputTooSmall();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void benchmark();
+};
+
+const struct {
+    const char* name;
+    StripifyFlags flags;
+    std::size_t maxIndexCount;
+    Float maxAcmr;
+} GridData[]{
+    /* Without the cache-aware ordering, new strips are started in the
+       shuffled input order, so there's more of them and consecutive strips
+       don't share vertices */
+    {"", {}, 800, 1.5f},
+    {"vertex cache order", StripifyFlag::VertexCacheOrder, 600, 1.0f},
+};
+
+const struct {
+    const char* name;
+    StripifyFlags flags;
+} BenchmarkData[]{
+    {"", {}},
+    {"vertex cache order", StripifyFlag::VertexCacheOrder},
+};
+
+StripifyTest::StripifyTest() {
+    addTests({&StripifyTest::twoTriangles<UnsignedByte>,
+              &StripifyTest::twoTriangles<UnsignedShort>,
+              &StripifyTest::twoTriangles<UnsignedInt>,
+              &StripifyTest::disconnected,
+              &StripifyTest::customRestartIndex,
+              &StripifyTest::degenerate,
+              &StripifyTest::empty,
+              &StripifyTest::erased<UnsignedByte>,
+              &StripifyTest::erased<UnsignedShort>,
+              &StripifyTest::erased<UnsignedInt>,
+              &StripifyTest::into});
+
+    addInstancedTests({&StripifyTest::grid},
+        Containers::arraySize(GridData));
+
+    addTests({&StripifyTest::wrongIndexCount,
+              &StripifyTest::indexOutOfRange,
+              &StripifyTest::restartIndexInRange,
+              &StripifyTest::outputTooSmall,
+              &StripifyTest::erasedNonContiguous,
+              &StripifyTest::erasedWrongIndexSize});
+
+    addInstancedBenchmarks({&StripifyTest::benchmark}, 5,
+        Containers::arraySize(BenchmarkData));
+}
+
+/* Triangles rotated to start with the smallest index and sorted, to check
+   that the decoded strips have the same triangles with the same winding as
+   the input */
+Containers::Array<Vector3ui> sortedTriangles(const Containers::ArrayView<const Vector3ui> triangles) {
+    Containers::Array<Vector3ui> out{NoInit, triangles.size()};
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        Vector3ui triangle = triangles[i];
+        while(triangle[0] != triangle.min())
+            triangle = {triangle[1], triangle[2], triangle[0]};
+        out[i] = triangle;
+    }
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        return std::make_tuple(a[0], a[1], a[2]) < std::make_tuple(b[0], b[1], b[2]);
+    });
+    return out;
+}
+
+/* Decodes strips joined with restart indices back to a triangle list, the
+   way a GPU would rasterize them. Odd triangles in each strip have the first
+   two vertices swapped to preserve winding, degenerate triangles are
+   skipped. */
+Containers::Array<Vector3ui> decodeStrips(const Containers::ArrayView<const UnsignedInt> strips, const UnsignedInt restartIndex) {
+    Containers::Array<Vector3ui> out;
+    std::size_t stripBegin = 0;
+    for(std::size_t i = 0; i <= strips.size(); ++i) {
+        if(i != strips.size() && strips[i] != restartIndex)
+            continue;
+
+        for(std::size_t k = stripBegin; k + 2 < i; ++k) {
+            Vector3ui triangle{strips[k], strips[k + 1], strips[k + 2]};
+            if((k - stripBegin) % 2)
+                std::swap(triangle[0], triangle[1]);
+            if(triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0])
+                continue;
+            arrayAppend(out, triangle);
+        }
+
+        stripBegin = i + 1;
+    }
+    return out;
+}
+
+/* Same as in OptimizeTest, except that restart indices are skipped and the
+   result is relative to the original triangle count */
+Float acmr(const Containers::ArrayView<const UnsignedInt> strips, const UnsignedInt vertexCount, const UnsignedInt restartIndex, const std::size_t triangleCount) {
+    Containers::Array<UnsignedInt> timestamps{ValueInit, vertexCount};
+    UnsignedInt time = 17;
+    UnsignedInt misses = 0;
+    for(const UnsignedInt index: strips) {
+        if(index == restartIndex) continue;
+        if(time - timestamps[index] > 16) {
+            timestamps[index] = time++;
+            ++misses;
+        }
+    }
+    return Float(misses)/Float(triangleCount);
+}
+
+/* A 16x16 grid, which has exactly 256 vertices, with triangles shuffled so
+   adjacent triangles aren't next to each other in the input */
+Containers::Array<UnsignedInt> shuffledGrid(const Trade::MeshData& grid) {
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const std::size_t triangleCount = indices.size()/3;
+    Containers::Array<UnsignedInt> shuffled{NoInit, indices.size()};
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        /* 97 is coprime with the triangle count so this is a permutation */
+        const std::size_t j = (i*97) % triangleCount;
+        for(std::size_t k = 0; k != 3; ++k)
+            shuffled[i*3 + k] = indices[j*3 + k];
+    }
+    return shuffled;
+}
+
+template<class T> void StripifyTest::twoTriangles() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two triangles sharing the 2 -> 1 edge form a single strip */
+    const T indices[]{
+        0, 1, 2,
+        2, 1, 3
+    };
+
+    CORRADE_COMPARE_AS(MeshTools::stripify(Containers::stridedArrayView(indices), 4),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void StripifyTest::disconnected() {
+    /* The first triangle has to be rotated for the second to continue the
+       strip, the last one is disconnected and gets a strip on its own */
+    const UnsignedInt indices[]{
+        1, 2, 0,
+        2, 1, 3,
+        4, 5, 6
+    };
+
+    CORRADE_COMPARE_AS(MeshTools::stripify(Containers::stridedArrayView(indices), 7),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 0xffffffffu, 4, 5, 6}),
+        TestSuite::Compare::Container);
+}
+
+void StripifyTest::customRestartIndex() {
+    const UnsignedShort indices[]{
+        0, 1, 2,
+        3, 4, 5
+    };
+
+    CORRADE_COMPARE_AS(MeshTools::stripify(Containers::stridedArrayView(indices), 6, 0xffff),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0xffff, 3, 4, 5}),
+        TestSuite::Compare::Container);
+}
+
+void StripifyTest::degenerate() {
+    /* Degenerate triangles don't render anything so they're dropped */
+    const UnsignedInt indices[]{
+        0, 0, 1,
+        0, 1, 2,
+        2, 2, 2
+    };
+
+    CORRADE_COMPARE_AS(MeshTools::stripify(Containers::stridedArrayView(indices), 3),
+        Containers::arrayView<UnsignedInt>({0, 1, 2}),
+        TestSuite::Compare::Container);
+}
+
+void StripifyTest::empty() {
+    CORRADE_COMPARE(MeshTools::stripify(Containers::StridedArrayView1D<const UnsignedInt>{}, 0).size(), 0);
+    CORRADE_COMPARE(MeshTools::stripifyInto(Containers::StridedArrayView1D<const UnsignedInt>{}, 0, Containers::StridedArrayView1D<UnsignedInt>{}), 0);
+}
+
+template<class T> void StripifyTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{
+        0, 1, 2,
+        2, 1, 3
+    };
+
+    CORRADE_COMPARE_AS(MeshTools::stripify(
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 4),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+
+    UnsignedInt output[8];
+    CORRADE_COMPARE(MeshTools::stripifyInto(
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 4, output), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(output).prefix(4),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void StripifyTest::into() {
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        3, 4, 5
+    };
+
+    /* The output has to be large enough for the worst case of every triangle
+       being a separate strip, the actual size is returned. The rest of the
+       output isn't touched. */
+    UnsignedInt output[9]{
+        100, 100, 100, 100, 100, 100, 100, 100, 100
+    };
+    CORRADE_COMPARE(MeshTools::stripifyInto(Containers::stridedArrayView(indices), 6, output, 77), 7);
+    CORRADE_COMPARE_AS(Containers::arrayView(output),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 77, 3, 4, 5, 100, 100}),
+        TestSuite::Compare::Container);
+}
+
+void StripifyTest::grid() {
+    auto&& data = GridData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({14, 14});
+    CORRADE_COMPARE(grid.vertexCount(), 256);
+    Containers::Array<UnsignedInt> indices = shuffledGrid(grid);
+    const std::size_t triangleCount = indices.size()/3;
+
+    Containers::Array<UnsignedInt> strips = MeshTools::stripify(Containers::stridedArrayView(indices), grid.vertexCount(), 0xffffffffu, data.flags);
+
+    /* Decoded strips give back the exact same triangles with the same
+       winding */
+    CORRADE_COMPARE_AS(sortedTriangles(decodeStrips(strips, 0xffffffffu)),
+        sortedTriangles(Containers::arrayCast<const Vector3ui>(indices)),
+        TestSuite::Compare::Container);
+
+    /* The strips are significantly smaller than the triangle list and in
+       case of cache-aware ordering also better than the 3.0 ACMR of the
+       shuffled input */
+    CORRADE_COMPARE_AS(strips.size(), data.maxIndexCount,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(acmr(strips, grid.vertexCount(), 0xffffffffu, triangleCount), data.maxAcmr,
+        TestSuite::Compare::Less);
+}
+
+void StripifyTest::wrongIndexCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[4]{};
+    UnsignedInt output[4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::stripifyInto(Containers::stridedArrayView(indices), 1, output);
+    CORRADE_COMPARE(out,
+        "MeshTools::stripifyInto(): index count not divisible by 3\n");
+}
+
+void StripifyTest::indexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+    UnsignedInt output[8];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::stripifyInto(Containers::stridedArrayView(indices), 3, output);
+    CORRADE_COMPARE(out,
+        "MeshTools::stripifyInto(): index 3 out of range for 3 vertices\n");
+}
+
+void StripifyTest::restartIndexInRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2};
+    UnsignedInt output[4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::stripifyInto(Containers::stridedArrayView(indices), 3, output, 2);
+    CORRADE_COMPARE(out,
+        "MeshTools::stripifyInto(): restart index 2 is in range for 3 vertices\n");
+}
+
+void StripifyTest::outputTooSmall() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+    UnsignedInt output[7];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::stripifyInto(Containers::stridedArrayView(indices), 4, output);
+    CORRADE_COMPARE(out,
+        "MeshTools::stripifyInto(): expected output to have at least 8 items but got 7\n");
+}
+
+void StripifyTest::erasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+    UnsignedInt output[8];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::stripifyInto(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 1, output);
+    MeshTools::stripify(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::stripifyInto(): second index view dimension is not contiguous\n"
+        "MeshTools::stripify(): second index view dimension is not contiguous\n");
+}
+
+void StripifyTest::erasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+    UnsignedInt output[8];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::stripifyInto(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, 1, output);
+    MeshTools::stripify(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, 1);
+    CORRADE_COMPARE(out,
+        "MeshTools::stripifyInto(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::stripify(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void StripifyTest::benchmark() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData grid = Primitives::grid3DSolid({255, 255});
+    const Containers::Array<UnsignedInt> indices = shuffledGrid(grid);
+    Containers::Array<UnsignedInt> output{NoInit, indices.size()/3*4};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        count = MeshTools::stripifyInto(Containers::stridedArrayView(indices), grid.vertexCount(), output, 0xffffffffu, data.flags);
+    }
+
+    CORRADE_COMPARE_AS(count, indices.size(),
+        TestSuite::Compare::Less);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::StripifyTest)
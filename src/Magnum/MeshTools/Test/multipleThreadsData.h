@@ -0,0 +1,51 @@
+#ifndef Magnum_MeshTools_Test_multipleThreadsData_h
+#define Magnum_MeshTools_Test_multipleThreadsData_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+/* Thread counts for instanced tests of the multi-threaded algorithms. The
+   test data are expected to be large enough for the algorithms to use more
+   than one thread. */
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultipleThreadsData[]{
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"7 threads", 7},
+    {"hardware concurrency", 0},
+    /* Should get clamped to a reasonable count for the data size */
+    {"more threads than items", 1000000}
+};
+
+}}}}
+
+#endif
@@ -28,6 +28,7 @@
 
 #include <Corrade/Containers/Optional.h>
 
+#include "Magnum/Math/TransformBatch.h"
 #include "Magnum/MeshTools/Filter.h"
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/Trade/MeshData.h"
@@ -126,9 +127,8 @@ void transform2DInPlace(Trade::MeshData& mesh, const Matrix3& transformation, co
     CORRADE_ASSERT(mesh.attributeFormat(*positionAttributeId) == VertexFormat::Vector2,
         "MeshTools::transform2DInPlace(): expected" << VertexFormat::Vector2 << "positions but got" << mesh.attributeFormat(*positionAttributeId), );
 
-    /** @todo this needs a proper batch implementation */
-    for(Vector2& position: mesh.mutableAttribute<Vector2>(*positionAttributeId))
-        position = transformation.transformPoint(position);
+    const Containers::StridedArrayView1D<Vector2> positions = mesh.mutableAttribute<Vector2>(*positionAttributeId);
+    Math::transformPointsInto(transformation, positions, positions);
 }
 
 Trade::MeshData transform3D(const Trade::MeshData& mesh, const Matrix4& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
@@ -284,32 +284,36 @@ void transform3DInPlace(Trade::MeshData& mesh, const Matrix4& transformation, co
     CORRADE_ASSERT(!normalAttributeId || mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3,
         "MeshTools::transform3DInPlace(): expected" << VertexFormat::Vector3 << "normals but got" << mesh.attributeFormat(*normalAttributeId), );
 
-    /** @todo this needs a proper batch implementation */
-    for(Vector3& position: mesh.mutableAttribute<Vector3>(*positionAttributeId))
-        position = transformation.transformPoint(position);
+    const Containers::StridedArrayView1D<Vector3> positions = mesh.mutableAttribute<Vector3>(*positionAttributeId);
+    Math::transformPointsInto(transformation, positions, positions);
 
     /* If no other attributes are present, nothing to do */
     if(!tangentAttributeId && !bitangentAttributeId && !normalAttributeId)
         return;
 
     const Matrix3x3 normalMatrix = transformation.normalMatrix();
+    /* The normals aren't renormalized, so not using transformNormalsInto()
+       but a plain vector transformation with the normal matrix */
+    const Matrix4 normalTransformation = Matrix4::from(normalMatrix, {});
     if(tangentAttributeId) {
-    /** @todo this needs a proper batch implementation */
-        if(tangentAttributeFormat == VertexFormat::Vector3)
-            for(Vector3& tangent: mesh.mutableAttribute<Vector3>(*tangentAttributeId))
-                tangent = normalMatrix*tangent;
-        else for(Vector4& tangent: mesh.mutableAttribute<Vector4>(*tangentAttributeId)) {
+        if(tangentAttributeFormat == VertexFormat::Vector3) {
+            const Containers::StridedArrayView1D<Vector3> tangents = mesh.mutableAttribute<Vector3>(*tangentAttributeId);
+            Math::transformVectorsInto(normalTransformation, tangents, tangents);
+        /** @todo this needs a proper batch implementation */
+        } else for(Vector4& tangent: mesh.mutableAttribute<Vector4>(*tangentAttributeId)) {
             tangent.xyz() = normalMatrix*tangent.xyz();
             /** @todo figure out the fourth component, probably has to get
                 flipped when the scale changes handedness? */
         }
     }
-    /** @todo this needs a proper batch implementation */
-    if(bitangentAttributeId) for(Vector3& bitangent: mesh.mutableAttribute<Vector3>(*bitangentAttributeId))
-        bitangent = normalMatrix*bitangent;
-    /** @todo this needs a proper batch implementation */
-    if(normalAttributeId) for(Vector3& normal: mesh.mutableAttribute<Vector3>(*normalAttributeId))
-        normal = normalMatrix*normal;
+    if(bitangentAttributeId) {
+        const Containers::StridedArrayView1D<Vector3> bitangents = mesh.mutableAttribute<Vector3>(*bitangentAttributeId);
+        Math::transformVectorsInto(normalTransformation, bitangents, bitangents);
+    }
+    if(normalAttributeId) {
+        const Containers::StridedArrayView1D<Vector3> normals = mesh.mutableAttribute<Vector3>(*normalAttributeId);
+        Math::transformVectorsInto(normalTransformation, normals, normals);
+    }
 }
 
 Trade::MeshData transformTextureCoordinates2D(const Trade::MeshData& mesh, const Matrix3& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
@@ -401,9 +405,8 @@ void transformTextureCoordinates2DInPlace(Trade::MeshData& mesh, const Matrix3&
     CORRADE_ASSERT(mesh.attributeFormat(*textureCoordinateAttributeId) == VertexFormat::Vector2,
         "MeshTools::transformTextureCoordinates2DInPlace(): expected" << VertexFormat::Vector2 << "texture coordinates but got" << mesh.attributeFormat(*textureCoordinateAttributeId), );
 
-    /** @todo this needs a proper batch implementation */
-    for(Vector2& position: mesh.mutableAttribute<Vector2>(*textureCoordinateAttributeId))
-        position = transformation.transformPoint(position);
+    const Containers::StridedArrayView1D<Vector2> textureCoordinates = mesh.mutableAttribute<Vector2>(*textureCoordinateAttributeId);
+    Math::transformPointsInto(transformation, textureCoordinates, textureCoordinates);
 }
 
 }}
@@ -1240,7 +1240,8 @@ enum class CompressedPixelFormat: UnsignedInt {
      * @ref Vk::PixelFormat::CompressedBc6hRGBUfloat;
      * @m_class{m-doc-external} [DXGI_FORMAT_BC6H_UF16](https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format)
      * or @m_class{m-doc-external} [MTLPixelFormatBC6H_RGBUfloat](https://developer.apple.com/documentation/metal/mtlpixelformat/mtlpixelformatbc6h_rgbufloat?language=objc).
-     * @see @relativeref{Trade,BcDecImageConverter}
+     * @see @ref Math::yFlipBc6hInPlace(),
+     *      @relativeref{Trade,BcDecImageConverter}
      * @m_keywords{DXGI_FORMAT_BC6H_UF16 MTLPixelFormatBC6H_RGBUfloat}
      * @m_since{2019,10}
      */
@@ -1255,7 +1256,8 @@ enum class CompressedPixelFormat: UnsignedInt {
      * @ref Vk::PixelFormat::CompressedBc6hRGBSfloat;
      * @m_class{m-doc-external} [DXGI_FORMAT_BC6H_SF16](https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format)
      * or @m_class{m-doc-external} [MTLPixelFormatBC6H_RGBFloat](https://developer.apple.com/documentation/metal/mtlpixelformat/mtlpixelformatbc6h_rgbfloat?language=objc).
-     * @see @relativeref{Trade,BcDecImageConverter}
+     * @see @ref Math::yFlipBc6hInPlace(),
+     *      @relativeref{Trade,BcDecImageConverter}
      * @m_keywords{DXGI_FORMAT_BC6H_UF16 MTLPixelFormatBC6H_RGBFloat}
      * @m_since{2019,10}
      */
@@ -1270,7 +1272,8 @@ enum class CompressedPixelFormat: UnsignedInt {
      * @ref Vk::PixelFormat::CompressedBc7RGBAUnorm;
      * @m_class{m-doc-external} [DXGI_FORMAT_BC7_UNORM](https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format)
      * or @m_class{m-doc-external} [MTLPixelFormatBC7_RGBAUnorm](https://developer.apple.com/documentation/metal/mtlpixelformat/mtlpixelformatbc7_rgbaunorm?language=objc).
-     * @see @relativeref{Trade,BcDecImageConverter}
+     * @see @ref Math::yFlipBc7InPlace(),
+     *      @relativeref{Trade,BcDecImageConverter}
      * @m_keywords{DXGI_FORMAT_BC7_UNORM MTLPixelFormatBC7_RGBAUnorm}
      * @m_since{2019,10}
      */
@@ -1285,7 +1288,8 @@ enum class CompressedPixelFormat: UnsignedInt {
      * @ref Vk::PixelFormat::CompressedBc7RGBASrgb;
      * @m_class{m-doc-external} [DXGI_FORMAT_BC7_UNORM_SRGB](https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format)
      * or @m_class{m-doc-external} [MTLPixelFormatBC7_RGBAUnorm_sRGB](https://developer.apple.com/documentation/metal/mtlpixelformat/mtlpixelformatbc7_rgbaunorm_srgb?language=objc).
-     * @see @relativeref{Trade,BcDecImageConverter}
+     * @see @ref Math::yFlipBc7InPlace(),
+     *      @relativeref{Trade,BcDecImageConverter}
      * @m_keywords{DXGI_FORMAT_BC7_UNORM_SRGB MTLPixelFormatBC7_RGBAUnorm_sRGB}
      * @m_since{2019,10}
      */
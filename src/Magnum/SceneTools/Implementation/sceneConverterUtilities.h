@@ -47,6 +47,12 @@
 
 #include "Magnum/Trade/Implementation/converterUtilities.h"
 
+/* The mesh analysis needs MeshTools, which the magnum-sceneconverter
+   executable always links to. Tests can be built without it. */
+#ifndef MAGNUM_SCENECONVERTER_NO_MESHTOOLS
+#include "Magnum/MeshTools/Analyze.h"
+#endif
+
 namespace Magnum { namespace SceneTools { namespace Implementation {
 
 using namespace Containers::Literals;
@@ -139,6 +145,10 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
         Containers::String indexBounds;
         MeshIndexType indexType;
         Containers::Array<MeshAttributeInfo> attributes;
+        #ifndef MAGNUM_SCENECONVERTER_NO_MESHTOOLS
+        Containers::Optional<MeshTools::VertexCacheStatistics> vertexCache;
+        Containers::Optional<MeshTools::VertexFetchStatistics> vertexFetch;
+        #endif
         std::size_t indexDataSize, vertexDataSize;
         Trade::DataFlags indexDataFlags, vertexDataFlags;
         Containers::String name;
@@ -463,6 +473,9 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
 
     /* Mesh properties */
     const bool showBounds = args.isSet("bounds");
+    #ifndef MAGNUM_SCENECONVERTER_NO_MESHTOOLS
+    const bool showAnalysis = args.isSet("analyze");
+    #endif
     Containers::Array<MeshInfo> meshInfos;
     if(args.isSet("info") || args.isSet("info-meshes")) for(UnsignedInt i = 0; i != importer.meshCount(); ++i) {
         for(UnsignedInt j = 0; j != importer.meshLevelCount(i); ++j) {
@@ -495,6 +508,27 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
                 info.indexDataFlags = mesh->indexDataFlags();
                 if(showBounds)
                     info.indexBounds = calculateBounds(mesh->indicesAsArray());
+
+                #ifndef MAGNUM_SCENECONVERTER_NO_MESHTOOLS
+                /* Analyze the vertex cache and vertex fetch efficiency, if
+                   requested. The analysis asserts on out-of-range indices
+                   and unknown formats, so check those first to not die on
+                   broken files. */
+                if(showAnalysis && !isMeshIndexTypeImplementationSpecific(mesh->indexType()) && mesh->indexCount() && Math::max<UnsignedInt>(mesh->indicesAsArray()) < mesh->vertexCount()) {
+                    if(mesh->primitive() == MeshPrimitive::Triangles && mesh->indexCount() % 3 == 0)
+                        info.vertexCache = MeshTools::analyzeVertexCache(*mesh);
+
+                    bool knownFormats = true;
+                    for(UnsignedInt k = 0; k != mesh->attributeCount(); ++k) {
+                        if(isVertexFormatImplementationSpecific(mesh->attributeFormat(k))) {
+                            knownFormats = false;
+                            break;
+                        }
+                    }
+                    if(knownFormats && mesh->attributeCount())
+                        info.vertexFetch = MeshTools::analyzeVertexFetch(*mesh);
+                }
+                #endif
             }
             for(UnsignedInt k = 0; k != mesh->attributeCount(); ++k) {
                 const Trade::MeshAttribute name = mesh->attributeName(k);
@@ -1085,6 +1119,16 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
             d << Debug::nospace << ")";
             if(info.indexBounds)
                 d << Debug::newline << "      Bounds:" << info.indexBounds;
+            #ifndef MAGNUM_SCENECONVERTER_NO_MESHTOOLS
+            if(info.vertexCache)
+                d << Debug::newline << "      Vertex cache: ACMR"
+                    << Utility::format("{:.3f}", info.vertexCache->acmr)
+                    << Debug::nospace << ", ATVR"
+                    << Utility::format("{:.3f}", info.vertexCache->atvr);
+            if(info.vertexFetch)
+                d << Debug::newline << "      Vertex fetch: overfetch"
+                    << Utility::format("{:.3f}", info.vertexFetch->overfetch);
+            #endif
         }
 
         totalMeshDataSize += info.vertexDataSize + info.indexDataSize;
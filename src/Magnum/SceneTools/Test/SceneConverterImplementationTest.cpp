@@ -58,6 +58,7 @@ struct SceneConverterImplementationTest: TestSuite::Tester {
     void infoMaterials();
     void infoMeshes();
     void infoMeshesBounds();
+    void infoMeshesAnalyze();
     void infoTextures();
     void infoImages();
     /* Image info further tested in ImageConverterImplementationTest */
@@ -143,7 +144,8 @@ SceneConverterImplementationTest::SceneConverterImplementationTest() {
                        &SceneConverterImplementationTest::infoMeshes},
         Containers::arraySize(InfoOneOrAllData));
 
-    addTests({&SceneConverterImplementationTest::infoMeshesBounds});
+    addTests({&SceneConverterImplementationTest::infoMeshesBounds,
+              &SceneConverterImplementationTest::infoMeshesAnalyze});
 
     addInstancedTests({&SceneConverterImplementationTest::infoTextures,
                        &SceneConverterImplementationTest::infoImages},
@@ -165,6 +167,7 @@ SceneConverterImplementationTest::SceneConverterImplementationTest() {
              .addBooleanOption("info-textures")
              .addBooleanOption("info-images")
              .addBooleanOption("bounds")
+             .addBooleanOption("analyze")
              .addBooleanOption("object-hierarchy");
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
@@ -856,6 +859,66 @@ void SceneConverterImplementationTest::infoMeshesBounds() {
         TestSuite::Compare::StringToFile);
 }
 
+void SceneConverterImplementationTest::infoMeshesAnalyze() {
+    #ifdef MAGNUM_SCENECONVERTER_NO_MESHTOOLS
+    CORRADE_SKIP("MeshTools not enabled, can't test mesh analysis.");
+    #else
+    struct Importer: Trade::AbstractImporter {
+        Trade::ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 4; }
+        Containers::Optional<Trade::MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+            /* Indexed triangles, both vertex cache and vertex fetch is
+               analyzed. All four vertices are transformed exactly once, and
+               all 48 bytes of vertex data fit into a single 64-byte line. */
+            if(id == 0) return Trade::MeshData{MeshPrimitive::Triangles,
+                {}, triangleIndices, Trade::MeshIndexData{triangleIndices},
+                {}, triangleVertices, {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(triangleVertices)}
+                }};
+            /* Indexed lines, only vertex fetch is analyzed */
+            if(id == 1) return Trade::MeshData{MeshPrimitive::Lines,
+                {}, lineIndices, Trade::MeshIndexData{lineIndices},
+                {}, lineVertices, {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(lineVertices)}
+                }};
+            /* Out-of-range index, nothing is analyzed */
+            if(id == 2) return Trade::MeshData{MeshPrimitive::Triangles,
+                {}, outOfRangeIndices, Trade::MeshIndexData{outOfRangeIndices},
+                {}, triangleVertices, {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(triangleVertices)}
+                }};
+            /* Non-indexed, nothing is analyzed */
+            if(id == 3) return Trade::MeshData{MeshPrimitive::Triangles,
+                {}, triangleVertices, {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(triangleVertices)}
+                }};
+            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+        }
+
+        UnsignedByte triangleIndices[6]{0, 1, 2, 2, 1, 3};
+        Vector3 triangleVertices[4]{};
+        UnsignedShort lineIndices[2]{0, 1};
+        Vector2 lineVertices[2]{};
+        UnsignedByte outOfRangeIndices[3]{0, 1, 4};
+    } importer;
+
+    const char* argv[]{"", "--info-meshes", "--analyze"};
+    CORRADE_VERIFY(_infoArgs.tryParse(Containers::arraySize(argv), argv));
+
+    std::chrono::high_resolution_clock::duration time;
+
+    Containers::String out;
+    Debug redirectOutput{&out};
+    CORRADE_VERIFY(Implementation::printInfo(Debug::Flag::DisableColors, false, _infoArgs, importer, time) == false);
+    CORRADE_COMPARE_AS(out,
+        Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterImplementationTestFiles/info-meshes-analyze.txt"),
+        TestSuite::Compare::StringToFile);
+    #endif
+}
+
 void SceneConverterImplementationTest::infoTextures() {
     auto&& data = InfoOneOrAllData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
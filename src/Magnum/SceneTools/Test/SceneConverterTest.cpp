@@ -348,6 +348,41 @@ const struct {
         "Mesh 0 fuzzy duplicate removal: 5 -> 4 vertices\n"
         "Mesh 1 fuzzy duplicate removal: 6 -> 4 vertices\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    {"one implicit mesh, simplify", {InPlaceInit, {
+            "--simplify", "0.5",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-center.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-center-simplified.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* The center vertex gets collapsed to the first corner, the vertex
+           data stay the same */
+        "quad-center-simplified.ply", nullptr,
+        {}},
+    {"one implicit mesh, simplify, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--simplify", "0.5", "-v",
+            "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-center.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-center-simplified.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        "quad-center-simplified.ply", nullptr,
+        "Mesh 0 simplification: 12 -> 6 indices, error 0\n"},
+    {"one implicit mesh, simplify with an error limit, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--simplify", "0", "--simplify-error", "0", "-v",
+            "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-center.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/quad-center-simplified.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* Collapsing the center vertex has a zero error, collapsing any of
+           the corners would change the shape, so it stops at the same point
+           as with a 0.5 ratio above */
+        "quad-center-simplified.ply", nullptr,
+        "Mesh 0 simplification: 12 -> 6 indices, error 0\n"},
     {"one implicit mesh, two converters", {InPlaceInit, {
             /* Unfortunately *have to* use an option to make the output
                predictable. Using --set instead of -c as in this case as we
@@ -1038,6 +1073,31 @@ const struct {
         }},
         nullptr, nullptr, nullptr, nullptr,
         "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes\n"},
+    {"--simplify out of range", {InPlaceInit, {
+            "--simplify", "1.5", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify option expects a ratio between 0 and 1, got 1.5\n"},
+    {"--simplify not a number", {InPlaceInit, {
+            "--simplify", "half", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify option expects a ratio between 0 and 1, got half\n"},
+    {"--simplify-error negative", {InPlaceInit, {
+            "--simplify", "0.5", "--simplify-error", "-0.1", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify-error option expects a non-negative value, got -0.1\n"},
+    {"--simplify-error NaN", {InPlaceInit, {
+            "--simplify", "0.5", "--simplify-error", "nan", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify-error option expects a non-negative value, got nan\n"},
+    {"--simplify-error not a number", {InPlaceInit, {
+            "--simplify", "0.5", "--simplify-error", "1e-2x", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify-error option expects a non-negative value, got 1e-2x\n"},
     {"--prefer without a colon", {InPlaceInit, {
             "--prefer", "PngImporter=StbImageImporter", "a", "b",
         }},
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdlib> /* std::strtof() */
 #include <sstream>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
@@ -39,6 +40,7 @@
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Copy.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Simplify.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
@@ -185,8 +187,8 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [-M|--mesh-converter PLUGIN]... [--plugin-dir DIR]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
     [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
-    [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
-    [--remove-duplicate-materials]
+    [--remove-duplicate-vertices-fuzzy EPSILON] [--simplify RATIO]
+    [--simplify-error ERROR] [--phong-to-pbr] [--remove-duplicate-materials]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
@@ -198,7 +200,8 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [--info-images] [--info-lights] [--info-cameras] [--info-materials]
     [--info-meshes] [--info-objects] [--info-scenes] [--info-skins]
     [--info-textures] [--info] [--color on|4bit|off|auto] [--bounds]
-    [--object-hierarchy] [-v|--verbose] [--profile] [--] input output
+    [--analyze] [--object-hierarchy] [-v|--verbose] [--profile] [--]
+    input output
 @endcode
 
 Arguments:
@@ -229,6 +232,11 @@ Arguments:
 -   `--remove-duplicate-vertices-fuzzy EPSILON` --- remove duplicate vertices
     using @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double)
     in all meshes after import
+-   `--simplify RATIO` --- simplify all indexed triangle meshes after import
+    and duplicate removal to given ratio of the original index count using
+    @ref MeshTools::simplify(const Trade::MeshData&, std::size_t, Float, MeshTools::SimplifyFlags)
+-   `--simplify-error ERROR` --- relative error limit for `--simplify`
+    (default: `0.01`)
 -   `--phong-to-pbr` --- convert Phong materials to PBR metallic/roughness
     using @ref MaterialTools::phongToPbrMetallicRoughness()
 -   `--remove-duplicate-materials` --- remove duplicate materials using
@@ -270,6 +278,11 @@ Arguments:
     as specifying all other data-related `--info-*` options together
 -   `--color` --- colored output for `--info` (default: `auto`)
 -   `--bounds` --- show bounds of known attributes in `--info` output
+-   `--analyze` --- show vertex cache and vertex fetch efficiency of indexed
+    meshes in `--info` output, calculated with
+    @ref MeshTools::analyzeVertexCache(const Trade::MeshData&, MeshTools::VertexCacheModel, UnsignedInt)
+    and @ref MeshTools::analyzeVertexFetch(const Trade::MeshData&, UnsignedInt, UnsignedInt)
+    using a 16-entry FIFO cache and 64-byte cache lines
 -   `--object-hierarchy` --- visualize object hierarchy in `--info` output
 -   `-v`, `--verbose` --- verbose output from importer and converter plugins
 -   `--profile` --- measure import and conversion time
@@ -334,6 +347,17 @@ using namespace Containers::Literals;
 
 namespace {
 
+/* Utility::Arguments::value<Float>() silently turns anything that isn't a
+   number into zero, which isn't desirable for options where zero is a valid
+   but drastic value */
+Containers::Optional<Float> parseFloat(const Containers::StringView value) {
+    char* end;
+    const Float result = std::strtof(value.data(), &end);
+    if(end == value.data() || end != value.end())
+        return {};
+    return result;
+}
+
 bool isPluginInfoRequested(const Utility::Arguments& args) {
     return args.isSet("info-importer") ||
            args.isSet("info-converter") ||
@@ -437,6 +461,8 @@ int main(int argc, char** argv) {
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
+        .addOption("simplify").setHelp("simplify", "simplify all indexed triangle meshes after import and duplicate removal to given ratio of the original index count", "RATIO")
+        .addOption("simplify-error", "0.01").setHelp("simplify-error", "relative error limit for --simplify", "ERROR")
         .addBooleanOption("phong-to-pbr").setHelp("phong-to-pbr", "convert Phong materials to PBR metallic/roughness")
         .addBooleanOption("remove-duplicate-materials").setHelp("remove-duplicate-materials", "remove duplicate materials")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
@@ -464,6 +490,7 @@ int main(int argc, char** argv) {
         .addBooleanOption("info").setHelp("info", "print info about everything in the input file and exit, same as specifying all other data-related --info-* options together")
         .addOption("color", "auto").setHelp("color", "colored output for --info", "on|4bit|off|auto")
         .addBooleanOption("bounds").setHelp("bounds", "show bounds of known attributes in --info output")
+        .addBooleanOption("analyze").setHelp("analyze", "show vertex cache and vertex fetch efficiency of indexed meshes in --info output")
         .addBooleanOption("object-hierarchy").setHelp("object-hierarchy", "visualize object hierarchy in --info output")
         .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
         .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
@@ -575,6 +602,21 @@ well, the IDs reference attributes of the first mesh.)")
         Error{} << "The --mesh-level option can only be used with --mesh";
         return 1;
     }
+    Float simplifyRatio{};
+    if(args.value<Containers::StringView>("simplify")) {
+        const Containers::Optional<Float> ratio = parseFloat(args.value<Containers::StringView>("simplify"));
+        if(!ratio || !(*ratio >= 0.0f && *ratio <= 1.0f)) {
+            Error{} << "The --simplify option expects a ratio between 0 and 1, got" << args.value<Containers::StringView>("simplify");
+            return 1;
+        }
+        simplifyRatio = *ratio;
+    }
+    const Containers::Optional<Float> simplifyError = parseFloat(args.value<Containers::StringView>("simplify-error"));
+    /* Written this way to reject NaNs as well */
+    if(!simplifyError || !(*simplifyError >= 0.0f)) {
+        Error{} << "The --simplify-error option expects a non-negative value, got" << args.value<Containers::StringView>("simplify-error");
+        return 1;
+    }
     /** @todo remove this once only-mesh-attributes can work with attribute
         names and thus for more meshes */
     if(args.value<Containers::StringView>("only-mesh-attributes") && !args.value<Containers::StringView>("mesh") && !args.isSet("concatenate-meshes")) {
@@ -1034,6 +1076,7 @@ well, the IDs reference attributes of the first mesh.)")
     Containers::Array<Trade::MeshData> meshes;
     if(args.isSet("remove-duplicate-vertices") ||
        args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
+       args.value<Containers::StringView>("simplify") ||
        args.arrayValueCount("mesh-converter"))
     {
         const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
@@ -1083,6 +1126,32 @@ well, the IDs reference attributes of the first mesh.)")
                 }
             }
 
+            /* Simplification */
+            if(args.value<Containers::StringView>("simplify")) {
+                if(mesh->primitive() != MeshPrimitive::Triangles || !mesh->isIndexed() || isMeshIndexTypeImplementationSpecific(mesh->indexType()) || !mesh->hasAttribute(Trade::MeshAttribute::Position)) {
+                    Warning{} << "Mesh" << i << "is not an indexed triangle mesh with positions, skipping simplification";
+                } else {
+                    const UnsignedInt beforeIndexCount = mesh->indexCount();
+                    Float error;
+                    {
+                        Trade::Implementation::Duration d{conversionTime};
+                        Containers::Pair<Trade::MeshData, Float> simplified = MeshTools::simplify(*Utility::move(mesh), std::size_t(beforeIndexCount*simplifyRatio)/3*3, *simplifyError);
+                        mesh = Utility::move(simplified.first());
+                        error = simplified.second();
+                    }
+
+                    if(args.isSet("verbose")) {
+                        Debug d;
+                        /* Same as with duplicate removal above */
+                        if(singleMesh)
+                            d << "Simplification:";
+                        else
+                            d << "Mesh" << i << "simplification:";
+                        d << beforeIndexCount << "->" << mesh->indexCount() << "indices, error" << error;
+                    }
+                }
+            }
+
             /* Arbitrary mesh converters */
             for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
                 const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
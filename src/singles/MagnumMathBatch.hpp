@@ -45,6 +45,10 @@
    a (slower) fallback instead. */
 #pragma ACME enable MAGNUM_SINGLES_NO_UTILITY_ALGORITHMS_DEPENDENCY
 
+/* Runtime CPU feature detection needs the Utility library, use just the
+   scalar code paths instead. */
+#pragma ACME enable MAGNUM_SINGLES_NO_CPU_DISPATCH
+
 /* We don't need anything from configure.h here that isn't pulled in by
    MagnumMath already */
 #pragma ACME enable Corrade_configure_h